@@ -0,0 +1,172 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+#include "AssetCache.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <shlobj.h>
+#include <knownfolders.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+#ifdef _WIN32
+// %LOCALAPPDATA%\Mission Vishwakarma\Cache : same base folder as SoftwareUpdate.cpp.
+fs::path CacheDir() {
+    PWSTR p = nullptr;
+    fs::path result;
+    if (SUCCEEDED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &p))) result = p;
+    if (p) CoTaskMemFree(p);
+    if (result.empty()) return result;
+    return result / L"Mission Vishwakarma" / L"Cache";
+}
+#else
+// $XDG_CACHE_HOME/Mission Vishwakarma, else ~/.cache/Mission Vishwakarma: the validations/ builds.
+fs::path CacheDir() {
+    const char* xdgCache = std::getenv("XDG_CACHE_HOME");
+    if (xdgCache && *xdgCache) return fs::path(xdgCache) / "Mission Vishwakarma";
+    const char* home = std::getenv("HOME");
+    if (home && *home) return fs::path(home) / ".cache" / "Mission Vishwakarma";
+    return {};
+}
+#endif
+
+} // namespace
+
+namespace AssetCache {
+
+fs::path FilePath(std::wstring_view kind, uint64_t key) {
+    const fs::path dir = CacheDir();
+    if (dir.empty()) return {};
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec) return {};
+
+    char keyText[17];
+    std::snprintf(keyText, sizeof(keyText), "%016llx", static_cast<unsigned long long>(key));
+    fs::path name(kind);
+    name += "-";
+    name += keyText;
+    name += ".bin";
+    return dir / name;
+}
+
+#ifdef _WIN32
+MappedFile::MappedFile(const fs::path& path) {
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return;
+
+    LARGE_INTEGER fileSize{};
+    // A zero-length file cannot be mapped.
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+        section = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file); // The section keeps the file referenced.
+    if (!section) return;
+
+    data = static_cast<const uint8_t*>(MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0));
+    if (!data) {
+        CloseHandle(section);
+        section = nullptr;
+        return;
+    }
+    size = static_cast<size_t>(fileSize.QuadPart);
+}
+#else
+MappedFile::MappedFile(const fs::path& path) {
+    const int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) return;
+    struct stat status {};
+    // A zero-length file cannot be mapped.
+    if (fstat(file, &status) == 0 && status.st_size > 0) {
+        void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        if (view != MAP_FAILED) {
+            data = static_cast<const uint8_t*>(view);
+            size = static_cast<size_t>(status.st_size);
+        }
+    }
+    close(file); // The mapping keeps the file referenced.
+}
+#endif
+
+MappedFile::~MappedFile() { Close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(other.data), size(other.size), section(other.section) {
+    other.data = nullptr;
+    other.size = 0;
+    other.section = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        data = other.data;
+        size = other.size;
+        section = other.section;
+        other.data = nullptr;
+        other.size = 0;
+        other.section = nullptr;
+    }
+    return *this;
+}
+
+void MappedFile::Close() {
+#ifdef _WIN32
+    if (data) UnmapViewOfFile(data);
+    if (section) CloseHandle(section);
+#else
+    if (data) munmap(const_cast<uint8_t*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+    section = nullptr;
+}
+
+bool WriteAtomically(const fs::path& path, std::initializer_list<Bytes> parts) {
+    if (path.empty()) return false;
+    // Per-process temporary name: two instances building the same file must not share one.
+    fs::path temporary = path;
+#ifdef _WIN32
+    temporary += L"." + std::to_wstring(GetCurrentProcessId()) + L".tmp";
+#else
+    temporary += ".";
+    temporary += std::to_string(getpid());
+    temporary += ".tmp";
+#endif
+
+    bool written = false;
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        for (const Bytes& part : parts) {
+            out.write(static_cast<const char*>(part.data), static_cast<std::streamsize>(part.size));
+        }
+        out.close();
+        written = !out.fail();
+    }
+#ifdef _WIN32
+    if (written && MoveFileExW(temporary.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) return true;
+#else
+    if (written && std::rename(temporary.c_str(), path.c_str()) == 0) return true; // Atomic replace.
+#endif
+
+    std::error_code ec;
+    fs::remove(temporary, ec);
+    return false;
+}
+
+} // namespace AssetCache
@@ -0,0 +1,70 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+/* On-disk cache for assets derived from data already compiled into the executable (the packed icon
+atlases today, IconAtlasImage.h). Everything in it can be regenerated, so every failure is silent
+and only means "build it the slow way": a missing folder, a locked or truncated file, a header that
+does not match.
+
+Files are CONTENT-ADDRESSED: the name carries a hash of every input that shapes the bytes, so a new
+build never reads an old build's output and nothing has to be invalidated by hand. A reader still
+validates the header it maps, because a hash names the file but does not prove what is inside it.
+
+Location: %LOCALAPPDATA%\Mission Vishwakarma\Cache, beside the updater state (SoftwareUpdate.cpp).
+Elsewhere (the validations/ builds) the XDG cache folder, $XDG_CACHE_HOME or ~/.cache. */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <string_view>
+
+namespace AssetCache {
+
+// FNV-1a 64, chainable through `seed`. Stable across builds and machines - it names files.
+constexpr uint64_t kHashSeed = 0xCBF29CE484222325ull;
+inline uint64_t Hash(const void* data, size_t size, uint64_t seed = kHashSeed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) seed = (seed ^ bytes[i]) * 0x100000001B3ull;
+    return seed;
+}
+inline uint64_t HashValue(uint64_t value, uint64_t seed = kHashSeed) {
+    return Hash(&value, sizeof(value), seed);
+}
+
+// `<cache folder>\<kind>-<key as 16 hex digits>.bin`, creating the folder. Empty on failure.
+std::filesystem::path FilePath(std::wstring_view kind, uint64_t key);
+
+// Read-only mapping of a whole file. Empty when the file is missing, empty or cannot be mapped.
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const uint8_t* Data() const { return data; }
+    size_t Size() const { return size; }
+    bool Empty() const { return size == 0; }
+
+private:
+    void Close();
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    void* section = nullptr; // HANDLE of the file mapping; unused with mmap.
+};
+
+struct Bytes {
+    const void* data;
+    size_t size;
+};
+
+// Writes the concatenation of `parts` to a temporary sibling, then renames it over `path`: another
+// instance launching at the same moment maps the old file or the whole new one, never a torn one.
+// Returns false, leaving no temporary behind, on any failure.
+bool WriteAtomically(const std::filesystem::path& path, std::initializer_list<Bytes> parts);
+
+} // namespace AssetCache
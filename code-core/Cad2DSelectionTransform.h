@@ -0,0 +1,44 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "EngineeringParallelFor.h"
+#include "RenderPage2D.h"
+
+// Rigid point map p' = base + M * (p - pivot); covers translation, rotation and reflection.
+struct Cad2DPointMapper {
+    double pivotX = 0.0, pivotY = 0.0;
+    double baseX = 0.0, baseY = 0.0;
+    double m00 = 1.0, m01 = 0.0, m10 = 0.0, m11 = 1.0;
+
+    Cad2DPoint2D Map(double x, double y) const {
+        const double vx = x - pivotX, vy = y - pivotY;
+        return { baseX + m00 * vx + m01 * vy, baseY + m10 * vx + m11 * vy };
+    }
+};
+
+/* One record type's share of ApplyTransform2DToSelection. The records for which wanted(record)
+   holds are picked in storage order, each is copied into its own slot and transform(record, slot)
+   runs on the pool, then the slots whose transform returned true are appended to outputs in the
+   order they were picked. transform must be a pure function of its record (it runs on any thread,
+   in any order), so outputs come out identical to a serial loop whatever the thread count. */
+template <typename Record, typename Wanted, typename Transform>
+void Cad2DTransformSelectedRecords(EngineeringParallelFor& pool, const std::vector<Record>& records,
+    std::vector<Record>& outputs, const Wanted& wanted, const Transform& transform) {
+    std::vector<const Record*> picked;
+    for (const Record& r : records) {
+        if (wanted(r)) picked.push_back(&r);
+    }
+    std::vector<Record> slots(picked.size());
+    std::vector<uint8_t> kept(picked.size(), 0);
+    pool.Run(picked.size(), [&](size_t i) {
+        slots[i] = *picked[i];
+        kept[i] = transform(*picked[i], slots[i]) ? 1 : 0;
+    });
+    outputs.reserve(outputs.size() + picked.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (kept[i]) outputs.push_back(std::move(slots[i]));
+    }
+}
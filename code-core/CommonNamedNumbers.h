@@ -57,7 +57,9 @@ constexpr uint16_t kGeometry2DCircleSchemaVersion = 1;
 constexpr uint16_t kGeometry2DEllipseSchemaVersion = 2; // v2: added rotation_radians.
 constexpr uint16_t kGeometry2DArcSchemaVersion = 2;     // v2: added rotation_radians.
 constexpr uint16_t kAsset2DDefinitionSchemaVersion = 1;
-constexpr uint16_t kAsset2DInsertSchemaVersion = 2; // v2: added scale_x/scale_y/rotation_degrees.
+// v2: added scale_x/scale_y/rotation_degrees. v3: reference insert, no baked member rows.
+constexpr uint16_t kAsset2DInsertSchemaVersion = 3;
+constexpr uint16_t kAsset2DInsertInstancedSchemaVersion = 3; // First version without member rows.
 constexpr uint64_t kMaxLocalObjectId = (1ULL << 40) - 1ULL;
 
 constexpr uint32_t ToNumber(ObjectType value) {
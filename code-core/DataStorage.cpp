@@ -983,6 +983,8 @@ void AppendObjectToTab(DATASETTAB& tab, ObjectType objectType, META_DATA* object
     {
         std::lock_guard<std::mutex> lock(*tab.storageObjectsMutex);
         tab.storageObjects3D.push_back({ objectType, object->memoryID, object });
+        tab.objectIndex.Insert(object->memoryID, TabObjectStore::Geometry3D,
+            static_cast<uint32_t>(tab.storageObjects3D.size() - 1));
     }
 
     tab.allIDsInThisTab.push_back(object->memoryID);
@@ -998,6 +1000,8 @@ void AppendLogicalObjectToTab(DATASETTAB& tab, ObjectType objectType, META_DATA*
     {
         std::lock_guard<std::mutex> lock(*tab.storageObjectsMutex);
         tab.storageLogicalObjects.push_back({ objectType, object->memoryID, object });
+        tab.objectIndex.Insert(object->memoryID, TabObjectStore::Logical,
+            static_cast<uint32_t>(tab.storageLogicalObjects.size() - 1));
         if (objectType == ObjectType::Scene3D) {
             if (tab.defaultScene3DMemoryId == 0) {
                 tab.defaultScene3DMemoryId = object->memoryID;
@@ -1741,10 +1745,12 @@ bool BuildRowsFromTab(DATASETTAB& tab, std::vector<ObjectStoreRow>& rows, uint64
 
             ObjectStoreRow row;
             row.objectId = insert.persistedId;
-            if (insert.containerMemoryId != 0) {
-                auto containerIt = memoryIdToPersistedId.find(insert.containerMemoryId);
-                if (containerIt != memoryIdToPersistedId.end()) {
-                    insert.persistedParentId = containerIt->second;
+            // Owning Page2D, or the owning Asset2DDefinition for a nested insert.
+            const uint64_t owner = insert.parentObjectId != 0 ? insert.parentObjectId : insert.containerMemoryId;
+            if (owner != 0) {
+                auto ownerIt = memoryIdToPersistedId.find(owner);
+                if (ownerIt != memoryIdToPersistedId.end()) {
+                    insert.persistedParentId = ownerIt->second;
                 }
             }
             row.parentId = insert.persistedParentId;
@@ -2026,6 +2032,7 @@ bool DataStorage::LoadYyyIntoTab(DATASETTAB& tab, const std::wstring& filePath,
         std::lock_guard<std::mutex> lock(*tab.storageObjectsMutex);
         tab.storageLogicalObjects.clear();
         tab.storageObjects3D.clear();
+        tab.objectIndex.Clear();
         tab.expandedDataTreeNodeIds.clear();
         CloseAllInternalSubTabsLocked(tab);
         tab.defaultScene3DMemoryId = 0;
@@ -2094,6 +2101,10 @@ bool DataStorage::LoadYyyIntoTab(DATASETTAB& tab, const std::wstring& filePath,
     std::vector<Cad2DTextRecordCPU> pendingTexts;
     std::unordered_map<uint64_t, uint64_t> insertPageByMemoryId; // Asset2DInsert -> owning Page2D.
     std::unordered_set<uint64_t> definitionMemoryIds;            // Asset2DDefinition memory ids.
+    // Inserts are buffered too: a nested insert's owning definition (and, after edits, its
+    // referenced definition) can carry a higher object_id than the insert row itself.
+    std::vector<Cad2DAssetInsertRecordCPU> pendingInserts;
+    std::vector<uint64_t> pendingInsertDefinitionIds; // Persisted definition_id, parallel to above.
 
     while ((rc = sqlite3_step(statement.stmt)) == SQLITE_ROW) {
         uint64_t objectId = static_cast<uint64_t>(sqlite3_column_int64(statement.stmt, 0));
@@ -2270,21 +2281,10 @@ bool DataStorage::LoadYyyIntoTab(DATASETTAB& tab, const std::wstring& filePath,
                     ? schemaVersion
                     : DefaultSchemaVersionForObjectType(objectType);
                 insert.isDeleted = false;
-                if (parentId != 0) { // Owning Page2D; pages always precede their inserts.
-                    auto parentIt = persistedIdToMemoryId.find(parentId);
-                    if (parentIt != persistedIdToMemoryId.end()) {
-                        insert.containerMemoryId = parentIt->second;
-                    }
-                }
-                // Definition rows always carry lower object_ids than their inserts (save order).
-                auto definitionIt = persistedIdToMemoryId.find(definitionPersistedId);
-                if (definitionIt != persistedIdToMemoryId.end()) {
-                    insert.definitionObjectId = definitionIt->second;
-                }
 
-                AppendAsset2DInsertToTab(tab, insert);
                 persistedIdToMemoryId[objectId] = insert.objectId;
-                insertPageByMemoryId[insert.objectId] = insert.containerMemoryId;
+                pendingInserts.push_back(std::move(insert));
+                pendingInsertDefinitionIds.push_back(definitionPersistedId);
             }
             continue;
         }
@@ -2328,7 +2328,32 @@ bool DataStorage::LoadYyyIntoTab(DATASETTAB& tab, const std::wstring& filePath,
         return false;
     }
 
-    // Second phase: append the buffered 2D geometry now that every container row is loaded.
+    // Second phase, inserts first: parent = Page2D -> placed on that page; parent =
+    // Asset2DDefinition -> nested insert (containerMemoryId 0). Legacy member rows below need
+    // insertPageByMemoryId.
+    for (size_t i = 0; i < pendingInserts.size(); ++i) {
+        Cad2DAssetInsertRecordCPU& insert = pendingInserts[i];
+        if (insert.persistedParentId != 0) {
+            auto parentIt = persistedIdToMemoryId.find(insert.persistedParentId);
+            if (parentIt != persistedIdToMemoryId.end()) {
+                if (definitionMemoryIds.count(parentIt->second) != 0) {
+                    insert.parentObjectId = parentIt->second;
+                } else {
+                    insert.containerMemoryId = parentIt->second;
+                }
+            }
+        }
+        auto definitionIt = persistedIdToMemoryId.find(pendingInsertDefinitionIds[i]);
+        if (definitionIt != persistedIdToMemoryId.end()) {
+            insert.definitionObjectId = definitionIt->second;
+        }
+        insertPageByMemoryId[insert.objectId] = insert.containerMemoryId;
+        AppendAsset2DInsertToTab(tab, insert);
+    }
+    // Reference inserts carry no geometry rows of their own; make sure the pages get rebuilt.
+    if (!pendingInserts.empty()) EnqueueCad2DAssetInstancesChanged(tab.tabID, 0);
+
+    // Then append the buffered 2D geometry now that every container row is loaded.
     // Parent = Page2D -> plain page object; parent = Asset2DInsert -> member of that placed
     // instance on the insert's page; parent = Asset2DDefinition -> hidden master geometry
     // (containerMemoryId 0: never rendered or hit-tested).
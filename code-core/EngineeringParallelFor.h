@@ -0,0 +1,137 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Spreads pure per-element work (tessellation of an import batch, regeneration for a batched property
+// edit, a Page2D selection transform) over helper threads and waits for it. Created per operation and reused across its Run calls,
+// so an import spawns its helpers once rather than once per 4096-entity batch - and only on the first
+// Run big enough to use them, so a three-object edit spawns none; the engineering thread takes
+// chunks too. Work run here must never touch model data other than its own element, the
+// allocator or the copy-thread queues - those stay with the engineering thread. The one exception
+// is construction into a per-slot राम::ChunkArena (RunWithSlots), as the STD import does.
+// VISHWAKARMA_PARALLEL_THREADS (total threads, 1 = serial) overrides the hardware count for timing.
+class EngineeringParallelFor {
+public:
+    EngineeringParallelFor() : EngineeringParallelFor(ThreadCountFromEnvironment()) {}
+    // A fixed thread count (clamped to 1..16), for benchmarks that sweep it.
+    explicit EngineeringParallelFor(unsigned threads) : threadCount(std::clamp(threads, 1u, kMaxThreads)) {}
+
+    ~EngineeringParallelFor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& helper : helpers) helper.join();
+    }
+
+    EngineeringParallelFor(const EngineeringParallelFor&) = delete;
+    EngineeringParallelFor& operator=(const EngineeringParallelFor&) = delete;
+
+    // Calls work(i) once for every i in [0, count), in any order and on any thread; returns when
+    // all calls have returned. Small counts run inline: waking helpers costs more than they save.
+    void Run(size_t count, const std::function<void(size_t)>& work) {
+        RunWithSlots(count, [&work](size_t i, unsigned) { work(i); });
+    }
+
+    // As Run, and also passes the calling thread's slot in [0, SlotCount()): 0 is the thread that
+    // called Run, each helper keeps its own slot for the object's lifetime. Per-slot state (an
+    // allocation arena) is therefore only ever used by one thread at a time.
+    void RunWithSlots(size_t count, const std::function<void(size_t, unsigned)>& work) {
+        if (threadCount == 1 || count < kMinParallelCount) {
+            for (size_t i = 0; i < count; ++i) work(i, 0);
+            return;
+        }
+        if (helpers.empty()) {
+            for (unsigned i = 1; i < threadCount; ++i) helpers.emplace_back([this, i] { HelperLoop(i); });
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &work;
+            jobCount = count;
+            nextIndex.store(0, std::memory_order_relaxed);
+            busyHelpers = helpers.size();
+            ++generation;
+        }
+        wake.notify_all();
+        RunChunks(work, count, 0);
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return busyHelpers == 0; });
+        job = nullptr;
+    }
+
+    unsigned SlotCount() const { return threadCount; }
+
+private:
+    static constexpr unsigned kMaxThreads = 16;
+    static constexpr size_t kMinParallelCount = 256;
+    static constexpr size_t kChunk = 64; // Elements claimed per atomic step; a few ms of work at most.
+
+    static unsigned ThreadCountFromEnvironment() {
+#ifdef _WIN32
+        wchar_t overrideText[16] = {};
+        if (GetEnvironmentVariableW(L"VISHWAKARMA_PARALLEL_THREADS", overrideText, 16) > 0) {
+            return static_cast<unsigned>(wcstoul(overrideText, nullptr, 10));
+        }
+#else // The validations build (validations/CMakeLists.txt) runs this on other platforms too.
+        if (const char* overrideText = std::getenv("VISHWAKARMA_PARALLEL_THREADS")) {
+            return static_cast<unsigned>(std::strtoul(overrideText, nullptr, 10));
+        }
+#endif
+        return std::thread::hardware_concurrency();
+    }
+
+    void RunChunks(const std::function<void(size_t, unsigned)>& work, size_t count, unsigned slot) {
+        for (;;) {
+            const size_t begin = nextIndex.fetch_add(kChunk, std::memory_order_relaxed);
+            if (begin >= count) return;
+            const size_t end = (std::min)(begin + kChunk, count);
+            for (size_t i = begin; i < end; ++i) work(i, slot);
+        }
+    }
+
+    void HelperLoop(unsigned slot) {
+        uint64_t seenGeneration = 0;
+        for (;;) {
+            const std::function<void(size_t, unsigned)>* work = nullptr;
+            size_t count = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping) return;
+                seenGeneration = generation;
+                work = job;
+                count = jobCount;
+            }
+            RunChunks(*work, count, slot);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--busyHelpers == 0) done.notify_one();
+            }
+        }
+    }
+
+    unsigned threadCount = 1; // Including the calling thread.
+    std::vector<std::thread> helpers;
+    std::mutex mutex;
+    std::condition_variable wake, done;
+    const std::function<void(size_t, unsigned)>* job = nullptr;
+    size_t jobCount = 0;
+    size_t busyHelpers = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+    std::atomic<size_t> nextIndex{ 0 };
+};
@@ -9,12 +9,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -25,6 +29,7 @@
 
 #include <windows.h>
 #include <commdlg.h>
+#include <psapi.h>
 
 namespace ExtensionCommunications {
 
@@ -44,7 +49,36 @@ constexpr uint32_t  kMaxPolygonSegments = 512;
 constexpr size_t    kMaxImported2DAssetDefinitions = 8'192;
 constexpr size_t    kMaxImported2DAssetInserts     = 1'000'000;
 constexpr size_t    kMaxImported2DAssetMasters     = 200'000;  // Master elements per definition.
-constexpr ULONGLONG kImportTimeoutMs   = 180'000;              // Whole import, wall clock.
+
+// Whole-session element counts. The caps above apply to the import as a whole while each batch is
+// handed to the caller and freed as soon as it is validated, so the totals live apart from it.
+struct ImportTotals {
+    size_t nodes = 0, members = 0;
+    size_t lines = 0, texts = 0, polygons = 0;
+    size_t assetDefinitions = 0, assetInserts = 0;
+    // STD: members may only reference accepted nodes. Node index = acceptance order; the
+    // sequence maps the worker's node stream (duplicates included) onto those indices.
+    std::unordered_map<uint32_t, uint32_t> nodeIndexById;
+    std::vector<uint32_t> nodeIndexBySequence;
+    std::unordered_set<uint32_t> definedKeys;  // DXF: inserts may only reference these.
+};
+// Longest the worker may stay silent. The clock restarts for every message, so a large import that
+// keeps streaming never times out, and the time the engineering thread spends in the batch sink
+// (the worker is blocked on backpressure meanwhile) is not counted against it.
+constexpr ULONGLONG kImportIdleTimeoutMs = 180'000;
+// Worker->host result ring: one worker batch (5,000 lines is ~200 KiB) per slot. A message
+// that does not fit a slot still travels inline on the pipe.
+constexpr uint32_t  kResultRingSlotBytes = 1u * 1024 * 1024;
+constexpr uint32_t  kResultRingSlotCount = 16;
+// Warm worker pool, per extension. Workers serve one job after another; a worker is retired
+// after this many jobs or once its working set passes the limit (fragmentation, leaks in
+// extension code). Up to kMaxBusyWorkersPerExtension queued files are dispatched ahead, so
+// independent files parse in parallel while the engineering thread imports the current one.
+constexpr uint32_t  kWorkerJobsBeforeRecycle = 32;
+constexpr SIZE_T    kWorkerRecycleWorkingSetBytes = 1024ull * 1024 * 1024;
+constexpr size_t    kMaxBusyWorkersPerExtension = 4;
+constexpr size_t    kMaxIdleWorkersPerExtension = 2;
+constexpr uint32_t  kMaxWorkerLogSlots = 8;  // Per-worker stderr logs; extra workers share the last.
 
 HWND FirstWindowHandleForDialogs() {
     uint16_t* windowList = publishedWindowIndexes.load(std::memory_order_acquire);
@@ -100,7 +134,7 @@ std::wstring StdImportTempPath(const wchar_t* leaf) {
 // diagnostics land. Every importer worker speaks the same wire protocol.
 struct ImporterProfile {
     const wchar_t* extensionSubdir;  // Folder under "<exe dir>\extensions"
-    const wchar_t* stderrLogLeaf;
+    const wchar_t* stderrLogLeaf;    // Worker log slot 0; slot n adds "-n" before ".log".
     const wchar_t* resultMarkerLeaf;
     const char*    logTag;           // Console prefix.
 };
@@ -137,14 +171,46 @@ std::string TailOfStderrLog(const std::wstring& logPath) {
     return text;
 }
 
+// Stderr log of the worker in the given slot. Workers run concurrently, so each one gets its own
+// file, and a failed job's stderr tail comes from the worker that ran it.
+std::wstring WorkerStderrLogPath(const ImporterProfile& profile, uint32_t logSlot) {
+    std::wstring leaf = profile.stderrLogLeaf;
+    if (logSlot != 0) leaf.insert(leaf.size() - 4, L"-" + std::to_wstring(logSlot)); // Before ".log".
+    return StdImportTempPath(leaf.c_str());
+}
+
 struct WorkerProcess {
     PROCESS_INFORMATION process{};
-    HANDLE stdinWrite = nullptr;  // Host writes the request here.
+    HANDLE stdinWrite = nullptr;  // Host writes requests (and slot credits) here.
     HANDLE stdoutRead = nullptr;  // Host reads worker messages here.
 
+    // Shared-memory transport. Either half may be absent, in which case that direction uses the
+    // inline pipe path. The ring lives as long as the worker; the input section is per job.
+    HANDLE remoteInputSection = nullptr; // Current job's file mapping - a handle value in the WORKER.
+    uint64_t inputBytes = 0;
+    HANDLE ringSection = nullptr;        // Worker->host result ring.
+    HANDLE remoteRingSection = nullptr;  // The worker's handle to ringSection - a value in the WORKER.
+    const uint8_t* ringView = nullptr;   // Host's read-only view of ringSection.
+
+    uint32_t jobsServed = 0;
+    uint32_t logSlot = 0;
+
+    // Closes the job's input section in the worker; a view the worker still maps keeps it alive.
+    void ReleaseJobInput() {
+        if (remoteInputSection) {
+            DuplicateHandle(process.hProcess, remoteInputSection, nullptr, nullptr, 0, FALSE,
+                DUPLICATE_CLOSE_SOURCE);
+            remoteInputSection = nullptr;
+            inputBytes = 0;
+        }
+    }
+
     ~WorkerProcess() {
+        // Closing stdin is the shutdown signal for an idle worker: its next read sees EOF.
         if (stdinWrite) CloseHandle(stdinWrite);
         if (stdoutRead) CloseHandle(stdoutRead);
+        if (ringView) UnmapViewOfFile(ringView);
+        if (ringSection) CloseHandle(ringSection);
         if (process.hProcess) {
             // If the worker is still running at teardown, something went wrong: kill it.
             if (WaitForSingleObject(process.hProcess, 0) == WAIT_TIMEOUT) {
@@ -156,6 +222,59 @@ struct WorkerProcess {
     }
 };
 
+/* Zero-copy transport. The input file reaches the worker as a read-only file mapping backed by
+the file's own page cache, instead of being read into host memory, wrapped in a protobuf and
+pushed through the pipe. Results come back through a ring of slots in a host-created section,
+with the pipe carrying only slot numbers and the host's credits. Best effort throughout:
+whatever cannot be set up falls back to the inline pipe path.
+
+Neither section is ever inheritable. Several workers are alive at once (the pool), and an
+inheritable section would leak into every worker spawned after it - letting one extension write
+another's results. Both are duplicated into the one worker they belong to instead: the ring once,
+right after SpawnImportWorker, and the input section per job (ShareInputFile). */
+void CreateResultRing(WorkerProcess& worker) {
+    const uint64_t ringBytes = (uint64_t)kResultRingSlotBytes * kResultRingSlotCount;
+    worker.ringSection = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+        (DWORD)(ringBytes >> 32), (DWORD)ringBytes, nullptr);
+    if (!worker.ringSection) return;
+    worker.ringView = static_cast<const uint8_t*>(MapViewOfFile(worker.ringSection, FILE_MAP_READ, 0, 0, 0));
+    // The worker's handle closes with the worker, so only the host's copy is ever closed here.
+    if (!worker.ringView || !DuplicateHandle(GetCurrentProcess(), worker.ringSection, worker.process.hProcess,
+            &worker.remoteRingSection, FILE_MAP_READ | FILE_MAP_WRITE, FALSE, 0)) {
+        if (worker.ringView) UnmapViewOfFile(worker.ringView);
+        CloseHandle(worker.ringSection);
+        worker.ringView = nullptr;
+        worker.ringSection = nullptr;
+        worker.remoteRingSection = nullptr;
+    }
+}
+
+void ShareInputFile(WorkerProcess& worker, const std::wstring& filePath) {
+    HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return;
+    LARGE_INTEGER size{};
+    HANDLE section = nullptr;
+    // A zero-length file cannot be mapped; an oversized one is refused by SendImportRequest.
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (uint64_t)size.QuadPart <= kMaxStdFileBytes) {
+        section = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file); // The section keeps the file referenced.
+    if (!section) return;
+    // The worker's copy is all that is needed; the host's closes right away.
+    if (DuplicateHandle(GetCurrentProcess(), section, worker.process.hProcess, &worker.remoteInputSection,
+            FILE_MAP_READ, FALSE, 0)) {
+        worker.inputBytes = (uint64_t)size.QuadPart;
+    } else {
+        worker.remoteInputSection = nullptr;
+    }
+    CloseHandle(section);
+}
+
+uint64_t HandleToWire(HANDLE handle) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+}
+
 bool SpawnImportWorker(WorkerProcess& worker, const ImporterProfile& profile, std::string& error) {
     const std::wstring extensionDir = ExecutableDirectory() + L"\\extensions\\" + profile.extensionSubdir;
     if (!std::filesystem::exists(std::filesystem::path(extensionDir) / L"main.py")) {
@@ -185,24 +304,46 @@ bool SpawnImportWorker(WorkerProcess& worker, const ImporterProfile& profile, st
     SetHandleInformation(stdinWrite, HANDLE_FLAG_INHERIT, 0);
     SetHandleInformation(stdoutRead, HANDLE_FLAG_INHERIT, 0);
 
-    // Worker stderr goes to a log file so parse tracebacks are diagnosable.
-    HANDLE stderrLog = CreateFileW(StdImportTempPath(profile.stderrLogLeaf).c_str(), GENERIC_WRITE, FILE_SHARE_READ,
-        &inheritable, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    // Worker stderr goes to a log file so parse tracebacks are diagnosable; without one, to NUL (the
+    // host's own stderr cannot be put on the explicit inherit list below).
+    HANDLE stderrLog = CreateFileW(WorkerStderrLogPath(profile, worker.logSlot).c_str(), GENERIC_WRITE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE, &inheritable, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (stderrLog == INVALID_HANDLE_VALUE) {
+        stderrLog = CreateFileW(L"NUL", GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, &inheritable,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    }
 
-    STARTUPINFOW startup{};
-    startup.cb = sizeof(startup);
-    startup.dwFlags = STARTF_USESTDHANDLES;
-    startup.hStdInput = stdinRead;
-    startup.hStdOutput = stdoutWrite;
-    startup.hStdError = (stderrLog != INVALID_HANDLE_VALUE) ? stderrLog : GetStdHandle(STD_ERROR_HANDLE);
+    // Inherit exactly this worker's three std handles. bInheritHandles alone hands the child EVERY
+    // inheritable handle in the host - including the child ends of other workers' pipes that another
+    // thread is spawning at this very moment, before it could clear their inherit flag.
+    HANDLE inheritList[3] = { stdinRead, stdoutWrite, stderrLog };
+    const DWORD inheritCount = (stderrLog != INVALID_HANDLE_VALUE) ? 3 : 2;
+    SIZE_T attributeBytes = 0;
+    InitializeProcThreadAttributeList(nullptr, 1, 0, &attributeBytes);
+    std::vector<uint8_t> attributeStorage(attributeBytes);
+    auto* attributes = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(attributeStorage.data());
+    bool attributesReady = InitializeProcThreadAttributeList(attributes, 1, 0, &attributeBytes) != FALSE;
+    const bool attributesInitialized = attributesReady;
+    attributesReady = attributesReady && UpdateProcThreadAttribute(attributes, 0,
+        PROC_THREAD_ATTRIBUTE_HANDLE_LIST, inheritList, inheritCount * sizeof(HANDLE), nullptr, nullptr);
+
+    STARTUPINFOEXW startup{};
+    startup.StartupInfo.cb = sizeof(startup);
+    startup.StartupInfo.dwFlags = STARTF_USESTDHANDLES;
+    startup.StartupInfo.hStdInput = stdinRead;
+    startup.StartupInfo.hStdOutput = stdoutWrite;
+    startup.StartupInfo.hStdError = (stderrLog != INVALID_HANDLE_VALUE) ? stderrLog : nullptr;
+    startup.lpAttributeList = attributes;
 
     // Self-contained frozen-CPython worker shipped next to Vishwakarma.exe: no Python
     // installation, no pip packages, no DLLs. Unbuffered pipes and the curated frozen
     // stdlib are built in. Still no AppContainer - that is the next hardening step.
     std::wstring commandLine = L"\"" + workerExe + L"\" main.py";
-    const BOOL created = CreateProcessW(workerExe.c_str(), commandLine.data(), nullptr, nullptr,
-        TRUE /*inherit handles*/, CREATE_NO_WINDOW, nullptr, extensionDir.c_str(),
-        &startup, &worker.process);
+    const BOOL created = attributesReady && CreateProcessW(workerExe.c_str(), commandLine.data(), nullptr,
+        nullptr, TRUE /*inherit handles: only inheritList*/, CREATE_NO_WINDOW | EXTENDED_STARTUPINFO_PRESENT,
+        nullptr, extensionDir.c_str(), &startup.StartupInfo, &worker.process);
+    const DWORD createError = GetLastError();
+    if (attributesInitialized) DeleteProcThreadAttributeList(attributes);
 
     // Child-side handles are duplicated into the worker; release the host copies.
     CloseHandle(stdinRead);
@@ -210,8 +351,7 @@ bool SpawnImportWorker(WorkerProcess& worker, const ImporterProfile& profile, st
     if (stderrLog != INVALID_HANDLE_VALUE) CloseHandle(stderrLog);
 
     if (!created) {
-        error = "Failed to launch VishwakarmaExtension.exe. Win32 error " +
-                std::to_string(GetLastError());
+        error = "Failed to launch VishwakarmaExtension.exe. Win32 error " + std::to_string(createError);
         CloseHandle(stdinWrite);
         CloseHandle(stdoutRead);
         return false;
@@ -229,7 +369,7 @@ bool WriteAll(HANDLE pipe, const void* data, size_t size, std::string& error) {
         DWORD written = 0;
         const DWORD chunk = (DWORD)(std::min<size_t>)(remaining, 4 * 1024 * 1024);
         if (!WriteFile(pipe, cursor, chunk, &written, nullptr) || written == 0) {
-            error = "Worker closed the pipe while receiving the file (see stderr log)";
+            error = "Worker closed its input pipe (see stderr log)";
             return false;
         }
         cursor += written;
@@ -251,7 +391,8 @@ bool ReadExact(const WorkerProcess& worker, uint8_t* buffer, uint32_t size,
         }
         if (available == 0) {
             if (GetTickCount64() > deadlineTick) {
-                error = "Import timed out";
+                error = "Import timed out: the worker sent nothing for " +
+                        std::to_string(kImportIdleTimeoutMs / 1000) + " s";
                 return false;
             }
             if (WaitForSingleObject(worker.process.hProcess, 0) != WAIT_TIMEOUT) {
@@ -276,70 +417,413 @@ bool ReadExact(const WorkerProcess& worker, uint8_t* buffer, uint32_t size,
     return true;
 }
 
-bool SendImportRequest(const WorkerProcess& worker, const std::wstring& stdFilePath, std::string& error) {
-    std::ifstream file(std::filesystem::path(stdFilePath), std::ios::binary | std::ios::ate);
-    if (!file) {
-        error = "Could not open file: " + Utf8FromWide(stdFilePath);
-        return false;
-    }
-    const std::streamoff fileSize = file.tellg();
-    if (fileSize < 0 || (uint64_t)fileSize > kMaxStdFileBytes) {
-        error = "File exceeds the " + std::to_string(kMaxStdFileBytes >> 20) + " MiB import limit";
+bool WriteFramedMessage(HANDLE pipe, const vishwakarma::extension::v1::HostToWorker& message,
+    std::string& error) {
+    std::string payload;
+    if (!message.SerializeToString(&payload)) {
+        error = "Failed to serialize a host message";
         return false;
     }
-    std::string fileBytes(static_cast<size_t>(fileSize), '\0');
-    file.seekg(0);
-    file.read(fileBytes.data(), fileSize);
+    const uint32_t length = (uint32_t)payload.size();
+    uint8_t prefix[4] = { (uint8_t)(length), (uint8_t)(length >> 8), (uint8_t)(length >> 16), (uint8_t)(length >> 24) };
+    return WriteAll(pipe, prefix, sizeof(prefix), error) &&
+           WriteAll(pipe, payload.data(), payload.size(), error);
+}
 
+bool SendImportRequest(WorkerProcess& worker, const std::wstring& stdFilePath, std::string& error) {
     vishwakarma::extension::v1::HostToWorker request;
     auto* import = request.mutable_import_file_request();
     import->set_file_name(Utf8FromWide(std::filesystem::path(stdFilePath).filename().wstring()));
-    import->set_file_bytes(std::move(fileBytes));
 
-    std::string payload;
-    if (!request.SerializeToString(&payload)) {
-        error = "Failed to serialize the import request";
+    ShareInputFile(worker, stdFilePath);
+    if (worker.remoteInputSection) {
+        auto* region = import->mutable_file_region();
+        region->set_section_handle(HandleToWire(worker.remoteInputSection));
+        region->set_offset(0);
+        region->set_length(worker.inputBytes);
+    } else {
+        std::ifstream file(std::filesystem::path(stdFilePath), std::ios::binary | std::ios::ate);
+        if (!file) {
+            error = "Could not open file: " + Utf8FromWide(stdFilePath);
+            return false;
+        }
+        const std::streamoff fileSize = file.tellg();
+        if (fileSize < 0 || (uint64_t)fileSize > kMaxStdFileBytes) {
+            error = "File exceeds the " + std::to_string(kMaxStdFileBytes >> 20) + " MiB import limit";
+            return false;
+        }
+        std::string fileBytes(static_cast<size_t>(fileSize), '\0');
+        file.seekg(0);
+        file.read(fileBytes.data(), fileSize);
+        import->set_file_bytes(std::move(fileBytes));
+    }
+
+    import->set_max_batch_entities(kMaxImportBatchEntities);
+    if (worker.ringView) {
+        auto* ring = import->mutable_result_ring();
+        ring->set_section_handle(HandleToWire(worker.remoteRingSection));
+        ring->set_slot_bytes(kResultRingSlotBytes);
+        ring->set_slot_count(kResultRingSlotCount);
+    }
+    return WriteFramedMessage(worker.stdinWrite, request, error);
+}
+
+// Reads the next worker message. A SharedBatch is resolved here - its slot is copied out,
+// credited back to the worker and parsed - so callers only ever see content messages. The copy
+// is deliberate: the worker can still write the slot, and the parser must see stable bytes.
+bool ReadWorkerMessage(const WorkerProcess& worker, std::vector<uint8_t>& payload,
+    vishwakarma::extension::v1::WorkerToHost& message, ULONGLONG deadlineTick, std::string& error) {
+    uint8_t prefix[4] = {};
+    if (!ReadExact(worker, prefix, sizeof(prefix), deadlineTick, error)) return false;
+    const uint32_t length = (uint32_t)prefix[0] | ((uint32_t)prefix[1] << 8) |
+                            ((uint32_t)prefix[2] << 16) | ((uint32_t)prefix[3] << 24);
+    if (length == 0 || length > kMaxMessageBytes) {
+        error = "Worker sent an out-of-range message length";
         return false;
     }
-    const uint32_t length = (uint32_t)payload.size();
-    uint8_t prefix[4] = { (uint8_t)(length), (uint8_t)(length >> 8), (uint8_t)(length >> 16), (uint8_t)(length >> 24) };
-    return WriteAll(worker.stdinWrite, prefix, sizeof(prefix), error) &&
-           WriteAll(worker.stdinWrite, payload.data(), payload.size(), error);
+    payload.resize(length);
+    if (!ReadExact(worker, payload.data(), length, deadlineTick, error)) return false;
+    if (!message.ParseFromArray(payload.data(), (int)length)) {
+        error = "Worker sent an unparseable message";
+        return false;
+    }
+    if (message.msg_case() != vishwakarma::extension::v1::WorkerToHost::kSharedBatch) return true;
+
+    const uint32_t slot = message.shared_batch().slot();
+    const uint32_t sharedLength = message.shared_batch().length();
+    if (!worker.ringView || slot >= kResultRingSlotCount ||
+        sharedLength == 0 || sharedLength > kResultRingSlotBytes) {
+        error = "Worker sent an invalid shared-memory batch";
+        return false;
+    }
+    const uint8_t* slotData = worker.ringView + (size_t)slot * kResultRingSlotBytes;
+    payload.assign(slotData, slotData + sharedLength);
+    if (!message.ParseFromArray(payload.data(), (int)sharedLength) ||
+        message.msg_case() == vishwakarma::extension::v1::WorkerToHost::kSharedBatch) {
+        error = "Worker sent an unparseable shared-memory batch";
+        return false;
+    }
+    // Credit the slot back even for a result: the result ends the job, the worker then waits for its
+    // next request and collects credits left unread on the way (recv_import_request).
+    vishwakarma::extension::v1::HostToWorker credit;
+    credit.mutable_shared_slot_credit()->set_slot(slot);
+    return WriteFramedMessage(worker.stdinWrite, credit, error);
+}
+
+// ---------- Warm worker pool ----------
+
+// A queued import: the ACTION_DETAILS::objectId payload. Registered with its extension's pool when
+// queued, so it may be dispatched to a worker before the engineering thread gets to it.
+struct PendingImport {
+    std::wstring path;
+    const ImporterProfile* profile = nullptr;
+    std::unique_ptr<WorkerProcess> worker;  // Set once the request has been sent.
+    bool dispatching = false;               // A prefetch is sending the request right now.
+};
+
+struct WorkerPool {
+    std::mutex mutex;
+    std::condition_variable dispatchDone;
+    std::vector<std::unique_ptr<WorkerProcess>> idle;
+    std::deque<PendingImport*> waiting;     // Queued, not yet dispatched, in queue order.
+    size_t busy = 0;                        // Workers holding a dispatched job.
+    uint32_t logSlotsInUse = 0;             // One bit per WorkerStderrLogPath slot.
+};
+
+WorkerPool& PoolFor(const ImporterProfile& profile) {
+    static WorkerPool stdPool, dxfPool;
+    return &profile == &kStdImporter ? stdPool : dxfPool;
+}
+
+// Caller holds pool.mutex. The last slot is an overflow shared by any further workers.
+uint32_t ClaimLogSlot(WorkerPool& pool) {
+    for (uint32_t slot = 0; slot + 1 < kMaxWorkerLogSlots; ++slot) {
+        if (!(pool.logSlotsInUse & (1u << slot))) {
+            pool.logSlotsInUse |= 1u << slot;
+            return slot;
+        }
+    }
+    return kMaxWorkerLogSlots - 1;
+}
+
+void RetireWorker(WorkerPool& pool, std::unique_ptr<WorkerProcess> worker) {
+    if (!worker) return;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.logSlotsInUse &= ~(1u << worker->logSlot);
+    }
+    worker.reset(); // Closes its pipes and terminates the process.
+}
+
+// Checked before a pooled worker takes a job and before it goes back to the pool.
+bool WorkerIsHealthy(const WorkerProcess& worker) {
+    if (WaitForSingleObject(worker.process.hProcess, 0) != WAIT_TIMEOUT) return false;
+    // Between jobs a worker has nothing to say: stray output means it is out of step.
+    DWORD available = 0;
+    if (!PeekNamedPipe(worker.stdoutRead, nullptr, 0, nullptr, &available, nullptr) || available != 0) {
+        return false;
+    }
+    if (worker.jobsServed >= kWorkerJobsBeforeRecycle) return false;
+    PROCESS_MEMORY_COUNTERS memory{};
+    memory.cb = sizeof(memory);
+    if (GetProcessMemoryInfo(worker.process.hProcess, &memory, sizeof(memory)) &&
+        memory.WorkingSetSize > kWorkerRecycleWorkingSetBytes) {
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<WorkerProcess> SpawnPooledWorker(WorkerPool& pool, const ImporterProfile& profile,
+    std::string& error) {
+    auto worker = std::make_unique<WorkerProcess>();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        worker->logSlot = ClaimLogSlot(pool);
+    }
+    if (!SpawnImportWorker(*worker, profile, error)) {
+        RetireWorker(pool, std::move(worker));
+        return nullptr;
+    }
+    CreateResultRing(*worker); // Needs the process handle to duplicate into.
+    return worker;
+}
+
+// Sends the import to a healthy idle worker, or to a freshly spawned one. On failure nothing is
+// dispatched and error says why.
+bool DispatchImport(PendingImport& pending, std::string& error) {
+    WorkerPool& pool = PoolFor(*pending.profile);
+    std::unique_ptr<WorkerProcess> worker;
+    std::vector<std::unique_ptr<WorkerProcess>> stale;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        while (!worker && !pool.idle.empty()) {
+            std::unique_ptr<WorkerProcess> candidate = std::move(pool.idle.back());
+            pool.idle.pop_back();
+            if (WorkerIsHealthy(*candidate)) {
+                worker = std::move(candidate);
+            } else {
+                stale.push_back(std::move(candidate));
+            }
+        }
+        ++pool.busy;
+    }
+    for (std::unique_ptr<WorkerProcess>& candidate : stale) RetireWorker(pool, std::move(candidate));
+
+    if (!worker) worker = SpawnPooledWorker(pool, *pending.profile, error);
+    if (worker && SendImportRequest(*worker, pending.path, error)) {
+        ++worker->jobsServed;
+        pending.worker = std::move(worker);
+        return true;
+    }
+    RetireWorker(pool, std::move(worker));
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    --pool.busy;
+    return false;
+}
+
+// Dispatches queued imports ahead of the engineering thread while workers are available, so
+// independent files parse in parallel. A job that gets ahead blocks on its result ring credits.
+void PrefetchWaitingImports(WorkerPool& pool) {
+    for (;;) {
+        PendingImport* next = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            if (pool.waiting.empty() || pool.busy >= kMaxBusyWorkersPerExtension) return;
+            next = pool.waiting.front();
+            pool.waiting.pop_front();
+            next->dispatching = true;
+        }
+        std::string error;
+        DispatchImport(*next, error); // On failure its owner retries and reports the error.
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            next->dispatching = false;
+        }
+        pool.dispatchDone.notify_all();
+    }
+}
+
+// Job over: a worker that completed it cleanly goes back to the pool, any other is retired.
+void FinishImport(PendingImport& pending, bool succeeded) {
+    if (!pending.worker) return;
+    WorkerPool& pool = PoolFor(*pending.profile);
+    std::unique_ptr<WorkerProcess> worker = std::move(pending.worker);
+    worker->ReleaseJobInput();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        --pool.busy;
+        if (succeeded && pool.idle.size() < kMaxIdleWorkersPerExtension && WorkerIsHealthy(*worker)) {
+            pool.idle.push_back(std::move(worker));
+        }
+    }
+    RetireWorker(pool, std::move(worker));
+    PrefetchWaitingImports(pool);
+}
+
+// The owner takes its import back from the pool; no prefetch touches it afterwards. Waits out
+// a prefetch that is sending its request at this very moment.
+void ClaimPendingImport(PendingImport& pending) {
+    WorkerPool& pool = PoolFor(*pending.profile);
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    auto it = std::find(pool.waiting.begin(), pool.waiting.end(), &pending);
+    if (it != pool.waiting.end()) pool.waiting.erase(it);
+    pool.dispatchDone.wait(lock, [&] { return !pending.dispatching; });
+}
+
+// Keeps one spawned worker idle: its interpreter start-up and module imports run while the
+// current job is being imported, so the next job starts warm.
+void WarmSpareWorker(WorkerPool& pool, const ImporterProfile& profile) {
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.idle.empty() || pool.busy >= kMaxBusyWorkersPerExtension) return;
+    }
+    std::string error;
+    std::unique_ptr<WorkerProcess> spare = SpawnPooledWorker(pool, profile, error);
+    if (!spare) return;
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (pool.idle.size() < kMaxIdleWorkersPerExtension) pool.idle.push_back(std::move(spare));
+    }
+    RetireWorker(pool, std::move(spare));
+}
+
+// UI thread: creates the action payload and queues it for prefetch. No process work here.
+uint64_t RegisterPendingImport(const ImporterProfile& profile, const std::wstring& path) {
+    auto* pending = new PendingImport();
+    pending->path = path;
+    pending->profile = &profile;
+    WorkerPool& pool = PoolFor(profile);
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.waiting.push_back(pending);
+    return reinterpret_cast<uint64_t>(pending);
+}
+
+// Engineering thread: takes ownership of a queued import and makes sure it is running on a
+// worker, then lets further queued files start. nullptr (and error) on failure.
+std::unique_ptr<PendingImport> StartQueuedImport(uint64_t payloadId, std::string& error) {
+    std::unique_ptr<PendingImport> pending(reinterpret_cast<PendingImport*>(payloadId));
+    if (!pending) {
+        error = "Import request carried no file path";
+        return nullptr;
+    }
+    WorkerPool& pool = PoolFor(*pending->profile);
+    ClaimPendingImport(*pending);
+    if (!pending->worker && !DispatchImport(*pending, error)) return nullptr;
+    PrefetchWaitingImports(pool);
+    WarmSpareWorker(pool, *pending->profile);
+    return pending;
+}
+
+// The sandbox boundary ends at these validators. Dependencies must arrive first: a member whose
+// nodes, or an insert whose definition, has not been validated yet is dropped no matter what the
+// worker claimed, so each batch is complete on its own and can be imported immediately.
+// Row and columnar nodes share this check. A duplicate id keeps the first node, but still takes
+// its slot in the node stream that columnar members index into.
+bool AppendValidatedNode(uint32_t id, double x, double y, double z,
+    ImportedStructuralModel& model, ImportTotals& totals, std::string& error) {
+    if (id == 0 || !std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+        error = "Worker sent an invalid node (zero id or non-finite coordinate)";
+        return false;
+    }
+    const uint32_t index = (uint32_t)(totals.nodes + model.nodes.size());
+    const auto inserted = totals.nodeIndexById.emplace(id, index);
+    totals.nodeIndexBySequence.push_back(inserted.first->second);
+    if (inserted.second) model.nodes.push_back({ id, (float)x, (float)y, (float)z });
+    return true;
+}
+
+// Bad parameters degrade to 0 (= catalog default dimensions), never fail the import.
+double SafeUserParameter(double value) {
+    return std::isfinite(value) && value > 0.0 ? value : 0.0;
 }
 
 bool AppendValidatedBatch(const vishwakarma::extension::v1::CreateGeometryBatch& batch,
-    ImportedStructuralModel& model, std::unordered_set<uint32_t>& seenNodeIds, std::string& error) {
-    if (model.nodes.size() + batch.nodes_size() > kMaxImportedNodes) {
+    ImportedStructuralModel& model, ImportTotals& totals, std::string& error) {
+    const auto& nodeColumns = batch.node_columns();
+    const auto& memberColumns = batch.member_columns();
+    const size_t nodeCount = (size_t)batch.nodes_size() + nodeColumns.node_ids_size();
+    const size_t memberCount = (size_t)batch.members_size() + memberColumns.member_ids_size();
+    if (nodeCount + memberCount > kMaxImportBatchEntities) {
+        error = "Worker exceeded the per-batch entity cap";
+        return false;
+    }
+    if (totals.nodeIndexBySequence.size() + nodeCount > kMaxImportedNodes) {
         error = "Worker exceeded the node cap";
         return false;
     }
-    if (model.members.size() + batch.members_size() > kMaxImportedMembers) {
+    if (totals.members + memberCount > kMaxImportedMembers) {
         error = "Worker exceeded the member cap";
         return false;
     }
+    const int columnMembers = memberColumns.member_ids_size();
+    if (nodeColumns.coordinates_size() != 3 * nodeColumns.node_ids_size() ||
+        memberColumns.node_indices_size() != 2 * columnMembers ||
+        memberColumns.profile_indices_size() != columnMembers ||
+        (memberColumns.user_parameters_size() != 0 && memberColumns.user_parameters_size() != 2 * columnMembers) ||
+        (size_t)memberColumns.profile_designations_size() > kMaxImportBatchEntities) {
+        error = "Worker sent geometry columns of mismatched lengths";
+        return false;
+    }
+    model.nodes.reserve(nodeCount);
+    model.members.reserve(memberCount);
+
     for (const auto& node : batch.nodes()) {
-        if (node.node_id() == 0 ||
-            !std::isfinite(node.x()) || !std::isfinite(node.y()) || !std::isfinite(node.z())) {
-            error = "Worker sent an invalid node (zero id or non-finite coordinate)";
-            return false;
-        }
-        if (!seenNodeIds.insert(node.node_id()).second) continue; // Ignore duplicate ids.
-        model.nodes.push_back({ node.node_id(), (float)node.x(), (float)node.y(), (float)node.z() });
+        if (!AppendValidatedNode(node.node_id(), node.x(), node.y(), node.z(), model, totals, error)) return false;
     }
+    const uint32_t* nodeIds = nodeColumns.node_ids().data();
+    const double* coordinates = nodeColumns.coordinates().data();
+    for (int i = 0; i < nodeColumns.node_ids_size(); ++i) {
+        if (!AppendValidatedNode(nodeIds[i], coordinates[3 * i], coordinates[3 * i + 1], coordinates[3 * i + 2],
+            model, totals, error)) return false;
+    }
+    totals.nodes += model.nodes.size();
+
+    // Designations resolve straight to catalog rows (generated perfect hash), so no string reaches
+    // the engineering thread.
+    auto resolveProfile = [](const std::string& designation) -> SteelProfileIndex {
+        // Overlong designations are certainly garbage: treat as unmapped rather than fail the import.
+        if (designation.empty() || designation.size() > kMaxProfileDesignationBytes) return kNoSteelProfile;
+        return FindSteelProfileIndexByDesignation(designation);
+    };
+
     for (const auto& member : batch.members()) {
         if (member.member_id() == 0 || member.start_node_id() == 0 || member.end_node_id() == 0) {
             error = "Worker sent an invalid member (zero id)";
             return false;
         }
-        // Overlong designations are certainly garbage: treat as unmapped rather than fail the import.
-        std::string designation = member.profile_designation();
-        if (designation.size() > kMaxProfileDesignationBytes) designation.clear();
-        // Bad parameters degrade to 0 (= catalog default dimensions), never fail the import.
-        auto safeParameter = [](double value) { return std::isfinite(value) && value > 0.0 ? value : 0.0; };
-        model.members.push_back({ member.member_id(), member.start_node_id(), member.end_node_id(),
-            std::move(designation),
-            safeParameter(member.user_parameter1()), safeParameter(member.user_parameter2()) });
+        const auto start = totals.nodeIndexById.find(member.start_node_id());
+        const auto end = totals.nodeIndexById.find(member.end_node_id());
+        if (start == totals.nodeIndexById.end() || end == totals.nodeIndexById.end()) continue;
+        model.members.push_back({ member.member_id(), start->second, end->second,
+            resolveProfile(member.profile_designation()),
+            SafeUserParameter(member.user_parameter1()), SafeUserParameter(member.user_parameter2()) });
     }
+
+    // Columns: the worker's string table is resolved once, then every member is plain array reads.
+    std::vector<SteelProfileIndex> profileRemap(memberColumns.profile_designations_size());
+    for (int i = 0; i < memberColumns.profile_designations_size(); ++i) {
+        profileRemap[i] = resolveProfile(memberColumns.profile_designations(i));
+    }
+    const uint32_t* memberIds = memberColumns.member_ids().data();
+    const uint32_t* nodeIndices = memberColumns.node_indices().data();
+    const uint32_t* profileIndices = memberColumns.profile_indices().data();
+    const double* parameters = memberColumns.user_parameters_size() != 0 ?
+        memberColumns.user_parameters().data() : nullptr;
+    const std::vector<uint32_t>& nodeIndexBySequence = totals.nodeIndexBySequence;
+    for (int i = 0; i < columnMembers; ++i) {
+        if (memberIds[i] == 0) {
+            error = "Worker sent an invalid member (zero id)";
+            return false;
+        }
+        const uint32_t start = nodeIndices[2 * i], end = nodeIndices[2 * i + 1];
+        if (start >= nodeIndexBySequence.size() || end >= nodeIndexBySequence.size()) continue;
+        const SteelProfileIndex profile =
+            profileIndices[i] < profileRemap.size() ? profileRemap[profileIndices[i]] : kNoSteelProfile;
+        model.members.push_back({ memberIds[i], nodeIndexBySequence[start], nodeIndexBySequence[end], profile,
+            parameters ? SafeUserParameter(parameters[2 * i]) : 0.0,
+            parameters ? SafeUserParameter(parameters[2 * i + 1]) : 0.0 });
+    }
+    totals.members += model.members.size();
     return true;
 }
 
@@ -356,6 +840,28 @@ bool ConvertValidated2DLine(const vishwakarma::extension::v1::Page2DLine& line,
     return true;
 }
 
+// Packed lines (x1, y1, x2, y2 per line) are validated and converted straight off the contiguous
+// wire array, with no per-line message objects.
+bool AppendValidated2DLineCoordinates(const google::protobuf::RepeatedField<double>& coordinates,
+    std::vector<ImportedPage2DLine>& out, std::string& error) {
+    if (coordinates.size() % 4 != 0) {
+        error = "Worker sent a packed 2D line array that is not made of whole lines";
+        return false;
+    }
+    const double* values = coordinates.data();
+    for (int i = 0; i < coordinates.size(); ++i) {
+        if (!std::isfinite(values[i])) {
+            error = "Worker sent a 2D line with non-finite coordinates";
+            return false;
+        }
+    }
+    out.reserve(out.size() + coordinates.size() / 4);
+    for (int i = 0; i < coordinates.size(); i += 4) {
+        out.push_back({ values[i], values[i + 1], values[i + 2], values[i + 3] });
+    }
+    return true;
+}
+
 bool ConvertValidated2DText(const vishwakarma::extension::v1::Page2DText& text,
     std::vector<ImportedPage2DText>& out, std::string& error) {
     if (!std::isfinite(text.x()) || !std::isfinite(text.y()) ||
@@ -385,43 +891,57 @@ bool ConvertValidated2DPolygon(const vishwakarma::extension::v1::Page2DPolygon&
 }
 
 bool AppendValidatedPage2DBatch(const vishwakarma::extension::v1::CreatePage2DBatch& batch,
-    ImportedPage2DContent& content, std::string& error) {
-    if (content.lines.size() + batch.lines_size() > kMaxImported2DLines) {
+    ImportedPage2DContent& content, ImportTotals& totals, std::string& error) {
+    const size_t lineCount = (size_t)batch.lines_size() + batch.line_coordinates_size() / 4;
+    if (lineCount + batch.texts_size() + batch.polygons_size() > kMaxImportBatchEntities) {
+        error = "Worker exceeded the per-batch entity cap";
+        return false;
+    }
+    if (totals.lines + lineCount > kMaxImported2DLines) {
         error = "Worker exceeded the 2D line cap";
         return false;
     }
-    if (content.texts.size() + batch.texts_size() > kMaxImported2DTexts) {
+    if (totals.texts + batch.texts_size() > kMaxImported2DTexts) {
         error = "Worker exceeded the 2D text cap";
         return false;
     }
-    if (content.polygons.size() + batch.polygons_size() > kMaxImported2DPolygons) {
+    if (totals.polygons + batch.polygons_size() > kMaxImported2DPolygons) {
         error = "Worker exceeded the 2D polygon cap";
         return false;
     }
     for (const auto& line : batch.lines()) {
         if (!ConvertValidated2DLine(line, content.lines, error)) return false;
     }
+    if (!AppendValidated2DLineCoordinates(batch.line_coordinates(), content.lines, error)) return false;
     for (const auto& text : batch.texts()) {
         if (!ConvertValidated2DText(text, content.texts, error)) return false;
     }
     for (const auto& polygon : batch.polygons()) {
         if (!ConvertValidated2DPolygon(polygon, content.polygons, error)) return false;
     }
+    totals.lines += content.lines.size();
+    totals.texts += content.texts.size();
+    totals.polygons += content.polygons.size();
     return true;
 }
 
+// A definition counts as one entity towards the batch cap; its master geometry has its own cap.
 bool AppendValidatedAsset2DBatch(const vishwakarma::extension::v1::CreateAsset2DBatch& batch,
-    ImportedPage2DContent& content, std::string& error) {
-    if (content.assetDefinitions.size() + batch.definitions_size() > kMaxImported2DAssetDefinitions) {
+    ImportedPage2DContent& content, ImportTotals& totals, std::string& error) {
+    if ((size_t)batch.definitions_size() + batch.inserts_size() > kMaxImportBatchEntities) {
+        error = "Worker exceeded the per-batch entity cap";
+        return false;
+    }
+    if (totals.assetDefinitions + batch.definitions_size() > kMaxImported2DAssetDefinitions) {
         error = "Worker exceeded the 2D asset definition cap";
         return false;
     }
-    if (content.assetInserts.size() + batch.inserts_size() > kMaxImported2DAssetInserts) {
+    if (totals.assetInserts + batch.inserts_size() > kMaxImported2DAssetInserts) {
         error = "Worker exceeded the 2D asset insert cap";
         return false;
     }
     for (const auto& definition : batch.definitions()) {
-        const size_t masterCount = (size_t)definition.lines_size() +
+        const size_t masterCount = (size_t)definition.lines_size() + definition.line_coordinates_size() / 4 +
             definition.texts_size() + definition.polygons_size();
         if (masterCount == 0 || masterCount > kMaxImported2DAssetMasters) {
             error = "Worker sent an asset definition with no / too many master elements";
@@ -438,12 +958,14 @@ bool AppendValidatedAsset2DBatch(const vishwakarma::extension::v1::CreateAsset2D
         for (const auto& line : definition.lines()) {
             if (!ConvertValidated2DLine(line, out.lines, error)) return false;
         }
+        if (!AppendValidated2DLineCoordinates(definition.line_coordinates(), out.lines, error)) return false;
         for (const auto& text : definition.texts()) {
             if (!ConvertValidated2DText(text, out.texts, error)) return false;
         }
         for (const auto& polygon : definition.polygons()) {
             if (!ConvertValidated2DPolygon(polygon, out.polygons, error)) return false;
         }
+        totals.definedKeys.insert(out.key);
         content.assetDefinitions.push_back(std::move(out));
     }
     for (const auto& insert : batch.inserts()) {
@@ -458,9 +980,12 @@ bool AppendValidatedAsset2DBatch(const vishwakarma::extension::v1::CreateAsset2D
             error = "Worker sent an asset insert with an invalid scale / rotation";
             return false;
         }
+        if (!totals.definedKeys.count(insert.asset_key())) continue;
         content.assetInserts.push_back({ insert.asset_key(), insert.x(), insert.y(),
             insert.scale_x(), insert.scale_y(), insert.rotation_degrees() });
     }
+    totals.assetDefinitions += content.assetDefinitions.size();
+    totals.assetInserts += content.assetInserts.size();
     return true;
 }
 
@@ -480,7 +1005,7 @@ bool QueueImportStdFile(DATASETTAB* tab, const std::wstring& stdFilePath) {
     ACTION_DETAILS request{};
     request.actionType = ACTION_TYPE::IMPORT_STD_FILE;
     request.source = INPUT_SOURCE::SYSTEM;
-    request.objectId = reinterpret_cast<uint64_t>(new std::wstring(stdFilePath));
+    request.objectId = RegisterPendingImport(kStdImporter, stdFilePath);
     request.timestamp = GetTickCount64();
     tab->todoCPUQueue->push(request);
     return true;
@@ -510,60 +1035,41 @@ bool QueueImportDxfFile(DATASETTAB* tab, const std::wstring& dxfFilePath) {
     ACTION_DETAILS request{};
     request.actionType = ACTION_TYPE::IMPORT_DXF_FILE;
     request.source = INPUT_SOURCE::SYSTEM;
-    request.objectId = reinterpret_cast<uint64_t>(new std::wstring(dxfFilePath));
+    request.objectId = RegisterPendingImport(kDxfImporter, dxfFilePath);
     request.timestamp = GetTickCount64();
     tab->todoCPUQueue->push(request);
     return true;
 }
 
 void ReleaseQueuedImportPath(uint64_t payloadId) {
-    delete reinterpret_cast<std::wstring*>(payloadId);
+    std::unique_ptr<PendingImport> pending(reinterpret_cast<PendingImport*>(payloadId));
+    if (!pending) return;
+    ClaimPendingImport(*pending);
+    FinishImport(*pending, false); // A prefetched job is abandoned mid-flight: retire its worker.
 }
 
-ImportedStructuralModel* RunQueuedStdImport(uint64_t payloadId, std::string& error) {
-    std::unique_ptr<std::wstring> path(reinterpret_cast<std::wstring*>(payloadId));
-    if (!path || path->empty()) {
-        error = "Import request carried no file path";
-        return nullptr;
-    }
-
-    WorkerProcess worker;
-    if (!SpawnImportWorker(worker, kStdImporter, error)) return nullptr;
-    if (!SendImportRequest(worker, *path, error)) return nullptr;
+bool RunQueuedStdImport(uint64_t payloadId, const StructuralBatchSink& onBatch, std::string& error) {
+    std::unique_ptr<PendingImport> pending = StartQueuedImport(payloadId, error);
+    if (!pending) return false;
+    const WorkerProcess& worker = *pending->worker;
+    const std::wstring& path = pending->path;
 
-    auto model = std::make_unique<ImportedStructuralModel>();
-    model->sourceFile = *path;
-    std::unordered_set<uint32_t> seenNodeIds;
-    const ULONGLONG deadlineTick = GetTickCount64() + kImportTimeoutMs;
+    ImportTotals totals;
 
     bool resultReceived = false;
     std::vector<uint8_t> payload;
+    vishwakarma::extension::v1::WorkerToHost message;
     while (!resultReceived) {
-        uint8_t prefix[4] = {};
-        if (!ReadExact(worker, prefix, sizeof(prefix), deadlineTick, error)) break;
-        const uint32_t length = (uint32_t)prefix[0] | ((uint32_t)prefix[1] << 8) |
-                                ((uint32_t)prefix[2] << 16) | ((uint32_t)prefix[3] << 24);
-        if (length == 0 || length > kMaxMessageBytes) {
-            error = "Worker sent an out-of-range message length";
-            break;
-        }
-        payload.resize(length);
-        if (!ReadExact(worker, payload.data(), length, deadlineTick, error)) break;
-
-        vishwakarma::extension::v1::WorkerToHost message;
-        if (!message.ParseFromArray(payload.data(), (int)length)) {
-            error = "Worker sent an unparseable message";
-            break;
-        }
+        if (!ReadWorkerMessage(worker, payload, message, GetTickCount64() + kImportIdleTimeoutMs, error)) break;
 
         switch (message.msg_case()) {
-        case vishwakarma::extension::v1::WorkerToHost::kCreateGeometryBatch:
-            if (!AppendValidatedBatch(message.create_geometry_batch(), *model, seenNodeIds, error)) {
-                resultReceived = false;
-            } else {
-                continue;
-            }
-            break;
+        case vishwakarma::extension::v1::WorkerToHost::kCreateGeometryBatch: {
+            ImportedStructuralModel batch;
+            batch.sourceFile = path;
+            if (!AppendValidatedBatch(message.create_geometry_batch(), batch, totals, error)) break;
+            if (!batch.nodes.empty() || !batch.members.empty()) onBatch(batch);
+            continue;
+        }
         case vishwakarma::extension::v1::WorkerToHost::kLog:
             std::cout << "[std-importer] "
                       << message.log().text().substr(0, 2000) << "\n";
@@ -583,82 +1089,47 @@ ImportedStructuralModel* RunQueuedStdImport(uint64_t payloadId, std::string& err
     }
 
     if (!resultReceived) {
-        const std::string stderrTail = TailOfStderrLog(StdImportTempPath(kStdImporter.stderrLogLeaf));
+        const std::string stderrTail = TailOfStderrLog(WorkerStderrLogPath(kStdImporter, worker.logSlot));
         if (!stderrTail.empty()) error += "\n\nWorker stderr:\n" + stderrTail;
         WriteImportResultMarker(kStdImporter, "FAILED: " + error.substr(0, 500));
-        return nullptr; // WorkerProcess destructor terminates the worker.
-    }
-
-    // The sandbox boundary ends at this validation: members must reference
-    // nodes that actually arrived, no matter what the worker claimed.
-    std::vector<ImportedMember> validMembers;
-    validMembers.reserve(model->members.size());
-    for (const ImportedMember& member : model->members) {
-        if (seenNodeIds.count(member.startNodeId) && seenNodeIds.count(member.endNodeId)) {
-            validMembers.push_back(member);
-        }
+        FinishImport(*pending, false); // Terminates the worker.
+        return false;
     }
-    model->members = std::move(validMembers);
+    FinishImport(*pending, true);
 
-    WriteImportResultMarker(kStdImporter, "OK: " + std::to_string(model->nodes.size()) + " nodes, " +
-                            std::to_string(model->members.size()) + " members from " + Utf8FromWide(*path));
-    std::cout << "[std-importer] Validated " << model->nodes.size() << " nodes and "
-              << model->members.size() << " members from " << Utf8FromWide(*path) << std::endl;
-    return model.release();
+    WriteImportResultMarker(kStdImporter, "OK: " + std::to_string(totals.nodes) + " nodes, " +
+                            std::to_string(totals.members) + " members from " + Utf8FromWide(path));
+    std::cout << "[std-importer] Validated " << totals.nodes << " nodes and "
+              << totals.members << " members from " << Utf8FromWide(path) << std::endl;
+    return true;
 }
 
-ImportedPage2DContent* RunQueuedDxfImport(uint64_t payloadId, std::string& error) {
-    std::unique_ptr<std::wstring> path(reinterpret_cast<std::wstring*>(payloadId));
-    if (!path || path->empty()) {
-        error = "Import request carried no file path";
-        WriteImportResultMarker(kDxfImporter, "FAILED: " + error);
-        return nullptr;
-    }
-
-    WorkerProcess worker;
-    if (!SpawnImportWorker(worker, kDxfImporter, error)) {
-        WriteImportResultMarker(kDxfImporter, "FAILED: " + error.substr(0, 500));
-        return nullptr;
-    }
-    if (!SendImportRequest(worker, *path, error)) {
+bool RunQueuedDxfImport(uint64_t payloadId, const Page2DBatchSink& onBatch, std::string& error) {
+    std::unique_ptr<PendingImport> pending = StartQueuedImport(payloadId, error);
+    if (!pending) {
         WriteImportResultMarker(kDxfImporter, "FAILED: " + error.substr(0, 500));
-        return nullptr;
+        return false;
     }
+    const WorkerProcess& worker = *pending->worker;
+    const std::wstring& path = pending->path;
 
-    auto content = std::make_unique<ImportedPage2DContent>();
-    content->sourceFile = *path;
-    const ULONGLONG deadlineTick = GetTickCount64() + kImportTimeoutMs;
+    ImportTotals totals;
 
     bool resultReceived = false;
     std::vector<uint8_t> payload;
+    vishwakarma::extension::v1::WorkerToHost message;
     while (!resultReceived) {
-        uint8_t prefix[4] = {};
-        if (!ReadExact(worker, prefix, sizeof(prefix), deadlineTick, error)) break;
-        const uint32_t length = (uint32_t)prefix[0] | ((uint32_t)prefix[1] << 8) |
-                                ((uint32_t)prefix[2] << 16) | ((uint32_t)prefix[3] << 24);
-        if (length == 0 || length > kMaxMessageBytes) {
-            error = "Worker sent an out-of-range message length";
-            break;
-        }
-        payload.resize(length);
-        if (!ReadExact(worker, payload.data(), length, deadlineTick, error)) break;
-
-        vishwakarma::extension::v1::WorkerToHost message;
-        if (!message.ParseFromArray(payload.data(), (int)length)) {
-            error = "Worker sent an unparseable message";
-            break;
-        }
+        if (!ReadWorkerMessage(worker, payload, message, GetTickCount64() + kImportIdleTimeoutMs, error)) break;
 
+        ImportedPage2DContent batch;
+        batch.sourceFile = path;
+        bool validated = false;
         switch (message.msg_case()) {
         case vishwakarma::extension::v1::WorkerToHost::kCreatePage2DBatch:
-            if (AppendValidatedPage2DBatch(message.create_page2d_batch(), *content, error)) {
-                continue;
-            }
+            validated = AppendValidatedPage2DBatch(message.create_page2d_batch(), batch, totals, error);
             break;
         case vishwakarma::extension::v1::WorkerToHost::kCreateAsset2DBatch:
-            if (AppendValidatedAsset2DBatch(message.create_asset2d_batch(), *content, error)) {
-                continue;
-            }
+            validated = AppendValidatedAsset2DBatch(message.create_asset2d_batch(), batch, totals, error);
             break;
         case vishwakarma::extension::v1::WorkerToHost::kLog:
             std::cout << kDxfImporter.logTag << " "
@@ -675,42 +1146,32 @@ ImportedPage2DContent* RunQueuedDxfImport(uint64_t payloadId, std::string& error
             error = "Worker sent an unknown message type";
             break;
         }
+        if (validated) {
+            onBatch(batch);
+            continue;
+        }
         if (!resultReceived) break; // Any validation failure or worker-reported error.
     }
 
     if (!resultReceived) {
-        const std::string stderrTail = TailOfStderrLog(StdImportTempPath(kDxfImporter.stderrLogLeaf));
+        const std::string stderrTail = TailOfStderrLog(WorkerStderrLogPath(kDxfImporter, worker.logSlot));
         if (!stderrTail.empty()) error += "\n\nWorker stderr:\n" + stderrTail;
         WriteImportResultMarker(kDxfImporter, "FAILED: " + error.substr(0, 500));
-        return nullptr; // WorkerProcess destructor terminates the worker.
-    }
-
-    // Sandbox boundary: an insert may only reference a definition that actually arrived. Drop the
-    // rest instead of trusting the worker (same policy as std members referencing missing nodes).
-    std::unordered_set<uint32_t> definedKeys;
-    definedKeys.reserve(content->assetDefinitions.size());
-    for (const ImportedAsset2DDefinition& definition : content->assetDefinitions) {
-        definedKeys.insert(definition.key);
-    }
-    std::vector<ImportedAsset2DInsert> validInserts;
-    validInserts.reserve(content->assetInserts.size());
-    for (const ImportedAsset2DInsert& insert : content->assetInserts) {
-        if (definedKeys.count(insert.key)) validInserts.push_back(insert);
-    }
-    content->assetInserts = std::move(validInserts);
-
-    const size_t total = content->lines.size() + content->texts.size() + content->polygons.size();
-    WriteImportResultMarker(kDxfImporter, "OK: " + std::to_string(content->lines.size()) + " lines, " +
-                            std::to_string(content->texts.size()) + " texts, " +
-                            std::to_string(content->polygons.size()) + " polygons, " +
-                            std::to_string(content->assetDefinitions.size()) + " assets (" +
-                            std::to_string(content->assetInserts.size()) + " inserts) from " +
-                            Utf8FromWide(*path));
+        FinishImport(*pending, false); // Terminates the worker.
+        return false;
+    }
+    FinishImport(*pending, true);
+
+    const size_t total = totals.lines + totals.texts + totals.polygons;
+    WriteImportResultMarker(kDxfImporter, "OK: " + std::to_string(totals.lines) + " lines, " +
+                            std::to_string(totals.texts) + " texts, " +
+                            std::to_string(totals.polygons) + " polygons, " +
+                            std::to_string(totals.assetDefinitions) + " assets (" +
+                            std::to_string(totals.assetInserts) + " inserts) from " +
+                            Utf8FromWide(path));
     std::cout << kDxfImporter.logTag << " Validated " << total << " Page2D elements, "
-              << content->assetDefinitions.size() << " asset definitions and "
-              << content->assetInserts.size() << " inserts from "
-              << Utf8FromWide(*path) << std::endl;
-    return content.release();
+              << totals.assetDefinitions << " asset definitions and "
+              << totals.assetInserts << " inserts from "
+              << Utf8FromWide(path) << std::endl;
+    return true;
 }
-
-} // namespace ExtensionCommunications
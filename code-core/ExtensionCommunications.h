@@ -10,8 +10,10 @@
 
 #pragma once
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
+#include "SteelProfileCatalog.h"
 
 struct DATASETTAB;
 
@@ -24,16 +26,19 @@ struct ImportedNode {
 
 struct ImportedMember {
     uint32_t id = 0;
-    uint32_t startNodeId = 0;
-    uint32_t endNodeId = 0;
-    // Vishwakarma catalog designation, already mapped from the STAAD name by the
-    // worker (profile_mapping.py). Empty = unmapped; drawn as a placeholder pipe.
-    std::string profileDesignation;
+    // Import-wide node indices: node n is the n-th ImportedNode handed to the sink
+    // in this import (across all batches). Always below the count delivered so far.
+    uint32_t startNode = 0;
+    uint32_t endNode = 0;
+    // Catalog row of the worker's designation (profile_mapping.py already mapped the STAAD name),
+    // resolved during validation. kNoSteelProfile = unmapped: drawn as a placeholder pipe.
+    SteelProfileIndex profile = kNoSteelProfile;
     // Parametric-family section dimensions (PRIS YD/ZD), SI meters; 0 = unset.
     double userParameter1 = 0.0;
     double userParameter2 = 0.0;
 };
 
+// One validated worker batch of a STAAD import (see RunQueuedStdImport).
 struct ImportedStructuralModel {
     std::wstring sourceFile;
     std::vector<ImportedNode> nodes;
@@ -72,11 +77,12 @@ struct ImportedAsset2DDefinition {
 struct ImportedAsset2DInsert {
     uint32_t key = 0;      // References an ImportedAsset2DDefinition::key.
     double x = 0, y = 0;
-    // Per-instance transform baked into the members at materialization; negative scale = mirror.
+    // Per-instance transform of the placed reference insert; negative scale = mirror.
     double scaleX = 1.0, scaleY = 1.0;
     double rotationDegrees = 0.0; // Counter-clockwise.
 };
 
+// One validated worker batch of a DXF import (see RunQueuedDxfImport).
 struct ImportedPage2DContent {
     std::wstring sourceFile;
     std::vector<ImportedPage2DLine> lines;
@@ -92,7 +98,9 @@ struct ImportedPage2DContent {
 bool QueueImportStdCommand(DATASETTAB* tab);
 
 // Queues an import of a known file path (no dialog). Used by the UI command
-// above and by the VISHWAKARMA_AUTO_IMPORT_STD dev/testing hook.
+// above and by the VISHWAKARMA_AUTO_IMPORT_STD dev/testing hook. Queued files
+// are handed to pooled, warm workers up to a few ahead of the engineering
+// thread, so a run of queued imports parses in parallel.
 bool QueueImportStdFile(DATASETTAB* tab, const std::wstring& stdFilePath);
 
 // Same pair for the DXF importer. The command variant refuses (with a message
@@ -100,17 +108,29 @@ bool QueueImportStdFile(DATASETTAB* tab, const std::wstring& stdFilePath);
 bool QueueImportDxfCommand(DATASETTAB* tab);
 bool QueueImportDxfFile(DATASETTAB* tab, const std::wstring& dxfFilePath);
 
-// Releases a queued import path payload without running the worker (used when
-// the engineering thread aborts an import, e.g. no Page2D open anymore).
+// Releases a queued import payload without importing it (used when the
+// engineering thread aborts an import, e.g. no Page2D open anymore). A worker
+// already parsing it ahead of time is retired.
 void ReleaseQueuedImportPath(uint64_t payloadId);
 
+// Worker batches are bounded (ExtensionIPC.proto: at most this many entities per message) and
+// reach the sink one at a time, so neither side ever holds a whole import in memory.
+constexpr uint32_t kMaxImportBatchEntities = 4096;
+
+// Called on the importing (engineering) thread for every validated batch, in arrival order.
+// The worker is not read again until the sink returns, and it can run at most one result ring
+// ahead of it: that is the backpressure. The sink may move out of the batch.
+using StructuralBatchSink = std::function<void(ImportedStructuralModel& batch)>;
+using Page2DBatchSink = std::function<void(ImportedPage2DContent& batch)>;
+
 // Engineering thread: runs the out-of-process import worker for a queued
 // request. payloadId is the ACTION_DETAILS::objectId of that action (owns
-// the path payload; always released here). Returns nullptr and fills error
-// on failure. Caller owns the returned model (delete when done).
-ImportedStructuralModel* RunQueuedStdImport(uint64_t payloadId, std::string& error);
+// the queued import; always released here). Returns false and fills error on
+// failure; batches already handed to the sink stay imported (the caller marks the result partial).
+// The timeout is on worker silence, not on the whole import: see kImportIdleTimeoutMs.
+bool RunQueuedStdImport(uint64_t payloadId, const StructuralBatchSink& onBatch, std::string& error);
 
-// Engineering thread: DXF variant; returns validated Page2D content.
-ImportedPage2DContent* RunQueuedDxfImport(uint64_t payloadId, std::string& error);
+// Engineering thread: DXF variant; streams validated Page2D content.
+bool RunQueuedDxfImport(uint64_t payloadId, const Page2DBatchSink& onBatch, std::string& error);
 
 } // namespace ExtensionCommunications
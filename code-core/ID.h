@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <atomic>
 #include <vector>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -18,8 +19,24 @@ public:
 	not memory ordering between threads. If hundreds of threads call next(),
 	each gets a unique ID.*/
 	static uint64_t next() {// fetch_add returns the current value and then increments atomically
+		if (pinnedNext != 0) { // Handed out by assignNext below; one use only.
+			const uint64_t id = pinnedNext;
+			pinnedNext = 0;
+			return id;
+		}
 		return counter.fetch_add(1, std::memory_order_relaxed);
 	}
+	/* Reserves `count` consecutive IDs in one step and returns the first. For parallel construction:
+	the engineering thread reserves a whole batch, and each object gets first + its arrival index no matter
+	which thread constructs it or when, so the IDs (and the saved file) stay the same as a serial run. */
+	static uint64_t reserve(uint64_t count) {
+		return counter.fetch_add(count, std::memory_order_relaxed);
+	}
+	// The next next() on this thread returns `id`, which must come from a reserve() range.
+	// Set it right before constructing the object that should carry it.
+	static void assignNext(uint64_t id) { pinnedNext = id; }
+private:
+	inline static thread_local uint64_t pinnedNext = 0; // 0 = none; IDs start from 1.
 };
 
 struct ReferenceID {
@@ -0,0 +1,343 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+// Icon atlas pixels, layout and cache. See IconAtlasImage.h.
+
+#include "IconAtlasImage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+// Reference cell size the procedural dummy icons were authored against; real cells scale from it.
+constexpr int kIconReferenceCellSize = 24;
+constexpr int kIconCellGap = 4;
+constexpr int kIconStartY = 48;
+constexpr int kIconAtlasMinDimension = 256;
+constexpr int kIconAtlasMaxDimension = 4096;
+
+struct Canvas {
+    int width;
+    int height;
+    uint8_t* pixels; // RGBA8
+};
+
+void SetPixelRGBA(Canvas& atlas, int x, int y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    if (x < 0 || y < 0 || x >= atlas.width || y >= atlas.height) return;
+    uint8_t* pixel = atlas.pixels + (static_cast<size_t>(y) * atlas.width + x) * 4u;
+    pixel[0] = r;
+    pixel[1] = g;
+    pixel[2] = b;
+    pixel[3] = a;
+}
+
+void SetCoverage(Canvas& atlas, int x, int y, uint8_t coverage) {
+    SetPixelRGBA(atlas, x, y, 255, 255, 255, coverage);
+}
+
+void GenerateRoundedRectangleNineSlice(Canvas& atlas, int originX, int originY, int sourceSizePx,
+    int sourceRadiusPx, std::array<std::array<IconAtlasRect, 3>, 3>& outSlice) {
+    for (int y = 0; y < sourceSizePx; ++y) {
+        for (int x = 0; x < sourceSizePx; ++x) {
+            const float px = (float)x + 0.5f;
+            const float py = (float)y + 0.5f;
+            const float nearestX = std::clamp(px, (float)sourceRadiusPx,
+                (float)(sourceSizePx - sourceRadiusPx));
+            const float nearestY = std::clamp(py, (float)sourceRadiusPx,
+                (float)(sourceSizePx - sourceRadiusPx));
+            const float dx = px - nearestX;
+            const float dy = py - nearestY;
+            const float distance = std::sqrt(dx * dx + dy * dy);
+            const float coverage = std::clamp((float)sourceRadiusPx + 0.5f - distance, 0.0f, 1.0f);
+
+            SetCoverage(atlas, originX + x, originY + y, (uint8_t)std::round(coverage * 255.0f));
+        }
+    }
+
+    const int middle = sourceSizePx - 2 * sourceRadiusPx;
+    const int widths[3] = { sourceRadiusPx, middle, sourceRadiusPx };
+    const int heights[3] = { sourceRadiusPx, middle, sourceRadiusPx };
+    int yCursor = originY;
+    for (int row = 0; row < 3; ++row) {
+        int xCursor = originX;
+        for (int col = 0; col < 3; ++col) {
+            outSlice[row][col] = { xCursor, yCursor, widths[col], heights[row] };
+            xCursor += widths[col];
+        }
+        yCursor += heights[row];
+    }
+}
+
+void FillRect(Canvas& atlas, int x, int y, int w, int h, uint8_t coverage) {
+    for (int yy = y; yy < y + h; ++yy) {
+        for (int xx = x; xx < x + w; ++xx) {
+            SetCoverage(atlas, xx, yy, coverage);
+        }
+    }
+}
+
+// Blits the rasterised icon centred inside the reserved atlas region (one square cell for every
+// icon but the wide word-mark, which gets a horizontal run of cells).
+void CopyRenderedSVGIconToAtlas(Canvas& atlas, const SVGIconRenderer::RenderedSVGIcon& icon,
+    int originX, int originY, int regionW, int regionH) {
+    if (icon.rgba.empty() || icon.width <= 0 || icon.height <= 0) return;
+
+    const int copyW = std::min(icon.width, regionW);
+    const int copyH = std::min(icon.height, regionH);
+    const int dstX = originX + std::max(0, (regionW - copyW) / 2);
+    const int dstY = originY + std::max(0, (regionH - copyH) / 2);
+
+    for (int y = 0; y < copyH; ++y) {
+        for (int x = 0; x < copyW; ++x) {
+            const size_t srcOffset = (static_cast<size_t>(y) * icon.width + x) * 4u;
+            SetPixelRGBA(atlas, dstX + x, dstY + y,
+                icon.rgba[srcOffset + 0],
+                icon.rgba[srcOffset + 1],
+                icon.rgba[srcOffset + 2],
+                icon.rgba[srcOffset + 3]);
+        }
+    }
+}
+
+// Number of cells one rasterised icon needs side by side: 1 for every square icon, more for a
+// wide one. The renderer keeps each icon's aspect ratio, so width alone decides this.
+int IconCellsWide(int iconWidthPx, int cellSize) {
+    return std::max(1, (iconWidthPx + cellSize - 1) / cellSize);
+}
+
+// Pixel width of a run of `cellsWide` cells, gaps included: the run belongs to one icon, so the
+// gaps between its cells are usable image area.
+int IconCellRunWidth(int cellsWide, int cellSize) {
+    return cellsWide * cellSize + (cellsWide - 1) * kIconCellGap;
+}
+
+// Reserves a horizontal run of `cellsWide` cells starting at `iconIndex`, advancing iconIndex to
+// the next row when the run would not fit in the current one (a run is never split across rows).
+bool TryReserveIconCellRun(int& iconIndex, int atlasW, int atlasH, int cellSize, int cellsWide,
+    int& outX, int& outY) {
+    const int cellsPerRow = (atlasW + kIconCellGap) / (cellSize + kIconCellGap);
+    if (cellsPerRow <= 0 || cellsWide > cellsPerRow) return false;
+
+    const int column = iconIndex % cellsPerRow;
+    if (column + cellsWide > cellsPerRow) iconIndex += cellsPerRow - column;
+
+    outX = (iconIndex % cellsPerRow) * (cellSize + kIconCellGap);
+    outY = kIconStartY + (iconIndex / cellsPerRow) * (cellSize + kIconCellGap);
+    return outX + IconCellRunWidth(cellsWide, cellSize) <= atlasW && outY + cellSize <= atlasH;
+}
+
+int ComputeIconAtlasDimension(size_t iconCount, int cellSize) {
+    const size_t iconsToPlace = std::max<size_t>(iconCount, 1u);
+    int dimension = kIconAtlasMinDimension;
+
+    while (dimension < kIconAtlasMaxDimension) {
+        const int cellsPerRow = (dimension + kIconCellGap) / (cellSize + kIconCellGap);
+        if (cellsPerRow > 0) {
+            const size_t rows =
+                (iconsToPlace + static_cast<size_t>(cellsPerRow) - 1u) / static_cast<size_t>(cellsPerRow);
+            const size_t requiredHeight = static_cast<size_t>(kIconStartY) +
+                (rows - 1u) * static_cast<size_t>(cellSize + kIconCellGap) +
+                static_cast<size_t>(cellSize);
+            if (requiredHeight <= static_cast<size_t>(dimension)) return dimension;
+        }
+
+        dimension *= 2;
+    }
+
+    return kIconAtlasMaxDimension;
+}
+
+/* The cache file: header, cells, then the pixels at a 64-byte aligned offset.
+
+Bump kIconAtlasFormatVersion whenever the file layout OR PackIconAtlas's output changes (the
+placeholder drawings, the packing, the cell gap): the key does not see code, only data. */
+constexpr uint32_t kIconAtlasFormatVersion = 1;
+constexpr char kIconAtlasMagic[8] = { 'V', 'K', 'A', 'T', 'L', 'A', 'S', '\0' };
+constexpr size_t kPixelAlignment = 64;
+
+struct IconAtlasFileHeader {
+    char magic[8];
+    uint32_t formatVersion;
+    uint32_t cellSize;
+    uint64_t manifestHash;   // SVGIconRenderer::EmbeddedManifestHash(): ids, file names and SVG bytes.
+    uint32_t rasterizerVersion;
+    uint32_t width;
+    uint32_t height;
+    uint32_t cellCount;
+    IconAtlasRect roundedRectangle[3][3];
+};
+
+size_t PixelOffset(uint32_t cellCount) {
+    const size_t end = sizeof(IconAtlasFileHeader) + static_cast<size_t>(cellCount) * sizeof(IconAtlasCell);
+    return (end + kPixelAlignment - 1) / kPixelAlignment * kPixelAlignment;
+}
+
+bool InsideAtlas(const IconAtlasRect& rect, uint32_t width, uint32_t height) {
+    return rect.x >= 0 && rect.y >= 0 && rect.width >= 0 && rect.height >= 0 &&
+        static_cast<uint32_t>(rect.x) + static_cast<uint32_t>(rect.width) <= width &&
+        static_cast<uint32_t>(rect.y) + static_cast<uint32_t>(rect.height) <= height;
+}
+
+} // namespace
+
+IconAtlasImage PackIconAtlas(int cellSize, const std::vector<SVGIconRenderer::RenderedSVGIcon>& svgIcons) {
+    cellSize = std::max(1, cellSize);
+    // Procedural dummy icons were authored in a 24 px reference cell; scale their coordinates to fit.
+    auto S = [cellSize](int v) { return (int)std::lround((double)v * cellSize / (double)kIconReferenceCellSize); };
+
+    // 4 dummy icons + one run per SVG icon. A wide icon costs `cellsWide` cells, plus as many
+    // again for the worst case where its run does not fit the current row and skips to the next.
+    size_t cellsNeeded = kIconPlaceholderCodepoints.size();
+    for (const SVGIconRenderer::RenderedSVGIcon& svgIcon : svgIcons) {
+        const int cellsWide = IconCellsWide(svgIcon.width, cellSize);
+        cellsNeeded += static_cast<size_t>(2 * cellsWide - 1);
+    }
+    const int atlasDimension = ComputeIconAtlasDimension(cellsNeeded, cellSize);
+
+    IconAtlasImage image;
+    image.width = atlasDimension;
+    image.height = atlasDimension;
+    image.ownedPixels.assign(image.PixelBytes(), 0);
+    Canvas atlas{ image.width, image.height, image.ownedPixels.data() };
+
+    // The source rounded rectangle is split into 9 texture regions at draw time.
+    // Destination corners are resized to ~2 mm in screen space by PushRoundedRectangle.
+    GenerateRoundedRectangleNineSlice(atlas, 0, 0, 32, 8, image.roundedRectangle);
+
+    std::array<int, 4> iconXs{};
+    std::array<int, 4> iconYs{};
+    int nextIconIndex = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (!TryReserveIconCellRun(nextIconIndex, image.width, image.height, cellSize, 1, iconXs[i], iconYs[i])) continue;
+        image.cells.push_back({ kIconPlaceholderCodepoints[i], { iconXs[i], iconYs[i], cellSize, cellSize }, 1 });
+        ++nextIconIndex;
+    }
+
+    // Dummy icon 0: plus
+    FillRect(atlas, iconXs[0] + S(10), iconYs[0] + S(4), S(4), S(16), 255);
+    FillRect(atlas, iconXs[0] + S(4), iconYs[0] + S(10), S(16), S(4), 255);
+
+    // Dummy icon 1: folder-like block
+    FillRect(atlas, iconXs[1] + S(4), iconYs[1] + S(8), S(16), S(11), 255);
+    FillRect(atlas, iconXs[1] + S(6), iconYs[1] + S(5), S(7), S(4), 255);
+
+    // Dummy icon 2: ring (drawn to fill the cell, radii scaled from the 24 px reference)
+    const float ringCenter = cellSize * 0.5f;
+    const float ringInner = 5.0f * cellSize / (float)kIconReferenceCellSize;
+    const float ringOuter = 8.0f * cellSize / (float)kIconReferenceCellSize;
+    for (int y = 0; y < cellSize; ++y) {
+        for (int x = 0; x < cellSize; ++x) {
+            const float dx = (float)x + 0.5f - ringCenter;
+            const float dy = (float)y + 0.5f - ringCenter;
+            const float d = std::sqrt(dx * dx + dy * dy);
+            if (d >= ringInner && d <= ringOuter) {
+                SetCoverage(atlas, iconXs[2] + x, iconYs[2] + y, 255);
+            }
+        }
+    }
+
+    // Dummy icon 3: 2x2 grid
+    FillRect(atlas, iconXs[3] + S(4), iconYs[3] + S(4), S(7), S(7), 255);
+    FillRect(atlas, iconXs[3] + S(13), iconYs[3] + S(4), S(7), S(7), 255);
+    FillRect(atlas, iconXs[3] + S(4), iconYs[3] + S(13), S(7), S(7), 255);
+    FillRect(atlas, iconXs[3] + S(13), iconYs[3] + S(13), S(7), S(7), 255);
+
+    for (const SVGIconRenderer::RenderedSVGIcon& svgIcon : svgIcons) {
+        const int cellsWide = IconCellsWide(svgIcon.width, cellSize);
+        const int runWidth = IconCellRunWidth(cellsWide, cellSize);
+        int cellX = 0;
+        int cellY = 0;
+        if (!TryReserveIconCellRun(nextIconIndex, image.width, image.height, cellSize, cellsWide, cellX, cellY)) break;
+
+        CopyRenderedSVGIconToAtlas(atlas, svgIcon, cellX, cellY, runWidth, cellSize);
+        // The cell spans the whole run, so its width:height ratio is what callers should size the
+        // quad by - PushIcon maps its UVs onto whatever rectangle it is given.
+        image.cells.push_back({ SVGIconRenderer::IconForID(svgIcon.id), { cellX, cellY, runWidth, cellSize }, 0 });
+        nextIconIndex += cellsWide;
+    }
+
+    return image;
+}
+
+std::filesystem::path IconAtlasCachePath(int cellSize) {
+    uint64_t key = AssetCache::HashValue(SVGIconRenderer::EmbeddedManifestHash());
+    key = AssetCache::HashValue(static_cast<uint64_t>(cellSize), key);
+    key = AssetCache::HashValue(SVGIconRenderer::RasterizerVersion(), key);
+    key = AssetCache::HashValue(kIconAtlasFormatVersion, key);
+    return AssetCache::FilePath(L"iconatlas", key);
+}
+
+bool LoadIconAtlas(const std::filesystem::path& path, int cellSize, IconAtlasImage& out) {
+    if (path.empty()) return false;
+    AssetCache::MappedFile file(path);
+    if (file.Size() < sizeof(IconAtlasFileHeader)) return false;
+    IconAtlasFileHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    // Every field is checked against this build and the file size: a truncated or foreign file must
+    // fall back to packing, never read out of bounds.
+    if (std::memcmp(header.magic, kIconAtlasMagic, sizeof(kIconAtlasMagic)) != 0 ||
+        header.formatVersion != kIconAtlasFormatVersion ||
+        header.cellSize != static_cast<uint32_t>(cellSize) ||
+        header.manifestHash != SVGIconRenderer::EmbeddedManifestHash() ||
+        header.rasterizerVersion != SVGIconRenderer::RasterizerVersion() ||
+        header.width == 0 || header.height == 0 ||
+        header.width > static_cast<uint32_t>(kIconAtlasMaxDimension) ||
+        header.height > static_cast<uint32_t>(kIconAtlasMaxDimension) ||
+        header.cellCount > 65536u ||
+        file.Size() != PixelOffset(header.cellCount) + static_cast<size_t>(header.width) * header.height * 4u) {
+        return false;
+    }
+
+    IconAtlasImage image;
+    image.width = static_cast<int>(header.width);
+    image.height = static_cast<int>(header.height);
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            if (!InsideAtlas(header.roundedRectangle[row][col], header.width, header.height)) return false;
+            image.roundedRectangle[row][col] = header.roundedRectangle[row][col];
+        }
+    }
+    image.cells.resize(header.cellCount);
+    std::memcpy(image.cells.data(), file.Data() + sizeof(IconAtlasFileHeader),
+        header.cellCount * sizeof(IconAtlasCell));
+    for (const IconAtlasCell& cell : image.cells) {
+        if (!InsideAtlas(cell.rect, header.width, header.height) || cell.inFallbackPool > 1) return false;
+    }
+    image.mappedPixels = file.Data() + PixelOffset(header.cellCount);
+    image.mapping = std::move(file);
+    out = std::move(image);
+    return true;
+}
+
+bool StoreIconAtlas(const std::filesystem::path& path, int cellSize, const IconAtlasImage& image) {
+    if (path.empty() || image.width <= 0 || image.height <= 0) return false;
+    IconAtlasFileHeader header{};
+    std::memcpy(header.magic, kIconAtlasMagic, sizeof(kIconAtlasMagic));
+    header.formatVersion = kIconAtlasFormatVersion;
+    header.cellSize = static_cast<uint32_t>(cellSize);
+    header.manifestHash = SVGIconRenderer::EmbeddedManifestHash();
+    header.rasterizerVersion = SVGIconRenderer::RasterizerVersion();
+    header.width = static_cast<uint32_t>(image.width);
+    header.height = static_cast<uint32_t>(image.height);
+    header.cellCount = static_cast<uint32_t>(image.cells.size());
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) header.roundedRectangle[row][col] = image.roundedRectangle[row][col];
+    }
+    const uint8_t padding[kPixelAlignment] = {};
+    const size_t cellBytes = image.cells.size() * sizeof(IconAtlasCell);
+    return AssetCache::WriteAtomically(path, { { &header, sizeof(header) }, { image.cells.data(), cellBytes },
+        { padding, PixelOffset(header.cellCount) - sizeof(header) - cellBytes },
+        { image.Pixels(), image.PixelBytes() } });
+}
+
+IconAtlasImage BuildIconAtlasImage(int cellSize) {
+    cellSize = std::max(1, cellSize);
+    const std::filesystem::path cachePath = IconAtlasCachePath(cellSize);
+    IconAtlasImage image;
+    if (LoadIconAtlas(cachePath, cellSize, image)) return image;
+
+    image = PackIconAtlas(cellSize, SVGIconRenderer::RenderEmbeddedSVGIcons(cellSize));
+    StoreIconAtlas(cachePath, cellSize, image);
+    return image;
+}
@@ -0,0 +1,65 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+/* The pixels and cell layout of one monitor's icon atlas, and their on-disk cache (AssetCache.h).
+BuildIconAtlas (UserInterface.cpp) turns the pixel layout into UVs for the monitor's IconAtlasCPU;
+the platform half uploads the pixels. Nothing here touches Windows, DirectX or FreeType, so
+validations/ builds it.
+
+A finished atlas is cached per (icon manifest hash, cell size, lunasvg version, format version) and
+memory-mapped on the next build for that cell size: the texture upload reads the mapping directly,
+so a warm start neither decompresses, rasterizes nor packs anything. */
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "AssetCache.h"
+#include "SVGIconRenderer.h"
+
+// Pixel rectangle inside the atlas.
+struct IconAtlasRect {
+    int32_t x = 0, y = 0, width = 0, height = 0;
+};
+
+// The four procedural placeholder icons packed ahead of the SVG ones (UIIconAtlasMetadata).
+constexpr std::array<char32_t, 4> kIconPlaceholderCodepoints{ U'\uE100', U'\uE101', U'\uE102', U'\uE103' };
+
+// One icon's cells: a square cell, or a horizontal run of them for a wide icon.
+struct IconAtlasCell {
+    char32_t codepoint = 0;
+    IconAtlasRect rect;
+    uint32_t inFallbackPool = 0; // 1: a placeholder, listed in IconAtlasCPU's mixedIconCodepoints.
+};
+
+class IconAtlasImage {
+public:
+    int width = 0, height = 0;                  // RGBA8, rows tightly packed.
+    std::vector<IconAtlasCell> cells;           // In placement order.
+    std::array<std::array<IconAtlasRect, 3>, 3> roundedRectangle{}; // The 9-slice source regions.
+
+    const uint8_t* Pixels() const { return mapping.Empty() ? ownedPixels.data() : mappedPixels; }
+    size_t PixelBytes() const { return static_cast<size_t>(width) * height * 4u; }
+    bool FromCache() const { return !mapping.Empty(); }
+
+private:
+    friend IconAtlasImage PackIconAtlas(int, const std::vector<SVGIconRenderer::RenderedSVGIcon>&);
+    friend bool LoadIconAtlas(const std::filesystem::path&, int, IconAtlasImage&);
+    std::vector<uint8_t> ownedPixels;           // A freshly packed atlas.
+    AssetCache::MappedFile mapping;             // A cached one: the pixels stay in the mapped file.
+    const uint8_t* mappedPixels = nullptr;
+};
+
+// Lays out the procedural placeholder icons and `svgIcons`, in order, in cells of `cellSize` px.
+IconAtlasImage PackIconAtlas(int cellSize, const std::vector<SVGIconRenderer::RenderedSVGIcon>& svgIcons);
+
+// The cache file for this build's icons at `cellSize`. Empty when there is no cache folder.
+std::filesystem::path IconAtlasCachePath(int cellSize);
+
+// Maps a cached atlas; false, leaving `out` untouched, for a missing, foreign or damaged file.
+bool LoadIconAtlas(const std::filesystem::path& path, int cellSize, IconAtlasImage& out);
+bool StoreIconAtlas(const std::filesystem::path& path, int cellSize, const IconAtlasImage& image);
+
+// The cached atlas when there is one; otherwise rasterized (SVGIconRenderer), packed and stored.
+IconAtlasImage BuildIconAtlasImage(int cellSize);
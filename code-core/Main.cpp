@@ -243,6 +243,7 @@ DATASETTAB* CreateEngineeringTab(const std::wstring& displayName = L"",
         std::lock_guard<std::mutex> lock(*tab.storageObjectsMutex);
         tab.storageLogicalObjects.clear();
         tab.storageObjects3D.clear();
+        tab.objectIndex.Clear();
         tab.expandedDataTreeNodeIds.clear();
         CloseAllInternalSubTabsLocked(tab);
         tab.defaultScene3DMemoryId = 0;
@@ -617,6 +618,14 @@ void ProcessPendingUIActions() {
                 PushSystemTodoToTab(&allTabs[tabIndex], ACTION_TYPE::MODIFY_OBJECT_PROPERTY,
                     static_cast<int>(fieldIndex), 0, 0, action.p2, action.p3);
             }
+        } else if (action.id == kPropertySelectionCommitUIAction) {
+            // p1 = (tabIndex << 8) | fieldIndex, p2 = object type number, p3 = double value bits.
+            const uint32_t tabIndex = static_cast<uint32_t>(action.p1 >> 8);
+            const uint8_t fieldIndex = static_cast<uint8_t>(action.p1 & 0xFFu);
+            if (tabIndex < MV_MAX_TABS) {
+                PushSystemTodoToTab(&allTabs[tabIndex], ACTION_TYPE::MODIFY_SELECTED_PROPERTY,
+                    static_cast<int>(fieldIndex), 0, 0, action.p2, action.p3);
+            }
         }
     }
 
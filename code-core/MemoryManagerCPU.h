@@ -103,7 +103,9 @@ struct CHUNK_METADATA { // Should not be more than 4KB in size.
 
     static const uint32_t freeByteRangesMaxSize = 498;
     FREE_RAM_RANGES freeByteRangesList[freeByteRangesMaxSize]; //Track the free space within the 4 MB Range.
-    std::byte headerPadding[4] = {}; //Reserve bytes. Deduct from here if new variable required inside this struct.
+    //Reserve bytes. Deduct from here if new variable required inside this struct. The layout is counted with
+    //MSVC's 80-byte std::mutex; a smaller one (libstdc++: 40 bytes, in the validations build) is made up here.
+    std::byte headerPadding[4 + (80 - sizeof(std::mutex))] = {};
 };
 static_assert(sizeof(CHUNK_METADATA) == 4096, "CHUNK_METADATA must be exactly 4KB (4096 bytes)");
 struct CPU_RAM_4MB : CHUNK_METADATA {
@@ -306,6 +308,27 @@ public:
     
     /*Called by the overloaded `new` operator in META_DATA. return A pointer to the allocated memory.*/
     std::byte* Allocate(uint64_t size, uint32_t memoryGroupNo);
+
+    /* A private chunk of one tab for one thread constructing objects in parallel (an EngineeringParallelFor
+    slot during an import). Small allocations made under an ArenaScope for that tab go to this chunk, so
+    they take only its own, uncontended chunk mutex; when it is full, the next chunk is acquired for the
+    tab as usual but not made the tab's active chunk. The chunks are the tab's like any other: freed with
+    the tab, and objects in them free normally. What is left unused in an arena's last chunk stays unused
+    until the tab closes, so keep one arena per thread for a whole operation rather than per batch. */
+    struct ChunkArena {
+        uint32_t memoryGroupNo = 0;
+        CPU_RAM_4MB* chunk = nullptr;
+    };
+    // Routes this thread's small allocations for arena.memoryGroupNo to the arena while in scope.
+    class ArenaScope {
+    public:
+        explicit ArenaScope(ChunkArena& arena) : previous(threadArena) { threadArena = &arena; }
+        ~ArenaScope() { threadArena = previous; }
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+    private:
+        ChunkArena* previous;
+    };
     void Free(std::byte* userPtr);//Free the memory allocated at the pointer.
     void notifyTabClosed(uint32_t memoryGroupNo);//De-commits all chunks associated with a closed tab.
 
@@ -337,6 +360,8 @@ private:
 
     CPU_RAM_4MB* getNewChunkForTab(uint32_t memoryGroupNo);
     std::byte* allocateFromSmallPool(uint32_t size, uint32_t memoryGroupNo);
+    std::byte* allocateFromArena(ChunkArena& arena, uint32_t size);
+    inline static thread_local ChunkArena* threadArena = nullptr; // Set by ArenaScope.
     std::byte* allocateFromLargePool(uint64_t size, uint32_t memoryGroupNo);
     void freeInLargePool(std::byte* ptr);
 
@@ -498,6 +523,9 @@ inline CPU_RAM_4MB* राम::getNewChunkForTab(uint32_t memoryGroupNo) {
 
 //A simple bump allocator for small objects within 4MB chunks.
 inline std::byte* राम::allocateFromSmallPool(uint32_t size, uint32_t memoryGroupNo) {
+    if (threadArena && threadArena->memoryGroupNo == memoryGroupNo) {
+        return allocateFromArena(*threadArena, size);
+    }
     CPU_RAM_4MB* currentChunk = nullptr;
     /* Fast Path: First, we get a pointer to the current chunk for this tab.
     This read operation needs to be protected by the global lock to prevent race conditions
@@ -536,6 +564,19 @@ inline std::byte* राम::allocateFromSmallPool(uint32_t size, uint32_t memor
     return ptr;
 }
 
+// Only the arena's own thread allocates from its chunk, so the chunk mutex is never contended;
+// the global mutex is taken once per 4 MB, to acquire the next chunk.
+inline std::byte* राम::allocateFromArena(ChunkArena& arena, uint32_t size) {
+    if (arena.chunk) {
+        std::byte* ptr = arena.chunk->Allocate(size);
+        if (ptr) return ptr;
+    }
+    std::lock_guard<std::mutex> lock(globalMemoryAllocationMutex);
+    arena.chunk = getNewChunkForTab(arena.memoryGroupNo);
+    if (!arena.chunk) return nullptr;
+    return arena.chunk->Allocate(size);
+}
+
 //Allocator for large objects, directly commits memory.
 inline std::byte* राम::allocateFromLargePool(uint64_t size, uint32_t memoryGroupNo) {
     std::lock_guard<std::mutex> lock(globalMemoryAllocationMutex);
@@ -0,0 +1,74 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <cmath>
+
+/* Vertex positions and normals of the primitives generated about a single center with fixed axes:
+SPHERE, TORUS and ELLIPSOID. Their GetGeometry() (डेटा-सामान्य-3D.h) emits exactly these, adding
+the color, packed normals and indices.
+
+It is these three whose Properties Pane center is a PropertyEditEffect::Placement field: every
+vertex is center + an offset that does not depend on the center, so moving the center is a pure
+translation and a transform-only MODIFY draws what regenerating would. Kept free of Windows and
+DirectX - any V3 with x/y/z and a 3-float constructor - so validations/PlacementEditTest.cpp can
+check that claim against the real tessellation.
+
+emit(position, normal) is called once per vertex, in GetGeometry's vertex order. */
+
+// Stacks from the +Y pole (phi = 0) to the -Y pole, slices around Y; no separate pole vertices.
+template <typename V3, typename Emit>
+void SphereSurface(const V3& center, float radius, int sliceCount, int stackCount, Emit&& emit) {
+    for (int i = 0; i <= stackCount; ++i) {
+        const float phi = 3.141592654f * i / stackCount; // 0 -> PI
+        const float sinPhi = sinf(phi);
+        const float cosPhi = cosf(phi);
+        for (int j = 0; j < sliceCount; ++j) {
+            const float theta = 6.283185307f * j / sliceCount; // 0 -> 2PI
+            const V3 position(center.x + radius * sinPhi * cosf(theta), center.y + radius * cosPhi,
+                center.z + radius * sinPhi * sinf(theta));
+            // Smooth shading: the normal is the direction from the center.
+            const float dx = position.x - center.x, dy = position.y - center.y, dz = position.z - center.z;
+            const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+            emit(position, V3(dx / length, dy / length, dz / length));
+        }
+    }
+}
+
+// The ring lies in the XZ plane around Y; majorSegments around the ring, minorSegments around the tube.
+template <typename V3, typename Emit>
+void TorusSurface(const V3& center, float majorRadius, float minorRadius, int majorSegments, int minorSegments,
+    Emit&& emit) {
+    for (int i = 0; i < majorSegments; ++i) {
+        const float theta = 6.283185307f * i / majorSegments;
+        const float cosTheta = cosf(theta);
+        const float sinTheta = sinf(theta);
+        for (int j = 0; j < minorSegments; ++j) {
+            const float phi = 6.283185307f * j / minorSegments;
+            const float cosPhi = cosf(phi);
+            const float sinPhi = sinf(phi);
+            const float ringRadius = majorRadius + minorRadius * cosPhi;
+            emit(V3(center.x + ringRadius * cosTheta, center.y + minorRadius * sinPhi, center.z + ringRadius * sinTheta),
+                V3(cosTheta * cosPhi, sinPhi, sinTheta * cosPhi));
+        }
+    }
+}
+
+// SphereSurface's layout with a radius per axis; the normal is the (unnormalized) gradient.
+template <typename V3, typename Emit>
+void EllipsoidSurface(const V3& center, float radiusX, float radiusY, float radiusZ, int sliceCount, int stackCount,
+    Emit&& emit) {
+    for (int i = 0; i <= stackCount; ++i) {
+        const float phi = 3.141592654f * i / stackCount;
+        const float sinPhi = sinf(phi);
+        const float cosPhi = cosf(phi);
+        for (int j = 0; j < sliceCount; ++j) {
+            const float theta = 6.283185307f * j / sliceCount;
+            const float cosTheta = cosf(theta);
+            const float sinTheta = sinf(theta);
+            const V3 position(center.x + radiusX * sinPhi * cosTheta, center.y + radiusY * cosPhi,
+                center.z + radiusZ * sinPhi * sinTheta);
+            emit(position, V3((position.x - center.x) / (radiusX * radiusX), (position.y - center.y) / (radiusY * radiusY),
+                (position.z - center.z) / (radiusZ * radiusZ)));
+        }
+    }
+}
@@ -52,6 +52,8 @@ DATASETTAB* ActiveTabForPrint() {
 // the underlying buffers alive even if the copy thread republishes/retires the snapshot
 // while our print command list is still executing on our private queue.
 struct Print2DPage {
+    double originXCU = 0.0; // Precision tile origin (Cad2DPageGPU).
+    double originYCU = 0.0;
     ComPtr<ID3D12Resource> lineBuffer;
     ComPtr<ID3D12Resource> lineIndirectBuffer;
     uint32_t lineCount = 0;
@@ -81,6 +83,8 @@ std::vector<Print2DPage> Collect2DPages(TabCad2DStorage& storage, uint64_t conta
     for (Cad2DPageGPU* page : snapshot->pages) {
         if (!page || page->containerMemoryId != containerMemoryId) continue;
         Print2DPage copy;
+        copy.originXCU = page->originXCU;
+        copy.originYCU = page->originYCU;
         copy.lineBuffer = page->lineBuffer;
         copy.lineIndirectBuffer = page->lineIndirectBuffer;
         copy.lineCount = page->lineCount;
@@ -134,10 +138,8 @@ void Record2DDraws(ID3D12GraphicsCommandList* cmd, DATASETTAB& tab, uint64_t con
     const Cad2DViewState& view = tab.viewports[slot >= 0 ? slot : 0].page2DView;
 
     Cad2DViewConstants constants{};
-    constants.viewCenterCU = {
-        static_cast<float>(view.centerXCU.load(std::memory_order_acquire)),
-        static_cast<float>(view.centerYCU.load(std::memory_order_acquire))
-    };
+    const double viewCenterXCU = view.centerXCU.load(std::memory_order_acquire);
+    const double viewCenterYCU = view.centerYCU.load(std::memory_order_acquire);
 
     // Print exactly the region currently visible on screen: scale the on-screen zoom so
     // the same horizontal CU extent fills the printed page width at print DPI.
@@ -158,6 +160,13 @@ void Record2DDraws(ID3D12GraphicsCommandList* cmd, DATASETTAB& tab, uint64_t con
     constants.minLineWeightPx = (std::max)(1.0f, static_cast<float>(kPrintDPI) / 96.0f);
     memcpy(pViewConstantData, &constants, sizeof(constants));
 
+    auto SetTileConstants = [&](const Print2DPage& page, UINT rootParameter) {
+        const Cad2DTileConstants tile =
+            Cad2DMakeTileConstants(page.originXCU, page.originYCU, viewCenterXCU, viewCenterYCU);
+        cmd->SetGraphicsRoot32BitConstants(rootParameter, sizeof(Cad2DTileConstants) / sizeof(uint32_t),
+            &tile, 0);
+        };
+
     if (storage.dx.lineRootSignature && storage.dx.linePSO && storage.dx.lineCommandSignature) {
         cmd->SetGraphicsRootSignature(storage.dx.lineRootSignature.Get());
         cmd->SetPipelineState(storage.dx.linePSO.Get());
@@ -166,6 +175,7 @@ void Record2DDraws(ID3D12GraphicsCommandList* cmd, DATASETTAB& tab, uint64_t con
 
         for (const Print2DPage& page : pages) {
             if (page.lineCount == 0 || !page.lineBuffer || !page.lineIndirectBuffer) continue;
+            SetTileConstants(page, kCad2DRecordTileRootParameter);
             cmd->SetGraphicsRootShaderResourceView(1, page.lineBuffer->GetGPUVirtualAddress());
             cmd->ExecuteIndirect(storage.dx.lineCommandSignature.Get(), 1,
                 page.lineIndirectBuffer.Get(), 0, nullptr, 0);
@@ -180,6 +190,7 @@ void Record2DDraws(ID3D12GraphicsCommandList* cmd, DATASETTAB& tab, uint64_t con
 
         for (const Print2DPage& page : pages) {
             if (page.curveCount == 0 || !page.curveBuffer || !page.curveIndirectBuffer) continue;
+            SetTileConstants(page, kCad2DRecordTileRootParameter);
             cmd->SetGraphicsRootShaderResourceView(1, page.curveBuffer->GetGPUVirtualAddress());
             cmd->ExecuteIndirect(storage.dx.curveCommandSignature.Get(), 1,
                 page.curveIndirectBuffer.Get(), 0, nullptr, 0);
@@ -214,6 +225,7 @@ void Record2DDraws(ID3D12GraphicsCommandList* cmd, DATASETTAB& tab, uint64_t con
         ibv.SizeInBytes = page.textIndexCount * sizeof(uint32_t);
         ibv.Format = DXGI_FORMAT_R32_UINT;
 
+        SetTileConstants(page, kCad2DTextTileRootParameter);
         cmd->IASetVertexBuffers(0, 1, &vbv);
         cmd->IASetIndexBuffer(&ibv);
         cmd->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -0,0 +1,89 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "EngineeringParallelFor.h"
+
+/* How a committed property edit reaches the model and the copy thread, for one object
+(ModifyObjectProperty) and for every selected object of one type (ModifySelectedObjectsProperty).
+Both forms live here, side by side, so the batched one cannot drift from committing the same edit
+to each object one at a time. No Windows, DirectX or model types: `Edit` brings them, and
+validations/PropertyEditCommitTest.cpp runs both forms over stand-in objects and compares.
+
+Edit provides, for its Object and Geometry types:
+  bool Validate(Object*)              the authoritative gate, against the object's own live values;
+  bool Store(Object*, Geometry&)      writes the field and bumps dataVersion (store mutex held);
+                                      true = placement-only edit, Geometry then holds the transform;
+  bool Regenerate(Object*, Geometry&) the full re-mesh, no lock held; false drops the MODIFY.
+                                      Called concurrently for different objects by the batched form;
+  void Emit(Object*, Geometry&&)      queues the MODIFY (queue mutex held).
+Every step reads and writes only its own object, which is what makes the two forms equivalent.
+The two mutexes are taken strictly one after the other, never nested. */
+
+// One object: validate, store, regenerate unless placement-only, emit. Returns whether it emitted.
+template <typename Geometry, typename Object, typename Edit>
+bool CommitPropertyEdit(Object* object, Edit& edit, std::mutex& storeMutex, std::mutex& queueMutex) {
+    if (!edit.Validate(object)) return false;
+    Geometry geometry{};
+    bool placementOnly = false;
+    {
+        // Held only for the store: the render thread takes it every frame.
+        std::lock_guard<std::mutex> lock(storeMutex);
+        placementOnly = edit.Store(object, geometry);
+    }
+    if (!placementOnly && !edit.Regenerate(object, geometry)) return false;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        edit.Emit(object, std::move(geometry));
+    }
+    return true;
+}
+
+/* The same edit on every candidate, in candidate order. Done one at a time that is N cycles, each
+with its own pair of lock round trips. Here:
+  1. every candidate is validated with no lock held, and rejected ones are skipped;
+  2. the accepted values are stored under ONE storeMutex acquisition;
+  3. shape edits regenerate on `regeneration`;
+  4. every MODIFY goes out under ONE queueMutex acquisition, in candidate order.
+Returns the number of objects that emitted, as the one-at-a-time loop would count them. */
+template <typename Geometry, typename Object, typename Edit>
+size_t CommitPropertyEditBatch(const std::vector<Object*>& candidates, Edit& edit, std::mutex& storeMutex,
+    std::mutex& queueMutex, EngineeringParallelFor& regeneration) {
+    std::vector<Object*> targets;
+    targets.reserve(candidates.size());
+    for (Object* object : candidates) {
+        if (edit.Validate(object)) targets.push_back(object);
+    }
+    if (targets.empty()) return 0;
+
+    std::vector<Geometry> geometry(targets.size());
+    std::vector<uint8_t> placementOnly(targets.size(), 0);
+    {
+        std::lock_guard<std::mutex> lock(storeMutex);
+        for (size_t i = 0; i < targets.size(); ++i) {
+            placementOnly[i] = edit.Store(targets[i], geometry[i]) ? 1 : 0;
+        }
+    }
+
+    std::vector<uint8_t> generated(targets.size(), 1);
+    regeneration.Run(targets.size(), [&](size_t i) {
+        if (placementOnly[i]) return;
+        generated[i] = edit.Regenerate(targets[i], geometry[i]) ? 1 : 0;
+    });
+
+    size_t emitted = 0;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        for (size_t i = 0; i < targets.size(); ++i) {
+            if (!generated[i]) continue;
+            edit.Emit(targets[i], std::move(geometry[i]));
+            ++emitted;
+        }
+    }
+    return emitted;
+}
@@ -21,14 +21,18 @@ namespace {
 // Each accessor is a captureless lambda that decays to a function pointer: portable, no casts at
 // the call site, and type-checked at compile time.
 
-// SPHERE: Center X/Y/Z, Radius.
+// SPHERE: Center X/Y/Z, Radius. The single-point types (SPHERE, TORUS, ELLIPSOID) mark their center
+// as a Placement edit: moving it translates the whole object without changing its shape.
 const PropertyFieldDescriptor kSphereFields[] = {
     { UITextID::PropCenterX, [](const META_DATA* o) { return static_cast<const SPHERE*>(o)->center.x; },
-        [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->center.x = v; }, PropertyFieldKind::Float32, 0, false },
+        [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->center.x = v; }, PropertyFieldKind::Float32, 0, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropCenterY, [](const META_DATA* o) { return static_cast<const SPHERE*>(o)->center.y; },
-        [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->center.y = v; }, PropertyFieldKind::Float32, 1, false },
+        [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->center.y = v; }, PropertyFieldKind::Float32, 1, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropCenterZ, [](const META_DATA* o) { return static_cast<const SPHERE*>(o)->center.z; },
-        [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->center.z = v; }, PropertyFieldKind::Float32, 2, false },
+        [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->center.z = v; }, PropertyFieldKind::Float32, 2, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropRadius, [](const META_DATA* o) { return static_cast<const SPHERE*>(o)->radius; },
         [](META_DATA* o, float v) { static_cast<SPHERE*>(o)->radius = v; }, PropertyFieldKind::Float32, 3, true },
 };
@@ -72,11 +76,14 @@ const PropertyFieldDescriptor kConeFields[] = {
 // TORUS: Center X/Y/Z, Major Radius, Minor Radius.
 const PropertyFieldDescriptor kTorusFields[] = {
     { UITextID::PropCenterX, [](const META_DATA* o) { return static_cast<const TORUS*>(o)->center.x; },
-        [](META_DATA* o, float v) { static_cast<TORUS*>(o)->center.x = v; }, PropertyFieldKind::Float32, 0, false },
+        [](META_DATA* o, float v) { static_cast<TORUS*>(o)->center.x = v; }, PropertyFieldKind::Float32, 0, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropCenterY, [](const META_DATA* o) { return static_cast<const TORUS*>(o)->center.y; },
-        [](META_DATA* o, float v) { static_cast<TORUS*>(o)->center.y = v; }, PropertyFieldKind::Float32, 1, false },
+        [](META_DATA* o, float v) { static_cast<TORUS*>(o)->center.y = v; }, PropertyFieldKind::Float32, 1, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropCenterZ, [](const META_DATA* o) { return static_cast<const TORUS*>(o)->center.z; },
-        [](META_DATA* o, float v) { static_cast<TORUS*>(o)->center.z = v; }, PropertyFieldKind::Float32, 2, false },
+        [](META_DATA* o, float v) { static_cast<TORUS*>(o)->center.z = v; }, PropertyFieldKind::Float32, 2, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropMajorRadius, [](const META_DATA* o) { return static_cast<const TORUS*>(o)->majorRadius; },
         [](META_DATA* o, float v) { static_cast<TORUS*>(o)->majorRadius = v; }, PropertyFieldKind::Float32, 3, true },
     { UITextID::PropMinorRadius, [](const META_DATA* o) { return static_cast<const TORUS*>(o)->minorRadius; },
@@ -86,11 +93,14 @@ const PropertyFieldDescriptor kTorusFields[] = {
 // ELLIPSOID: Center X/Y/Z, Radius X/Y/Z.
 const PropertyFieldDescriptor kEllipsoidFields[] = {
     { UITextID::PropCenterX, [](const META_DATA* o) { return static_cast<const ELLIPSOID*>(o)->center.x; },
-        [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->center.x = v; }, PropertyFieldKind::Float32, 0, false },
+        [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->center.x = v; }, PropertyFieldKind::Float32, 0, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropCenterY, [](const META_DATA* o) { return static_cast<const ELLIPSOID*>(o)->center.y; },
-        [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->center.y = v; }, PropertyFieldKind::Float32, 1, false },
+        [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->center.y = v; }, PropertyFieldKind::Float32, 1, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropCenterZ, [](const META_DATA* o) { return static_cast<const ELLIPSOID*>(o)->center.z; },
-        [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->center.z = v; }, PropertyFieldKind::Float32, 2, false },
+        [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->center.z = v; }, PropertyFieldKind::Float32, 2, false,
+        PropertyEditEffect::Placement },
     { UITextID::PropRadiusX, [](const META_DATA* o) { return static_cast<const ELLIPSOID*>(o)->radiusX; },
         [](META_DATA* o, float v) { static_cast<ELLIPSOID*>(o)->radiusX = v; }, PropertyFieldKind::Float32, 3, true },
     { UITextID::PropRadiusY, [](const META_DATA* o) { return static_cast<const ELLIPSOID*>(o)->radiusY; },
@@ -300,3 +310,21 @@ void ApplyPropertyValueFromDisplay(const PropertyTypeDescriptor& table, META_DAT
     table.fields[b + 1].set(object, authored.y);
     table.fields[b + 2].set(object, authored.z);
 }
+
+bool ApplyPlacementValueFromDisplay(const PropertyTypeDescriptor& table, META_DATA* object,
+    uint8_t fieldIndex, float newValue) {
+    if (!object || fieldIndex >= table.fieldCount) return false;
+    if (table.fields[fieldIndex].effect != PropertyEditEffect::Placement) return false;
+    Placement3D* placement = PlacementForObject(table.objectType, object);
+    const uint8_t group = PointGroupOfField(table, fieldIndex);
+    if (!placement || group == kNoPointGroup) return false;
+
+    const uint8_t b = table.pointGroupFirstField[group];
+    DirectX::XMFLOAT3 world;
+    DirectX::XMStoreFloat3(&world, placement->TransformPoint(DirectX::XMVectorSet(
+        table.fields[b].get(object), table.fields[b + 1].get(object),
+        table.fields[b + 2].get(object), 1.0f)));
+    placement->origin = PlacementOriginForWorldValue(placement->origin, world,
+        static_cast<uint8_t>(fieldIndex - b), newValue);
+    return true;
+}
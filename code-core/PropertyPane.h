@@ -19,6 +19,12 @@ struct META_DATA; // Accessors take the base pointer; concrete down-casts live i
 
 enum class PropertyFieldKind : uint8_t { Float32 /*, Float64, Int, Text, Derived... future*/ };
 
+// What committing a field does to the mesh. Shape edits regenerate it. Placement edits only move the
+// object rigidly - a SPHERE's center, not a CYLINDER's end point, which also turns or stretches the
+// axis - so they go through the object's Placement3D and a transform-only MODIFY, and the mesh
+// already on the GPU is reused as is.
+enum class PropertyEditEffect : uint8_t { Shape, Placement };
+
 struct PropertyFieldDescriptor {
     UITextID  labelStringID;         // e.g. UITextID::PropRadius, UITextID::PropCenterX
     float (*get)(const META_DATA*);  // typed accessor; reads the raw stored field
@@ -26,6 +32,7 @@ struct PropertyFieldDescriptor {
     PropertyFieldKind kind;          // MVP: Float32 only
     uint8_t   fieldIndex;            // Stable per-type index, used in the edit protocol.
     bool      mustBePositive;        // MVP validation hint (radii, diameters).
+    PropertyEditEffect effect = PropertyEditEffect::Shape;
 };
 
 // No 3D type needs more than two point triples today (an axis has two ends). Fixed slots rather
@@ -87,3 +94,21 @@ void ReadPropertyValuesForDisplay(const PropertyTypeDescriptor& table, const MET
     float* out);
 void ApplyPropertyValueFromDisplay(const PropertyTypeDescriptor& table, META_DATA* object,
     uint8_t fieldIndex, float newValue);
+
+/* The Placement counterpart of the above: for a PropertyEditEffect::Placement field, shifts the
+object's placement origin along the edited WORLD axis so the point reads newValue, leaving the
+authored fields (and so the mesh) untouched. Returns false - having changed nothing - for a Shape
+field or a type without a placement; the caller then falls back to ApplyPropertyValueFromDisplay. */
+bool ApplyPlacementValueFromDisplay(const PropertyTypeDescriptor& table, META_DATA* object,
+    uint8_t fieldIndex, float newValue);
+
+// Its arithmetic, on plain values (any V3 with x/y/z) so validations/PlacementEditTest.cpp runs it:
+// the origin that makes a point now displayed at `world` read newValue on `axis`. The rotation is
+// unchanged, so moving the origin by the world delta moves every vertex by it.
+template <typename V3>
+V3 PlacementOriginForWorldValue(V3 origin, const V3& world, uint8_t axis, float newValue) {
+    if (axis == 0) origin.x += newValue - world.x;
+    else if (axis == 1) origin.y += newValue - world.y;
+    else origin.z += newValue - world.z;
+    return origin;
+}
@@ -38,15 +38,9 @@ struct Cad2DContainerRecords {
     std::vector<Cad2DEllipseRecordCPU> ellipses;
     std::vector<Cad2DArcRecordCPU> arcs;
     std::vector<Cad2DTextRecordCPU> texts;
+    std::vector<Cad2DAssetInstance> assetInstances; // Reference inserts drawn on this page.
 };
 
-constexpr uint32_t kMinPolygonLineSegmentCount = 3;
-constexpr uint32_t kMaxPolygonLineSegmentCount = 16;
-constexpr double kDegreesToRadians = 3.14159265358979323846 / 180.0;
-constexpr uint32_t kCurveTypeCircle = 0;
-constexpr uint32_t kCurveTypeEllipse = 1;
-constexpr uint32_t kCurveTypeArc = 2;
-
 uint32_t TopUIHeightPx(int monitorId, const DX12ResourcesPerWindow& winRes) {
     if (winRes.contentOnly) return 0; // Extracted view windows render content edge to edge.
     int topUITotalHeightPx = 0;
@@ -103,115 +97,6 @@ every batch - which is precisely the per-object staging allocation the ring exis
 replacement lives inside ProcessCad2DCopyBatch as ring-backed lambdas, because it needs to be able
 to FLUSH the recording when the ring fills, and only that function owns the command list. */
 
-Cad2DLineGPURecord ToGpuLineRecord(const Cad2DLineRecordCPU& line) {
-    Cad2DLineGPURecord gpuLine{};
-    gpuLine.x1 = static_cast<float>(line.x1);
-    gpuLine.y1 = static_cast<float>(line.y1);
-    gpuLine.x2 = static_cast<float>(line.x2);
-    gpuLine.y2 = static_cast<float>(line.y2);
-    gpuLine.lineWeight = line.lineWeight;
-    gpuLine.lineWeightMode = static_cast<uint32_t>(line.lineWeightMode);
-    gpuLine.colorABGR = line.colorABGR;
-    return gpuLine;
-}
-
-void AppendPolylineLineRecords(const Cad2DPolylineRecordCPU& polyline,
-    std::vector<Cad2DLineGPURecord>& gpuLines) {
-    if (polyline.points.size() < 2) return;
-
-    for (size_t i = 1; i < polyline.points.size(); ++i) {
-        Cad2DLineGPURecord gpuLine{};
-        gpuLine.x1 = static_cast<float>(polyline.points[i - 1].x);
-        gpuLine.y1 = static_cast<float>(polyline.points[i - 1].y);
-        gpuLine.x2 = static_cast<float>(polyline.points[i].x);
-        gpuLine.y2 = static_cast<float>(polyline.points[i].y);
-        gpuLine.lineWeight = polyline.lineWeight;
-        gpuLine.lineWeightMode = static_cast<uint32_t>(polyline.lineWeightMode);
-        gpuLine.colorABGR = polyline.colorABGR;
-        gpuLines.push_back(gpuLine);
-    }
-}
-
-uint32_t ClampedPolygonLineSegmentCount(uint32_t lineSegmentCount) {
-    return std::clamp(lineSegmentCount, kMinPolygonLineSegmentCount, kMaxPolygonLineSegmentCount);
-}
-
-void AppendPolygonLineRecords(const Cad2DPolygonRecordCPU& polygon,
-    std::vector<Cad2DLineGPURecord>& gpuLines) {
-    if (polygon.radius <= 0.0) return;
-
-    const uint32_t lineSegmentCount = ClampedPolygonLineSegmentCount(polygon.lineSegmentCount);
-    const double angleStep = 360.0 / static_cast<double>(lineSegmentCount);
-    for (uint32_t i = 0; i < lineSegmentCount; ++i) {
-        const double angle0 = (polygon.rotationDegrees + angleStep * static_cast<double>(i)) * kDegreesToRadians;
-        const double angle1 = (polygon.rotationDegrees + angleStep * static_cast<double>((i + 1) % lineSegmentCount)) *
-            kDegreesToRadians;
-
-        Cad2DLineGPURecord gpuLine{};
-        gpuLine.x1 = static_cast<float>(polygon.centerX + std::sin(angle0) * polygon.radius);
-        gpuLine.y1 = static_cast<float>(polygon.centerY + std::cos(angle0) * polygon.radius);
-        gpuLine.x2 = static_cast<float>(polygon.centerX + std::sin(angle1) * polygon.radius);
-        gpuLine.y2 = static_cast<float>(polygon.centerY + std::cos(angle1) * polygon.radius);
-        gpuLine.lineWeight = polygon.lineWeight;
-        gpuLine.lineWeightMode = static_cast<uint32_t>(polygon.lineWeightMode);
-        gpuLine.colorABGR = polygon.colorABGR;
-        gpuLines.push_back(gpuLine);
-    }
-}
-
-Cad2DCurveGPURecord ToGpuCircleRecord(const Cad2DCircleRecordCPU& circle) {
-    Cad2DCurveGPURecord gpuCurve{};
-    gpuCurve.centerX = static_cast<float>(circle.centerX);
-    gpuCurve.centerY = static_cast<float>(circle.centerY);
-    gpuCurve.radiusX = static_cast<float>(circle.radius);
-    gpuCurve.radiusY = static_cast<float>(circle.radius);
-    gpuCurve.startX = gpuCurve.centerX + gpuCurve.radiusX;
-    gpuCurve.startY = gpuCurve.centerY;
-    gpuCurve.endX = gpuCurve.startX;
-    gpuCurve.endY = gpuCurve.startY;
-    gpuCurve.lineWeight = circle.lineWeight;
-    gpuCurve.lineWeightMode = static_cast<uint32_t>(circle.lineWeightMode);
-    gpuCurve.colorABGR = circle.colorABGR;
-    gpuCurve.curveType = kCurveTypeCircle;
-    return gpuCurve;
-}
-
-Cad2DCurveGPURecord ToGpuEllipseRecord(const Cad2DEllipseRecordCPU& ellipse) {
-    Cad2DCurveGPURecord gpuCurve{};
-    gpuCurve.centerX = static_cast<float>(ellipse.centerX);
-    gpuCurve.centerY = static_cast<float>(ellipse.centerY);
-    gpuCurve.radiusX = static_cast<float>(ellipse.radiusX);
-    gpuCurve.radiusY = static_cast<float>(ellipse.radiusY);
-    gpuCurve.startX = gpuCurve.centerX + gpuCurve.radiusX;
-    gpuCurve.startY = gpuCurve.centerY;
-    gpuCurve.endX = gpuCurve.startX;
-    gpuCurve.endY = gpuCurve.startY;
-    gpuCurve.lineWeight = ellipse.lineWeight;
-    gpuCurve.lineWeightMode = static_cast<uint32_t>(ellipse.lineWeightMode);
-    gpuCurve.colorABGR = ellipse.colorABGR;
-    gpuCurve.curveType = kCurveTypeEllipse;
-    gpuCurve.rotationRadians = static_cast<float>(ellipse.rotationRadians);
-    return gpuCurve;
-}
-
-Cad2DCurveGPURecord ToGpuArcRecord(const Cad2DArcRecordCPU& arc) {
-    Cad2DCurveGPURecord gpuCurve{};
-    gpuCurve.centerX = static_cast<float>(arc.centerX);
-    gpuCurve.centerY = static_cast<float>(arc.centerY);
-    gpuCurve.radiusX = static_cast<float>(arc.radiusX);
-    gpuCurve.radiusY = static_cast<float>(arc.radiusY);
-    gpuCurve.startX = static_cast<float>(arc.startX);
-    gpuCurve.startY = static_cast<float>(arc.startY);
-    gpuCurve.endX = static_cast<float>(arc.endX);
-    gpuCurve.endY = static_cast<float>(arc.endY);
-    gpuCurve.lineWeight = arc.lineWeight;
-    gpuCurve.lineWeightMode = static_cast<uint32_t>(arc.lineWeightMode);
-    gpuCurve.colorABGR = arc.colorABGR;
-    gpuCurve.curveType = kCurveTypeArc;
-    gpuCurve.rotationRadians = static_cast<float>(arc.rotationRadians);
-    return gpuCurve;
-}
-
 struct PendingGlyphQuad {
     float x0 = 0.0f;
     float y0 = 0.0f;
@@ -224,7 +109,7 @@ struct PendingGlyphQuad {
     uint32_t colorABGR = 0xFF000000u;
 };
 
-void AppendTextRecordGeometry(const Cad2DTextRecordCPU& text,
+void AppendTextRecordGeometry(const Cad2DTextRecordCPU& text, double originX, double originY,
     std::vector<Cad2DTextVertex>& vertices, std::vector<uint32_t>& indices) {
     if (text.text.empty() || text.textHeightCU <= 0.0f || text.font != 0) return;
 
@@ -304,15 +189,15 @@ void AppendTextRecordGeometry(const Cad2DTextRecordCPU& text,
 
     const float cosA = std::cos(text.rotationRadians);
     const float sinA = std::sin(text.rotationRadians);
-    const float originX = static_cast<float>(text.x) + text.xOffsetCU;
-    const float originY = static_cast<float>(text.y) + text.yOffsetCU;
+    const float anchorX = static_cast<float>(text.x - originX) + text.xOffsetCU;
+    const float anchorY = static_cast<float>(text.y - originY) + text.yOffsetCU;
 
     auto transformPoint = [&](float localX, float localY) -> DirectX::XMFLOAT2 {
         localX += alignX;
         localY += alignY;
         return {
-            originX + localX * cosA - localY * sinA,
-            originY + localX * sinA + localY * cosA
+            anchorX + localX * cosA - localY * sinA,
+            anchorY + localX * sinA + localY * cosA
         };
     };
 
@@ -337,6 +222,16 @@ void AppendTextRecordGeometry(const Cad2DTextRecordCPU& text,
     }
 }
 
+// Float records of one precision tile while ProcessCad2DCopyBatch builds a container's pages.
+struct Cad2DTileBuild {
+    double originX = 0.0;
+    double originY = 0.0;
+    std::vector<Cad2DLineGPURecord> lines;
+    std::vector<Cad2DCurveGPURecord> curves;
+    std::vector<Cad2DTextVertex> textVertices;
+    std::vector<uint32_t> textIndices;
+};
+
 void PublishCad2DPages(TabCad2DStorage& storage, std::vector<std::unique_ptr<Cad2DPageGPU>> pages) {
     const uint64_t retireFence = gpu.renderFenceValue.load(std::memory_order_acquire);
 
@@ -361,11 +256,13 @@ void InitCad2DTabResources(TabCad2DStorage& storage) {
     if (storage.dx.lineRootSignature && storage.dx.curveRootSignature && storage.dx.textRootSignature) return;
 
     {
-        CD3DX12_ROOT_PARAMETER1 rootParams[2] = {};
+        CD3DX12_ROOT_PARAMETER1 rootParams[3] = {};
         rootParams[0].InitAsConstantBufferView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE,
             D3D12_SHADER_VISIBILITY_ALL);
         rootParams[1].InitAsShaderResourceView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE,
             D3D12_SHADER_VISIBILITY_VERTEX);
+        rootParams[kCad2DRecordTileRootParameter].InitAsConstants(
+            sizeof(Cad2DTileConstants) / sizeof(uint32_t), 1, 0, D3D12_SHADER_VISIBILITY_VERTEX);
 
         CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootDesc;
         rootDesc.Init_1_1(_countof(rootParams), rootParams, 0, nullptr,
@@ -413,11 +310,13 @@ void InitCad2DTabResources(TabCad2DStorage& storage) {
     }
 
     {
-        CD3DX12_ROOT_PARAMETER1 rootParams[2] = {};
+        CD3DX12_ROOT_PARAMETER1 rootParams[3] = {};
         rootParams[0].InitAsConstantBufferView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE,
             D3D12_SHADER_VISIBILITY_ALL);
         rootParams[1].InitAsShaderResourceView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE,
             D3D12_SHADER_VISIBILITY_VERTEX);
+        rootParams[kCad2DRecordTileRootParameter].InitAsConstants(
+            sizeof(Cad2DTileConstants) / sizeof(uint32_t), 1, 0, D3D12_SHADER_VISIBILITY_VERTEX);
 
         CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootDesc;
         rootDesc.Init_1_1(_countof(rootParams), rootParams, 0, nullptr,
@@ -471,11 +370,13 @@ void InitCad2DTabResources(TabCad2DStorage& storage) {
         ranges[1].Init(D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, 1, 0, 0,
             D3D12_DESCRIPTOR_RANGE_FLAG_NONE);
 
-        CD3DX12_ROOT_PARAMETER1 rootParams[3] = {};
+        CD3DX12_ROOT_PARAMETER1 rootParams[4] = {};
         rootParams[0].InitAsConstantBufferView(0, 0, D3D12_ROOT_DESCRIPTOR_FLAG_NONE,
             D3D12_SHADER_VISIBILITY_VERTEX);
         rootParams[1].InitAsDescriptorTable(1, &ranges[0], D3D12_SHADER_VISIBILITY_PIXEL);
         rootParams[2].InitAsDescriptorTable(1, &ranges[1], D3D12_SHADER_VISIBILITY_PIXEL);
+        rootParams[kCad2DTextTileRootParameter].InitAsConstants(
+            sizeof(Cad2DTileConstants) / sizeof(uint32_t), 1, 0, D3D12_SHADER_VISIBILITY_VERTEX);
 
         CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootDesc;
         rootDesc.Init_1_1(_countof(rootParams), rootParams, 0, nullptr,
@@ -529,6 +430,7 @@ void CleanupCad2DTabResources(TabCad2DStorage& storage) {
     storage.retiredSnapshots.clear();
     storage.retiredPages.clear();
     storage.activePages.clear();
+    storage.assetDefinitionGpuCache.clear();
 
     storage.dx.lineCommandSignature.Reset();
     storage.dx.linePSO.Reset();
@@ -627,10 +529,8 @@ void RenderPage2D(ID3D12GraphicsCommandList* commandList, DX12ResourcesPerWindow
     commandList->ClearRenderTargetView(rttHandle, cadBackground, 0, nullptr);
 
     Cad2DViewConstants constants{}; // `view` is the Viewport's pan/zoom, handed in by the compositor.
-    constants.viewCenterCU = {
-        static_cast<float>(view.centerXCU.load(std::memory_order_acquire)),
-        static_cast<float>(view.centerYCU.load(std::memory_order_acquire))
-    };
+    const double viewCenterXCU = view.centerXCU.load(std::memory_order_acquire);
+    const double viewCenterYCU = view.centerYCU.load(std::memory_order_acquire);
     constants.zoomPixelsPerCU =
         (std::max)(view.zoomPixelsPerCU.load(std::memory_order_acquire),
             kCad2DZoomMinPixelsPerCU);
@@ -653,9 +553,18 @@ void RenderPage2D(ID3D12GraphicsCommandList* commandList, DX12ResourcesPerWindow
     commandList->SetGraphicsRootConstantBufferView(0, viewCBV);
     commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
+    // Each page is one precision tile: its offset to the view center is rebased here, in double.
+    auto SetTileConstants = [&](const Cad2DPageGPU& page, UINT rootParameter) {
+        const Cad2DTileConstants tile =
+            Cad2DMakeTileConstants(page.originXCU, page.originYCU, viewCenterXCU, viewCenterYCU);
+        commandList->SetGraphicsRoot32BitConstants(rootParameter,
+            sizeof(Cad2DTileConstants) / sizeof(uint32_t), &tile, 0);
+        };
+
     for (Cad2DPageGPU* page : snapshot->pages) {
         if (!page || page->containerMemoryId != activeContainerMemoryId) continue;
         if (page->lineCount > 0 && page->lineBuffer && page->lineIndirectBuffer) {
+            SetTileConstants(*page, kCad2DRecordTileRootParameter);
             commandList->SetGraphicsRootShaderResourceView(1, page->lineBuffer->GetGPUVirtualAddress());
             commandList->ExecuteIndirect(storage.dx.lineCommandSignature.Get(), 1,
                 page->lineIndirectBuffer.Get(), 0, nullptr, 0);
@@ -671,6 +580,7 @@ void RenderPage2D(ID3D12GraphicsCommandList* commandList, DX12ResourcesPerWindow
         for (Cad2DPageGPU* page : snapshot->pages) {
             if (!page || page->containerMemoryId != activeContainerMemoryId) continue;
             if (page->curveCount > 0 && page->curveBuffer && page->curveIndirectBuffer) {
+                SetTileConstants(*page, kCad2DRecordTileRootParameter);
                 commandList->SetGraphicsRootShaderResourceView(1, page->curveBuffer->GetGPUVirtualAddress());
                 commandList->ExecuteIndirect(storage.dx.curveCommandSignature.Get(), 1,
                     page->curveIndirectBuffer.Get(), 0, nullptr, 0);
@@ -710,6 +620,7 @@ void RenderPage2D(ID3D12GraphicsCommandList* commandList, DX12ResourcesPerWindow
         ibv.SizeInBytes = page->textIndexCount * sizeof(uint32_t);
         ibv.Format = DXGI_FORMAT_R32_UINT;
 
+        SetTileConstants(*page, kCad2DTextTileRootParameter);
         commandList->IASetVertexBuffers(0, 1, &vbv);
         commandList->IASetIndexBuffer(&ibv);
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -813,6 +724,8 @@ void ProcessCad2DCopyBatch(const std::vector<CommandToCopyThread2D>& batch,
         std::vector<Cad2DEllipseRecordCPU> ellipses;
         std::vector<Cad2DArcRecordCPU> arcs;
         std::vector<Cad2DTextRecordCPU> texts;
+        std::vector<Cad2DAssetDefinitionRecordCPU> assetDefinitions;
+        std::vector<Cad2DAssetInsertRecordCPU> assetInserts;
         {
             std::lock_guard<std::mutex> lock(storage.cpuRecordsMutex);
             // objectId -> record index per type: a batch of K commands costs O(records + K)
@@ -886,7 +799,8 @@ void ProcessCad2DCopyBatch(const std::vector<CommandToCopyThread2D>& batch,
                     ReportCad2DIngestStatsLocked(storage, command.containerMemoryId); break;
 #endif
                 default:
-                    break; // SelectionRefresh: no geometry; its presence alone forces the rebuild below.
+                    break; // SelectionRefresh / AssetInstancesChanged: no geometry; their presence
+                           // alone forces the rebuild below.
                 }
             }
             lines = storage.lineRecords;
@@ -896,6 +810,8 @@ void ProcessCad2DCopyBatch(const std::vector<CommandToCopyThread2D>& batch,
             ellipses = storage.ellipseRecords;
             arcs = storage.arcRecords;
             texts = storage.textRecords;
+            assetDefinitions = storage.assetDefinitionRecords;
+            assetInserts = storage.assetInsertRecords;
         }
 
         std::unordered_set<uint64_t> selected2D; // Objects to stamp with kCad2DSelectedFlag.
@@ -927,6 +843,16 @@ void ProcessCad2DCopyBatch(const std::vector<CommandToCopyThread2D>& batch,
             if (text.containerMemoryId != 0) containers[text.containerMemoryId].texts.push_back(text);
         }
 
+        // Reference inserts: each definition is converted once (cached across batches), then every
+        // instance is a transformed copy of those records - no per-insert member records exist.
+        Cad2DRefreshAssetDefinitionCache(storage.assetDefinitionGpuCache, assetDefinitions, lines, polylines,
+            polygons, circles, ellipses, arcs, texts);
+        std::vector<Cad2DAssetInstance> assetInstances;
+        Cad2DExpandAssetInstances(assetDefinitions, assetInserts, 0, assetInstances);
+        for (const Cad2DAssetInstance& instance : assetInstances) {
+            containers[instance.containerMemoryId].assetInstances.push_back(instance);
+        }
+
         /* Staging for this tab's rebuild (graphics.md, 10M plan Step 0). The allocator and list are
         the copy thread's, handed in rather than created per batch, and every byte goes through the
         one global ring instead of a committed UPLOAD resource per vector.
@@ -1016,10 +942,6 @@ void ProcessCad2DCopyBatch(const std::vector<CommandToCopyThread2D>& batch,
             };
 
         for (const auto& [containerMemoryId, records] : containers) {
-            auto page = std::make_unique<Cad2DPageGPU>();
-            page->containerMemoryId = containerMemoryId;
-
-            std::vector<Cad2DLineGPURecord> gpuLines;
             size_t polylineSegmentCount = 0;
             for (const Cad2DPolylineRecordCPU& polyline : records.polylines) {
                 if (polyline.points.size() >= 2) polylineSegmentCount += polyline.points.size() - 1;
@@ -1027,91 +949,166 @@ void ProcessCad2DCopyBatch(const std::vector<CommandToCopyThread2D>& batch,
             size_t polygonSegmentCount = 0;
             for (const Cad2DPolygonRecordCPU& polygon : records.polygons) {
                 if (polygon.radius > 0.0) {
-                    polygonSegmentCount += ClampedPolygonLineSegmentCount(polygon.lineSegmentCount);
+                    polygonSegmentCount += Cad2DClampedPolygonLineSegmentCount(polygon.lineSegmentCount);
                 }
             }
-            gpuLines.reserve(records.lines.size() + polylineSegmentCount + polygonSegmentCount);
-            // Stamp kCad2DSelectedFlag on the GPU records belonging to selected objects (all the
-            // segments an object expands into), so the 2D vertex shaders draw them in deep blue.
-            auto stampSelected = [&](size_t firstIndex, uint64_t objectId) {
-                if (selected2D.find(objectId) == selected2D.end()) return;
-                for (size_t i = firstIndex; i < gpuLines.size(); ++i) gpuLines[i].flags |= kCad2DSelectedFlag;
-            };
+            size_t instancedLineCount = 0;
+            size_t instancedCurveCount = 0;
+            for (const Cad2DAssetInstance& instance : records.assetInstances) {
+                auto cached = storage.assetDefinitionGpuCache.find(instance.definitionObjectId);
+                if (cached == storage.assetDefinitionGpuCache.end()) continue;
+                instancedLineCount += cached->second.lines.size();
+                instancedCurveCount += cached->second.curves.size();
+            }
+
+            // Bucket every record into a precision tile (RenderPage2D.h). Most drawings fit one
+            // tile, so the first tile reserves the container totals up front.
+            // Consecutive records and the pieces of one cut segment mostly share a tile, so the
+            // last one is remembered (std::map entries never move).
+            std::map<std::pair<int64_t, int64_t>, Cad2DTileBuild> tiles;
+            std::pair<int64_t, int64_t> lastKey;
+            Cad2DTileBuild* lastTile = nullptr;
+            auto tileAt = [&](double anchorX, double anchorY) -> Cad2DTileBuild& {
+                const std::pair<int64_t, int64_t> key{
+                    Cad2DPrecisionTileIndex(anchorX), Cad2DPrecisionTileIndex(anchorY) };
+                if (lastTile && key == lastKey) return *lastTile;
+                auto [it, inserted] = tiles.try_emplace(key);
+                if (inserted) {
+                    it->second.originX = Cad2DPrecisionTileOrigin(key.first);
+                    it->second.originY = Cad2DPrecisionTileOrigin(key.second);
+                    if (tiles.size() == 1) {
+                        it->second.lines.reserve(records.lines.size() + polylineSegmentCount +
+                            polygonSegmentCount + instancedLineCount);
+                        it->second.curves.reserve(records.circles.size() + records.ellipses.size() +
+                            records.arcs.size() + instancedCurveCount);
+                    }
+                }
+                lastKey = key;
+                lastTile = &it->second;
+                return it->second;
+                };
+
+            // Line work goes segment by segment. A segment that crosses tile edges is cut at each
+            // one, so every piece is rebased on the tile it lies in; one crossing more than
+            // kCad2DMaxSegmentTileCrossings edges goes whole to the tile of its midpoint. Selected
+            // objects stamp kCad2DSelectedFlag on every piece, so the 2D vertex shaders draw them
+            // in deep blue.
+            std::vector<double> segmentCuts;
+            auto addSegment = [&](const auto& record, bool selected, double x1, double y1, double x2, double y2) {
+                auto addPiece = [&](double ax, double ay, double bx, double by) {
+                    Cad2DTileBuild& tile = tileAt((ax + bx) * 0.5, (ay + by) * 0.5);
+                    tile.lines.push_back(Cad2DToGpuLineSegment(record, ax, ay, bx, by, tile.originX, tile.originY));
+                    if (selected) tile.lines.back().flags |= kCad2DSelectedFlag;
+                    };
+                Cad2DCutSegmentAtTileEdges(x1, y1, x2, y2, segmentCuts, addPiece);
+                };
             for (const Cad2DLineRecordCPU& line : records.lines) {
-                const size_t before = gpuLines.size();
-                gpuLines.push_back(ToGpuLineRecord(line));
-                stampSelected(before, line.objectId);
+                addSegment(line, selected2D.count(line.objectId) != 0, line.x1, line.y1, line.x2, line.y2);
             }
             for (const Cad2DPolylineRecordCPU& polyline : records.polylines) {
-                const size_t before = gpuLines.size();
-                AppendPolylineLineRecords(polyline, gpuLines);
-                stampSelected(before, polyline.objectId);
+                const bool selected = selected2D.count(polyline.objectId) != 0;
+                Cad2DForEachPolylineSegment(polyline, [&](double x1, double y1, double x2, double y2) {
+                    addSegment(polyline, selected, x1, y1, x2, y2);
+                    });
             }
             for (const Cad2DPolygonRecordCPU& polygon : records.polygons) {
-                const size_t before = gpuLines.size();
-                AppendPolygonLineRecords(polygon, gpuLines);
-                stampSelected(before, polygon.objectId);
-            }
-            UploadVector(page->lineBuffer, gpuLines);
-            page->lineCount = static_cast<uint32_t>(gpuLines.size());
-
-            if (!gpuLines.empty()) {
-                std::vector<D3D12_DRAW_ARGUMENTS> drawArgs(1);
-                drawArgs[0].VertexCountPerInstance = 6;
-                drawArgs[0].InstanceCount = page->lineCount;
-                drawArgs[0].StartVertexLocation = 0;
-                drawArgs[0].StartInstanceLocation = 0;
-                UploadVector(page->lineIndirectBuffer, drawArgs);
+                const bool selected = selected2D.count(polygon.objectId) != 0;
+                Cad2DForEachPolygonSegment(polygon, [&](double x1, double y1, double x2, double y2) {
+                    addSegment(polygon, selected, x1, y1, x2, y2);
+                    });
             }
 
-            std::vector<Cad2DCurveGPURecord> gpuCurves;
-            gpuCurves.reserve(records.circles.size() + records.ellipses.size() + records.arcs.size());
-            auto stampCurveSelected = [&](uint64_t objectId) {
-                if (selected2D.find(objectId) != selected2D.end() && !gpuCurves.empty()) {
-                    gpuCurves.back().flags |= kCad2DSelectedFlag;
-                }
-            };
+            // A curve record is drawn from its center, so that is where it is bucketed.
+            auto addCurve = [&](double centerX, double centerY, uint64_t objectId, auto&& toGpu) {
+                Cad2DTileBuild& tile = tileAt(centerX, centerY);
+                tile.curves.push_back(toGpu(tile.originX, tile.originY));
+                if (selected2D.find(objectId) != selected2D.end()) tile.curves.back().flags |= kCad2DSelectedFlag;
+                };
             for (const Cad2DCircleRecordCPU& circle : records.circles) {
-                if (circle.radius > 0.0) {
-                    gpuCurves.push_back(ToGpuCircleRecord(circle));
-                    stampCurveSelected(circle.objectId);
-                }
+                if (circle.radius <= 0.0) continue;
+                addCurve(circle.centerX, circle.centerY, circle.objectId,
+                    [&](double ox, double oy) { return Cad2DToGpuCircleRecord(circle, ox, oy); });
             }
             for (const Cad2DEllipseRecordCPU& ellipse : records.ellipses) {
-                if (ellipse.radiusX > 0.0 && ellipse.radiusY > 0.0) {
-                    gpuCurves.push_back(ToGpuEllipseRecord(ellipse));
-                    stampCurveSelected(ellipse.objectId);
-                }
+                if (ellipse.radiusX <= 0.0 || ellipse.radiusY <= 0.0) continue;
+                addCurve(ellipse.centerX, ellipse.centerY, ellipse.objectId,
+                    [&](double ox, double oy) { return Cad2DToGpuEllipseRecord(ellipse, ox, oy); });
             }
             for (const Cad2DArcRecordCPU& arc : records.arcs) {
-                if (arc.radiusX > 0.0 && arc.radiusY > 0.0) {
-                    gpuCurves.push_back(ToGpuArcRecord(arc));
-                    stampCurveSelected(arc.objectId);
-                }
-            }
-            UploadVector(page->curveBuffer, gpuCurves);
-            page->curveCount = static_cast<uint32_t>(gpuCurves.size());
-
-            if (!gpuCurves.empty()) {
-                std::vector<D3D12_DRAW_ARGUMENTS> drawArgs(1);
-                drawArgs[0].VertexCountPerInstance = 6;
-                drawArgs[0].InstanceCount = page->curveCount;
-                drawArgs[0].StartVertexLocation = 0;
-                drawArgs[0].StartInstanceLocation = 0;
-                UploadVector(page->curveIndirectBuffer, drawArgs);
+                if (arc.radiusX <= 0.0 || arc.radiusY <= 0.0) continue;
+                addCurve(arc.centerX, arc.centerY, arc.objectId,
+                    [&](double ox, double oy) { return Cad2DToGpuArcRecord(arc, ox, oy); });
             }
 
-            std::vector<Cad2DTextVertex> textVertices;
-            std::vector<uint32_t> textIndices;
             for (const Cad2DTextRecordCPU& text : records.texts) {
-                AppendTextRecordGeometry(text, textVertices, textIndices);
+                Cad2DTileBuild& tile = tileAt(text.x, text.y);
+                AppendTextRecordGeometry(text, tile.originX, tile.originY, tile.textVertices, tile.textIndices);
+            }
+
+            // An instance lands in the tile of its insert point. Rebasing the transform there keeps
+            // the whole master-to-tile map in double; only the final tile-local result is narrowed.
+            // A selected insert stamps every record of every definition it expands into.
+            for (const Cad2DAssetInstance& instance : records.assetInstances) {
+                auto cached = storage.assetDefinitionGpuCache.find(instance.definitionObjectId);
+                if (cached == storage.assetDefinitionGpuCache.end()) continue;
+                Cad2DTileBuild& tile = tileAt(instance.transform.tx, instance.transform.ty);
+                Cad2DAffine2D tileTransform = instance.transform;
+                tileTransform.tx -= tile.originX;
+                tileTransform.ty -= tile.originY;
+                const uint32_t flags =
+                    selected2D.find(instance.rootInsertObjectId) != selected2D.end() ? kCad2DSelectedFlag : 0u;
+                for (Cad2DLineGPURecord gpuLine : cached->second.lines) {
+                    Cad2DTransformLineGPURecord(gpuLine, tileTransform);
+                    gpuLine.flags |= flags;
+                    tile.lines.push_back(gpuLine);
+                }
+                for (Cad2DCurveGPURecord gpuCurve : cached->second.curves) {
+                    Cad2DTransformCurveGPURecord(gpuCurve, tileTransform);
+                    gpuCurve.flags |= flags;
+                    tile.curves.push_back(gpuCurve);
+                }
+                for (Cad2DTextRecordCPU text : cached->second.texts) {
+                    Cad2DTransformTextRecord(text, tileTransform);
+                    AppendTextRecordGeometry(text, 0.0, 0.0, tile.textVertices, tile.textIndices);
+                }
             }
-            UploadVector(page->textVertexBuffer, textVertices);
-            UploadVector(page->textIndexBuffer, textIndices);
-            page->textVertexCount = static_cast<uint32_t>(textVertices.size());
-            page->textIndexCount = static_cast<uint32_t>(textIndices.size());
 
-            pages.push_back(std::move(page));
+            for (auto& [tileKey, tile] : tiles) {
+                if (tile.lines.empty() && tile.curves.empty() && tile.textIndices.empty()) continue;
+                auto page = std::make_unique<Cad2DPageGPU>();
+                page->containerMemoryId = containerMemoryId;
+                page->originXCU = tile.originX;
+                page->originYCU = tile.originY;
+
+                UploadVector(page->lineBuffer, tile.lines);
+                page->lineCount = static_cast<uint32_t>(tile.lines.size());
+                if (!tile.lines.empty()) {
+                    std::vector<D3D12_DRAW_ARGUMENTS> drawArgs(1);
+                    drawArgs[0].VertexCountPerInstance = 6;
+                    drawArgs[0].InstanceCount = page->lineCount;
+                    drawArgs[0].StartVertexLocation = 0;
+                    drawArgs[0].StartInstanceLocation = 0;
+                    UploadVector(page->lineIndirectBuffer, drawArgs);
+                }
+
+                UploadVector(page->curveBuffer, tile.curves);
+                page->curveCount = static_cast<uint32_t>(tile.curves.size());
+                if (!tile.curves.empty()) {
+                    std::vector<D3D12_DRAW_ARGUMENTS> drawArgs(1);
+                    drawArgs[0].VertexCountPerInstance = 6;
+                    drawArgs[0].InstanceCount = page->curveCount;
+                    drawArgs[0].StartVertexLocation = 0;
+                    drawArgs[0].StartInstanceLocation = 0;
+                    UploadVector(page->curveIndirectBuffer, drawArgs);
+                }
+
+                UploadVector(page->textVertexBuffer, tile.textVertices);
+                UploadVector(page->textIndexBuffer, tile.textIndices);
+                page->textVertexCount = static_cast<uint32_t>(tile.textVertices.size());
+                page->textIndexCount = static_cast<uint32_t>(tile.textIndices.size());
+
+                pages.push_back(std::move(page));
+            }
         }
 
         // Final submit for this tab. Leaves the list CLOSED, which is what the Scene3D batch
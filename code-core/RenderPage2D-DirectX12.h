@@ -12,6 +12,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -23,8 +24,12 @@ struct DX12ResourcesUI;
 
 using Microsoft::WRL::ComPtr;
 
+// One precision tile of one container: a container spanning several tiles publishes several pages.
+// Every float coordinate in the buffers below is relative to (originXCU, originYCU).
 struct Cad2DPageGPU {
     uint64_t containerMemoryId = 0;
+    double originXCU = 0.0;
+    double originYCU = 0.0;
 
     ComPtr<ID3D12Resource> lineBuffer;
     ComPtr<ID3D12Resource> lineIndirectBuffer;
@@ -40,6 +45,11 @@ struct Cad2DPageGPU {
     uint32_t textIndexCount = 0;
 };
 
+// Root parameter slot of the Cad2DTileConstants (b1) in the line / curve and the text root
+// signatures. Shared with PrinterController, which records its own draws against them.
+constexpr UINT kCad2DRecordTileRootParameter = 2;
+constexpr UINT kCad2DTextTileRootParameter = 3;
+
 struct Cad2DPageSnapshot {
     std::vector<Cad2DPageGPU*> pages;
 };
@@ -87,6 +97,10 @@ struct TabCad2DStorage {
     std::vector<Cad2DAssetDefinitionRecordCPU> assetDefinitionRecords;
     std::vector<Cad2DAssetInsertRecordCPU> assetInsertRecords;
 
+    // Copy thread only: definition id -> master geometry converted to GPU records, re-built when
+    // the definition's revision (or base point) moves. Every reference insert draws from here.
+    std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU> assetDefinitionGpuCache;
+
     std::atomic<Cad2DPageSnapshot*> activeSnapshot{ nullptr };
     std::vector<std::unique_ptr<Cad2DPageGPU>> activePages;
 
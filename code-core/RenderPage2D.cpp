@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <random>
+#include <unordered_map>
 #include <utility>
 
 #include "CommonNamedNumbers.h"
@@ -12,6 +14,7 @@
 
 #include "विश्वकर्मा.h"
 #include "ID.h"
+#include "Cad2DSelectionTransform.h"
 
 namespace {
 std::mutex gCad2DCopyQueueMutex;
@@ -23,10 +26,8 @@ constexpr double kMinCurveRadiusCU = 1.0e-9;
 constexpr float kDefaultTextHeightCU = 9.0f;
 
 StoredLogicalObject* FindLogicalObjectByIdLocked(DATASETTAB& tab, uint64_t memoryId) {
-    for (StoredLogicalObject& entry : tab.storageLogicalObjects) {
-        if (entry.object && entry.object->memoryID == memoryId) return &entry;
-    }
-    return nullptr;
+    StoredLogicalObject* entry = FindStoredLogicalObject(tab, memoryId);
+    return entry && entry->object ? entry : nullptr;
 }
 
 void ClearLineCreationState(TabCad2DStorage& storage) {
@@ -410,7 +411,10 @@ bool HandleTextCreationChar(DATASETTAB& tab, int charCode) {
 }
 }
 
-void EnqueueCad2DLine(uint64_t tabID, uint64_t containerMemoryId, Cad2DLineRecordCPU line) {
+namespace {
+// The copy-thread command that adds one record (or replaces it: same objectId). A record without an
+// id gets a fresh memory id here, so new objects are numbered in enqueue order.
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId, Cad2DLineRecordCPU line) {
     if (line.objectId == 0) line.objectId = MemoryID::next();
     line.containerMemoryId = containerMemoryId;
 #ifdef _DEBUG
@@ -429,15 +433,11 @@ void EnqueueCad2DLine(uint64_t tabID, uint64_t containerMemoryId, Cad2DLineRecor
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.line = line;
-
-    {
-        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
-        gCad2DCopyQueue.push(std::move(command));
-    }
-    toCopyThreadCV.notify_one();
+    return command;
 }
 
-void EnqueueCad2DPolyline(uint64_t tabID, uint64_t containerMemoryId, Cad2DPolylineRecordCPU polyline) {
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId,
+    Cad2DPolylineRecordCPU polyline) {
     if (polyline.objectId == 0) polyline.objectId = MemoryID::next();
     polyline.containerMemoryId = containerMemoryId;
 
@@ -447,15 +447,11 @@ void EnqueueCad2DPolyline(uint64_t tabID, uint64_t containerMemoryId, Cad2DPolyl
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.polyline = std::move(polyline);
-
-    {
-        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
-        gCad2DCopyQueue.push(std::move(command));
-    }
-    toCopyThreadCV.notify_one();
+    return command;
 }
 
-void EnqueueCad2DPolygon(uint64_t tabID, uint64_t containerMemoryId, Cad2DPolygonRecordCPU polygon) {
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId,
+    Cad2DPolygonRecordCPU polygon) {
     if (polygon.objectId == 0) polygon.objectId = MemoryID::next();
     polygon.containerMemoryId = containerMemoryId;
 
@@ -465,15 +461,11 @@ void EnqueueCad2DPolygon(uint64_t tabID, uint64_t containerMemoryId, Cad2DPolygo
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.polygon = polygon;
-
-    {
-        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
-        gCad2DCopyQueue.push(std::move(command));
-    }
-    toCopyThreadCV.notify_one();
+    return command;
 }
 
-void EnqueueCad2DCircle(uint64_t tabID, uint64_t containerMemoryId, Cad2DCircleRecordCPU circle) {
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId,
+    Cad2DCircleRecordCPU circle) {
     if (circle.objectId == 0) circle.objectId = MemoryID::next();
     circle.containerMemoryId = containerMemoryId;
 
@@ -483,15 +475,11 @@ void EnqueueCad2DCircle(uint64_t tabID, uint64_t containerMemoryId, Cad2DCircleR
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.circle = circle;
-
-    {
-        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
-        gCad2DCopyQueue.push(std::move(command));
-    }
-    toCopyThreadCV.notify_one();
+    return command;
 }
 
-void EnqueueCad2DEllipse(uint64_t tabID, uint64_t containerMemoryId, Cad2DEllipseRecordCPU ellipse) {
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId,
+    Cad2DEllipseRecordCPU ellipse) {
     if (ellipse.objectId == 0) ellipse.objectId = MemoryID::next();
     ellipse.containerMemoryId = containerMemoryId;
 
@@ -501,15 +489,10 @@ void EnqueueCad2DEllipse(uint64_t tabID, uint64_t containerMemoryId, Cad2DEllips
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.ellipse = ellipse;
-
-    {
-        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
-        gCad2DCopyQueue.push(std::move(command));
-    }
-    toCopyThreadCV.notify_one();
+    return command;
 }
 
-void EnqueueCad2DArc(uint64_t tabID, uint64_t containerMemoryId, Cad2DArcRecordCPU arc) {
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId, Cad2DArcRecordCPU arc) {
     if (arc.objectId == 0) arc.objectId = MemoryID::next();
     arc.containerMemoryId = containerMemoryId;
 
@@ -519,15 +502,10 @@ void EnqueueCad2DArc(uint64_t tabID, uint64_t containerMemoryId, Cad2DArcRecordC
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.arc = arc;
-
-    {
-        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
-        gCad2DCopyQueue.push(std::move(command));
-    }
-    toCopyThreadCV.notify_one();
+    return command;
 }
 
-void EnqueueCad2DText(uint64_t tabID, uint64_t containerMemoryId, Cad2DTextRecordCPU text) {
+CommandToCopyThread2D MakeCad2DAddCommand(uint64_t tabID, uint64_t containerMemoryId, Cad2DTextRecordCPU text) {
     if (text.objectId == 0) text.objectId = MemoryID::next();
     text.containerMemoryId = containerMemoryId;
 
@@ -537,7 +515,10 @@ void EnqueueCad2DText(uint64_t tabID, uint64_t containerMemoryId, Cad2DTextRecor
     command.tabID = tabID;
     command.containerMemoryId = containerMemoryId;
     command.text = std::move(text);
+    return command;
+}
 
+void PushCad2DCopyCommand(CommandToCopyThread2D command) {
     {
         std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
         gCad2DCopyQueue.push(std::move(command));
@@ -545,6 +526,52 @@ void EnqueueCad2DText(uint64_t tabID, uint64_t containerMemoryId, Cad2DTextRecor
     toCopyThreadCV.notify_one();
 }
 
+// Bulk form of the EnqueueCad2D* adders: every record of every vector, vectors in argument order,
+// under one queue lock and one wake-up. The copy thread sees exactly the sequence the per-record
+// calls would have produced, and new ids are handed out in that same order.
+template <typename... RecordVectors>
+void PushCad2DAddCommands(uint64_t tabID, uint64_t containerMemoryId, RecordVectors&... recordVectors) {
+    {
+        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
+        auto pushAll = [&](auto& records) {
+            for (auto& record : records) {
+                gCad2DCopyQueue.push(MakeCad2DAddCommand(tabID, containerMemoryId, std::move(record)));
+            }
+        };
+        (pushAll(recordVectors), ...);
+    }
+    toCopyThreadCV.notify_one();
+}
+}
+
+void EnqueueCad2DLine(uint64_t tabID, uint64_t containerMemoryId, Cad2DLineRecordCPU line) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, std::move(line)));
+}
+
+void EnqueueCad2DPolyline(uint64_t tabID, uint64_t containerMemoryId, Cad2DPolylineRecordCPU polyline) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, std::move(polyline)));
+}
+
+void EnqueueCad2DPolygon(uint64_t tabID, uint64_t containerMemoryId, Cad2DPolygonRecordCPU polygon) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, polygon));
+}
+
+void EnqueueCad2DCircle(uint64_t tabID, uint64_t containerMemoryId, Cad2DCircleRecordCPU circle) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, circle));
+}
+
+void EnqueueCad2DEllipse(uint64_t tabID, uint64_t containerMemoryId, Cad2DEllipseRecordCPU ellipse) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, ellipse));
+}
+
+void EnqueueCad2DArc(uint64_t tabID, uint64_t containerMemoryId, Cad2DArcRecordCPU arc) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, arc));
+}
+
+void EnqueueCad2DText(uint64_t tabID, uint64_t containerMemoryId, Cad2DTextRecordCPU text) {
+    PushCad2DCopyCommand(MakeCad2DAddCommand(tabID, containerMemoryId, std::move(text)));
+}
+
 void EnqueueCad2DSelectionRefresh(uint64_t tabID, uint64_t containerMemoryId) {
     // A no-op command: it carries no geometry, but its presence forces the copy thread to rebuild
     // and republish this tab's pages, re-applying selection flags into the GPU records.
@@ -575,6 +602,21 @@ void EnqueueCad2DIngestStatsReport(uint64_t tabID, uint64_t containerMemoryId) {
     toCopyThreadCV.notify_one();
 }
 
+void EnqueueCad2DAssetInstancesChanged(uint64_t tabID, uint64_t containerMemoryId) {
+    // Like SelectionRefresh: no geometry, the rebuild re-expands every reference insert of the tab
+    // (and re-converts definitions whose revision moved). containerMemoryId 0 is fine here.
+    CommandToCopyThread2D command{};
+    command.type = CommandToCopyThread2DType::AssetInstancesChanged;
+    command.tabID = tabID;
+    command.containerMemoryId = containerMemoryId;
+
+    {
+        std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
+        gCad2DCopyQueue.push(std::move(command));
+    }
+    toCopyThreadCV.notify_one();
+}
+
 bool HasPendingCad2DCopyCommands() {
     std::lock_guard<std::mutex> lock(gCad2DCopyQueueMutex);
     return !gCad2DCopyQueue.empty();
@@ -708,6 +750,107 @@ static uint32_t GenerateUniqueAssetNumberLocked(TabCad2DStorage& s) {
     return assetNumber;
 }
 
+// --- Asset masters: grouping and bounds shared by create / hit-test / zoom ------------------------
+namespace {
+// Master records of one asset definition plus their bounds in the master frame. Pointers are valid
+// only while the caller holds cpuRecordsMutex.
+struct Cad2DAssetMasters {
+    double baseX = 0.0, baseY = 0.0;
+    bool hasBounds = false;
+    double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+    std::vector<const Cad2DLineRecordCPU*> lines;
+    std::vector<const Cad2DPolylineRecordCPU*> polylines;
+    std::vector<const Cad2DPolygonRecordCPU*> polygons;
+    std::vector<const Cad2DCircleRecordCPU*> circles;
+    std::vector<const Cad2DEllipseRecordCPU*> ellipses;
+    std::vector<const Cad2DArcRecordCPU*> arcs;
+    std::vector<const Cad2DTextRecordCPU*> texts;
+};
+
+// Axis-aligned bounds of one record, fed point by point to include(x, y).
+template <typename Include> void IncludeRecordBounds(const Cad2DLineRecordCPU& r, Include&& include) {
+    include(r.x1, r.y1); include(r.x2, r.y2);
+}
+template <typename Include> void IncludeRecordBounds(const Cad2DPolylineRecordCPU& r, Include&& include) {
+    for (const Cad2DPoint2D& p : r.points) include(p.x, p.y);
+}
+template <typename Include> void IncludeRecordBounds(const Cad2DPolygonRecordCPU& r, Include&& include) {
+    include(r.centerX - r.radius, r.centerY - r.radius);
+    include(r.centerX + r.radius, r.centerY + r.radius);
+}
+template <typename Include> void IncludeRecordBounds(const Cad2DCircleRecordCPU& r, Include&& include) {
+    include(r.centerX - r.radius, r.centerY - r.radius);
+    include(r.centerX + r.radius, r.centerY + r.radius);
+}
+template <typename Include> void IncludeRecordBounds(const Cad2DEllipseRecordCPU& r, Include&& include) {
+    // Axis-aligned bounding half-extents of the rotated ellipse.
+    const double c = std::cos(r.rotationRadians), sn = std::sin(r.rotationRadians);
+    const double hx = std::sqrt(r.radiusX * c * r.radiusX * c + r.radiusY * sn * r.radiusY * sn);
+    const double hy = std::sqrt(r.radiusX * sn * r.radiusX * sn + r.radiusY * c * r.radiusY * c);
+    include(r.centerX - hx, r.centerY - hy);
+    include(r.centerX + hx, r.centerY + hy);
+}
+template <typename Include> void IncludeRecordBounds(const Cad2DArcRecordCPU& r, Include&& include) {
+    const double radius = (std::max)(std::abs(r.radiusX), std::abs(r.radiusY));
+    include(r.centerX - radius, r.centerY - radius); // Full-ellipse box; conservative for partial arcs.
+    include(r.centerX + radius, r.centerY + radius);
+}
+template <typename Include> void IncludeRecordBounds(const Cad2DTextRecordCPU& r, Include&& include) {
+    include(r.x, r.y); include(r.x, r.y + (double)r.textHeightCU);
+}
+
+// Caller must hold s.cpuRecordsMutex. One pass over the records, so a per-click / per-zoom call
+// costs O(records) no matter how many instances reference each definition.
+std::unordered_map<uint64_t, Cad2DAssetMasters> GatherAssetMastersLocked(const TabCad2DStorage& s) {
+    std::unordered_map<uint64_t, Cad2DAssetMasters> masters;
+    for (const Cad2DAssetDefinitionRecordCPU& d : s.assetDefinitionRecords) {
+        if (d.isDeleted) continue;
+        Cad2DAssetMasters& m = masters[d.objectId];
+        m.baseX = d.baseX;
+        m.baseY = d.baseY;
+    }
+    auto gather = [&](const auto& records, auto member) {
+        for (const auto& r : records) {
+            if (r.isDeleted || r.containerMemoryId != 0 || r.parentObjectId == 0) continue;
+            auto it = masters.find(r.parentObjectId);
+            if (it == masters.end()) continue;
+            Cad2DAssetMasters& m = it->second;
+            (m.*member).push_back(&r);
+            IncludeRecordBounds(r, [&](double x, double y) {
+                if (!m.hasBounds) { m.minX = m.maxX = x; m.minY = m.maxY = y; m.hasBounds = true; return; }
+                m.minX = (std::min)(m.minX, x); m.maxX = (std::max)(m.maxX, x);
+                m.minY = (std::min)(m.minY, y); m.maxY = (std::max)(m.maxY, y);
+            });
+        }
+    };
+    gather(s.lineRecords, &Cad2DAssetMasters::lines);
+    gather(s.polylineRecords, &Cad2DAssetMasters::polylines);
+    gather(s.polygonRecords, &Cad2DAssetMasters::polygons);
+    gather(s.circleRecords, &Cad2DAssetMasters::circles);
+    gather(s.ellipseRecords, &Cad2DAssetMasters::ellipses);
+    gather(s.arcRecords, &Cad2DAssetMasters::arcs);
+    gather(s.textRecords, &Cad2DAssetMasters::texts);
+    return masters;
+}
+
+// Page-space bounds of one instance: the definition's master box, mapped corner by corner.
+template <typename Include>
+void IncludeAssetInstanceBounds(const Cad2DAssetInstance& instance,
+    const std::unordered_map<uint64_t, Cad2DAssetMasters>& masters, Include&& include) {
+    auto it = masters.find(instance.definitionObjectId);
+    if (it == masters.end() || !it->second.hasBounds) return;
+    const Cad2DAssetMasters& m = it->second;
+    const double xs[2] = { m.minX - m.baseX, m.maxX - m.baseX };
+    const double ys[2] = { m.minY - m.baseY, m.maxY - m.baseY };
+    for (double x : xs) {
+        for (double y : ys) {
+            const Cad2DPoint2D p = instance.transform.Map(x, y);
+            include(p.x, p.y);
+        }
+    }
+}
+}
+
 void Cad2DCreateAssetFromSelection(DATASETTAB& tab) {
     if (!tab.cad2d || !Cad2DIsActivePage2D(tab)) return;
     TabCad2DStorage& s = *tab.cad2d;
@@ -721,103 +864,157 @@ void Cad2DCreateAssetFromSelection(DATASETTAB& tab) {
     }
     if (selected.empty()) return;
 
-    std::lock_guard<std::mutex> lock(s.cpuRecordsMutex);
-
-    auto wanted = [&](const auto& r) {
-        return !r.isDeleted && r.containerMemoryId == container && selected.count(r.objectId) != 0;
-    };
+    uint64_t firstInsertId = 0;
+    {
+        std::lock_guard<std::mutex> lock(s.cpuRecordsMutex);
 
-    // Bounding box of the selected objects; its middle becomes the asset insert base point.
-    double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
-    bool hasBounds = false;
-    auto include = [&](double x, double y) {
-        if (!hasBounds) { minX = maxX = x; minY = maxY = y; hasBounds = true; return; }
-        minX = (std::min)(minX, x); maxX = (std::max)(maxX, x);
-        minY = (std::min)(minY, y); maxY = (std::max)(maxY, y);
-    };
-    for (const Cad2DLineRecordCPU& r : s.lineRecords) {
-        if (!wanted(r)) continue;
-        include(r.x1, r.y1); include(r.x2, r.y2);
-    }
-    for (const Cad2DPolylineRecordCPU& r : s.polylineRecords) {
-        if (!wanted(r)) continue;
-        for (const Cad2DPoint2D& p : r.points) include(p.x, p.y);
-    }
-    for (const Cad2DPolygonRecordCPU& r : s.polygonRecords) {
-        if (!wanted(r)) continue;
-        include(r.centerX - r.radius, r.centerY - r.radius);
-        include(r.centerX + r.radius, r.centerY + r.radius);
-    }
-    for (const Cad2DCircleRecordCPU& r : s.circleRecords) {
-        if (!wanted(r)) continue;
-        include(r.centerX - r.radius, r.centerY - r.radius);
-        include(r.centerX + r.radius, r.centerY + r.radius);
-    }
-    for (const Cad2DEllipseRecordCPU& r : s.ellipseRecords) {
-        if (!wanted(r)) continue;
-        const double c = std::cos(r.rotationRadians), sn = std::sin(r.rotationRadians);
-        const double hx = std::sqrt(r.radiusX * c * r.radiusX * c + r.radiusY * sn * r.radiusY * sn);
-        const double hy = std::sqrt(r.radiusX * sn * r.radiusX * sn + r.radiusY * c * r.radiusY * c);
-        include(r.centerX - hx, r.centerY - hy);
-        include(r.centerX + hx, r.centerY + hy);
-    }
-    for (const Cad2DArcRecordCPU& r : s.arcRecords) {
-        if (!wanted(r)) continue;
-        const double radius = (std::max)(std::abs(r.radiusX), std::abs(r.radiusY));
-        include(r.centerX - radius, r.centerY - radius); // Full-ellipse box; conservative for partial arcs.
-        include(r.centerX + radius, r.centerY + radius);
-    }
-    for (const Cad2DTextRecordCPU& r : s.textRecords) {
-        if (!wanted(r)) continue;
-        include(r.x, r.y); include(r.x, r.y + (double)r.textHeightCU);
-    }
-    if (!hasBounds) return;
+        // Legacy (schema v1/v2) inserts keep baked member records on the page. Any selected member
+        // brings the rest of its instance along, as a click would; those members become masters of
+        // the new definition below, and the emptied insert is soft-deleted in the same step instead
+        // of staying on the page with nothing left to draw.
+        std::unordered_set<uint64_t> legacyInserts;
+        for (const Cad2DAssetInsertRecordCPU& insert : s.assetInsertRecords) {
+            if (!insert.isDeleted && insert.parentObjectId == 0 && insert.containerMemoryId == container &&
+                !Cad2DIsInstancedAssetInsert(insert)) {
+                legacyInserts.insert(insert.objectId);
+            }
+        }
+        if (!legacyInserts.empty()) {
+            std::unordered_set<uint64_t> touched;
+            for (uint64_t insertId : legacyInserts) {
+                if (selected.count(insertId) != 0) touched.insert(insertId);
+            }
+            auto findTouched = [&](const auto& records) {
+                for (const auto& r : records) {
+                    if (!r.isDeleted && r.containerMemoryId == container && selected.count(r.objectId) != 0 &&
+                        legacyInserts.count(r.parentObjectId) != 0) {
+                        touched.insert(r.parentObjectId);
+                    }
+                }
+            };
+            findTouched(s.lineRecords);
+            findTouched(s.polylineRecords);
+            findTouched(s.polygonRecords);
+            findTouched(s.circleRecords);
+            findTouched(s.ellipseRecords);
+            findTouched(s.arcRecords);
+            findTouched(s.textRecords);
+            auto selectMembers = [&](const auto& records) {
+                for (const auto& r : records) {
+                    if (!r.isDeleted && r.containerMemoryId == container && touched.count(r.parentObjectId) != 0) {
+                        selected.insert(r.objectId);
+                    }
+                }
+            };
+            if (!touched.empty()) {
+                selectMembers(s.lineRecords);
+                selectMembers(s.polylineRecords);
+                selectMembers(s.polygonRecords);
+                selectMembers(s.circleRecords);
+                selectMembers(s.ellipseRecords);
+                selectMembers(s.arcRecords);
+                selectMembers(s.textRecords);
+            }
+            legacyInserts = std::move(touched);
+        }
 
-    Cad2DAssetDefinitionRecordCPU definition{};
-    definition.objectId = MemoryID::next();
-    definition.assetNumber = GenerateUniqueAssetNumberLocked(s);
-    definition.baseX = (minX + maxX) * 0.5;
-    definition.baseY = (minY + maxY) * 0.5;
-    definition.schemaVersion = VishwakarmaStorage::kAsset2DDefinitionSchemaVersion;
+        auto wanted = [&](const auto& r) {
+            return !r.isDeleted && r.containerMemoryId == container && selected.count(r.objectId) != 0;
+        };
 
-    // The originals become the first placed instance; drawing stays exactly as it is.
-    Cad2DAssetInsertRecordCPU firstInsert{};
-    firstInsert.objectId = MemoryID::next();
-    firstInsert.containerMemoryId = container;
-    firstInsert.definitionObjectId = definition.objectId;
-    firstInsert.x = definition.baseX;
-    firstInsert.y = definition.baseY;
-    firstInsert.schemaVersion = VishwakarmaStorage::kAsset2DInsertSchemaVersion;
-
-    // Hidden master copies keep the source page coordinates (inserts translate by click - base).
-    // containerMemoryId = 0: no page owns them, so they never render, hit-test or zoom-fit.
-    auto convert = [&](auto& records) {
-        const size_t originalCount = records.size();
-        for (size_t i = 0; i < originalCount; ++i) {
-            if (!wanted(records[i])) continue;
-            auto master = records[i];
-            master.objectId = MemoryID::next();
-            master.persistedId = 0;
-            master.persistedParentId = 0;
-            master.parentObjectId = definition.objectId;
-            master.containerMemoryId = 0;
-            tab.allIDsInThisTab.push_back(master.objectId);
-            records.push_back(std::move(master)); // May reallocate; re-index the original below.
-            records[i].parentObjectId = firstInsert.objectId;
+        // Bounding box of the selected objects; its middle becomes the asset insert base point.
+        double minX = 0.0, minY = 0.0, maxX = 0.0, maxY = 0.0;
+        bool hasBounds = false;
+        auto include = [&](double x, double y) {
+            if (!hasBounds) { minX = maxX = x; minY = maxY = y; hasBounds = true; return; }
+            minX = (std::min)(minX, x); maxX = (std::max)(maxX, x);
+            minY = (std::min)(minY, y); maxY = (std::max)(maxY, y);
+        };
+        auto includeAll = [&](const auto& records) {
+            for (const auto& r : records) {
+                if (wanted(r)) IncludeRecordBounds(r, include);
+            }
+        };
+        includeAll(s.lineRecords);
+        includeAll(s.polylineRecords);
+        includeAll(s.polygonRecords);
+        includeAll(s.circleRecords);
+        includeAll(s.ellipseRecords);
+        includeAll(s.arcRecords);
+        includeAll(s.textRecords);
+
+        // Selected reference inserts are nested into the new definition; they count towards the box.
+        std::vector<Cad2DAssetInstance> instances;
+        Cad2DExpandAssetInstances(s.assetDefinitionRecords, s.assetInsertRecords, container, instances);
+        if (!instances.empty()) {
+            const auto masters = GatherAssetMastersLocked(s);
+            for (const Cad2DAssetInstance& instance : instances) {
+                if (selected.count(instance.rootInsertObjectId) != 0) {
+                    IncludeAssetInstanceBounds(instance, masters, include);
+                }
+            }
+        }
+        if (!hasBounds) return;
+
+        Cad2DAssetDefinitionRecordCPU definition{};
+        definition.objectId = MemoryID::next();
+        definition.assetNumber = GenerateUniqueAssetNumberLocked(s);
+        definition.baseX = (minX + maxX) * 0.5;
+        definition.baseY = (minY + maxY) * 0.5;
+        definition.schemaVersion = VishwakarmaStorage::kAsset2DDefinitionSchemaVersion;
+
+        // The first placed instance sits on the base point with an identity transform, so the
+        // drawing stays exactly as it is.
+        Cad2DAssetInsertRecordCPU firstInsert{};
+        firstInsert.objectId = MemoryID::next();
+        firstInsert.containerMemoryId = container;
+        firstInsert.definitionObjectId = definition.objectId;
+        firstInsert.x = definition.baseX;
+        firstInsert.y = definition.baseY;
+        firstInsert.schemaVersion = VishwakarmaStorage::kAsset2DInsertSchemaVersion;
+
+        // The originals become the hidden masters, keeping their ids and source page coordinates.
+        // containerMemoryId = 0: no page owns them, so they never render, hit-test or zoom-fit.
+        auto convert = [&](auto& records) {
+            for (auto& r : records) {
+                if (!wanted(r)) continue;
+                r.parentObjectId = definition.objectId;
+                r.containerMemoryId = 0;
+            }
+        };
+        convert(s.lineRecords);
+        convert(s.polylineRecords);
+        convert(s.polygonRecords);
+        convert(s.circleRecords);
+        convert(s.ellipseRecords);
+        convert(s.arcRecords);
+        convert(s.textRecords);
+        // Page coordinates are the new definition's master frame, so x / y carry over unchanged.
+        for (Cad2DAssetInsertRecordCPU& insert : s.assetInsertRecords) {
+            if (insert.isDeleted || insert.parentObjectId != 0 || insert.containerMemoryId != container ||
+                selected.count(insert.objectId) == 0 || !Cad2DIsInstancedAssetInsert(insert)) {
+                continue;
+            }
+            insert.parentObjectId = definition.objectId;
+            insert.containerMemoryId = 0;
+        }
+        for (Cad2DAssetInsertRecordCPU& insert : s.assetInsertRecords) {
+            if (legacyInserts.count(insert.objectId) != 0) insert.isDeleted = true;
         }
-    };
-    convert(s.lineRecords);
-    convert(s.polylineRecords);
-    convert(s.polygonRecords);
-    convert(s.circleRecords);
-    convert(s.ellipseRecords);
-    convert(s.arcRecords);
-    convert(s.textRecords);
 
-    s.assetDefinitionRecords.push_back(definition);
-    s.assetInsertRecords.push_back(firstInsert);
-    tab.allIDsInThisTab.push_back(definition.objectId);
-    tab.allIDsInThisTab.push_back(firstInsert.objectId);
+        s.assetDefinitionRecords.push_back(definition);
+        s.assetInsertRecords.push_back(firstInsert);
+        tab.allIDsInThisTab.push_back(definition.objectId);
+        tab.allIDsInThisTab.push_back(firstInsert.objectId);
+        firstInsertId = firstInsert.objectId;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s.selection2DMutex);
+        s.selectedObjectIds.clear();
+        s.selectedObjectIds.insert(firstInsertId);
+    }
+    EnqueueCad2DAssetInstancesChanged(tab.tabID, container);
 }
 
 void Cad2DBeginAssetInsert(DATASETTAB& tab) {
@@ -864,6 +1061,47 @@ double DistPointToEllipse(double px, double py, double cx, double cy, double rx,
     return std::abs(r - 1.0) * (std::min)(sx, sy);
 }
 
+// Pick distance to one record's outline.
+double DistPointToRecord(double px, double py, const Cad2DLineRecordCPU& r) {
+    return DistPointToSegment(px, py, r.x1, r.y1, r.x2, r.y2);
+}
+
+double DistPointToRecord(double px, double py, const Cad2DPolylineRecordCPU& r) {
+    double best = std::numeric_limits<double>::infinity();
+    for (size_t i = 1; i < r.points.size(); ++i) {
+        best = (std::min)(best, DistPointToSegment(px, py, r.points[i - 1].x, r.points[i - 1].y,
+            r.points[i].x, r.points[i].y));
+    }
+    return best;
+}
+
+double DistPointToRecord(double px, double py, const Cad2DPolygonRecordCPU& r) {
+    double best = std::numeric_limits<double>::infinity();
+    if (r.radius <= 0.0) return best;
+    const uint32_t n = std::clamp(r.lineSegmentCount, 3u, 16u);
+    const double step = 360.0 / (double)n;
+    for (uint32_t i = 0; i < n; ++i) {
+        const double a0 = (r.rotationDegrees + step * i) * 3.14159265358979323846 / 180.0;
+        const double a1 = (r.rotationDegrees + step * ((i + 1) % n)) * 3.14159265358979323846 / 180.0;
+        best = (std::min)(best, DistPointToSegment(px, py,
+            r.centerX + std::sin(a0) * r.radius, r.centerY + std::cos(a0) * r.radius,
+            r.centerX + std::sin(a1) * r.radius, r.centerY + std::cos(a1) * r.radius));
+    }
+    return best;
+}
+
+double DistPointToRecord(double px, double py, const Cad2DCircleRecordCPU& r) {
+    return DistPointToCircle(px, py, r.centerX, r.centerY, r.radius);
+}
+
+double DistPointToRecord(double px, double py, const Cad2DEllipseRecordCPU& r) {
+    return DistPointToEllipse(px, py, r.centerX, r.centerY, r.radiusX, r.radiusY, r.rotationRadians);
+}
+
+double DistPointToRecord(double px, double py, const Cad2DArcRecordCPU& r) {
+    return DistPointToEllipse(px, py, r.centerX, r.centerY, r.radiusX, r.radiusY, r.rotationRadians);
+}
+
 void Cad2DHandleSelectionClick(DATASETTAB& tab, double xCU, double yCU) {
     if (!tab.cad2d) return;
     const uint64_t container = Cad2DFindTargetPage2DMemoryId(tab);
@@ -885,59 +1123,73 @@ void Cad2DHandleSelectionClick(DATASETTAB& tab, double xCU, double yCU) {
         auto consider = [&](double d, uint64_t id, uint64_t parentId) {
             if (d < bestDist) { bestDist = d; bestId = id; bestParentId = parentId; }
         };
-        for (const Cad2DLineRecordCPU& r : s.lineRecords) {
-            if (r.isDeleted || r.containerMemoryId != container) continue;
-            consider(DistPointToSegment(xCU, yCU, r.x1, r.y1, r.x2, r.y2), r.objectId, r.parentObjectId);
-        }
-        for (const Cad2DPolylineRecordCPU& r : s.polylineRecords) {
-            if (r.isDeleted || r.containerMemoryId != container) continue;
-            for (size_t i = 1; i < r.points.size(); ++i) {
-                consider(DistPointToSegment(xCU, yCU, r.points[i - 1].x, r.points[i - 1].y,
-                    r.points[i].x, r.points[i].y), r.objectId, r.parentObjectId);
+        auto considerAll = [&](const auto& records) {
+            for (const auto& r : records) {
+                if (r.isDeleted || r.containerMemoryId != container) continue;
+                consider(DistPointToRecord(xCU, yCU, r), r.objectId, r.parentObjectId);
             }
-        }
-        for (const Cad2DPolygonRecordCPU& r : s.polygonRecords) {
-            if (r.isDeleted || r.containerMemoryId != container || r.radius <= 0.0) continue;
-            const uint32_t n = std::clamp(r.lineSegmentCount, 3u, 16u);
-            const double step = 360.0 / (double)n;
-            for (uint32_t i = 0; i < n; ++i) {
-                const double a0 = (r.rotationDegrees + step * i) * 3.14159265358979323846 / 180.0;
-                const double a1 = (r.rotationDegrees + step * ((i + 1) % n)) * 3.14159265358979323846 / 180.0;
-                consider(DistPointToSegment(xCU, yCU,
-                    r.centerX + std::sin(a0) * r.radius, r.centerY + std::cos(a0) * r.radius,
-                    r.centerX + std::sin(a1) * r.radius, r.centerY + std::cos(a1) * r.radius),
-                    r.objectId, r.parentObjectId);
+        };
+        considerAll(s.lineRecords);
+        considerAll(s.polylineRecords);
+        considerAll(s.polygonRecords);
+        considerAll(s.circleRecords);
+        considerAll(s.ellipseRecords);
+        considerAll(s.arcRecords);
+
+        // Reference inserts: map the pick point into the definition's master frame and test the
+        // masters there; the distance scales back by sqrt|det| (exact for uniform scale). A hit
+        // reports the top-level insert as both id and parent, so it expands like a baked instance.
+        std::vector<Cad2DAssetInstance> instances;
+        Cad2DExpandAssetInstances(s.assetDefinitionRecords, s.assetInsertRecords, container, instances);
+        if (!instances.empty()) {
+            const auto masters = GatherAssetMastersLocked(s);
+            for (const Cad2DAssetInstance& instance : instances) {
+                auto mastersIt = masters.find(instance.definitionObjectId);
+                if (mastersIt == masters.end() || !mastersIt->second.hasBounds) continue;
+                const Cad2DAssetMasters& m = mastersIt->second;
+                const Cad2DAffine2D& t = instance.transform;
+                const double det = t.Determinant();
+                if (std::abs(det) < 1.0e-18) continue;
+                const double toPage = std::sqrt(std::abs(det));
+                const double dx = xCU - t.tx, dy = yCU - t.ty;
+                const double lx = (t.m11 * dx - t.m01 * dy) / det + m.baseX;
+                const double ly = (-t.m10 * dx + t.m00 * dy) / det + m.baseY;
+                const double localTol = bestDist / toPage;
+                if (lx < m.minX - localTol || lx > m.maxX + localTol ||
+                    ly < m.minY - localTol || ly > m.maxY + localTol) {
+                    continue; // Outside this instance's box: skip its masters.
+                }
+                auto considerMasters = [&](const auto& records) {
+                    for (const auto* r : records) {
+                        consider(DistPointToRecord(lx, ly, *r) * toPage, instance.rootInsertObjectId,
+                            instance.rootInsertObjectId);
+                    }
+                };
+                considerMasters(m.lines);
+                considerMasters(m.polylines);
+                considerMasters(m.polygons);
+                considerMasters(m.circles);
+                considerMasters(m.ellipses);
+                considerMasters(m.arcs);
             }
         }
-        for (const Cad2DCircleRecordCPU& r : s.circleRecords) {
-            if (r.isDeleted || r.containerMemoryId != container) continue;
-            consider(DistPointToCircle(xCU, yCU, r.centerX, r.centerY, r.radius), r.objectId,
-                r.parentObjectId);
-        }
-        for (const Cad2DEllipseRecordCPU& r : s.ellipseRecords) {
-            if (r.isDeleted || r.containerMemoryId != container) continue;
-            consider(DistPointToEllipse(xCU, yCU, r.centerX, r.centerY, r.radiusX, r.radiusY,
-                r.rotationRadians), r.objectId, r.parentObjectId);
-        }
-        for (const Cad2DArcRecordCPU& r : s.arcRecords) {
-            if (r.isDeleted || r.containerMemoryId != container) continue;
-            consider(DistPointToEllipse(xCU, yCU, r.centerX, r.centerY, r.radiusX, r.radiusY,
-                r.rotationRadians), r.objectId, r.parentObjectId);
-        }
 
         if (bestId != 0) {
             // Parent expansion: when the hit object's parent is a Asset2DInsert, the whole
-            // instance is selected - every record sharing that parent, across all record types.
-            bool parentIsAssetInsert = false;
+            // instance is selected - the reference insert itself, or for a legacy baked insert
+            // every record sharing that parent, across all record types.
+            const Cad2DAssetInsertRecordCPU* parentInsert = nullptr;
             if (bestParentId != 0) {
                 for (const Cad2DAssetInsertRecordCPU& insert : s.assetInsertRecords) {
                     if (!insert.isDeleted && insert.objectId == bestParentId) {
-                        parentIsAssetInsert = true;
+                        parentInsert = &insert;
                         break;
                     }
                 }
             }
-            if (parentIsAssetInsert) {
+            if (parentInsert && Cad2DIsInstancedAssetInsert(*parentInsert)) {
+                hitGroup.push_back(parentInsert->objectId);
+            } else if (parentInsert) {
                 auto gather = [&](const auto& records) {
                     for (const auto& r : records) {
                         if (!r.isDeleted && r.parentObjectId == bestParentId) hitGroup.push_back(r.objectId);
@@ -979,18 +1231,6 @@ void Cad2DHandleSelectionClick(DATASETTAB& tab, double xCU, double yCU) {
 
 constexpr double kPi2D = 3.14159265358979323846;
 
-// Rigid point map p' = base + M * (p - pivot); covers translation, rotation and reflection.
-struct Cad2DPointMapper {
-    double pivotX = 0.0, pivotY = 0.0;
-    double baseX = 0.0, baseY = 0.0;
-    double m00 = 1.0, m01 = 0.0, m10 = 0.0, m11 = 1.0;
-
-    Cad2DPoint2D Map(double x, double y) const {
-        const double vx = x - pivotX, vy = y - pivotY;
-        return { baseX + m00 * vx + m01 * vy, baseY + m10 * vx + m11 * vy };
-    }
-};
-
 // Offset side for a polyline: +1 = left of the direction of travel, -1 = right, decided by which
 // side of the segment nearest to the pick point the pick falls on.
 bool PolylineOffsetSideFromPick(const std::vector<Cad2DPoint2D>& points, double px, double py,
@@ -1061,7 +1301,8 @@ bool OffsetPolylinePoints(const std::vector<Cad2DPoint2D>& points, double distan
 }
 
 // Applies the armed transform to every selected object of the active Page2D. Move/Rotate update
-// the records in place (ids preserved); Copy/Offset/Mirror enqueue brand-new objects.
+// the records in place (ids preserved); Copy/Offset/Mirror enqueue brand-new objects. Selected
+// reference inserts are re-placed (or copied) in the insert records directly.
 void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
     double p1x, double p1y, double p2x, double p2y, double p3x, double p3y) {
     TabCad2DStorage& s = *tab.cad2d;
@@ -1109,6 +1350,9 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
     std::vector<Cad2DArcRecordCPU> arcs;
     std::vector<Cad2DTextRecordCPU> texts;
 
+    std::vector<Cad2DAssetInsertRecordCPU> newInserts;
+    bool insertsChanged = false;
+
     auto asNewObject = [&](auto& record) {
         record.objectId = 0; // EnqueueCad2D* assigns a fresh memory id; save assigns persisted ids.
         record.persistedId = 0;
@@ -1119,18 +1363,33 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
         return !isDeleted && recContainer == container && selected.count(objectId) != 0;
     };
 
+    // Each record's transform is a pure function of the record and the picked points, so a large
+    // selection (a DXF import, easily 10^5 entities) is transformed on EngineeringParallelFor: the
+    // selected records of a type are picked in storage order, transformed into their own slots,
+    // then compacted in that order. The result - and the ids PushCad2DAddCommands later hands the
+    // copies - is identical to a serial pass whatever the thread count. `transform` returns false
+    // to drop a record (a degenerate offset).
+    EngineeringParallelFor pool;
+    auto transformSelected = [&](const auto& records, auto& outputs, const auto& transform) {
+        Cad2DTransformSelectedRecords(pool, records, outputs,
+            [&](const auto& r) { return wanted(r.objectId, r.isDeleted, r.containerMemoryId); },
+            [&](const auto& r, auto& out) {
+                if (!transform(r, out)) return false;
+                if (makesCopy) asNewObject(out);
+                return true;
+            });
+    };
+
     {
         std::lock_guard<std::mutex> lock(s.cpuRecordsMutex);
-        for (const Cad2DLineRecordCPU& r : s.lineRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            Cad2DLineRecordCPU out = r;
+        transformSelected(s.lineRecords, lines, [&](const Cad2DLineRecordCPU& r, Cad2DLineRecordCPU& out) {
             if (kind == Cad2DTransformKind::Offset) {
                 // Parallel line at the offset distance, toward the side of the second click.
                 const double dirX = r.x2 - r.x1, dirY = r.y2 - r.y1;
                 const double len = std::hypot(dirX, dirY);
-                if (len <= 1.0e-12) continue;
+                if (len <= 1.0e-12) return false;
                 const double side = dirX * (p2y - r.y1) - dirY * (p2x - r.x1);
-                if (std::abs(side) <= 1.0e-12) continue; // Click on the line: side undefined.
+                if (std::abs(side) <= 1.0e-12) return false; // Click on the line: side undefined.
                 const double sign = side > 0.0 ? 1.0 : -1.0;
                 const double nx = -dirY / len * sign * offsetDistance;
                 const double ny = dirX / len * sign * offsetDistance;
@@ -1140,36 +1399,32 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                 const Cad2DPoint2D b = map.Map(r.x2, r.y2);
                 out.x1 = a.x; out.y1 = a.y; out.x2 = b.x; out.y2 = b.y;
             }
-            if (makesCopy) asNewObject(out);
-            lines.push_back(out);
-        }
-        for (const Cad2DPolylineRecordCPU& r : s.polylineRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            Cad2DPolylineRecordCPU out = r;
+            return true;
+        });
+        transformSelected(s.polylineRecords, polylines,
+            [&](const Cad2DPolylineRecordCPU& r, Cad2DPolylineRecordCPU& out) {
             if (kind == Cad2DTransformKind::Offset) {
                 const std::vector<Cad2DPoint2D> cleaned = CleanPolylinePoints(r.points);
                 double sign = 0.0;
-                if (!PolylineOffsetSideFromPick(cleaned, p2x, p2y, sign)) continue;
-                if (!OffsetPolylinePoints(cleaned, offsetDistance, sign, out.points)) continue;
+                if (!PolylineOffsetSideFromPick(cleaned, p2x, p2y, sign)) return false;
+                if (!OffsetPolylinePoints(cleaned, offsetDistance, sign, out.points)) return false;
             } else {
                 for (Cad2DPoint2D& p : out.points) p = map.Map(p.x, p.y);
             }
-            if (makesCopy) asNewObject(out);
-            polylines.push_back(std::move(out));
-        }
-        for (const Cad2DPolygonRecordCPU& r : s.polygonRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            Cad2DPolygonRecordCPU out = r;
+            return true;
+        });
+        transformSelected(s.polygonRecords, polygons,
+            [&](const Cad2DPolygonRecordCPU& r, Cad2DPolygonRecordCPU& out) {
             if (kind == Cad2DTransformKind::Offset) {
                 // Offset the edges: the apothem changes by the distance, so the circumradius
                 // changes by distance / cos(pi/n). Second click outside the polygon grows it.
-                if (r.radius <= 0.0) continue;
+                if (r.radius <= 0.0) return false;
                 const uint32_t n = std::clamp(r.lineSegmentCount, 3u, 16u);
                 const double cosHalf = (std::max)(std::cos(kPi2D / (double)n), 1.0e-9);
                 const double grow =
                     std::hypot(p2x - r.centerX, p2y - r.centerY) > r.radius ? 1.0 : -1.0;
                 out.radius = r.radius + grow * offsetDistance / cosHalf;
-                if (out.radius <= kMinPolygonRadiusCU) continue;
+                if (out.radius <= kMinPolygonRadiusCU) return false;
             } else {
                 const Cad2DPoint2D c = map.Map(r.centerX, r.centerY);
                 out.centerX = c.x; out.centerY = c.y;
@@ -1183,27 +1438,23 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                         180.0 - 2.0 * mirrorLineAngleRadians * 180.0 / kPi2D - r.rotationDegrees;
                 }
             }
-            if (makesCopy) asNewObject(out);
-            polygons.push_back(out);
-        }
-        for (const Cad2DCircleRecordCPU& r : s.circleRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            Cad2DCircleRecordCPU out = r;
+            return true;
+        });
+        transformSelected(s.circleRecords, circles,
+            [&](const Cad2DCircleRecordCPU& r, Cad2DCircleRecordCPU& out) {
             if (kind == Cad2DTransformKind::Offset) {
                 const double grow =
                     std::hypot(p2x - r.centerX, p2y - r.centerY) > r.radius ? 1.0 : -1.0;
                 out.radius = r.radius + grow * offsetDistance;
-                if (out.radius <= kMinCurveRadiusCU) continue;
+                if (out.radius <= kMinCurveRadiusCU) return false;
             } else {
                 const Cad2DPoint2D c = map.Map(r.centerX, r.centerY);
                 out.centerX = c.x; out.centerY = c.y;
             }
-            if (makesCopy) asNewObject(out);
-            circles.push_back(out);
-        }
-        for (const Cad2DEllipseRecordCPU& r : s.ellipseRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            Cad2DEllipseRecordCPU out = r;
+            return true;
+        });
+        transformSelected(s.ellipseRecords, ellipses,
+            [&](const Cad2DEllipseRecordCPU& r, Cad2DEllipseRecordCPU& out) {
             if (kind == Cad2DTransformKind::Offset) {
                 const double sx = (std::max)(std::abs(r.radiusX), 1.0e-9);
                 const double sy = (std::max)(std::abs(r.radiusY), 1.0e-9);
@@ -1214,7 +1465,7 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                 const double grow = nx * nx + ny * ny > 1.0 ? 1.0 : -1.0;
                 out.radiusX = r.radiusX + grow * offsetDistance;
                 out.radiusY = r.radiusY + grow * offsetDistance;
-                if (out.radiusX <= kMinCurveRadiusCU || out.radiusY <= kMinCurveRadiusCU) continue;
+                if (out.radiusX <= kMinCurveRadiusCU || out.radiusY <= kMinCurveRadiusCU) return false;
             } else {
                 const Cad2DPoint2D c = map.Map(r.centerX, r.centerY);
                 out.centerX = c.x; out.centerY = c.y;
@@ -1224,12 +1475,9 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                     out.rotationRadians = 2.0 * mirrorLineAngleRadians - r.rotationRadians;
                 }
             }
-            if (makesCopy) asNewObject(out);
-            ellipses.push_back(out);
-        }
-        for (const Cad2DArcRecordCPU& r : s.arcRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            Cad2DArcRecordCPU out = r;
+            return true;
+        });
+        transformSelected(s.arcRecords, arcs, [&](const Cad2DArcRecordCPU& r, Cad2DArcRecordCPU& out) {
             if (kind == Cad2DTransformKind::Offset) {
                 const double sx = (std::max)(std::abs(r.radiusX), 1.0e-9);
                 const double sy = (std::max)(std::abs(r.radiusY), 1.0e-9);
@@ -1240,7 +1488,7 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                 const double grow = nx * nx + ny * ny > 1.0 ? 1.0 : -1.0;
                 out.radiusX = r.radiusX + grow * offsetDistance;
                 out.radiusY = r.radiusY + grow * offsetDistance;
-                if (out.radiusX <= kMinCurveRadiusCU || out.radiusY <= kMinCurveRadiusCU) continue;
+                if (out.radiusX <= kMinCurveRadiusCU || out.radiusY <= kMinCurveRadiusCU) return false;
                 // Rescale the end points per local axis so they stay on the new curve.
                 auto rescale = [&](double wx, double wy, double& ox, double& oy) {
                     const double ex = wx - r.centerX, ey = wy - r.centerY;
@@ -1271,13 +1519,10 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                     out.endX = en.x; out.endY = en.y;
                 }
             }
-            if (makesCopy) asNewObject(out);
-            arcs.push_back(out);
-        }
+            return true;
+        });
         if (kind != Cad2DTransformKind::Offset) { // Offset is not defined for text.
-            for (const Cad2DTextRecordCPU& r : s.textRecords) {
-                if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-                Cad2DTextRecordCPU out = r;
+            transformSelected(s.textRecords, texts, [&](const Cad2DTextRecordCPU& r, Cad2DTextRecordCPU& out) {
                 // The rendered origin is (x + xOffsetCU, y + yOffsetCU); map that effective
                 // point so the offsets keep working unchanged.
                 const Cad2DPoint2D o =
@@ -1291,19 +1536,48 @@ void ApplyTransform2DToSelection(DATASETTAB& tab, Cad2DTransformKind kind,
                     out.rotationRadians =
                         (float)(2.0 * mirrorLineAngleRadians - (double)r.rotationRadians);
                 }
-                if (makesCopy) asNewObject(out);
-                texts.push_back(std::move(out));
+                return true;
+            });
+        }
+        // Reference inserts: only the placement changes (the definition is shared). Offset has no
+        // meaning for an instance. Mirror: Refl(phi) * R(theta) * S(sx, sy) = R(2*phi - theta) *
+        // S(sx, -sy), so the copy flips scaleY and reflects the rotation.
+        if (kind != Cad2DTransformKind::Offset) {
+            for (Cad2DAssetInsertRecordCPU& insert : s.assetInsertRecords) {
+                if (insert.isDeleted || insert.parentObjectId != 0 || insert.containerMemoryId != container ||
+                    selected.count(insert.objectId) == 0 || !Cad2DIsInstancedAssetInsert(insert)) {
+                    continue;
+                }
+                Cad2DAssetInsertRecordCPU out = insert;
+                const Cad2DPoint2D p = map.Map(insert.x, insert.y);
+                out.x = p.x; out.y = p.y;
+                if (kind == Cad2DTransformKind::Rotate) {
+                    out.rotationDegrees = insert.rotationDegrees + rotationDeltaRadians * 180.0 / kPi2D;
+                } else if (kind == Cad2DTransformKind::Mirror) {
+                    out.rotationDegrees =
+                        2.0 * mirrorLineAngleRadians * 180.0 / kPi2D - insert.rotationDegrees;
+                    out.scaleY = -insert.scaleY;
+                }
+                if (makesCopy) {
+                    out.objectId = MemoryID::next();
+                    out.persistedId = 0;
+                    out.persistedParentId = 0;
+                    newInserts.push_back(out);
+                } else {
+                    insert = out;
+                }
+                insertsChanged = true;
+            }
+            for (const Cad2DAssetInsertRecordCPU& insert : newInserts) {
+                s.assetInsertRecords.push_back(insert);
+                tab.allIDsInThisTab.push_back(insert.objectId);
             }
         }
     }
 
-    for (Cad2DLineRecordCPU& r : lines) EnqueueCad2DLine(tab.tabID, container, r);
-    for (Cad2DPolylineRecordCPU& r : polylines) EnqueueCad2DPolyline(tab.tabID, container, std::move(r));
-    for (Cad2DPolygonRecordCPU& r : polygons) EnqueueCad2DPolygon(tab.tabID, container, r);
-    for (Cad2DCircleRecordCPU& r : circles) EnqueueCad2DCircle(tab.tabID, container, r);
-    for (Cad2DEllipseRecordCPU& r : ellipses) EnqueueCad2DEllipse(tab.tabID, container, r);
-    for (Cad2DArcRecordCPU& r : arcs) EnqueueCad2DArc(tab.tabID, container, r);
-    for (Cad2DTextRecordCPU& r : texts) EnqueueCad2DText(tab.tabID, container, std::move(r));
+    // One queue lock and one copy-thread wake-up for the whole result, however large the selection.
+    PushCad2DAddCommands(tab.tabID, container, lines, polylines, polygons, circles, ellipses, arcs, texts);
+    if (insertsChanged) EnqueueCad2DAssetInstancesChanged(tab.tabID, container);
 }
 
 void HandleTransform2DClick(DATASETTAB& tab, double xCU, double yCU) {
@@ -1367,7 +1641,7 @@ void HandleAssetInsertClick(DATASETTAB& tab, double xCU, double yCU) {
 } // namespace
 
 bool Cad2DInstantiateAsset(DATASETTAB& tab, uint64_t containerMemoryId, uint64_t definitionObjectId,
-    double xCU, double yCU, double scaleX, double scaleY, double rotationDegrees) {
+    double xCU, double yCU, double scaleX, double scaleY, double rotationDegrees, bool enqueueRebuild) {
     if (!tab.cad2d || containerMemoryId == 0 || definitionObjectId == 0) return false;
     if (!std::isfinite(scaleX) || !std::isfinite(scaleY) || !std::isfinite(rotationDegrees) ||
         std::abs(scaleX) < 1.0e-9 || std::abs(scaleY) < 1.0e-9) {
@@ -1375,25 +1649,16 @@ bool Cad2DInstantiateAsset(DATASETTAB& tab, uint64_t containerMemoryId, uint64_t
     }
     TabCad2DStorage& s = *tab.cad2d;
 
-    std::vector<Cad2DLineRecordCPU> lines;
-    std::vector<Cad2DPolylineRecordCPU> polylines;
-    std::vector<Cad2DPolygonRecordCPU> polygons;
-    std::vector<Cad2DCircleRecordCPU> circles;
-    std::vector<Cad2DEllipseRecordCPU> ellipses;
-    std::vector<Cad2DArcRecordCPU> arcs;
-    std::vector<Cad2DTextRecordCPU> texts;
-
     {
         std::lock_guard<std::mutex> lock(s.cpuRecordsMutex);
-        double baseX = 0.0, baseY = 0.0;
         bool found = false;
         for (const Cad2DAssetDefinitionRecordCPU& d : s.assetDefinitionRecords) {
-            if (!d.isDeleted && d.objectId == definitionObjectId) {
-                baseX = d.baseX; baseY = d.baseY; found = true; break;
-            }
+            if (!d.isDeleted && d.objectId == definitionObjectId) { found = true; break; }
         }
         if (!found) return false;
 
+        // A reference only: the copy thread draws the definition's cached records through
+        // Cad2DAssetInsertTransform, so placing an instance costs one record, not a member copy.
         Cad2DAssetInsertRecordCPU insert{};
         insert.objectId = MemoryID::next();
         insert.containerMemoryId = containerMemoryId;
@@ -1405,110 +1670,29 @@ bool Cad2DInstantiateAsset(DATASETTAB& tab, uint64_t containerMemoryId, uint64_t
         insert.rotationDegrees = rotationDegrees;
         insert.schemaVersion = VishwakarmaStorage::kAsset2DInsertSchemaVersion;
 
-        // Point map member = insert + R(theta) * S(scaleX, scaleY) * (master - base).
-        const double theta = rotationDegrees * kPi2D / 180.0;
-        const double cosT = std::cos(theta), sinT = std::sin(theta);
-        const double m00 = cosT * scaleX, m01 = -sinT * scaleY;
-        const double m10 = sinT * scaleX, m11 = cosT * scaleY;
-        auto mapPoint = [&](double px, double py) -> Cad2DPoint2D {
-            const double vx = px - baseX, vy = py - baseY;
-            return { xCU + m00 * vx + m01 * vy, yCU + m10 * vx + m11 * vy };
-        };
-
-        // Angle fields cannot go through the point map. Decompose the negative-scale part:
-        // both axes negative is an extra 180deg rotation; exactly one negative axis is a
-        // reflection (across the y-axis for scaleX < 0: line angle phi = 90deg, across the
-        // x-axis for scaleY < 0: phi = 0). Then apply the same angle formulas as the
-        // EDIT_ROTATE / EDIT_MIRROR selection transforms above. Non-uniform |scale| on the
-        // parametric round shapes is an approximation (a squashed circle is not a circle).
-        const bool negX = scaleX < 0.0, negY = scaleY < 0.0;
-        const bool mirrored = negX != negY;
-        const double thetaEff = (negX && negY) ? theta + kPi2D : theta;
-        const double mirrorPhi = negX ? kPi2D / 2.0 : 0.0;
-        auto mapRotationRadians = [&](double rot) { // Ellipse / arc / text rotation fields.
-            return mirrored ? (2.0 * mirrorPhi - rot) + thetaEff : rot + thetaEff;
-        };
-        auto mapPolygonDegrees = [&](double a) {    // Polygon param angle a = 90deg - polar.
-            const double thetaEffDeg = thetaEff * 180.0 / kPi2D;
-            return mirrored ? (180.0 - 2.0 * mirrorPhi * 180.0 / kPi2D - a) - thetaEffDeg
-                            : a - thetaEffDeg;
-        };
-        const double absX = std::abs(scaleX), absY = std::abs(scaleY);
-        const double radiusScale = (std::max)(absX, absY); // Circle / polygon approximation.
-
-        // Copy every master record of this definition, transform it and re-parent to the insert.
-        auto instantiate = [&](const auto& records, auto& out, auto&& transform) {
-            for (const auto& r : records) {
-                if (r.isDeleted || r.parentObjectId != definitionObjectId) continue;
-                auto member = r;
-                member.objectId = 0; // EnqueueCad2D* assigns a fresh memory id.
-                member.persistedId = 0;
-                member.persistedParentId = 0;
-                member.parentObjectId = insert.objectId;
-                member.containerMemoryId = containerMemoryId;
-                transform(member);
-                out.push_back(std::move(member));
-            }
-        };
-        instantiate(s.lineRecords, lines, [&](Cad2DLineRecordCPU& r) {
-            const Cad2DPoint2D a = mapPoint(r.x1, r.y1);
-            const Cad2DPoint2D b = mapPoint(r.x2, r.y2);
-            r.x1 = a.x; r.y1 = a.y; r.x2 = b.x; r.y2 = b.y; });
-        instantiate(s.polylineRecords, polylines, [&](Cad2DPolylineRecordCPU& r) {
-            for (Cad2DPoint2D& p : r.points) p = mapPoint(p.x, p.y); });
-        instantiate(s.polygonRecords, polygons, [&](Cad2DPolygonRecordCPU& r) {
-            const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
-            r.centerX = c.x; r.centerY = c.y;
-            r.radius *= radiusScale;
-            r.rotationDegrees = mapPolygonDegrees(r.rotationDegrees); });
-        instantiate(s.circleRecords, circles, [&](Cad2DCircleRecordCPU& r) {
-            const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
-            r.centerX = c.x; r.centerY = c.y;
-            r.radius *= radiusScale; });
-        instantiate(s.ellipseRecords, ellipses, [&](Cad2DEllipseRecordCPU& r) {
-            const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
-            r.centerX = c.x; r.centerY = c.y;
-            r.radiusX *= absX; // Exact for uniform scale; axis-aligned approximation otherwise.
-            r.radiusY *= absY;
-            r.rotationRadians = mapRotationRadians(r.rotationRadians); });
-        instantiate(s.arcRecords, arcs, [&](Cad2DArcRecordCPU& r) {
-            const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
-            const Cad2DPoint2D st = mapPoint(r.startX, r.startY);
-            const Cad2DPoint2D en = mapPoint(r.endX, r.endY);
-            r.centerX = c.x; r.centerY = c.y;
-            r.radiusX *= absX;
-            r.radiusY *= absY;
-            r.rotationRadians = mapRotationRadians(r.rotationRadians);
-            if (mirrored) { // Reflection reverses the CCW sweep: swap the end points.
-                r.startX = en.x; r.startY = en.y;
-                r.endX = st.x; r.endY = st.y;
-            } else {
-                r.startX = st.x; r.startY = st.y;
-                r.endX = en.x; r.endY = en.y;
-            } });
-        instantiate(s.textRecords, texts, [&](Cad2DTextRecordCPU& r) {
-            // Map the effective origin (x + offset) like the selection transforms do; glyphs
-            // stay readable under mirror (baseline direction reflects, height stays positive).
-            const Cad2DPoint2D o = mapPoint(r.x + (double)r.xOffsetCU, r.y + (double)r.yOffsetCU);
-            r.x = o.x - (double)r.xOffsetCU;
-            r.y = o.y - (double)r.yOffsetCU;
-            r.textHeightCU = (float)((double)r.textHeightCU * absY);
-            r.rotationRadians = (float)mapRotationRadians((double)r.rotationRadians); });
-
         s.assetInsertRecords.push_back(insert);
         tab.allIDsInThisTab.push_back(insert.objectId);
     }
 
-    for (Cad2DLineRecordCPU& r : lines) EnqueueCad2DLine(tab.tabID, containerMemoryId, r);
-    for (Cad2DPolylineRecordCPU& r : polylines) EnqueueCad2DPolyline(tab.tabID, containerMemoryId, std::move(r));
-    for (Cad2DPolygonRecordCPU& r : polygons) EnqueueCad2DPolygon(tab.tabID, containerMemoryId, r);
-    for (Cad2DCircleRecordCPU& r : circles) EnqueueCad2DCircle(tab.tabID, containerMemoryId, r);
-    for (Cad2DEllipseRecordCPU& r : ellipses) EnqueueCad2DEllipse(tab.tabID, containerMemoryId, r);
-    for (Cad2DArcRecordCPU& r : arcs) EnqueueCad2DArc(tab.tabID, containerMemoryId, r);
-    for (Cad2DTextRecordCPU& r : texts) EnqueueCad2DText(tab.tabID, containerMemoryId, std::move(r));
+    if (enqueueRebuild) EnqueueCad2DAssetInstancesChanged(tab.tabID, containerMemoryId);
     return true;
 }
 
+void Cad2DInvalidateAssetDefinition(DATASETTAB& tab, uint64_t definitionObjectId) {
+    if (!tab.cad2d || definitionObjectId == 0) return;
+    {
+        std::lock_guard<std::mutex> lock(tab.cad2d->cpuRecordsMutex);
+        bool found = false;
+        for (Cad2DAssetDefinitionRecordCPU& d : tab.cad2d->assetDefinitionRecords) {
+            if (d.objectId == definitionObjectId) { ++d.revision; found = true; break; }
+        }
+        if (!found) return;
+    }
+    // Definitions that nest this one need no bump: each definition caches only its own masters,
+    // nested content is re-expanded through the insert transforms on every rebuild.
+    EnqueueCad2DAssetInstancesChanged(tab.tabID, 0);
+}
+
 uint64_t Cad2DCreateAssetDefinition(DATASETTAB& tab, double baseX, double baseY,
     const std::vector<Cad2DLineRecordCPU>& masterLines,
     const std::vector<Cad2DTextRecordCPU>& masterTexts,
@@ -1820,42 +2004,27 @@ void Cad2DZoomToExtents(DATASETTAB& tab, bool selectedOnly) {
 
     {
         std::lock_guard<std::mutex> lock(s.cpuRecordsMutex);
-        for (const Cad2DLineRecordCPU& r : s.lineRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            include(r.x1, r.y1); include(r.x2, r.y2);
-        }
-        for (const Cad2DPolylineRecordCPU& r : s.polylineRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            for (const Cad2DPoint2D& p : r.points) include(p.x, p.y);
-        }
-        for (const Cad2DPolygonRecordCPU& r : s.polygonRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            include(r.centerX - r.radius, r.centerY - r.radius);
-            include(r.centerX + r.radius, r.centerY + r.radius);
-        }
-        for (const Cad2DCircleRecordCPU& r : s.circleRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            include(r.centerX - r.radius, r.centerY - r.radius);
-            include(r.centerX + r.radius, r.centerY + r.radius);
-        }
-        for (const Cad2DEllipseRecordCPU& r : s.ellipseRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            // Axis-aligned bounding half-extents of the rotated ellipse.
-            const double c = std::cos(r.rotationRadians), sn = std::sin(r.rotationRadians);
-            const double hx = std::sqrt(r.radiusX * c * r.radiusX * c + r.radiusY * sn * r.radiusY * sn);
-            const double hy = std::sqrt(r.radiusX * sn * r.radiusX * sn + r.radiusY * c * r.radiusY * c);
-            include(r.centerX - hx, r.centerY - hy);
-            include(r.centerX + hx, r.centerY + hy);
-        }
-        for (const Cad2DArcRecordCPU& r : s.arcRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            const double radius = (std::max)(std::abs(r.radiusX), std::abs(r.radiusY));
-            include(r.centerX - radius, r.centerY - radius); // Full-ellipse box; conservative for partial arcs.
-            include(r.centerX + radius, r.centerY + radius);
-        }
-        for (const Cad2DTextRecordCPU& r : s.textRecords) {
-            if (!wanted(r.objectId, r.isDeleted, r.containerMemoryId)) continue;
-            include(r.x, r.y); include(r.x, r.y + (double)r.textHeightCU);
+        auto includeAll = [&](const auto& records) {
+            for (const auto& r : records) {
+                if (wanted(r.objectId, r.isDeleted, r.containerMemoryId)) IncludeRecordBounds(r, include);
+            }
+        };
+        includeAll(s.lineRecords);
+        includeAll(s.polylineRecords);
+        includeAll(s.polygonRecords);
+        includeAll(s.circleRecords);
+        includeAll(s.ellipseRecords);
+        includeAll(s.arcRecords);
+        includeAll(s.textRecords);
+
+        std::vector<Cad2DAssetInstance> instances;
+        Cad2DExpandAssetInstances(s.assetDefinitionRecords, s.assetInsertRecords, container, instances);
+        if (!instances.empty()) {
+            const auto masters = GatherAssetMastersLocked(s);
+            for (const Cad2DAssetInstance& instance : instances) {
+                if (filterBySelection && selected.count(instance.rootInsertObjectId) == 0) continue;
+                IncludeAssetInstanceBounds(instance, masters, include);
+            }
         }
     }
     if (!hasBounds) {
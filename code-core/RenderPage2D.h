@@ -1,11 +1,15 @@
 // Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "UserInputProcessing.h"
@@ -180,23 +184,29 @@ struct Cad2DAssetDefinitionRecordCPU {
     double baseX = 0.0; // Insert base point: middle of the bounding box of the source objects.
     double baseY = 0.0; // Master geometry keeps source page coordinates; each insert places
                         // members at insert + R(rotation) * S(scale) * (master - base).
+    // Bumped by Cad2DInvalidateAssetDefinition whenever the master geometry changes; keys the copy
+    // thread's converted-record cache (TabCad2DStorage::assetDefinitionGpuCache). Not persisted.
+    uint64_t revision = 0;
     uint16_t schemaVersion = 0;
     bool isDeleted = false;
 };
 
-// One placed instance of an asset on a Page2D. Virtual container object: never rendered itself;
-// its member records live on the page (containerMemoryId = page) with parentObjectId = this
-// objectId, so the draw side needs no asset awareness. Selection expands through the parent.
+// One placed instance of an asset. Virtual container object: never rendered itself. Schema v3+
+// inserts are references: the page stores no member records, the copy thread expands the
+// definition through the insert's transform (Cad2DExpandAssetInstances). Schema v1/v2 inserts from
+// older files keep their baked member records on the page (parentObjectId = this objectId); they
+// render as plain page objects and selection expands through the parent.
 struct Cad2DAssetInsertRecordCPU {
     uint64_t objectId = 0;
-    uint64_t containerMemoryId = 0; // Owning Page2D.
+    uint64_t containerMemoryId = 0; // Owning Page2D; 0 for an insert nested in a definition.
     uint64_t persistedId = 0;
     uint64_t persistedParentId = 0;
+    uint64_t parentObjectId = 0; // 0 = placed on a page; else owning Asset2DDefinition (nested).
     uint64_t definitionObjectId = 0; // Memory id of the Cad2DAssetDefinitionRecordCPU.
-    double x = 0.0; // Insert point in page ComputerUnits.
+    double x = 0.0; // Insert point in page ComputerUnits (owning definition's master frame if nested).
     double y = 0.0;
-    // Per-instance transform (schema v2), baked into the member records at placement:
-    // member = insert + R(rotation) * S(scale) * (master - base). Negative scale = mirror.
+    // Per-instance transform: member = insert + R(rotation) * S(scale) * (master - base).
+    // Negative scale = mirror.
     double scaleX = 1.0;
     double scaleY = 1.0;
     double rotationDegrees = 0.0; // Counter-clockwise.
@@ -204,6 +214,55 @@ struct Cad2DAssetInsertRecordCPU {
     bool isDeleted = false;
 };
 
+// True for reference inserts (schema v3+); false for legacy inserts with baked member records.
+bool Cad2DIsInstancedAssetInsert(const Cad2DAssetInsertRecordCPU& insert);
+
+// 2D affine map p' = M * p + t, in double. Asset instancing composes these through nested inserts.
+struct Cad2DAffine2D {
+    double m00 = 1.0, m01 = 0.0, m10 = 0.0, m11 = 1.0;
+    double tx = 0.0, ty = 0.0;
+
+    Cad2DPoint2D Map(double x, double y) const {
+        return { tx + m00 * x + m01 * y, ty + m10 * x + m11 * y };
+    }
+    double Determinant() const { return m00 * m11 - m01 * m10; }
+};
+
+// outer o inner: applies inner first, then outer.
+inline Cad2DAffine2D Cad2DComposeAffine(const Cad2DAffine2D& outer, const Cad2DAffine2D& inner) {
+    Cad2DAffine2D out;
+    out.m00 = outer.m00 * inner.m00 + outer.m01 * inner.m10;
+    out.m01 = outer.m00 * inner.m01 + outer.m01 * inner.m11;
+    out.m10 = outer.m10 * inner.m00 + outer.m11 * inner.m10;
+    out.m11 = outer.m10 * inner.m01 + outer.m11 * inner.m11;
+    out.tx = outer.tx + outer.m00 * inner.tx + outer.m01 * inner.ty;
+    out.ty = outer.ty + outer.m10 * inner.tx + outer.m11 * inner.ty;
+    return out;
+}
+
+// One definition drawn on a page. transform maps the definition's base-relative master
+// coordinates (master - base) to page ComputerUnits. A nested insert yields one entry per
+// definition it reaches, all tagged with the top-level insert that selection works on.
+struct Cad2DAssetInstance {
+    uint64_t rootInsertObjectId = 0;
+    uint64_t containerMemoryId = 0;
+    uint64_t definitionObjectId = 0;
+    Cad2DAffine2D transform;
+};
+
+// Maps the inserted definition's base-relative coordinates into the frame that owns the insert:
+// the page for a top-level insert (originX/Y = 0), else the owning definition's base-relative frame
+// (originX/Y = that definition's base point).
+Cad2DAffine2D Cad2DAssetInsertTransform(const Cad2DAssetInsertRecordCPU& insert,
+    double originX, double originY);
+
+// Platform-neutral expansion of the reference inserts into per-definition instance transforms,
+// flattening nested inserts depth-first. A definition that (indirectly) inserts itself is cut at
+// the repeat. containerMemoryId = 0 expands every page. Legacy baked inserts are skipped.
+void Cad2DExpandAssetInstances(const std::vector<Cad2DAssetDefinitionRecordCPU>& definitions,
+    const std::vector<Cad2DAssetInsertRecordCPU>& inserts, uint64_t containerMemoryId,
+    std::vector<Cad2DAssetInstance>& outInstances);
+
 enum class CommandToCopyThread2DType : uint8_t {
     AddLine = 0,
     AddText = 1,
@@ -213,8 +272,9 @@ enum class CommandToCopyThread2DType : uint8_t {
     AddEllipse = 5,
     AddArc = 6,
     SelectionRefresh = 7, // No geometry; forces a page rebuild so selection flags re-apply.
-    ReportIngestStats = 8 // Debug diagnostics: print the container's record counts + bbox once
-                          // every command queued before it has been ingested.
+    ReportIngestStats = 8, // Debug diagnostics: print the container's record counts + bbox once
+                           // every command queued before it has been ingested.
+    AssetInstancesChanged = 9 // No geometry; asset inserts / definitions changed, forces a rebuild.
 };
 
 // GPU record 'flags' bit set for the currently selected 2D objects; the 2D vertex shaders read it
@@ -263,6 +323,11 @@ struct Cad2DCurveGPURecord {
 };
 static_assert(sizeof(Cad2DCurveGPURecord) == 64, "Cad2DCurveGPURecord must be 64 bytes.");
 
+// Cad2DCurveGPURecord::curveType values (Shader2D_CurveVertex / Shader2D_CurvePixel).
+constexpr uint32_t kCad2DCurveTypeCircle = 0;
+constexpr uint32_t kCad2DCurveTypeEllipse = 1;
+constexpr uint32_t kCad2DCurveTypeArc = 2;
+
 struct Cad2DTextVertex {
     float x;
     float y;
@@ -273,16 +338,97 @@ struct Cad2DTextVertex {
 };
 static_assert(sizeof(Cad2DTextVertex) == 24, "Cad2DTextVertex must match Shader2D_TextVertex input.");
 
+// The view center is not in here: it reaches the shaders folded into Cad2DTileConstants, so no
+// float ever holds an absolute drawing coordinate.
 struct Cad2DViewConstants {
-    Cad2DFloat2 viewCenterCU;
     float zoomPixelsPerCU;
     float dpiY;
     Cad2DFloat2 viewportSizePx;
     float minLineWeightPx;
     float padding0;
+    Cad2DFloat2 padding1;
 };
 static_assert(sizeof(Cad2DViewConstants) == 32, "Cad2DViewConstants must stay 16-byte aligned.");
 
+/* Page-local precision tiles (2Drendering.md section 10, Option A). A float has 24 mantissa bits,
+so an absolute coordinate of 10,000,000 CU is only good to 1 CU - and survey-grid or site drawings
+sit that far from the origin. The copy thread therefore buckets every record into a fixed-size
+world tile and stores float coordinates relative to that tile's double origin. At draw time the
+render thread hands each tile `origin - viewCenter`, subtracted in double, as two root constants
+(register b1). Panning changes only that offset; the GPU records are never re-converted.
+
+Line work (lines, polyline and polygon segments) is cut at every tile edge it crosses and each
+piece goes to the tile it lies in, so its locals stay within half a tile of the tile center and
+65,536 CU keeps a float step below 0.01 CU. The rest is bucketed by the point its GPU record is
+built from: a curve by its center, a text by its origin, an asset instance by its insert point.
+Those locals reach a radius, a string or an asset's extent beyond that point, and a segment
+crossing more than kCad2DMaxSegmentTileCrossings edges goes whole to its midpoint's tile, so for
+records far larger than a tile the 0.01 CU figure does not hold: precision falls in proportion to
+their size. Indices are clamped so a stray NaN or 1e300 coordinate lands in an edge tile instead
+of overflowing the integer conversion. */
+constexpr double kCad2DPrecisionTileSizeCU = 65536.0;
+constexpr int64_t kCad2DPrecisionTileIndexLimit = int64_t(1) << 40;
+constexpr int64_t kCad2DMaxSegmentTileCrossings = 64; // Bounds the pieces one segment is cut into.
+
+inline int64_t Cad2DPrecisionTileIndex(double coordinateCU) {
+    const double index = std::floor(coordinateCU / kCad2DPrecisionTileSizeCU);
+    if (!(index > -double(kCad2DPrecisionTileIndexLimit))) return -kCad2DPrecisionTileIndexLimit; // NaN too.
+    if (index > double(kCad2DPrecisionTileIndexLimit)) return kCad2DPrecisionTileIndexLimit;
+    return static_cast<int64_t>(index);
+}
+
+inline double Cad2DPrecisionTileOrigin(int64_t tileIndex) {
+    return (static_cast<double>(tileIndex) + 0.5) * kCad2DPrecisionTileSizeCU;
+}
+
+// Calls piece(ax, ay, bx, by) for each piece of the segment cut at every tile edge it crosses, in
+// order from (x1, y1): each piece starts exactly where the previous one ended and lies in a single
+// tile. A segment within one tile, or crossing more than kCad2DMaxSegmentTileCrossings edges, is
+// one piece. cuts is caller-owned scratch, so a page build reuses one allocation.
+template <typename Piece>
+void Cad2DCutSegmentAtTileEdges(double x1, double y1, double x2, double y2, std::vector<double>& cuts, Piece&& piece) {
+    const int64_t tileX1 = Cad2DPrecisionTileIndex(x1), tileX2 = Cad2DPrecisionTileIndex(x2);
+    const int64_t tileY1 = Cad2DPrecisionTileIndex(y1), tileY2 = Cad2DPrecisionTileIndex(y2);
+    const int64_t crossings = std::abs(tileX2 - tileX1) + std::abs(tileY2 - tileY1);
+    if (crossings == 0 || crossings > kCad2DMaxSegmentTileCrossings) {
+        piece(x1, y1, x2, y2);
+        return;
+    }
+    // Parameters along the segment where it meets a tile edge, in either axis.
+    cuts.clear();
+    for (int64_t edge = (std::min)(tileX1, tileX2) + 1; edge <= (std::max)(tileX1, tileX2); ++edge) {
+        cuts.push_back((static_cast<double>(edge) * kCad2DPrecisionTileSizeCU - x1) / (x2 - x1));
+    }
+    for (int64_t edge = (std::min)(tileY1, tileY2) + 1; edge <= (std::max)(tileY1, tileY2); ++edge) {
+        cuts.push_back((static_cast<double>(edge) * kCad2DPrecisionTileSizeCU - y1) / (y2 - y1));
+    }
+    std::sort(cuts.begin(), cuts.end());
+    double lastCut = 0.0, ax = x1, ay = y1;
+    for (double cut : cuts) {
+        if (!(cut > lastCut) || cut >= 1.0) continue; // A corner crossing yields the same cut twice.
+        const double bx = x1 + (x2 - x1) * cut, by = y1 + (y2 - y1) * cut;
+        piece(ax, ay, bx, by);
+        ax = bx; ay = by; lastCut = cut;
+    }
+    piece(ax, ay, x2, y2);
+}
+
+// Root constants (b1) for one tile: tile origin minus view center, already rebased in double.
+struct Cad2DTileConstants {
+    Cad2DFloat2 tileOffsetCU;
+};
+static_assert(sizeof(Cad2DTileConstants) == 8, "Cad2DTileConstants is two 32-bit root constants.");
+
+inline Cad2DTileConstants Cad2DMakeTileConstants(double tileOriginXCU, double tileOriginYCU,
+    double viewCenterXCU, double viewCenterYCU) {
+    Cad2DTileConstants constants{};
+    constants.tileOffsetCU = {
+        static_cast<float>(tileOriginXCU - viewCenterXCU),
+        static_cast<float>(tileOriginYCU - viewCenterYCU)
+    };
+    return constants;
+}
+
 struct Cad2DViewState {
     std::atomic<double> centerXCU{ 0.0 };
     std::atomic<double> centerYCU{ 0.0 };
@@ -310,6 +456,93 @@ enum class Cad2DTransformKind : uint32_t {
     Move = 5
 };
 
+// One asset definition's master geometry converted to GPU records once, relative to its base
+// point (small float coordinates). Owned by the copy thread; every instance is a transformed copy
+// (Cad2DTransform*Record). Text stays CPU-side so glyph layout runs on the transformed record.
+struct Cad2DAssetDefinitionGPU {
+    uint64_t revision = 0;
+    double baseX = 0.0;
+    double baseY = 0.0;
+    std::vector<Cad2DLineGPURecord> lines;
+    std::vector<Cad2DCurveGPURecord> curves;
+    std::vector<Cad2DTextRecordCPU> texts;
+};
+
+// Per-instance record transforms. Curves take the rotation / |scale| of the map; a mirroring map
+// reverses arc sweeps, so start / end swap. A circle under non-uniform scale becomes an ellipse.
+// Text keeps reading left to right under mirror (baseline reflects, glyphs do not).
+void Cad2DTransformLineGPURecord(Cad2DLineGPURecord& record, const Cad2DAffine2D& transform);
+void Cad2DTransformCurveGPURecord(Cad2DCurveGPURecord& record, const Cad2DAffine2D& transform);
+void Cad2DTransformTextRecord(Cad2DTextRecordCPU& record, const Cad2DAffine2D& transform);
+
+// CPU record -> GPU record converters (RenderPage2DRecords.cpp). They subtract (originX, originY) in
+// double BEFORE narrowing to float: the origin is the record's precision tile (Cad2DPageGPU) or a
+// definition's base point (asset cache).
+constexpr uint32_t kCad2DMinPolygonLineSegmentCount = 3;
+constexpr uint32_t kCad2DMaxPolygonLineSegmentCount = 16;
+
+Cad2DLineGPURecord Cad2DToGpuLineRecord(const Cad2DLineRecordCPU& line, double originX, double originY);
+Cad2DCurveGPURecord Cad2DToGpuCircleRecord(const Cad2DCircleRecordCPU& circle, double originX, double originY);
+Cad2DCurveGPURecord Cad2DToGpuEllipseRecord(const Cad2DEllipseRecordCPU& ellipse, double originX, double originY);
+Cad2DCurveGPURecord Cad2DToGpuArcRecord(const Cad2DArcRecordCPU& arc, double originX, double originY);
+void Cad2DAppendPolylineLineRecords(const Cad2DPolylineRecordCPU& polyline, double originX, double originY,
+    std::vector<Cad2DLineGPURecord>& gpuLines);
+void Cad2DAppendPolygonLineRecords(const Cad2DPolygonRecordCPU& polygon, double originX, double originY,
+    std::vector<Cad2DLineGPURecord>& gpuLines);
+
+inline uint32_t Cad2DClampedPolygonLineSegmentCount(uint32_t lineSegmentCount) {
+    return std::clamp(lineSegmentCount, kCad2DMinPolygonLineSegmentCount, kCad2DMaxPolygonLineSegmentCount);
+}
+
+// One segment of a line, polyline or polygon record, given in double and narrowed after the rebase.
+template <typename Record>
+Cad2DLineGPURecord Cad2DToGpuLineSegment(const Record& record, double x1, double y1, double x2, double y2,
+    double originX, double originY) {
+    Cad2DLineGPURecord gpuLine{};
+    gpuLine.x1 = static_cast<float>(x1 - originX);
+    gpuLine.y1 = static_cast<float>(y1 - originY);
+    gpuLine.x2 = static_cast<float>(x2 - originX);
+    gpuLine.y2 = static_cast<float>(y2 - originY);
+    gpuLine.lineWeight = record.lineWeight;
+    gpuLine.lineWeightMode = static_cast<uint32_t>(record.lineWeightMode);
+    gpuLine.colorABGR = record.colorABGR;
+    return gpuLine;
+}
+
+// fn(x1, y1, x2, y2) for every segment, in page (or master) coordinates.
+template <typename Fn>
+void Cad2DForEachPolylineSegment(const Cad2DPolylineRecordCPU& polyline, Fn&& fn) {
+    for (size_t i = 1; i < polyline.points.size(); ++i) {
+        fn(polyline.points[i - 1].x, polyline.points[i - 1].y, polyline.points[i].x, polyline.points[i].y);
+    }
+}
+
+template <typename Fn>
+void Cad2DForEachPolygonSegment(const Cad2DPolygonRecordCPU& polygon, Fn&& fn) {
+    if (polygon.radius <= 0.0) return;
+
+    constexpr double kDegreesToRadians = 3.14159265358979323846 / 180.0;
+    const uint32_t lineSegmentCount = Cad2DClampedPolygonLineSegmentCount(polygon.lineSegmentCount);
+    const double angleStep = 360.0 / static_cast<double>(lineSegmentCount);
+    for (uint32_t i = 0; i < lineSegmentCount; ++i) {
+        const double angle0 = (polygon.rotationDegrees + angleStep * static_cast<double>(i)) * kDegreesToRadians;
+        const double angle1 = (polygon.rotationDegrees + angleStep * static_cast<double>((i + 1) % lineSegmentCount)) *
+            kDegreesToRadians;
+        fn(polygon.centerX + std::sin(angle0) * polygon.radius, polygon.centerY + std::cos(angle0) * polygon.radius,
+            polygon.centerX + std::sin(angle1) * polygon.radius, polygon.centerY + std::cos(angle1) * polygon.radius);
+    }
+}
+
+// Re-converts the masters of every definition whose cache entry is missing or stale (revision or
+// base point moved) and drops entries of definitions that are gone. Masters are converted with the
+// base point as origin, so instances far from the origin keep full precision.
+void Cad2DRefreshAssetDefinitionCache(std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU>& cache,
+    const std::vector<Cad2DAssetDefinitionRecordCPU>& definitions,
+    const std::vector<Cad2DLineRecordCPU>& lines, const std::vector<Cad2DPolylineRecordCPU>& polylines,
+    const std::vector<Cad2DPolygonRecordCPU>& polygons, const std::vector<Cad2DCircleRecordCPU>& circles,
+    const std::vector<Cad2DEllipseRecordCPU>& ellipses, const std::vector<Cad2DArcRecordCPU>& arcs,
+    const std::vector<Cad2DTextRecordCPU>& texts);
+
 struct CommandToCopyThread2D {
     CommandToCopyThread2DType type = CommandToCopyThread2DType::AddLine;
     uint64_t id = 0;
@@ -333,6 +566,7 @@ void EnqueueCad2DArc(uint64_t tabID, uint64_t containerMemoryId, Cad2DArcRecordC
 void EnqueueCad2DText(uint64_t tabID, uint64_t containerMemoryId, Cad2DTextRecordCPU text);
 void EnqueueCad2DSelectionRefresh(uint64_t tabID, uint64_t containerMemoryId);
 void EnqueueCad2DIngestStatsReport(uint64_t tabID, uint64_t containerMemoryId);
+void EnqueueCad2DAssetInstancesChanged(uint64_t tabID, uint64_t containerMemoryId);
 bool HasPendingCad2DCopyCommands();
 void PopAllCad2DCopyCommands(std::vector<CommandToCopyThread2D>& outCommands);
 
@@ -350,21 +584,28 @@ void Cad2DBeginTextCreation(DATASETTAB& tab);
 // selection is empty. The following clicks are consumed by Cad2DHandleInput; ESC cancels.
 void Cad2DBeginTransform2D(DATASETTAB& tab, Cad2DTransformKind kind);
 // Converts the current 2D selection into a new asset: creates a Asset2DDefinition (random
-// assetNumber, base point = bounding-box center, hidden master copies) plus the first
-// Asset2DInsert, and re-parents the selected records to that insert. Drawing stays unchanged.
+// assetNumber, base point = bounding-box center), moves the selected records into it as hidden
+// masters and places the first Asset2DInsert in their stead. Selected reference inserts become
+// nested inserts of the new definition. Drawing stays unchanged; the selection becomes the insert.
 void Cad2DCreateAssetFromSelection(DATASETTAB& tab);
 // Arms asset-insert mode: every following Page2D click places an instance of the asset selected
 // in the Insert Asset pane (assetInsertSelectedDefinitionId; falls back to the first definition).
 void Cad2DBeginAssetInsert(DATASETTAB& tab);
 // Reusable asset instantiation, shared by the interactive Insert Asset click path and the DXF
 // importer. Places one instance of the definition (by memory id) at (xCU, yCU) on containerMemoryId:
-// creates a Cad2DAssetInsertRecordCPU and page copies of the definition's master records with the
-// instance transform baked in (member = insert + R(rotation) * S(scale) * (master - base),
-// parentObjectId = the new insert), enqueued for rendering. Negative scale mirrors along that
-// axis. Returns false if the definition id is unknown or a scale is zero / non-finite. Locks the
-// tab's cpuRecordsMutex internally.
+// creates a reference Cad2DAssetInsertRecordCPU only - no member records are copied; the copy
+// thread draws the definition through member = insert + R(rotation) * S(scale) * (master - base).
+// Negative scale mirrors along that axis. enqueueRebuild = false lets bulk callers (DXF import)
+// enqueue one EnqueueCad2DAssetInstancesChanged after the last insert instead of one per insert.
+// Returns false if the definition id is unknown or a scale is zero / non-finite. Locks the tab's
+// cpuRecordsMutex internally.
 bool Cad2DInstantiateAsset(DATASETTAB& tab, uint64_t containerMemoryId, uint64_t definitionObjectId,
-    double xCU, double yCU, double scaleX = 1.0, double scaleY = 1.0, double rotationDegrees = 0.0);
+    double xCU, double yCU, double scaleX = 1.0, double scaleY = 1.0, double rotationDegrees = 0.0,
+    bool enqueueRebuild = true);
+// Marks a definition's master geometry as changed: bumps its revision so the copy thread
+// re-converts it, then enqueues a rebuild. Every instance (nested ones included) picks it up.
+// Call after editing master records or the base point. Locks the tab's cpuRecordsMutex internally.
+void Cad2DInvalidateAssetDefinition(DATASETTAB& tab, uint64_t definitionObjectId);
 // Creates an asset definition from imported master geometry (DXF BLOCK). The master records are
 // stored hidden (containerMemoryId = 0, parentObjectId = the new definition) and never rendered;
 // their coordinates stay in the block's own frame, baseX/baseY is the insert base point. Assigns a
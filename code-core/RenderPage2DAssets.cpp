@@ -0,0 +1,148 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+// Platform-neutral 2D asset instancing: insert transforms, nested-insert expansion and the
+// per-instance record transforms the copy thread applies to a definition's cached GPU records.
+
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CommonNamedNumbers.h"
+#include "RenderPage2D.h"
+
+namespace {
+constexpr double kPiAsset2D = 3.14159265358979323846;
+
+// Rotation and per-axis scale of a map M = R(rotation) * S(scaleX, scaleY). The rotation is the
+// image angle of the x axis; mirrored = det(M) < 0 (the y axis flips). Exact for every transform
+// built from Cad2DAssetInsertTransform; an approximation where nested non-uniform scales shear.
+struct Cad2DAffineParts {
+    double rotationRadians = 0.0;
+    double absScaleX = 1.0;
+    double absScaleY = 1.0;
+    bool mirrored = false;
+};
+
+Cad2DAffineParts DecomposeAffine(const Cad2DAffine2D& transform) {
+    Cad2DAffineParts parts;
+    const double det = transform.Determinant();
+    parts.absScaleX = std::hypot(transform.m00, transform.m10);
+    parts.absScaleY = parts.absScaleX > 1.0e-12 ? std::abs(det) / parts.absScaleX : 0.0;
+    parts.rotationRadians = std::atan2(transform.m10, transform.m00);
+    parts.mirrored = det < 0.0;
+    return parts;
+}
+
+// Angle fields cannot go through the point map: a rotation adds, a reflection negates first.
+double MapAngleRadians(const Cad2DAffineParts& parts, double angle) {
+    return parts.mirrored ? parts.rotationRadians - angle : parts.rotationRadians + angle;
+}
+}
+
+bool Cad2DIsInstancedAssetInsert(const Cad2DAssetInsertRecordCPU& insert) {
+    return insert.schemaVersion >= VishwakarmaStorage::kAsset2DInsertInstancedSchemaVersion;
+}
+
+Cad2DAffine2D Cad2DAssetInsertTransform(const Cad2DAssetInsertRecordCPU& insert,
+    double originX, double originY) {
+    const double theta = insert.rotationDegrees * kPiAsset2D / 180.0;
+    const double cosT = std::cos(theta), sinT = std::sin(theta);
+    Cad2DAffine2D transform;
+    transform.m00 = cosT * insert.scaleX; transform.m01 = -sinT * insert.scaleY;
+    transform.m10 = sinT * insert.scaleX; transform.m11 = cosT * insert.scaleY;
+    transform.tx = insert.x - originX;
+    transform.ty = insert.y - originY;
+    return transform;
+}
+
+void Cad2DExpandAssetInstances(const std::vector<Cad2DAssetDefinitionRecordCPU>& definitions,
+    const std::vector<Cad2DAssetInsertRecordCPU>& inserts, uint64_t containerMemoryId,
+    std::vector<Cad2DAssetInstance>& outInstances) {
+    std::unordered_map<uint64_t, const Cad2DAssetDefinitionRecordCPU*> definitionById;
+    definitionById.reserve(definitions.size());
+    for (const Cad2DAssetDefinitionRecordCPU& definition : definitions) {
+        if (!definition.isDeleted) definitionById.emplace(definition.objectId, &definition);
+    }
+    std::unordered_map<uint64_t, std::vector<const Cad2DAssetInsertRecordCPU*>> nestedByDefinition;
+    for (const Cad2DAssetInsertRecordCPU& insert : inserts) {
+        if (insert.isDeleted || insert.parentObjectId == 0 || !Cad2DIsInstancedAssetInsert(insert)) continue;
+        nestedByDefinition[insert.parentObjectId].push_back(&insert);
+    }
+
+    std::vector<uint64_t> path; // Definitions on the current nesting chain (cycle guard).
+    auto expand = [&](auto& self, const Cad2DAssetInsertRecordCPU& insert, const Cad2DAffine2D& parent,
+        double originX, double originY, uint64_t rootId, uint64_t container) -> void {
+            auto definitionIt = definitionById.find(insert.definitionObjectId);
+            if (definitionIt == definitionById.end()) return;
+            const Cad2DAssetDefinitionRecordCPU& definition = *definitionIt->second;
+            for (uint64_t onPath : path) {
+                if (onPath == definition.objectId) return;
+            }
+
+            const Cad2DAffine2D world =
+                Cad2DComposeAffine(parent, Cad2DAssetInsertTransform(insert, originX, originY));
+            outInstances.push_back({ rootId, container, definition.objectId, world });
+
+            auto nestedIt = nestedByDefinition.find(definition.objectId);
+            if (nestedIt == nestedByDefinition.end()) return;
+            path.push_back(definition.objectId);
+            for (const Cad2DAssetInsertRecordCPU* nested : nestedIt->second) {
+                self(self, *nested, world, definition.baseX, definition.baseY, rootId, container);
+            }
+            path.pop_back();
+        };
+
+    for (const Cad2DAssetInsertRecordCPU& insert : inserts) {
+        if (insert.isDeleted || insert.parentObjectId != 0 || insert.containerMemoryId == 0) continue;
+        if (!Cad2DIsInstancedAssetInsert(insert)) continue;
+        if (containerMemoryId != 0 && insert.containerMemoryId != containerMemoryId) continue;
+        expand(expand, insert, Cad2DAffine2D{}, 0.0, 0.0, insert.objectId, insert.containerMemoryId);
+    }
+}
+
+void Cad2DTransformLineGPURecord(Cad2DLineGPURecord& record, const Cad2DAffine2D& transform) {
+    const Cad2DPoint2D a = transform.Map(record.x1, record.y1);
+    const Cad2DPoint2D b = transform.Map(record.x2, record.y2);
+    record.x1 = static_cast<float>(a.x); record.y1 = static_cast<float>(a.y);
+    record.x2 = static_cast<float>(b.x); record.y2 = static_cast<float>(b.y);
+}
+
+void Cad2DTransformCurveGPURecord(Cad2DCurveGPURecord& record, const Cad2DAffine2D& transform) {
+    const Cad2DAffineParts parts = DecomposeAffine(transform);
+    const Cad2DPoint2D center = transform.Map(record.centerX, record.centerY);
+    record.centerX = static_cast<float>(center.x);
+    record.centerY = static_cast<float>(center.y);
+    record.radiusX = static_cast<float>(record.radiusX * parts.absScaleX);
+    record.radiusY = static_cast<float>(record.radiusY * parts.absScaleY);
+    record.rotationRadians = static_cast<float>(MapAngleRadians(parts, record.rotationRadians));
+
+    if (record.curveType == kCad2DCurveTypeArc) {
+        const Cad2DPoint2D start = transform.Map(record.startX, record.startY);
+        const Cad2DPoint2D end = transform.Map(record.endX, record.endY);
+        const Cad2DPoint2D& first = parts.mirrored ? end : start; // Reflection reverses the CCW sweep.
+        const Cad2DPoint2D& second = parts.mirrored ? start : end;
+        record.startX = static_cast<float>(first.x); record.startY = static_cast<float>(first.y);
+        record.endX = static_cast<float>(second.x); record.endY = static_cast<float>(second.y);
+        return;
+    }
+    if (record.curveType == kCad2DCurveTypeCircle &&
+        std::abs(record.radiusX - record.radiusY) > 1.0e-6f * std::abs(record.radiusX)) {
+        record.curveType = kCad2DCurveTypeEllipse; // Squashed circle; rotation carries the axes.
+    }
+    record.startX = record.centerX + record.radiusX; // Unused by full curves; same as ToGpu*Record.
+    record.startY = record.centerY;
+    record.endX = record.startX;
+    record.endY = record.startY;
+}
+
+void Cad2DTransformTextRecord(Cad2DTextRecordCPU& record, const Cad2DAffine2D& transform) {
+    const Cad2DAffineParts parts = DecomposeAffine(transform);
+    // Map the effective origin (x + offset) like the selection transforms do.
+    const Cad2DPoint2D origin =
+        transform.Map(record.x + (double)record.xOffsetCU, record.y + (double)record.yOffsetCU);
+    record.x = origin.x - (double)record.xOffsetCU;
+    record.y = origin.y - (double)record.yOffsetCU;
+    record.textHeightCU = (float)((double)record.textHeightCU * parts.absScaleY);
+    record.rotationRadians = (float)MapAngleRadians(parts, (double)record.rotationRadians);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+// Platform-neutral CPU record -> GPU record conversion, shared by the copy thread's per-tile build
+// and the asset definition cache.
+
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "RenderPage2D.h"
+
+Cad2DLineGPURecord Cad2DToGpuLineRecord(const Cad2DLineRecordCPU& line, double originX, double originY) {
+    Cad2DLineGPURecord gpuLine{};
+    gpuLine.x1 = static_cast<float>(line.x1 - originX);
+    gpuLine.y1 = static_cast<float>(line.y1 - originY);
+    gpuLine.x2 = static_cast<float>(line.x2 - originX);
+    gpuLine.y2 = static_cast<float>(line.y2 - originY);
+    gpuLine.lineWeight = line.lineWeight;
+    gpuLine.lineWeightMode = static_cast<uint32_t>(line.lineWeightMode);
+    gpuLine.colorABGR = line.colorABGR;
+    return gpuLine;
+}
+
+void Cad2DAppendPolylineLineRecords(const Cad2DPolylineRecordCPU& polyline, double originX, double originY,
+    std::vector<Cad2DLineGPURecord>& gpuLines) {
+    Cad2DForEachPolylineSegment(polyline, [&](double x1, double y1, double x2, double y2) {
+        gpuLines.push_back(Cad2DToGpuLineSegment(polyline, x1, y1, x2, y2, originX, originY));
+        });
+}
+
+void Cad2DAppendPolygonLineRecords(const Cad2DPolygonRecordCPU& polygon, double originX, double originY,
+    std::vector<Cad2DLineGPURecord>& gpuLines) {
+    Cad2DForEachPolygonSegment(polygon, [&](double x1, double y1, double x2, double y2) {
+        gpuLines.push_back(Cad2DToGpuLineSegment(polygon, x1, y1, x2, y2, originX, originY));
+        });
+}
+
+Cad2DCurveGPURecord Cad2DToGpuCircleRecord(const Cad2DCircleRecordCPU& circle, double originX, double originY) {
+    Cad2DCurveGPURecord gpuCurve{};
+    gpuCurve.centerX = static_cast<float>(circle.centerX - originX);
+    gpuCurve.centerY = static_cast<float>(circle.centerY - originY);
+    gpuCurve.radiusX = static_cast<float>(circle.radius);
+    gpuCurve.radiusY = static_cast<float>(circle.radius);
+    gpuCurve.startX = gpuCurve.centerX + gpuCurve.radiusX;
+    gpuCurve.startY = gpuCurve.centerY;
+    gpuCurve.endX = gpuCurve.startX;
+    gpuCurve.endY = gpuCurve.startY;
+    gpuCurve.lineWeight = circle.lineWeight;
+    gpuCurve.lineWeightMode = static_cast<uint32_t>(circle.lineWeightMode);
+    gpuCurve.colorABGR = circle.colorABGR;
+    gpuCurve.curveType = kCad2DCurveTypeCircle;
+    return gpuCurve;
+}
+
+Cad2DCurveGPURecord Cad2DToGpuEllipseRecord(const Cad2DEllipseRecordCPU& ellipse, double originX, double originY) {
+    Cad2DCurveGPURecord gpuCurve{};
+    gpuCurve.centerX = static_cast<float>(ellipse.centerX - originX);
+    gpuCurve.centerY = static_cast<float>(ellipse.centerY - originY);
+    gpuCurve.radiusX = static_cast<float>(ellipse.radiusX);
+    gpuCurve.radiusY = static_cast<float>(ellipse.radiusY);
+    gpuCurve.startX = gpuCurve.centerX + gpuCurve.radiusX;
+    gpuCurve.startY = gpuCurve.centerY;
+    gpuCurve.endX = gpuCurve.startX;
+    gpuCurve.endY = gpuCurve.startY;
+    gpuCurve.lineWeight = ellipse.lineWeight;
+    gpuCurve.lineWeightMode = static_cast<uint32_t>(ellipse.lineWeightMode);
+    gpuCurve.colorABGR = ellipse.colorABGR;
+    gpuCurve.curveType = kCad2DCurveTypeEllipse;
+    gpuCurve.rotationRadians = static_cast<float>(ellipse.rotationRadians);
+    return gpuCurve;
+}
+
+Cad2DCurveGPURecord Cad2DToGpuArcRecord(const Cad2DArcRecordCPU& arc, double originX, double originY) {
+    Cad2DCurveGPURecord gpuCurve{};
+    gpuCurve.centerX = static_cast<float>(arc.centerX - originX);
+    gpuCurve.centerY = static_cast<float>(arc.centerY - originY);
+    gpuCurve.radiusX = static_cast<float>(arc.radiusX);
+    gpuCurve.radiusY = static_cast<float>(arc.radiusY);
+    gpuCurve.startX = static_cast<float>(arc.startX - originX);
+    gpuCurve.startY = static_cast<float>(arc.startY - originY);
+    gpuCurve.endX = static_cast<float>(arc.endX - originX);
+    gpuCurve.endY = static_cast<float>(arc.endY - originY);
+    gpuCurve.lineWeight = arc.lineWeight;
+    gpuCurve.lineWeightMode = static_cast<uint32_t>(arc.lineWeightMode);
+    gpuCurve.colorABGR = arc.colorABGR;
+    gpuCurve.curveType = kCad2DCurveTypeArc;
+    gpuCurve.rotationRadians = static_cast<float>(arc.rotationRadians);
+    return gpuCurve;
+}
+
+void Cad2DRefreshAssetDefinitionCache(std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU>& cache,
+    const std::vector<Cad2DAssetDefinitionRecordCPU>& definitions,
+    const std::vector<Cad2DLineRecordCPU>& lines, const std::vector<Cad2DPolylineRecordCPU>& polylines,
+    const std::vector<Cad2DPolygonRecordCPU>& polygons, const std::vector<Cad2DCircleRecordCPU>& circles,
+    const std::vector<Cad2DEllipseRecordCPU>& ellipses, const std::vector<Cad2DArcRecordCPU>& arcs,
+    const std::vector<Cad2DTextRecordCPU>& texts) {
+    std::unordered_set<uint64_t> liveDefinitions;
+    std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU*> stale;
+    for (const Cad2DAssetDefinitionRecordCPU& definition : definitions) {
+        if (definition.isDeleted) continue;
+        liveDefinitions.insert(definition.objectId);
+        auto cached = cache.find(definition.objectId);
+        if (cached != cache.end() && cached->second.revision == definition.revision &&
+            cached->second.baseX == definition.baseX && cached->second.baseY == definition.baseY) {
+            continue;
+        }
+        Cad2DAssetDefinitionGPU& entry = cache[definition.objectId];
+        entry = Cad2DAssetDefinitionGPU{};
+        entry.revision = definition.revision;
+        entry.baseX = definition.baseX;
+        entry.baseY = definition.baseY;
+        stale.emplace(definition.objectId, &entry);
+    }
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (liveDefinitions.count(it->first) == 0) it = cache.erase(it);
+        else ++it;
+    }
+    if (stale.empty()) return;
+
+    auto convert = [&](const auto& records, auto&& append) {
+        for (const auto& record : records) {
+            if (record.isDeleted || record.containerMemoryId != 0 || record.parentObjectId == 0) continue;
+            auto entryIt = stale.find(record.parentObjectId);
+            if (entryIt == stale.end()) continue;
+            append(*entryIt->second, record);
+        }
+    };
+    convert(lines, [](Cad2DAssetDefinitionGPU& entry, const Cad2DLineRecordCPU& r) {
+        entry.lines.push_back(Cad2DToGpuLineRecord(r, entry.baseX, entry.baseY)); });
+    convert(polylines, [](Cad2DAssetDefinitionGPU& entry, const Cad2DPolylineRecordCPU& r) {
+        Cad2DAppendPolylineLineRecords(r, entry.baseX, entry.baseY, entry.lines); });
+    convert(polygons, [](Cad2DAssetDefinitionGPU& entry, const Cad2DPolygonRecordCPU& r) {
+        Cad2DAppendPolygonLineRecords(r, entry.baseX, entry.baseY, entry.lines); });
+    convert(circles, [](Cad2DAssetDefinitionGPU& entry, const Cad2DCircleRecordCPU& r) {
+        if (r.radius > 0.0) entry.curves.push_back(Cad2DToGpuCircleRecord(r, entry.baseX, entry.baseY)); });
+    convert(ellipses, [](Cad2DAssetDefinitionGPU& entry, const Cad2DEllipseRecordCPU& r) {
+        if (r.radiusX > 0.0 && r.radiusY > 0.0) {
+            entry.curves.push_back(Cad2DToGpuEllipseRecord(r, entry.baseX, entry.baseY));
+        } });
+    convert(arcs, [](Cad2DAssetDefinitionGPU& entry, const Cad2DArcRecordCPU& r) {
+        if (r.radiusX > 0.0 && r.radiusY > 0.0) {
+            entry.curves.push_back(Cad2DToGpuArcRecord(r, entry.baseX, entry.baseY));
+        } });
+    convert(texts, [](Cad2DAssetDefinitionGPU& entry, const Cad2DTextRecordCPU& r) {
+        Cad2DTextRecordCPU local = r;
+        local.x -= entry.baseX;
+        local.y -= entry.baseY;
+        entry.texts.push_back(std::move(local)); });
+}
@@ -1157,6 +1157,35 @@ void ProcessScene3DCopyBatch(const std::vector<CommandToCopyThread>& batch,
                 return it == tabRes.hiddenInstanceMasks.end() ? kVisibleInAllSubTabs : it->second;
                 };
 
+            /* The word-wide form of WriteVisibilityMask, for SET_VISIBILITY_RANGES. `updates` are
+            (gpuInstanceIndex, new word) pairs; sorted by index, every run of ADJACENT indices goes
+            out as one staging region and one CopyBufferRegion instead of one of each per object.
+            Objects added together get adjacent indices, so hiding or showing a whole container is
+            a few large copies rather than millions of 8-byte ones. A span is capped so it stays a
+            sane ring allocation - when the ring is full the fallback is then one committed buffer
+            per 512 KB span, not one per entry (the hazard CLEAR_SUBTAB_HIDES re-queues to avoid). */
+            auto WriteVisibilityMaskRuns = [&](std::vector<std::pair<uint32_t, uint64_t>>& updates) {
+                constexpr size_t kMaxWordsPerCopy = 65536; // 512 KB of staging per span.
+                ForEachVisibilityMaskSpan(updates, kMaxWordsPerCopy, [&](size_t first, size_t last) {
+                    const uint64_t bytes = (last - first) * kVisibilityMaskBytes;
+
+                    uint8_t* mapped = nullptr;
+                    ID3D12Resource* stagingResource = nullptr;
+                    uint64_t stagingOffset = 0;
+                    AcquireStaging(bytes, mapped, stagingResource, stagingOffset);
+                    for (size_t u = first; u < last; ++u) {
+                        const auto& [index, mask] = updates[u];
+                        memcpy(mapped + (u - first) * kVisibilityMaskBytes, &mask, kVisibilityMaskBytes);
+                        if (mask == kVisibleInAllSubTabs) tabRes.hiddenInstanceMasks.erase(index);
+                        else tabRes.hiddenInstanceMasks[index] = mask;
+                    }
+                    commandList->CopyBufferRegion(tabRes.visibilityMask.resource.Get(),
+                        static_cast<uint64_t>(updates[first].first) * kVisibilityMaskBytes,
+                        stagingResource, stagingOffset, bytes);
+                    });
+                gCopyStats.maskWrites.fetch_add(updates.size(), std::memory_order_relaxed);
+                };
+
             uint32_t gpuInstanceIndex; // Stable renderer identity of the object being processed.
             std::unordered_map<uint64_t, GeometryPage*> newestPagesByContainer;
             /* Indices vacated by REMOVE and slots vacated by REMOVE / MODIFY in this chunk. They do
@@ -1385,6 +1414,51 @@ void ProcessScene3DCopyBatch(const std::vector<CommandToCopyThread>& batch,
                     }
                     break;
 
+                case CommandToCopyThreadType::SET_VISIBILITY_RANGES:
+                    /* Bulk hide / show: one command for a whole ribbon action. Only words whose
+                    bit actually changes are collected, then written span-wise.
+
+                    Whole-container SHOW walks the hidden-object shadow, so it costs what is hidden
+                    rather than what exists - "Show All" on an unhidden 10M scene writes nothing.
+                    Whole-container HIDE has no such shortcut and sweeps the dense registry; it
+                    comes out already in index order, which is the order the spans want. */
+                    {
+                        const uint64_t bits = cmd.visibilityBits;
+                        auto updatedMask = [&](uint64_t current) {
+                            return cmd.visibilityVisible ? (current | bits) : (current & ~bits);
+                        };
+                        std::vector<std::pair<uint32_t, uint64_t>> updates;
+                        if (cmd.visibilityWholeContainer && cmd.visibilityVisible) {
+                            for (const auto& [index, mask] : tabRes.hiddenInstanceMasks) {
+                                if ((mask & bits) == bits) continue;
+                                const GeometryPage* page = tabRes.registry[index].page;
+                                if (!page || page->containerMemoryId != cmd.containerMemoryId) continue;
+                                updates.emplace_back(index, mask | bits);
+                            }
+                        } else if (cmd.visibilityWholeContainer) {
+                            for (uint32_t index = 0; index < tabRes.instanceCount; ++index) {
+                                const InstanceRegistryEntry& entry = tabRes.registry[index];
+                                if (entry.memoryID == 0 || !entry.page ||
+                                    entry.page->containerMemoryId != cmd.containerMemoryId) continue;
+                                const uint64_t current = CurrentVisibilityMask(index);
+                                if ((current & bits) != 0) updates.emplace_back(index, current & ~bits);
+                            }
+                        } else if (cmd.visibilityIdRuns) {
+                            const std::vector<uint64_t>& runs = *cmd.visibilityIdRuns;
+                            for (size_t r = 0; r + 1 < runs.size(); r += 2) {
+                                for (uint64_t id = runs[r]; id <= runs[r + 1]; ++id) {
+                                    const uint32_t index = tabRes.registry.Find(id);
+                                    if (index == kInvalidInstanceIndex) continue; // Not on the GPU yet.
+                                    const uint64_t current = CurrentVisibilityMask(index);
+                                    const uint64_t updated = updatedMask(current);
+                                    if (updated != current) updates.emplace_back(index, updated);
+                                }
+                            }
+                        }
+                        if (!updates.empty()) WriteVisibilityMaskRuns(updates);
+                    }
+                    break;
+
                 case CommandToCopyThreadType::CLEAR_SUBTAB_HIDES:
                     /* A sub-tab slot has been retired and its bit is about to be reused. Force that
                     bit back ON everywhere, so hides authored for the old view do not silently
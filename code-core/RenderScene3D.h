@@ -10,6 +10,7 @@
 #include <condition_variable>
 #include <cstddef> // offsetof, used by the VisibleIndirectCommand alignment asserts.
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
@@ -17,6 +18,7 @@
 
 #include "ConstantsApplication.h" // MV_MAX_CONTAINERS_PER_SUBTAB
 #include "डेटा.h" // GeometryData: the vertex/index payload carried by CommandToCopyThread.
+#include "VisibilityRuns.h" // SET_VISIBILITY_RANGES run lists and mask spans.
 
 /* The set of containers one SubTab draws (graphics.md, 10M plan Step 6, item 3). A SubTab holds a
 SET of containers of a single type - never a mix, because a mixed SubTab would have ambiguous
@@ -267,13 +269,13 @@ static_assert(sizeof(GeometryPlacementRecordInPage) == 64,
 
 /* Commands sent from Generator thread(s) to the Copy thread.
 
-SET_VISIBILITY / CLEAR_SUBTAB_HIDES carry no geometry and touch no geometry page: they are pure
+SET_VISIBILITY / SET_VISIBILITY_RANGES / CLEAR_SUBTAB_HIDES carry no geometry and touch no geometry page: they are pure
 VisibilityMask writes (10M plan Step 5), which is exactly why hide/show costs nothing proportional
 to the scene. Note that they must be kept OUT of the per-object deduplication pass in
 ProcessScene3DCopyBatch - that pass keys on `id` alone, so an ADD and a hide of the same object in
 one batch would collapse to whichever came last and the geometry would silently never be uploaded. */
 enum class CommandToCopyThreadType { NONE = 0, ADD, MODIFY, REMOVE, SET_VISIBILITY,
-    CLEAR_SUBTAB_HIDES };
+    CLEAR_SUBTAB_HIDES, SET_VISIBILITY_RANGES };
 struct CommandToCopyThread
 {
     CommandToCopyThreadType type;
@@ -282,14 +284,24 @@ struct CommandToCopyThread
     uint64_t tabID = 0; // NEW: We must know which tab this object belongs to!
     uint64_t containerMemoryId = 0; // Parent high-level container; pages never mix container IDs.
     /* Which SubTab bit a mask command addresses, as a pre-shifted word (1ull << subTabSlot).
-       SET_VISIBILITY    : change this bit on the object named by `id`.
-       CLEAR_SUBTAB_HIDES: force this bit back ON for every object the tab currently hides (`id` is
-       unused), so a retired sub-tab slot does not hand its hides to whatever reuses the slot.
+       SET_VISIBILITY       : change this bit on the object named by `id`.
+       SET_VISIBILITY_RANGES: change this bit on every object named by `visibilityIdRuns`, or on
+       every object parented to `containerMemoryId` when `visibilityWholeContainer` is set.
+       CLEAR_SUBTAB_HIDES   : force this bit back ON for every object the tab currently hides (`id`
+       is unused), so a retired sub-tab slot does not hand its hides to whatever reuses the slot.
        The producer sends a BIT, not a whole word, because only the copy thread knows an object's
        current membership - keeping that state in one place is what stops the two threads from
        having to agree on a shared shadow. */
     uint64_t visibilityBits = 0;
-    bool visibilityVisible = true; // SET_VISIBILITY only: set the bit (show) or clear it (hide).
+    bool visibilityVisible = true; // SET_VISIBILITY(_RANGES): set the bit (show) or clear it (hide).
+    /* SET_VISIBILITY_RANGES only. One command for a whole hide / show action instead of one per
+    object: "Show All" on a 10M-object scene used to queue 10M of these structs, each dragging an
+    empty std::optional<GeometryData> along. The runs are flattened inclusive [first, last] memoryID
+    pairs, ascending and non-overlapping - memoryIDs are handed out sequentially, so a container's
+    objects collapse to a handful of runs however many there are. Shared rather than owned because
+    the batch is copied out of the queue by value. */
+    bool visibilityWholeContainer = false;
+    std::shared_ptr<const std::vector<uint64_t>> visibilityIdRuns;
 };
 
 /* A MODIFY carrying a world matrix but NO vertices or indices is a TRANSFORM-ONLY edit: the copy
@@ -307,6 +319,7 @@ inline bool IsTransformOnlyEdit(const CommandToCopyThread& command) {
 // deduplication pass (see CommandToCopyThreadType above).
 inline bool IsVisibilityCommand(const CommandToCopyThread& command) {
     return command.type == CommandToCopyThreadType::SET_VISIBILITY ||
+        command.type == CommandToCopyThreadType::SET_VISIBILITY_RANGES ||
         command.type == CommandToCopyThreadType::CLEAR_SUBTAB_HIDES;
 }
 
@@ -320,11 +333,17 @@ inline uint64_t EstimateStagingBytes(const CommandToCopyThread& command) {
     // A mask write is one 8-byte staging region and nothing else - no record, no redirect, no
     // geometry (10M plan Step 5). CLEAR_SUBTAB_HIDES fans out over the tab's hidden objects, whose
     // count only the copy thread knows; it is charged one entry here and re-checked against the
-    // ring as it writes, the same way an oversize geometry payload is.
+    // ring as it writes, the same way an oversize geometry payload is. A whole-container
+    // SET_VISIBILITY_RANGES is in the same position; a run list is charged for every id it names.
     if (command.type == CommandToCopyThreadType::SET_VISIBILITY ||
         command.type == CommandToCopyThreadType::CLEAR_SUBTAB_HIDES) {
         return kVisibilityMaskBytes;
     }
+    if (command.type == CommandToCopyThreadType::SET_VISIBILITY_RANGES) {
+        if (command.visibilityWholeContainer || !command.visibilityIdRuns) return kVisibilityMaskBytes;
+        const uint64_t ids = VisibilityRunIdCount(*command.visibilityIdRuns);
+        return (ids ? ids : 1) * kVisibilityMaskBytes;
+    }
     if (!command.geometry.has_value()) return 0;
     const GeometryData& geometry = *command.geometry;
     return geometry.vertices.size() * sizeof(Vertex) + geometry.indices.size() * sizeof(uint16_t)
@@ -7,10 +7,13 @@
 #include <lunasvg.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 
 namespace {
@@ -34,6 +37,101 @@ bool DecompressSVG(const SVGIconRenderer::Embedded::CompressedSVGIcon& icon, std
     return true;
 }
 
+#if defined(LUNASVG_VERSION_MAJOR)
+constexpr uint32_t kLunaSVGVersion =
+    LUNASVG_VERSION_MAJOR * 10000u + LUNASVG_VERSION_MINOR * 100u + LUNASVG_VERSION_MICRO;
+#else
+constexpr uint32_t kLunaSVGVersion = 0;
+#endif
+
+// Renders one icon. `deferText`: leave an SVG containing <text> untouched and return false with
+// `deferred` set - see RasterizeEmbeddedSVGIcons.
+bool RasterizeIcon(const SVGIconRenderer::Embedded::CompressedSVGIcon& icon, int pixelSize, bool deferText,
+    bool& deferred, SVGIconRenderer::RenderedSVGIcon& rendered) {
+    deferred = false;
+    std::string svgText;
+    if (!DecompressSVG(icon, svgText)) return false;
+    if (deferText && svgText.find("<text") != std::string::npos) {
+        deferred = true;
+        return false;
+    }
+
+    std::unique_ptr<lunasvg::Document> document =
+        lunasvg::Document::loadFromData(svgText.data(), svgText.size());
+    if (!document) {
+        std::cerr << "Failed to parse embedded SVG icon: " << icon.fileName << "\n";
+        return false;
+    }
+
+    // Height drives the raster; width follows the SVG's own aspect ratio. Passing both would
+    // make lunasvg scale x and y independently, squashing a wide icon (the विश्वकर्मा
+    // word-mark) into a square. Every square icon still comes out pixelSize x pixelSize.
+    lunasvg::Bitmap bitmap = document->renderToBitmap(-1, pixelSize, 0x00000000u);
+    if (bitmap.isNull() || bitmap.width() <= 0 || bitmap.height() <= 0) {
+        std::cerr << "Failed to rasterize embedded SVG icon: " << icon.fileName << "\n";
+        return false;
+    }
+
+    bitmap.convertToRGBA();
+
+    rendered.id = icon.id;
+    rendered.fileName = icon.fileName;
+    rendered.width = bitmap.width();
+    rendered.height = bitmap.height();
+    rendered.rgba.resize(static_cast<size_t>(rendered.width) * rendered.height * 4u);
+
+    const int rowBytes = rendered.width * 4;
+    const uint8_t* sourcePixels = bitmap.data();
+    uint8_t* destinationPixels = rendered.rgba.data();
+    for (int y = 0; y < rendered.height; ++y) {
+        std::memcpy(destinationPixels + static_cast<size_t>(y) * rowBytes,
+            sourcePixels + static_cast<size_t>(y) * bitmap.stride(),
+            static_cast<size_t>(rowBytes));
+    }
+    return true;
+}
+
+/* Every icon is an independent document, so they are spread over a few threads taking rows off a
+shared counter. The exception is an SVG with <text>: lunasvg resolves fonts through one process-wide
+font cache that fills itself lazily, so those few are left to the calling thread after the join.
+Results land in their manifest row and are compacted afterwards, so the output order - which decides
+the atlas layout - does not depend on thread timing. */
+std::vector<SVGIconRenderer::RenderedSVGIcon> RasterizeEmbeddedSVGIcons(int pixelSize) {
+    using SVGIconRenderer::Embedded::kSVGIcons;
+    using SVGIconRenderer::Embedded::kSVGIconCount;
+    constexpr unsigned kMaxRasterThreads = 8;
+    std::vector<SVGIconRenderer::RenderedSVGIcon> slots(kSVGIconCount);
+    std::vector<uint8_t> deferredRows(kSVGIconCount, 0);
+    std::atomic<size_t> nextRow{ 0 };
+    auto worker = [&]() {
+        for (size_t row; (row = nextRow.fetch_add(1, std::memory_order_relaxed)) < kSVGIconCount; ) {
+            bool deferred = false;
+            RasterizeIcon(kSVGIcons[row], pixelSize, true, deferred, slots[row]);
+            deferredRows[row] = deferred ? 1 : 0;
+        }
+    };
+
+    const unsigned hardwareThreads = (std::max)(1u, std::thread::hardware_concurrency());
+    const unsigned threadCount = (std::min)({ hardwareThreads, kMaxRasterThreads,
+        static_cast<unsigned>(kSVGIconCount) });
+    std::vector<std::thread> helpers;
+    for (unsigned t = 1; t < threadCount; ++t) helpers.emplace_back(worker);
+    worker();
+    for (std::thread& helper : helpers) helper.join();
+
+    for (size_t row = 0; row < kSVGIconCount; ++row) {
+        bool deferred = false;
+        if (deferredRows[row]) RasterizeIcon(kSVGIcons[row], pixelSize, false, deferred, slots[row]);
+    }
+
+    std::vector<SVGIconRenderer::RenderedSVGIcon> renderedIcons;
+    renderedIcons.reserve(kSVGIconCount);
+    for (SVGIconRenderer::RenderedSVGIcon& icon : slots) {
+        if (!icon.rgba.empty()) renderedIcons.push_back(std::move(icon));
+    }
+    return renderedIcons;
+}
+
 } // namespace
 
 namespace SVGIconRenderer {
@@ -47,53 +145,12 @@ bool HasEmbeddedSVGIcon(uint32_t iconID) noexcept {
 }
 
 std::vector<RenderedSVGIcon> RenderEmbeddedSVGIcons(int pixelSize) {
-    std::vector<RenderedSVGIcon> renderedIcons;
-    if (pixelSize <= 0) return renderedIcons;
-
-    renderedIcons.reserve(Embedded::kSVGIconCount);
-
-    for (const auto& icon : Embedded::kSVGIcons) {
-        std::string svgText;
-        if (!DecompressSVG(icon, svgText)) continue;
-
-        std::unique_ptr<lunasvg::Document> document =
-            lunasvg::Document::loadFromData(svgText.data(), svgText.size());
-        if (!document) {
-            std::cerr << "Failed to parse embedded SVG icon: " << icon.fileName << "\n";
-            continue;
-        }
-
-        // Height drives the raster; width follows the SVG's own aspect ratio. Passing both would
-        // make lunasvg scale x and y independently, squashing a wide icon (the विश्वकर्मा
-        // word-mark) into a square. Every square icon still comes out pixelSize x pixelSize.
-        lunasvg::Bitmap bitmap = document->renderToBitmap(-1, pixelSize, 0x00000000u);
-        if (bitmap.isNull() || bitmap.width() <= 0 || bitmap.height() <= 0) {
-            std::cerr << "Failed to rasterize embedded SVG icon: " << icon.fileName << "\n";
-            continue;
-        }
-
-        bitmap.convertToRGBA();
-
-        RenderedSVGIcon rendered{};
-        rendered.id = icon.id;
-        rendered.fileName = icon.fileName;
-        rendered.width = bitmap.width();
-        rendered.height = bitmap.height();
-        rendered.rgba.resize(static_cast<size_t>(rendered.width) * rendered.height * 4u);
-
-        const int rowBytes = rendered.width * 4;
-        const uint8_t* sourcePixels = bitmap.data();
-        uint8_t* destinationPixels = rendered.rgba.data();
-        for (int y = 0; y < rendered.height; ++y) {
-            std::memcpy(destinationPixels + static_cast<size_t>(y) * rowBytes,
-                sourcePixels + static_cast<size_t>(y) * bitmap.stride(),
-                static_cast<size_t>(rowBytes));
-        }
+    if (pixelSize <= 0) return {};
+    return RasterizeEmbeddedSVGIcons(pixelSize);
+}
 
-        renderedIcons.push_back(std::move(rendered));
-    }
+uint64_t EmbeddedManifestHash() noexcept { return Embedded::kSVGIconManifestHash; }
 
-    return renderedIcons;
-}
+uint32_t RasterizerVersion() noexcept { return kLunaSVGVersion; }
 
 } // namespace SVGIconRenderer
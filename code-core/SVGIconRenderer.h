@@ -21,6 +21,13 @@ constexpr char32_t IconForID(uint32_t iconID) noexcept {
 }
 
 bool HasEmbeddedSVGIcon(uint32_t iconID) noexcept;
+// Every embedded icon rasterized at `pixelSize` px high, in manifest order. Uncached: the finished
+// atlas is what gets cached (IconAtlasImage.h).
 std::vector<RenderedSVGIcon> RenderEmbeddedSVGIcons(int pixelSize);
 
+// What RenderEmbeddedSVGIcons' output depends on besides the size, for cache keys: the embedded
+// manifest's hash (ids, file names and SVG bytes) and the lunasvg version it was built against.
+uint64_t EmbeddedManifestHash() noexcept;
+uint32_t RasterizerVersion() noexcept;
+
 } // namespace SVGIconRenderer
@@ -0,0 +1,143 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+/* The camera distance of Zoom Max / Zoom Focus (ZoomSceneToExtents): how far behind its target the
+camera has to sit, along its current view direction, for a set of objects to fit the frustum. No
+Windows or DirectX dependency - any type with .x/.y/.z (and .w for a quaternion) will do - so
+validations/SceneExtentsFitTest.cpp checks it against the per-vertex answer it replaced.
+
+With the camera at distance d behind the target, a point at offset o from the target has depth
+d + o.forward and is inside the frustum when |o.right| <= depth * tanHalfFovX (same for up). So the
+minimum d over a point set is the largest of its support values o.direction along
+    right/tanX - forward, -right/tanX - forward, up/tanY - forward, -up/tanY - forward
+plus nearZ + o.(-forward) for the near plane. Per object those supports are bounded from its cached
+authored box (center reach + |extents| . |direction in authored space|) and sphere (center reach +
+radius * |direction|), taking the tighter of the two: never below the per-vertex answer, equal to
+it whenever the box hugs the mesh. The four lateral directions are four lanes of one array, so each
+object costs a few dot products and no mesh. */
+class SceneExtentsFit {
+public:
+    // Camera frame: target point, unit forward / right / up, half-FOV tangents (margin included).
+    template <typename V3>
+    SceneExtentsFit(const V3& target, const V3& forward, const V3& right, const V3& up,
+        float tanHalfFovX, float tanHalfFovY)
+        : target{ target.x, target.y, target.z }, forward{ forward.x, forward.y, forward.z } {
+        const Vec r{ right.x / tanHalfFovX, right.y / tanHalfFovX, right.z / tanHalfFovX };
+        const Vec u{ up.x / tanHalfFovY, up.y / tanHalfFovY, up.z / tanHalfFovY };
+        const Vec f = this->forward;
+        directions[0] = { r.x - f.x, r.y - f.y, r.z - f.z };
+        directions[1] = { -r.x - f.x, -r.y - f.y, -r.z - f.z };
+        directions[2] = { u.x - f.x, u.y - f.y, u.z - f.z };
+        directions[3] = { -u.x - f.x, -u.y - f.y, -u.z - f.z };
+        for (int lane = 0; lane < 4; ++lane) {
+            directionLengths[lane] = std::sqrt(Dot(directions[lane], directions[lane]));
+            targetReach[lane] = Dot(this->target, directions[lane]);
+        }
+    }
+
+    // An object by its cached AUTHORED-space box (center, half extents) and bounding sphere (same
+    // center), never moved: authored is world.
+    template <typename V3>
+    void AddBounds(const V3& center, const V3& extents, float radius) {
+        static const Vec kIdentityAxes[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+        AddWorldBounds({ center.x, center.y, center.z }, kIdentityAxes, { extents.x, extents.y, extents.z }, radius);
+    }
+
+    // The same, for an object placed by Placement3D: rotate by the unit quaternion (x, y, z, w), then
+    // translate by origin - what the vertex shader applies, so the fit matches what is on screen.
+    template <typename V3, typename Q4>
+    void AddBounds(const V3& center, const V3& extents, float radius, const V3& origin, const Q4& rotation) {
+        const float x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
+        // World images of the authored x, y and z axes (the rotation matrix's columns).
+        const Vec axes[3] = {
+            { 1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w) },
+            { 2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w) },
+            { 2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y) } };
+        const Vec worldCenter{
+            origin.x + axes[0].x * center.x + axes[1].x * center.y + axes[2].x * center.z,
+            origin.y + axes[0].y * center.x + axes[1].y * center.y + axes[2].y * center.z,
+            origin.z + axes[0].z * center.x + axes[1].z * center.y + axes[2].z * center.z };
+        AddWorldBounds(worldCenter, axes, { extents.x, extents.y, extents.z }, radius);
+    }
+
+    // One world-space point: the exact per-vertex fit the bounds replace.
+    template <typename V3>
+    void AddPoint(const V3& point) {
+        const Vec p{ point.x, point.y, point.z };
+        for (int lane = 0; lane < 4; ++lane) {
+            lateralReach[lane] = (std::max)(lateralReach[lane], Dot(p, directions[lane]) - targetReach[lane]);
+        }
+        nearReach = (std::max)(nearReach, -Dot({ p.x - target.x, p.y - target.y, p.z - target.z }, forward));
+        empty = false;
+    }
+
+    bool Empty() const { return empty; }
+
+    // Distance behind the target at which everything added fits, the near plane included; 0 if nothing was added.
+    float RequiredDistance(float nearZ) const {
+        if (empty) return 0.0f;
+        return (std::max)({ 0.0f, lateralReach[0], lateralReach[1], lateralReach[2], lateralReach[3],
+            nearZ + nearReach });
+    }
+
+private:
+    struct Vec { float x, y, z; };
+    static float Dot(const Vec& a, const Vec& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    void AddWorldBounds(const Vec& center, const Vec axes[3], const Vec& extents, float radius) {
+        for (int lane = 0; lane < 4; ++lane) {
+            const Vec& d = directions[lane];
+            const float boxReach = extents.x * std::abs(Dot(axes[0], d)) + extents.y * std::abs(Dot(axes[1], d)) +
+                extents.z * std::abs(Dot(axes[2], d));
+            lateralReach[lane] = (std::max)(lateralReach[lane],
+                Dot(center, d) - targetReach[lane] + (std::min)(boxReach, radius * directionLengths[lane]));
+        }
+        const float boxForwardReach = extents.x * std::abs(Dot(axes[0], forward)) +
+            extents.y * std::abs(Dot(axes[1], forward)) + extents.z * std::abs(Dot(axes[2], forward));
+        const float alongForward = Dot({ center.x - target.x, center.y - target.y, center.z - target.z }, forward);
+        nearReach = (std::max)(nearReach, -alongForward + (std::min)(boxForwardReach, radius));
+        empty = false;
+    }
+
+    Vec target, forward;
+    Vec directions[4];
+    float directionLengths[4];
+    float targetReach[4];
+    float lateralReach[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+    float nearReach = -FLT_MAX;
+    bool empty = true;
+};
+
+// Authored-space box (center, half extents) and bounding sphere about the box center of a mesh's
+// vertices (anything with .position.x/y/z), as StoredGeometryObject3D caches them. False when empty.
+template <typename Vertex, typename V3>
+bool SceneBoundsOfVertices(const std::vector<Vertex>& vertices, V3& center, V3& extents, float& radius) {
+    if (vertices.empty()) return false;
+    float low[3] = { vertices[0].position.x, vertices[0].position.y, vertices[0].position.z };
+    float high[3] = { low[0], low[1], low[2] };
+    for (const Vertex& vertex : vertices) {
+        const float p[3] = { vertex.position.x, vertex.position.y, vertex.position.z };
+        for (int axis = 0; axis < 3; ++axis) {
+            low[axis] = (std::min)(low[axis], p[axis]);
+            high[axis] = (std::max)(high[axis], p[axis]);
+        }
+    }
+    center.x = 0.5f * (low[0] + high[0]);
+    center.y = 0.5f * (low[1] + high[1]);
+    center.z = 0.5f * (low[2] + high[2]);
+    extents.x = 0.5f * (high[0] - low[0]);
+    extents.y = 0.5f * (high[1] - low[1]);
+    extents.z = 0.5f * (high[2] - low[2]);
+    float radiusSq = 0.0f;
+    for (const Vertex& vertex : vertices) {
+        const float dx = vertex.position.x - center.x, dy = vertex.position.y - center.y, dz = vertex.position.z - center.z;
+        radiusSq = (std::max)(radiusSq, dx * dx + dy * dy + dz * dz);
+    }
+    radius = std::sqrt(radiusSq);
+    return true;
+}
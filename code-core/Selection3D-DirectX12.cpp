@@ -5,7 +5,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <unordered_set>
 
 // Generated shader byte-code headers (see FxCompile entries in Vishwakarma.vcxproj).
 #include "ShaderSceneVertex_16.h"           // g_sceneVertexShader16   (reused by the highlight PSO)
@@ -384,13 +383,12 @@ void RecordSelectionOverlays(ID3D12GraphicsCommandList* commandList, DX12Resourc
     if (!commandList || !tabRes.selection3D.initialized || sceneHeight <= 0) return;
 
     // --- Highlight the selected objects in deep blue -------------------------------------------
-    std::vector<uint64_t> selectedCopy;
+    SelectionSet selectedCopy; // Copied with its hash index, so the page walk below tests O(1).
     {
         std::lock_guard<std::mutex> lock(selection.selectedMutex);
         selectedCopy = selection.selectedObjectIds;
     }
-    if (!selectedCopy.empty() && !containers.Empty()) {
-        std::unordered_set<uint64_t> selectedSet(selectedCopy.begin(), selectedCopy.end());
+    if (!selectedCopy.Empty() && !containers.Empty()) {
         GeometryPageSnapshot* snapshot = storage.activeSnapshot.load(std::memory_order_acquire);
         if (snapshot) {
             commandList->SetGraphicsRootSignature(tabRes.rootSignature.Get());
@@ -406,7 +404,7 @@ void RecordSelectionOverlays(ID3D12GraphicsCommandList* commandList, DX12Resourc
             ForEachSubTabPage(*snapshot, containers, [&](GeometryPage& page) {
                 bool boundBuffers = false;
                 for (const GeometryPlacementRecordInPage& obj : page.objects) {
-                    if (obj.isDeleted || selectedSet.find(obj.objectID) == selectedSet.end()) continue;
+                    if (obj.isDeleted || !selectedCopy.Contains(obj.objectID)) continue;
                     if (!boundBuffers) { BindPageBuffers(commandList, page); boundBuffers = true; }
                     // Absolute (page-base-relative), matching the IBV bound at the page base.
                     const UINT startIndex =
@@ -28,6 +28,8 @@ SelectionState. */
 #include <mutex>
 #include <vector>
 
+#include "SelectionSet.h"
+
 // Forward declarations (full definitions live in MemoryManagerGPU-DirectX12.h).
 struct DX12ResourcesPerTab;
 struct DX12ResourcesPerWindow;
@@ -54,7 +56,7 @@ constexpr uint64_t kNavCubeVisibleMs = 700;
 struct SelectionState {
     // Selected object ids. Written by the logic thread, copied by the render thread each frame.
     std::mutex selectedMutex;
-    std::vector<uint64_t> selectedObjectIds;
+    SelectionSet selectedObjectIds;
 
     // Pick request: logic thread -> render thread.
     std::atomic<bool> pickRequested{ false };
@@ -0,0 +1,90 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/* Insertion-ordered object ids plus a dense open-addressed index over them, so membership is O(1)
+and a selection-driven operation walks only the selected objects. The vector it replaced made every
+move / hide / zoom O(objects x selected): hiding 50k selected members of a 1M-object model took minutes.
+
+Each id carries a hint: the object's slot in DATASETTAB::storageObjects3D at the time it was
+selected (kNoStoredIndex when unknown). Consumers must check the slot still holds the same memoryId
+before trusting it - the store is append-only but cleared wholesale on tab reset. Plain data,
+copyable, guarded by SelectionState::selectedMutex. No Windows dependency, so validations/ tests it
+against std::unordered_set. */
+class SelectionSet {
+public:
+    static constexpr uint32_t kNoStoredIndex = 0xFFFFFFFFu;
+
+    bool Empty() const { return ids.empty(); }
+    size_t Size() const { return ids.size(); }
+    const std::vector<uint64_t>& Ids() const { return ids; }                  // Insertion order.
+    const std::vector<uint32_t>& StoredIndices() const { return storedIndices; } // Parallel to Ids().
+
+    bool Contains(uint64_t id) const { return !table.empty() && table[FindBucket(id)] != 0; }
+
+    void Clear() { ids.clear(); storedIndices.clear(); table.clear(); }
+
+    // Returns false (and leaves the existing hint alone) when id is already selected.
+    bool Insert(uint64_t id, uint32_t storedIndex = kNoStoredIndex) {
+        if ((ids.size() + 1) * 2 > table.size()) Rehash((ids.size() + 1) * 2);
+        uint32_t& bucket = table[FindBucket(id)];
+        if (bucket != 0) return false;
+        ids.push_back(id);
+        storedIndices.push_back(storedIndex);
+        bucket = static_cast<uint32_t>(ids.size()); // Position + 1; 0 marks an empty bucket.
+        return true;
+    }
+
+    // Keeps insertion order, so it is O(ids after the erased one): fine for Ctrl+click toggling, not
+    // for bulk edits. The bucket is emptied by backward-shift deletion (no tombstones), then the
+    // later ids' buckets are renumbered one down before the vectors close the gap.
+    bool Erase(uint64_t id) {
+        if (!Contains(id)) return false;
+        size_t hole = FindBucket(id);
+        const size_t position = table[hole] - 1;
+        const size_t mask = table.size() - 1;
+        for (size_t next = (hole + 1) & mask; table[next] != 0; next = (next + 1) & mask) {
+            // An entry may fill the hole when the hole lies on its probe path (home .. next).
+            const size_t home = static_cast<size_t>(Mix(ids[table[next] - 1])) & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                table[hole] = table[next];
+                hole = next;
+            }
+        }
+        table[hole] = 0;
+        // Lookups while renumbering still compare against the unshifted vectors, whose ids stay distinct.
+        for (size_t i = position + 1; i < ids.size(); ++i) --table[FindBucket(ids[i])];
+        ids.erase(ids.begin() + position);
+        storedIndices.erase(storedIndices.begin() + position);
+        return true;
+    }
+
+private:
+    // splitmix64 finalizer: MemoryIDs are sequential, which would cluster under the identity hash.
+    static uint64_t Mix(uint64_t id) {
+        id = (id ^ (id >> 30)) * 0xBF58476D1CE4E5B9ull;
+        id = (id ^ (id >> 27)) * 0x94D049BB133111EBull;
+        return id ^ (id >> 31);
+    }
+
+    // Linear probing: the bucket holding id, or the empty bucket where it would go.
+    size_t FindBucket(uint64_t id) const {
+        const size_t mask = table.size() - 1;
+        size_t bucket = static_cast<size_t>(Mix(id)) & mask;
+        while (table[bucket] != 0 && ids[table[bucket] - 1] != id) bucket = (bucket + 1) & mask;
+        return bucket;
+    }
+
+    void Rehash(size_t minimumBuckets) {
+        size_t buckets = 16;
+        while (buckets < minimumBuckets) buckets *= 2;
+        table.assign(buckets, 0);
+        for (size_t i = 0; i < ids.size(); ++i) table[FindBucket(ids[i])] = static_cast<uint32_t>(i + 1);
+    }
+
+    std::vector<uint64_t> ids;
+    std::vector<uint32_t> storedIndices;
+    std::vector<uint32_t> table; // Power-of-two buckets, at most half full.
+};
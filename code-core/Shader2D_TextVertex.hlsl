@@ -1,12 +1,18 @@
 // Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
 
 cbuffer Cad2DViewConstants : register(b0) {
-    float2 viewCenterCU;
     float zoomPixelsPerCU;
     float dpiY;
     float2 viewportSizePx;
     float minLineWeightPx;
     float padding0;
+    float2 padding1;
+};
+
+// Record coordinates are relative to their precision tile; tileOffsetCU = tile origin - view
+// center, subtracted in double on the CPU (RenderPage2D.h, Cad2DTileConstants).
+cbuffer Cad2DTileConstants : register(b1) {
+    float2 tileOffsetCU;
 };
 
 struct VSInput {
@@ -24,7 +30,7 @@ struct PSInput {
 };
 
 float4 ModelToClip(float2 pCU) {
-    float2 delta = pCU - viewCenterCU;
+    float2 delta = pCU + tileOffsetCU;
     float2 screenPx = float2(
         viewportSizePx.x * 0.5 + delta.x * zoomPixelsPerCU,
         viewportSizePx.y * 0.5 - delta.y * zoomPixelsPerCU);
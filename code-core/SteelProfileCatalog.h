@@ -2,6 +2,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string_view>
 
 /* Compile-time embedded copy of the hot-rolled steel section catalog
 (Catalog/profiles_hot_*.csv). Design doc: website/content/civil/SteelTable.md.
@@ -59,3 +60,72 @@ inline const SteelProfileRecord* FindSteelProfileById(uint64_t id) {
     if (low < kSteelProfileCount && kSteelProfiles[low].id == id) return &kSteelProfiles[low];
     return nullptr;
 }
+
+// Row of kSteelProfiles, for in-memory references that never outlive the process (import
+// batches): two bytes instead of a designation string. Persisted data keeps the catalog id.
+using SteelProfileIndex = uint16_t;
+inline constexpr SteelProfileIndex kNoSteelProfile = 0xFFFF;
+static_assert(kSteelProfileCount < kNoSteelProfile, "catalog outgrew SteelProfileIndex");
+
+// Multiply-xorshift over four bytes at a time (FNV-1a for the tail), then a seeded murmur3
+// finalizer: one pass over the text for both probes. Must match designation_hash() /
+// designation_slot_hash() in code-miscellaneous/steel_profile_embedder.py.
+constexpr uint32_t SteelProfileDesignationHash(std::string_view text) {
+    uint32_t value = 0x811C9DC5u ^ static_cast<uint32_t>(text.size());
+    size_t i = 0;
+    for (; i + 4 <= text.size(); i += 4) { // Assembled bytewise to stay constexpr; compiles to one load.
+        const uint32_t word = static_cast<uint32_t>(static_cast<uint8_t>(text[i])) |
+            static_cast<uint32_t>(static_cast<uint8_t>(text[i + 1])) << 8 |
+            static_cast<uint32_t>(static_cast<uint8_t>(text[i + 2])) << 16 |
+            static_cast<uint32_t>(static_cast<uint8_t>(text[i + 3])) << 24;
+        value = (value ^ word) * 0x9E3779B1u;
+        value ^= value >> 15;
+    }
+    for (; i < text.size(); ++i) value = (value ^ static_cast<uint8_t>(text[i])) * 0x01000193u;
+    return value;
+}
+
+constexpr uint32_t SteelProfileDesignationSlotHash(uint32_t value, uint32_t seed) {
+    value ^= seed * 0x9E3779B1u;
+    value ^= value >> 16;
+    value *= 0x85EBCA6Bu;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35u;
+    return value ^ (value >> 16);
+}
+
+// text == stored in one pass: comparing with a bare const char* would strlen it first.
+constexpr bool SteelProfileTextEquals(std::string_view text, const char* stored) {
+    size_t i = 0;
+    for (; i < text.size(); ++i) {
+        if (stored[i] != text[i]) return false; // Also stops at stored's terminator.
+    }
+    return stored[i] == '\0';
+}
+
+// Exact (case-sensitive) designation or alt_designation alias -> row, through the generated
+// perfect hash: one hash, one mix and at most two string compares, no table to build. A
+// designation shared by several rows (JIS/KS mirrors, identical geometry by design) yields the
+// first in id order; an alias yields the first row carrying it, unless it is itself some row's
+// designation ("IPE 200" is NPB 200's alias but its own row too), which wins. kNoSteelProfile
+// when absent.
+constexpr SteelProfileIndex FindSteelProfileIndexByDesignation(std::string_view designation) {
+    constexpr uint32_t bucketCount = sizeof(kSteelProfileDesignationSeeds) / sizeof(kSteelProfileDesignationSeeds[0]);
+    constexpr uint32_t slotCount = sizeof(kSteelProfileDesignationSlots) / sizeof(kSteelProfileDesignationSlots[0]);
+    if (designation.empty()) return kNoSteelProfile; // Would match any row without an alias.
+    const uint32_t hash = SteelProfileDesignationHash(designation);
+    const uint32_t seed = kSteelProfileDesignationSeeds[hash % bucketCount];
+    const SteelProfileIndex row = kSteelProfileDesignationSlots[SteelProfileDesignationSlotHash(hash, seed) % slotCount];
+    const SteelProfileRecord& record = kSteelProfiles[row];
+    return SteelProfileTextEquals(designation, record.designation) || SteelProfileTextEquals(designation, record.altDesignation)
+        ? row : kNoSteelProfile;
+}
+
+// steel_profile_embedder.py verifies the round trip of every key when it writes the tables, and
+// validations/SteelProfileCatalogTest.cpp repeats it through this function for every row and
+// alias; walking all rows in a static_assert blows MSVC's default constexpr step budget. These spot
+// checks only catch the C++ hashes drifting from their Python twins, at a handful of steps each.
+static_assert(FindSteelProfileIndexByDesignation(kSteelProfiles[0].designation) == 0,
+    "designation hash out of sync with steel_profile_embedder.py");
+static_assert(std::string_view(kSteelProfiles[FindSteelProfileIndexByDesignation(kSteelProfiles[kSteelProfileCount - 1].designation)].designation)
+    == kSteelProfiles[kSteelProfileCount - 1].designation, "designation hash out of sync with steel_profile_embedder.py");
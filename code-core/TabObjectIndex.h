@@ -0,0 +1,92 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Which DATASETTAB vector a TabObjectIndex entry points into.
+enum class TabObjectStore : uint8_t { None = 0, Logical = 1, Geometry3D = 2 };
+
+struct TabObjectSlot {
+    TabObjectStore store = TabObjectStore::None; // None = not in this tab.
+    uint32_t slot = 0;                           // Index into that store's vector.
+};
+
+/* memoryId -> (store, slot) over storageLogicalObjects / storageObjects3D, so a property edit or a
+tree operation finds its object in O(1) instead of scanning a million-entry vector. Both stores are
+append-only, so a slot stays valid until the tab is reset (which clears the index with them).
+
+Open addressing with linear probing, at most 3/4 full counting tombstones. memoryId 0 is never
+issued (MemoryID starts at 1), so it marks an empty bucket; Erase leaves a tombstone (store None,
+id kept) so later probe chains stay intact, and the next Rehash drops it. Written by the
+engineering thread under storageObjectsMutex, in the same critical section that appends to the
+store; readers either hold that mutex or are the engineering thread itself.
+Kept free of Windows headers so validations/ can test it against std::unordered_map. */
+class TabObjectIndex {
+public:
+    TabObjectSlot Find(uint64_t memoryId) const {
+        if (memoryId == 0 || buckets.empty()) return {};
+        const Bucket& bucket = buckets[Probe(memoryId)];
+        if (bucket.memoryId != memoryId || bucket.store == TabObjectStore::None) return {}; // Absent or erased.
+        return { bucket.store, bucket.slot };
+    }
+
+    // Adds or repoints memoryId.
+    void Insert(uint64_t memoryId, TabObjectStore store, uint32_t slot) {
+        if (memoryId == 0 || store == TabObjectStore::None) return;
+        if ((used + 1) * 4 > buckets.size() * 3) Rehash((live + 1) * 2);
+        Bucket& bucket = buckets[Probe(memoryId)];
+        if (bucket.memoryId == 0) { ++used; ++live; }
+        else if (bucket.store == TabObjectStore::None) ++live; // Reviving its own tombstone.
+        bucket = { memoryId, slot, store };
+    }
+
+    void Erase(uint64_t memoryId) {
+        if (memoryId == 0 || buckets.empty()) return;
+        Bucket& bucket = buckets[Probe(memoryId)];
+        if (bucket.memoryId != memoryId || bucket.store == TabObjectStore::None) return;
+        bucket.store = TabObjectStore::None;
+        --live;
+    }
+
+    void Reserve(size_t count) { if ((count + 1) * 4 > buckets.size() * 3) Rehash(count + 1); }
+    void Clear() { buckets.clear(); used = 0; live = 0; }
+    size_t Size() const { return live; }
+    size_t BucketCount() const { return buckets.size(); }
+
+private:
+    struct Bucket {
+        uint64_t memoryId = 0;
+        uint32_t slot = 0;
+        TabObjectStore store = TabObjectStore::None;
+    };
+
+    // The bucket holding memoryId (live or tombstone), else the empty bucket that ends its chain.
+    size_t Probe(uint64_t memoryId) const {
+        uint64_t mixed = (memoryId ^ (memoryId >> 30)) * 0xBF58476D1CE4E5B9ull; // splitmix64: ids
+        mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;               // are sequential.
+        const size_t mask = buckets.size() - 1;
+        size_t index = static_cast<size_t>(mixed ^ (mixed >> 31)) & mask;
+        while (buckets[index].memoryId != 0 && buckets[index].memoryId != memoryId) index = (index + 1) & mask;
+        return index;
+    }
+
+    // Re-inserts the live entries into a table sized for liveCount at under 3/4 load; drops tombstones.
+    void Rehash(size_t liveCount) {
+        size_t size = 64;
+        while (size * 3 < liveCount * 4) size *= 2;
+        std::vector<Bucket> old;
+        old.swap(buckets);
+        buckets.resize(size);
+        used = live = 0;
+        for (const Bucket& bucket : old) {
+            if (bucket.memoryId == 0 || bucket.store == TabObjectStore::None) continue;
+            buckets[Probe(bucket.memoryId)] = bucket;
+            ++used; ++live;
+        }
+    }
+
+    std::vector<Bucket> buckets; // Power-of-two size.
+    size_t used = 0;             // Live + tombstone buckets.
+    size_t live = 0;
+};
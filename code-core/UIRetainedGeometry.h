@@ -0,0 +1,102 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/* Retained geometry for one BuildUIOverlay widget subtree. The ribbon is almost entirely static, yet
+immediate mode re-measured and re-tessellated every label and icon of it every frame on every
+monitor. A subtree is now tessellated only when its key changes; otherwise its cached vertex/index
+range is copied into the frame's buffers. Hit-testing and UIActions still run every frame - only the
+geometry is retained.
+
+No Windows or DirectX dependency - the vertex type and draw context (UIVertex / UIDrawContext in
+UserInterface.h, or anything with the same vertexPtr / indexPtr / vertexCount / indexCount) are
+template parameters - so validations/UIRetainedGeometryTest.cpp checks replay against immediate
+tessellation.
+
+Language and theme are not key fields: LocalizedUIString always asks for English and
+uiActiveColors is set once at startup. Whichever change makes either switchable must add it here. */
+struct UIRetainedKey {
+    float dpiX = 0.0f, dpiY = 0.0f;   // Fully determines UITopRibbonLayout (PrecomputeTopRibbonLayout).
+    float scrollOffsetPx = 0.0f;
+    float widthPx = 0.0f;             // Window width: decides which controls are culled.
+    const void* iconData = nullptr;   // Monitor icon atlas the icon UVs were read from,
+    uint32_t iconGeneration = 0;      // and the BuildIconAtlas run that filled it.
+    int32_t hoveredIndex = -1;        // Hovered group / control inside the subtree. -1 = none.
+    bool pressed = false;             // Left button held over the hovered control.
+    bool operator==(const UIRetainedKey&) const = default;
+};
+
+template <typename Vertex>
+struct UIRetainedGeometry {
+    UIRetainedKey key;
+    bool valid = false;               // False until built, and whenever the build ran out of room.
+    uint32_t baseVertex = 0;          // Frame vertex count the indices below were built against.
+    std::vector<Vertex> vertices;
+    std::vector<uint16_t> indices;
+};
+
+// Tessellation target for a dirty subtree - the frame buffers are write-combined upload memory and
+// must not be read back. Grown once to the frame buffers' capacity; one per window is enough.
+template <typename Vertex>
+struct UIRetainedScratch {
+    std::vector<Vertex> vertices;
+    std::vector<uint16_t> indices;
+};
+
+// Vertex / index room a freshly tessellated subtree must leave unused to be cached. Every Push*
+// checks capacity and silently drops what does not fit, and none needs more than this (a rounded
+// rectangle is 36 vertices), so a subtree that left less room may be truncated: it is drawn, but
+// rebuilt next frame rather than replayed.
+constexpr uint32_t kRetainedUIHeadroomVertices = 64;
+constexpr uint32_t kRetainedUIHeadroomIndices = 96;
+
+// Emits one retained subtree into ctx, whose buffers hold maxVertices / maxIndices. `tessellate` is
+// the subtree's immediate-mode drawing code; it runs only when the key changed, or when the cached
+// range no longer fits where this frame places it. It writes through ctx as usual - ctx's pointers
+// are aimed at the scratch for the duration while its counters keep their frame values, so every
+// capacity check and index base inside comes out exactly as immediate mode would have produced them.
+template <typename Context, typename Vertex, typename Tessellate>
+void EmitRetainedUI(Context& ctx, UIRetainedGeometry<Vertex>& cache, UIRetainedScratch<Vertex>& scratch,
+    const UIRetainedKey& key, uint32_t maxVertices, uint32_t maxIndices, Tessellate&& tessellate) {
+    const uint32_t firstVertex = ctx.vertexCount;
+    const uint32_t firstIndex = ctx.indexCount;
+    const bool fits = firstVertex + cache.vertices.size() <= maxVertices &&
+        firstIndex + cache.indices.size() <= maxIndices;
+    if (!cache.valid || !(cache.key == key) || !fits) {
+        if (scratch.vertices.size() < maxVertices) scratch.vertices.resize(maxVertices);
+        if (scratch.indices.size() < maxIndices) scratch.indices.resize(maxIndices);
+        Vertex* const frameVertices = ctx.vertexPtr;
+        uint16_t* const frameIndices = ctx.indexPtr;
+        ctx.vertexPtr = scratch.vertices.data();
+        ctx.indexPtr = scratch.indices.data();
+        tessellate();
+        cache.vertices.assign(scratch.vertices.data(), ctx.vertexPtr);
+        cache.indices.assign(scratch.indices.data(), ctx.indexPtr);
+        cache.key = key;
+        cache.baseVertex = firstVertex;
+        cache.valid = ctx.vertexCount + kRetainedUIHeadroomVertices <= maxVertices &&
+            ctx.indexCount + kRetainedUIHeadroomIndices <= maxIndices;
+        ctx.vertexPtr = frameVertices;
+        ctx.indexPtr = frameIndices;
+        ctx.vertexCount = firstVertex;
+        ctx.indexCount = firstIndex;
+    }
+
+    const uint32_t vertexCount = static_cast<uint32_t>(cache.vertices.size());
+    const uint32_t indexCount = static_cast<uint32_t>(cache.indices.size());
+    if (vertexCount) memcpy(ctx.vertexPtr, cache.vertices.data(), vertexCount * sizeof(Vertex));
+    if (cache.baseVertex == firstVertex) {
+        if (indexCount) memcpy(ctx.indexPtr, cache.indices.data(), indexCount * sizeof(uint16_t));
+    } else {
+        // Something drawn before the subtree changed size: same geometry, shifted index base.
+        const uint16_t delta = static_cast<uint16_t>(firstVertex - cache.baseVertex);
+        for (uint32_t i = 0; i < indexCount; ++i) ctx.indexPtr[i] = static_cast<uint16_t>(cache.indices[i] + delta);
+    }
+    ctx.vertexPtr += vertexCount;
+    ctx.indexPtr += indexCount;
+    ctx.vertexCount += vertexCount;
+    ctx.indexCount += indexCount;
+}
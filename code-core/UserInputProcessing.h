@@ -118,8 +118,8 @@ enum class ACTION_TYPE : uint16_t { // Specifying uint16_t ensures that it is of
     BEGIN_ELLIPSE_CREATION2D = 30017,
     BEGIN_ARC_CREATION2D = 30018,
     BEGIN_PRIMITIVE_CREATION3D = 30019,
-    IMPORT_STD_FILE = 30020, // objectId owns a heap std::wstring* with the chosen file path.
-    IMPORT_DXF_FILE = 30021, // objectId owns a heap std::wstring* with the chosen file path.
+    IMPORT_STD_FILE = 30020, // objectId owns the queued import (file path + prefetched worker).
+    IMPORT_DXF_FILE = 30021, // objectId owns the queued import (file path + prefetched worker).
     MODIFY_OBJECT_PROPERTY = 30022, // objectId = memoryID, x = fieldIndex,
                                     // auxValue = std::bit_cast<uint64_t>(double value).
     ZOOM_MAX_EXTENTS = 30023,   // Fit ALL objects of the active Scene3D / Page2D in the view.
@@ -140,7 +140,9 @@ enum class ACTION_TYPE : uint16_t { // Specifying uint16_t ensures that it is of
     // 10M plan Step 6). objectId = the Scene3D being added / removed; no geometry is copied - the
     // set is a list of container IDs the renderers iterate.
     ADD_CONTAINER_TO_SUBTAB = 30034,
-    REMOVE_CONTAINER_FROM_SUBTAB = 30035
+    REMOVE_CONTAINER_FROM_SUBTAB = 30035,
+    MODIFY_SELECTED_PROPERTY = 30036 // objectId = ObjectType number, x = fieldIndex, auxValue = value
+                                     // bits: the edit applied to every selected object of that type.
 };
 
 struct ACTION_DETAILS_OLD {
@@ -101,7 +101,8 @@ void BuildMonitorIconAtlas(DX12ResourcesUI& uiRes, ID3D12Device* device, int mon
     if (cellSize <= 0) cellSize = 20;
 
     // Build the CPU atlas and fill this monitor's icon glyph lookup + metadata.
-    AtlasBitmap iconAtlas = BuildIconAtlas(cellSize, MonitorIconAtlasCPU(monitorId));
+    // On a warm start the pixels are the mapped cache file itself.
+    const IconAtlasImage iconAtlas = BuildIconAtlas(cellSize, MonitorIconAtlasCPU(monitorId));
 
     // Upload into this monitor's icon texture via the copy-queue path, then CPU-block until ready.
     // Caller must have already drained + released any previous atlas for this monitor (RestartRenderThreads),
@@ -110,8 +111,8 @@ void BuildMonitorIconAtlas(DX12ResourcesUI& uiRes, ID3D12Device* device, int mon
     desc.width = iconAtlas.width;
     desc.height = iconAtlas.height;
     desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    desc.pixels = iconAtlas.pixels.data();
-    desc.rowPitch = iconAtlas.width * iconAtlas.bytesPerPixel;
+    desc.pixels = iconAtlas.Pixels();
+    desc.rowPitch = iconAtlas.width * 4;
 
     std::atomic<uint64_t> uploadFence = 0;
     SubmitTextureUpload(desc, &screen.uiIconAtlasTexture, &uploadFence);
@@ -151,16 +152,14 @@ void BuildMonitorIconAtlas(DX12ResourcesUI& uiRes, ID3D12Device* device, int mon
 
     char debugName[64];
     std::snprintf(debugName, sizeof(debugName), "icon_atlas_debug_%d.bmp", monitorId);
-    SaveToBmp(debugName, iconAtlas.pixels.data(), iconAtlas.width, iconAtlas.height, iconAtlas.bytesPerPixel);
+    SaveToBmp(debugName, iconAtlas.Pixels(), iconAtlas.width, iconAtlas.height, 4);
 
     std::wcout << L"Icon atlas built for monitor " << monitorId << L" (cell " << cellSize << L" px)\n";
 }
 
 void InitUIResources( DX12ResourcesUI& uiRes, ID3D12Device* device) {
-    if (!InitFontSystem()) { // FONT system initialization (CPU-side)
-        std::cerr << "Font system initialization failed failed\n";
-        return;
-    }
+    // No FreeType here: UI text draws from the prebaked MSDF atlas. InitFontSystem runs on first use of
+    // the FreeType rasterizer (BuildFontAtlas), so startup no longer parses a font face it never reads.
 
     // Root signature
     CD3DX12_DESCRIPTOR_RANGE1 ranges[2]; // Descriptor ranges
@@ -265,7 +264,7 @@ void InitUIResources( DX12ResourcesUI& uiRes, ID3D12Device* device) {
     // lazily by RenderUIOverlay (see EnsureWindowUIBuffers).
     std::wcout << L"UI Resources Initialized (Phase 4A)\n";
     
-    AtlasBitmap englishAtlas = BuildMSDFFontAtlas();
+    const AtlasPixelsView englishAtlas = BuildMSDFFontAtlas();
     // The icon atlas is per monitor now (its cell size scales with DPI). It is built + uploaded and its
     // SRV heap created by BuildMonitorIconAtlas from RestartRenderThreads. InitUIResources only handles
     // the shared, DPI-independent English MSDF atlas below.
@@ -274,7 +273,7 @@ void InitUIResources( DX12ResourcesUI& uiRes, ID3D12Device* device) {
     desc.width = englishAtlas.width;
     desc.height = englishAtlas.height;
     desc.format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    desc.pixels = englishAtlas.pixels.data();
+    desc.pixels = englishAtlas.pixels;
     desc.rowPitch = englishAtlas.width * englishAtlas.bytesPerPixel;
 
     SubmitTextureUpload(desc, &uiRes.uiAtlasTextures[UI_ENGLISH_ATLAS_SLOT], &atlasFence);// Enqueue the upload through upload queue
@@ -30,6 +30,7 @@
 #include <cfloat>
 #include <charconv>
 #include <cmath>
+#include <cstring>
 #include <mutex>
 #include <utility>
 std::atomic<uint32_t> actionWriteIndex;
@@ -50,7 +51,7 @@ struct UIRoundedRectangleNineSlice {
 
 struct UIIconAtlasMetadata {
     UIRoundedRectangleNineSlice roundedRectangle{};
-    std::array<char32_t, 4> dummyIconCodepoints{ U'\uE100', U'\uE101', U'\uE102', U'\uE103' };
+    std::array<char32_t, 4> dummyIconCodepoints{ kIconPlaceholderCodepoints };
     std::vector<char32_t> mixedIconCodepoints{};
 };
 
@@ -60,19 +61,13 @@ struct UIIconAtlasMetadata {
 struct IconAtlasCPU {
     std::unordered_map<char32_t, Glyph> iconGlyphLookup; // private-use codepoints -> atlas UVs
     UIIconAtlasMetadata metadata;
+    uint32_t generation = 0; // Bumped by every BuildIconAtlas; part of UIRetainedKey.
 };
 
 static IconAtlasCPU gMonitorIconAtlas[MV_MAX_MONITORS];
 
 IconAtlasCPU& MonitorIconAtlasCPU(int monitorId) { return gMonitorIconAtlas[monitorId]; }
 
-// Reference cell size the procedural dummy icons were authored against; real cells scale from it.
-constexpr int kIconReferenceCellSize = 24;
-constexpr int kIconCellGap = 4;
-constexpr int kIconStartY = 48;
-constexpr int kIconAtlasMinDimension = 256;
-constexpr int kIconAtlasMaxDimension = 4096;
-
 static const char* LogicalObjectName(VishwakarmaStorage::ObjectType objectType, const META_DATA* object) {
     if (!object) return "";
 
@@ -122,120 +117,6 @@ static UIAtlasRegion MakeAtlasRegion(int x, int y, int w, int h, int atlasW, int
 
 UIColors uiLightDefaultColors, uiActiveColors; // Initialized to default light theme colors.
 
-static void SetAtlasPixelRGBA(AtlasBitmap& atlas, int x, int y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-    if (x < 0 || y < 0 || x >= atlas.width || y >= atlas.height) return;
-
-    if (atlas.bytesPerPixel == 4) {
-        const size_t offset = (static_cast<size_t>(y) * atlas.width + x) * 4u;
-        atlas.pixels[offset + 0] = r;
-        atlas.pixels[offset + 1] = g;
-        atlas.pixels[offset + 2] = b;
-        atlas.pixels[offset + 3] = a;
-    }
-    else {
-        atlas.pixels[static_cast<size_t>(y) * atlas.width + x] = a;
-    }
-}
-
-static void SetAtlasCoverage(AtlasBitmap& atlas, int x, int y, uint8_t coverage) {
-    SetAtlasPixelRGBA(atlas, x, y, 255, 255, 255, coverage);
-}
-
-static void GenerateRoundedRectangleNineSlice(AtlasBitmap& atlas, int originX, int originY,
-    int sourceSizePx, int sourceRadiusPx, UIRoundedRectangleNineSlice& outSlice) {
-    const int atlasW = atlas.width;
-    const int atlasH = atlas.height;
-
-    for (int y = 0; y < sourceSizePx; ++y) {
-        for (int x = 0; x < sourceSizePx; ++x) {
-            const float px = (float)x + 0.5f;
-            const float py = (float)y + 0.5f;
-            const float nearestX = std::clamp(px, (float)sourceRadiusPx,
-                (float)(sourceSizePx - sourceRadiusPx));
-            const float nearestY = std::clamp(py, (float)sourceRadiusPx,
-                (float)(sourceSizePx - sourceRadiusPx));
-            const float dx = px - nearestX;
-            const float dy = py - nearestY;
-            const float distance = std::sqrt(dx * dx + dy * dy);
-            const float coverage = std::clamp((float)sourceRadiusPx + 0.5f - distance, 0.0f, 1.0f);
-
-            SetAtlasCoverage(atlas, originX + x, originY + y, (uint8_t)std::round(coverage * 255.0f));
-        }
-    }
-
-    const int middle = sourceSizePx - 2 * sourceRadiusPx;
-    const int widths[3] = { sourceRadiusPx, middle, sourceRadiusPx };
-    const int heights[3] = { sourceRadiusPx, middle, sourceRadiusPx };
-    int yCursor = originY;
-    for (int row = 0; row < 3; ++row) {
-        int xCursor = originX;
-        for (int col = 0; col < 3; ++col) {
-            outSlice.regions[row][col] =
-                MakeAtlasRegion(xCursor, yCursor, widths[col], heights[row], atlasW, atlasH);
-            xCursor += widths[col];
-        }
-        yCursor += heights[row];
-    }
-}
-
-static void FillRect(AtlasBitmap& atlas, int x, int y, int w, int h, uint8_t coverage) {
-    for (int yy = y; yy < y + h; ++yy) {
-        for (int xx = x; xx < x + w; ++xx) {
-            SetAtlasCoverage(atlas, xx, yy, coverage);
-        }
-    }
-}
-
-// Blits the rasterised icon centred inside the reserved atlas region (one square cell for every
-// icon but the wide word-mark, which gets a horizontal run of cells).
-static void CopyRenderedSVGIconToAtlas(AtlasBitmap& atlas, const SVGIconRenderer::RenderedSVGIcon& icon,
-    int originX, int originY, int regionW, int regionH) {
-    if (icon.rgba.empty() || icon.width <= 0 || icon.height <= 0) return;
-
-    const int copyW = std::min(icon.width, regionW);
-    const int copyH = std::min(icon.height, regionH);
-    const int dstX = originX + std::max(0, (regionW - copyW) / 2);
-    const int dstY = originY + std::max(0, (regionH - copyH) / 2);
-
-    for (int y = 0; y < copyH; ++y) {
-        for (int x = 0; x < copyW; ++x) {
-            const size_t srcOffset = (static_cast<size_t>(y) * icon.width + x) * 4u;
-            SetAtlasPixelRGBA(atlas, dstX + x, dstY + y,
-                icon.rgba[srcOffset + 0],
-                icon.rgba[srcOffset + 1],
-                icon.rgba[srcOffset + 2],
-                icon.rgba[srcOffset + 3]);
-        }
-    }
-}
-
-// Number of cells one rasterised icon needs side by side: 1 for every square icon, more for a
-// wide one. The renderer keeps each icon's aspect ratio, so width alone decides this.
-static int IconCellsWide(int iconWidthPx, int cellSize) {
-    return std::max(1, (iconWidthPx + cellSize - 1) / cellSize);
-}
-
-// Pixel width of a run of `cellsWide` cells, gaps included: the run belongs to one icon, so the
-// gaps between its cells are usable image area.
-static int IconCellRunWidth(int cellsWide, int cellSize) {
-    return cellsWide * cellSize + (cellsWide - 1) * kIconCellGap;
-}
-
-// Reserves a horizontal run of `cellsWide` cells starting at `iconIndex`, advancing iconIndex to
-// the next row when the run would not fit in the current one (a run is never split across rows).
-static bool TryReserveIconCellRun(int& iconIndex, int atlasW, int atlasH, int cellSize, int cellsWide,
-    int& outX, int& outY) {
-    const int cellsPerRow = (atlasW + kIconCellGap) / (cellSize + kIconCellGap);
-    if (cellsPerRow <= 0 || cellsWide > cellsPerRow) return false;
-
-    const int column = iconIndex % cellsPerRow;
-    if (column + cellsWide > cellsPerRow) iconIndex += cellsPerRow - column;
-
-    outX = (iconIndex % cellsPerRow) * (cellSize + kIconCellGap);
-    outY = kIconStartY + (iconIndex / cellsPerRow) * (cellSize + kIconCellGap);
-    return outX + IconCellRunWidth(cellsWide, cellSize) <= atlasW && outY + cellSize <= atlasH;
-}
-
 static void StoreIconCellGlyph(IconAtlasCPU& out, char32_t codepoint, int x, int y, int atlasW, int atlasH,
     int cellW, int cellH, bool includeInFallbackPool = true) {
     Glyph glyph{};
@@ -252,129 +133,43 @@ static void StoreIconCellGlyph(IconAtlasCPU& out, char32_t codepoint, int x, int
     }
 }
 
-static int ComputeIconAtlasDimension(size_t iconCount, int cellSize) {
-    const size_t iconsToPlace = std::max<size_t>(iconCount, 1u);
-    int dimension = kIconAtlasMinDimension;
-
-    while (dimension < kIconAtlasMaxDimension) {
-        const int cellsPerRow = (dimension + kIconCellGap) / (cellSize + kIconCellGap);
-        if (cellsPerRow > 0) {
-            const size_t rows =
-                (iconsToPlace + static_cast<size_t>(cellsPerRow) - 1u) / static_cast<size_t>(cellsPerRow);
-            const size_t requiredHeight = static_cast<size_t>(kIconStartY) +
-                (rows - 1u) * static_cast<size_t>(cellSize + kIconCellGap) +
-                static_cast<size_t>(cellSize);
-            if (requiredHeight <= static_cast<size_t>(dimension)) return dimension;
-        }
-
-        dimension *= 2;
-    }
-
-    return kIconAtlasMaxDimension;
-}
-
 // Builds an icon atlas whose cells are `iconCellSizePx` px (the monitor's on-screen icon size) and fills
-// `out` with the matching UVs + metadata. Called per monitor by the platform BuildMonitorIconAtlas.
-AtlasBitmap BuildIconAtlas(int iconCellSizePx, IconAtlasCPU& out) {
-    const int cellSize = std::max(1, iconCellSizePx);
-    // Procedural dummy icons were authored in a 24 px reference cell; scale their coordinates to fit.
-    auto S = [cellSize](int v) { return (int)std::lround((double)v * cellSize / (double)kIconReferenceCellSize); };
-
-    const std::vector<SVGIconRenderer::RenderedSVGIcon> svgIcons =
-        SVGIconRenderer::RenderEmbeddedSVGIcons(cellSize);
-    // 4 dummy icons + one run per SVG icon. A wide icon costs `cellsWide` cells, plus as many
-    // again for the worst case where its run does not fit the current row and skips to the next.
-    size_t cellsNeeded = 4u;
-    for (const SVGIconRenderer::RenderedSVGIcon& svgIcon : svgIcons) {
-        const int cellsWide = IconCellsWide(svgIcon.width, cellSize);
-        cellsNeeded += static_cast<size_t>(2 * cellsWide - 1);
-    }
-    const int atlasDimension = ComputeIconAtlasDimension(cellsNeeded, cellSize);
-    const int atlasW = atlasDimension;
-    const int atlasH = atlasDimension;
-
-    AtlasBitmap atlas{};
-    atlas.width = atlasW;
-    atlas.height = atlasH;
-    atlas.bytesPerPixel = 4;
-    atlas.pixels.resize(static_cast<size_t>(atlasW) * atlasH * atlas.bytesPerPixel, 0);
-
-    // The source rounded rectangle is split into 9 texture regions at draw time.
-    // Destination corners are resized to ~2 mm in screen space by PushRoundedRectangle.
-    GenerateRoundedRectangleNineSlice(atlas, 0, 0, 32, 8, out.metadata.roundedRectangle);
+// `out` with the matching UVs + metadata. Called per monitor by the platform BuildMonitorIconAtlas. The
+// pixels and their layout come from IconAtlasImage.h: mapped from the on-disk cache after the first
+// launch at this cell size, rasterized and packed before it.
+IconAtlasImage BuildIconAtlas(int iconCellSizePx, IconAtlasCPU& out) {
+    IconAtlasImage atlas = BuildIconAtlasImage(iconCellSizePx);
 
     out.iconGlyphLookup.clear();
     out.metadata.mixedIconCodepoints.clear();
-
-    std::array<int, 4> iconXs{};
-    std::array<int, 4> iconYs{};
-    int nextIconIndex = 0;
-    for (int i = 0; i < 4; ++i) {
-        if (!TryReserveIconCellRun(nextIconIndex, atlasW, atlasH, cellSize, 1, iconXs[i], iconYs[i])) continue;
-        StoreIconCellGlyph(out, out.metadata.dummyIconCodepoints[i], iconXs[i], iconYs[i], atlasW, atlasH,
-            cellSize, cellSize);
-        ++nextIconIndex;
-    }
-
-    // Dummy icon 0: plus
-    FillRect(atlas, iconXs[0] + S(10), iconYs[0] + S(4), S(4), S(16), 255);
-    FillRect(atlas, iconXs[0] + S(4), iconYs[0] + S(10), S(16), S(4), 255);
-
-    // Dummy icon 1: folder-like block
-    FillRect(atlas, iconXs[1] + S(4), iconYs[1] + S(8), S(16), S(11), 255);
-    FillRect(atlas, iconXs[1] + S(6), iconYs[1] + S(5), S(7), S(4), 255);
-
-    // Dummy icon 2: ring (drawn to fill the cell, radii scaled from the 24 px reference)
-    const float ringCenter = cellSize * 0.5f;
-    const float ringInner = 5.0f * cellSize / (float)kIconReferenceCellSize;
-    const float ringOuter = 8.0f * cellSize / (float)kIconReferenceCellSize;
-    for (int y = 0; y < cellSize; ++y) {
-        for (int x = 0; x < cellSize; ++x) {
-            const float dx = (float)x + 0.5f - ringCenter;
-            const float dy = (float)y + 0.5f - ringCenter;
-            const float d = std::sqrt(dx * dx + dy * dy);
-            if (d >= ringInner && d <= ringOuter) {
-                SetAtlasCoverage(atlas, iconXs[2] + x, iconYs[2] + y, 255);
-            }
+    ++out.generation;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            const IconAtlasRect& rect = atlas.roundedRectangle[row][col];
+            out.metadata.roundedRectangle.regions[row][col] =
+                MakeAtlasRegion(rect.x, rect.y, rect.width, rect.height, atlas.width, atlas.height);
         }
     }
-
-    // Dummy icon 3: 2x2 grid
-    FillRect(atlas, iconXs[3] + S(4), iconYs[3] + S(4), S(7), S(7), 255);
-    FillRect(atlas, iconXs[3] + S(13), iconYs[3] + S(4), S(7), S(7), 255);
-    FillRect(atlas, iconXs[3] + S(4), iconYs[3] + S(13), S(7), S(7), 255);
-    FillRect(atlas, iconXs[3] + S(13), iconYs[3] + S(13), S(7), S(7), 255);
-
-    for (const SVGIconRenderer::RenderedSVGIcon& svgIcon : svgIcons) {
-        const int cellsWide = IconCellsWide(svgIcon.width, cellSize);
-        const int runWidth = IconCellRunWidth(cellsWide, cellSize);
-        int cellX = 0;
-        int cellY = 0;
-        if (!TryReserveIconCellRun(nextIconIndex, atlasW, atlasH, cellSize, cellsWide, cellX, cellY)) break;
-
-        CopyRenderedSVGIconToAtlas(atlas, svgIcon, cellX, cellY, runWidth, cellSize);
-        // The glyph spans the whole run, so its width:height ratio is what callers should size the
-        // quad by - PushIcon maps these UVs onto whatever rectangle it is given.
-        StoreIconCellGlyph(out, SVGIconRenderer::IconForID(svgIcon.id), cellX, cellY, atlasW, atlasH,
-            runWidth, cellSize, false);
-        nextIconIndex += cellsWide;
+    // An SVG icon's cell spans its whole run, so its width:height ratio is what callers should size
+    // the quad by - PushIcon maps these UVs onto whatever rectangle it is given.
+    for (const IconAtlasCell& cell : atlas.cells) {
+        StoreIconCellGlyph(out, cell.codepoint, cell.rect.x, cell.rect.y, atlas.width, atlas.height,
+            cell.rect.width, cell.rect.height, cell.inFallbackPool != 0);
     }
-
     return atlas;
 }
 
-AtlasBitmap BuildMSDFFontAtlas() { // Called by the platform InitUIResources; declared in UserInterface.h.
-    AtlasBitmap atlas{};
-    atlas.width = NotoSansMSDF_Width;
-    atlas.height = NotoSansMSDF_Height;
-    atlas.bytesPerPixel = 4;
-    atlas.pixels.assign(NotoSansMSDF_Pixels,
-        NotoSansMSDF_Pixels + (size_t)atlas.width * (size_t)atlas.height * (size_t)atlas.bytesPerPixel);
+AtlasPixelsView BuildMSDFFontAtlas() { // Called by the platform InitUIResources; declared in UserInterface.h.
+    // Both the pixels and the glyph table are constant data in the executable image (see
+    // msdf_atlas_json_parser.py): nothing is parsed or copied here except the per-glyph conversion
+    // to pixel metrics below.
+    const AtlasPixelsView atlas{ NotoSansMSDF_Width, NotoSansMSDF_Height, 4, NotoSansMSDF_Pixels };
 
     glyphLookup.clear();
-    for (const auto& entry : NotoSansMSDF_Glyphs) {
-        const char32_t codepoint = entry.first;
-        const MSDFGlyph& msdf = entry.second;
+    glyphLookup.reserve(std::size(NotoSansMSDF_Glyphs));
+    for (const MSDFGlyphEntry& entry : NotoSansMSDF_Glyphs) {
+        const char32_t codepoint = entry.codepoint;
+        const MSDFGlyph& msdf = entry.glyph;
 
         Glyph glyph{};
         glyph.uvMinX = msdf.atlasLeft / (float)atlas.width;
@@ -1371,81 +1166,137 @@ void BuildUIOverlay(SingleUIWindow& window, UIDrawContext& ctx, DX12ResourcesUI&
     // Draw active indicator (orange)
     pushRect(extentX, topActionGroupY - 5.0f, extentW, 5.0f, 0xFF3399FF);
 
+    // The three ribbon subtrees below are retained (UIRetainedRibbon): each is hit-tested and
+    // clicked every frame, but tessellated only when its key changes.
+    UIRetainedRibbon& retained = window.retainedRibbon;
+    UIRetainedKey layoutKey;
+    layoutKey.dpiX = topRibbonLayout.dpiX;
+    layoutKey.dpiY = topRibbonLayout.dpiY;
+
+    int32_t hoveredGroupIndex = -1;
     for (size_t groupIndex = 0; groupIndex < TotalTopUIActionGroups; ++groupIndex) {
-        const UIActionGroupNames& group = topUIActionGroupNames[groupIndex];
         const UITopRibbonActionGroupLayout& groupLayout = topRibbonLayout.actionGroups[groupIndex];
-        const char32_t* label = LocalizedUIString(group.labelStringID);
-        const bool hovered = group.isEnabled &&
+        const bool hovered = topUIActionGroupNames[groupIndex].isEnabled &&
             input.mouseX >= groupLayout.navX && input.mouseX < groupLayout.navX + groupLayout.navWidth &&
             input.mouseY >= actionGroupLabelY && input.mouseY < actionGroupLabelY + groupLabelHeight;
-
-        if (hovered) {
-            pushRect(groupLayout.navX, actionGroupLabelY, groupLayout.navWidth, groupLabelHeight,
-                uiActiveColors.tabBackgroundHover);
-        }
-        if (hovered && input.leftButtonPressedThisFrame) {
+        if (!hovered) continue;
+        hoveredGroupIndex = static_cast<int32_t>(groupIndex);
+        if (input.leftButtonPressedThisFrame) {
             topRibbonLayout.scrollOffsetPx = groupLayout.contentStartX;
             ClampTopRibbonScroll(topRibbonLayout, W);
         }
-
-        pushTextClipped(groupLayout.navX + 4.0f, textBaselineY(actionGroupLabelY, groupLabelHeight, uiTextScale),
-            label, groupLayout.navWidth - 8.0f, uiActiveColors.actionText, uiTextScale);
+        break;
     }
 
-    for (size_t runIndex = 0; runIndex < topRibbonLayout.actionSubGroupRunCount; ++runIndex) {
-        const UITopRibbonSubGroupRunLayout& run = topRibbonLayout.actionSubGroupRuns[runIndex];
-        if (run.subGroupIndex >= TotalTopUIActionSubGroups) continue;
-
-        const UIActionGroupNames& subGroup = topUIActionSubGroupNames[run.subGroupIndex];
-        const char32_t* label = LocalizedUIString(subGroup.labelStringID);
-        const float runX = run.contentStartX - ribbonScrollX;
-        const float runWidth = std::max(0.0f, run.contentEndX - run.contentStartX);
-        const float labelWidth = MeasureUIStringWidth(label, uiTextScale);
-        const float labelX = runX + std::max(4.0f, (runWidth - labelWidth) * 0.5f);
-
-        pushTextClipped(labelX, textBaselineY(actionSubGroupLabelY, groupLabelHeight, uiTextScale),
-            label, std::max(0.0f, runWidth - 8.0f), uiActiveColors.actionText, uiTextScale);
-
-        if (runIndex + 1 < topRibbonLayout.actionSubGroupRunCount) {
-            const float lineX = std::floor(run.contentEndX + buttonGap * 0.5f - ribbonScrollX);
-            const float lineHeight = 3.0f * topRibbonLayout.buttonHeightPx + 2.0f;
-            if (lineX >= -1.0f && lineX <= W + 1.0f) {
-                pushRect(lineX, topActionGroupY, 1.0f, lineHeight, 0xFF555555);
+    UIRetainedKey groupLabelsKey = layoutKey;
+    groupLabelsKey.hoveredIndex = hoveredGroupIndex;
+    EmitRetainedUI(ctx, retained.groupLabels, retained.scratch, groupLabelsKey, uiRes.maxVertices, uiRes.maxIndices, [&]() {
+        for (size_t groupIndex = 0; groupIndex < TotalTopUIActionGroups; ++groupIndex) {
+            const UIActionGroupNames& group = topUIActionGroupNames[groupIndex];
+            const UITopRibbonActionGroupLayout& groupLayout = topRibbonLayout.actionGroups[groupIndex];
+            const char32_t* label = LocalizedUIString(group.labelStringID);
+            if (static_cast<int32_t>(groupIndex) == hoveredGroupIndex) {
+                pushRect(groupLayout.navX, actionGroupLabelY, groupLayout.navWidth, groupLabelHeight,
+                    uiActiveColors.tabBackgroundHover);
             }
+            pushTextClipped(groupLayout.navX + 4.0f, textBaselineY(actionGroupLabelY, groupLabelHeight, uiTextScale),
+                label, groupLayout.navWidth - 8.0f, uiActiveColors.actionText, uiTextScale);
         }
-    }
+    });
+
+    UIRetainedKey subGroupLabelsKey = layoutKey;
+    subGroupLabelsKey.scrollOffsetPx = ribbonScrollX;
+    subGroupLabelsKey.widthPx = W;
+    EmitRetainedUI(ctx, retained.subGroupLabels, retained.scratch, subGroupLabelsKey, uiRes.maxVertices, uiRes.maxIndices, [&]() {
+        for (size_t runIndex = 0; runIndex < topRibbonLayout.actionSubGroupRunCount; ++runIndex) {
+            const UITopRibbonSubGroupRunLayout& run = topRibbonLayout.actionSubGroupRuns[runIndex];
+            if (run.subGroupIndex >= TotalTopUIActionSubGroups) continue;
+
+            const UIActionGroupNames& subGroup = topUIActionSubGroupNames[run.subGroupIndex];
+            const char32_t* label = LocalizedUIString(subGroup.labelStringID);
+            const float runX = run.contentStartX - ribbonScrollX;
+            const float runWidth = std::max(0.0f, run.contentEndX - run.contentStartX);
+            const float labelWidth = MeasureUIStringWidth(label, uiTextScale);
+            const float labelX = runX + std::max(4.0f, (runWidth - labelWidth) * 0.5f);
+
+            pushTextClipped(labelX, textBaselineY(actionSubGroupLabelY, groupLabelHeight, uiTextScale),
+                label, std::max(0.0f, runWidth - 8.0f), uiActiveColors.actionText, uiTextScale);
+
+            if (runIndex + 1 < topRibbonLayout.actionSubGroupRunCount) {
+                const float lineX = std::floor(run.contentEndX + buttonGap * 0.5f - ribbonScrollX);
+                const float lineHeight = 3.0f * topRibbonLayout.buttonHeightPx + 2.0f;
+                if (lineX >= -1.0f && lineX <= W + 1.0f) {
+                    pushRect(lineX, topActionGroupY, 1.0f, lineHeight, 0xFF555555);
+                }
+            }
+        }
+    });
 
+    // Ribbon controls: hit test and clicks. Only buttons and dropdown triggers respond.
+    int32_t hoveredControlIndex = -1;
     for (size_t i = 0; i < TotalUIControls; ++i) {
         const auto& ctrl = AllUIControls[i];
+        if (ctrl.type != 1 && ctrl.type != 2) continue;
         const UITopRibbonControlLayout& ctrlLayout = topRibbonLayout.controls[i];
         const float btnX = ctrlLayout.x - ribbonScrollX;
-        const float btnY = ctrlLayout.y;
-        const float btnWidth = ctrlLayout.width;
-        const float btnHeight = ctrlLayout.height;
-        const char32_t* label = LocalizedControlLabel(ctrl);
-        uint32_t baseColor = StableRandomUIColour((uint32_t)ctrl.action ^ ((uint32_t)i * 0x9E3779B9u));// Render
-        uint32_t iconColor = StableRandomUIColour(((uint32_t)ctrl.action << 1) ^ 0xA511E9B3u ^ (uint32_t)i);
-        char32_t resolvedIconChar = ctrl.iconChar;
-        const uint32_t actionIconID = static_cast<uint32_t>(ctrl.action);
-        if (resolvedIconChar == SVGIconRenderer::NoIcon && SVGIconRenderer::HasEmbeddedSVGIcon(actionIconID)) {
-            resolvedIconChar = SVGIconRenderer::IconForID(actionIconID);
+        const bool controlVisible = btnX + ctrlLayout.width >= 0.0f && btnX <= W;
+        const bool hovered = controlVisible && ctrl.isEnabled &&
+            input.mouseX >= btnX && input.mouseX < btnX + ctrlLayout.width &&
+            input.mouseY >= ctrlLayout.y && input.mouseY < ctrlLayout.y + ctrlLayout.height;
+        if (!hovered) continue;
+        hoveredControlIndex = static_cast<int32_t>(i);
+
+        if (input.leftButtonPressedThisFrame) {
+            ImprovementData::RecordRibbonAction((uint32_t)ctrl.action); // Usage statistics.
+            PushUIAction((uint32_t)ctrl.action);
+            if (ctrl.zIndex == 1) { // Dropdown trigger
+                window.activeDropdownAction = ctrl.action;
+            }
+            if (ctrl.action == Commands::INSERT_ASSET2D) {
+                // Companion right-side pane for picking the asset; the engineering thread
+                // arms asset-insert mode through the pushed action above.
+                window.assetInsertPaneOpen = true;
+                window.rightPaneOpen = false; // The two panes share the right-side slot.
+            }
         }
+        break;
+    }
 
-        const uint32_t iconID = static_cast<uint32_t>(resolvedIconChar);
-        const bool hasDedicatedSVGIcon =
-            resolvedIconChar != SVGIconRenderer::NoIcon &&
-            SVGIconRenderer::HasEmbeddedSVGIcon(iconID) &&
-            ctx.iconData &&
-            ctx.iconData->iconGlyphLookup.find(resolvedIconChar) != ctx.iconData->iconGlyphLookup.end();
-        const bool controlVisible = btnX + btnWidth >= 0.0f && btnX <= W;
-        bool hovered = false;
-
-        if (ctrl.type == 1 || ctrl.type == 2) {                     // Button or Dropdown trigger
-            hovered = controlVisible && ctrl.isEnabled && (input.mouseX >= btnX && input.mouseX < btnX + btnWidth &&
-                input.mouseY >= btnY && input.mouseY < btnY + btnHeight);
-            uint32_t drawColor = hovered && input.leftButtonDown ? 0xFF333333 : baseColor;
-            if (hovered && !input.leftButtonDown) drawColor = 0xFF555555;
-            if (controlVisible) {
+    UIRetainedKey controlsKey = subGroupLabelsKey;
+    controlsKey.iconData = ctx.iconData;
+    controlsKey.iconGeneration = ctx.iconData ? ctx.iconData->generation : 0;
+    controlsKey.hoveredIndex = hoveredControlIndex;
+    controlsKey.pressed = hoveredControlIndex >= 0 && input.leftButtonDown;
+    EmitRetainedUI(ctx, retained.controls, retained.scratch, controlsKey, uiRes.maxVertices, uiRes.maxIndices, [&]() {
+        for (size_t i = 0; i < TotalUIControls; ++i) {
+            const auto& ctrl = AllUIControls[i];
+            const UITopRibbonControlLayout& ctrlLayout = topRibbonLayout.controls[i];
+            const float btnX = ctrlLayout.x - ribbonScrollX;
+            const float btnY = ctrlLayout.y;
+            const float btnWidth = ctrlLayout.width;
+            const float btnHeight = ctrlLayout.height;
+            const char32_t* label = LocalizedControlLabel(ctrl);
+            uint32_t baseColor = StableRandomUIColour((uint32_t)ctrl.action ^ ((uint32_t)i * 0x9E3779B9u));// Render
+            uint32_t iconColor = StableRandomUIColour(((uint32_t)ctrl.action << 1) ^ 0xA511E9B3u ^ (uint32_t)i);
+            char32_t resolvedIconChar = ctrl.iconChar;
+            const uint32_t actionIconID = static_cast<uint32_t>(ctrl.action);
+            if (resolvedIconChar == SVGIconRenderer::NoIcon && SVGIconRenderer::HasEmbeddedSVGIcon(actionIconID)) {
+                resolvedIconChar = SVGIconRenderer::IconForID(actionIconID);
+            }
+
+            const uint32_t iconID = static_cast<uint32_t>(resolvedIconChar);
+            const bool hasDedicatedSVGIcon =
+                resolvedIconChar != SVGIconRenderer::NoIcon &&
+                SVGIconRenderer::HasEmbeddedSVGIcon(iconID) &&
+                ctx.iconData &&
+                ctx.iconData->iconGlyphLookup.find(resolvedIconChar) != ctx.iconData->iconGlyphLookup.end();
+            const bool controlVisible = btnX + btnWidth >= 0.0f && btnX <= W;
+            if (!controlVisible) continue;
+            const bool hovered = static_cast<int32_t>(i) == hoveredControlIndex;
+
+            if (ctrl.type == 1 || ctrl.type == 2) {                     // Button or Dropdown trigger
+                uint32_t drawColor = hovered && input.leftButtonDown ? 0xFF333333 : baseColor;
+                if (hovered && !input.leftButtonDown) drawColor = 0xFF555555;
                 if (hovered) {
                     PushRoundedRectangle(ctx, btnX, btnY, btnWidth, btnHeight, roundedCornerRadiusPx,
                         drawColor, uiRes);
@@ -1455,65 +1306,42 @@ void BuildUIOverlay(SingleUIWindow& window, UIDrawContext& ctx, DX12ResourcesUI&
                         baseColor, uiRes);
                 }
             }
-
-            bool clicked = hovered && input.leftButtonPressedThisFrame;
-
-            if (clicked && ctrl.isEnabled) {
-                ImprovementData::RecordRibbonAction((uint32_t)ctrl.action); // Usage statistics.
-                PushUIAction((uint32_t)ctrl.action);
-                if (ctrl.zIndex == 1) { // Dropdown trigger
-                    window.activeDropdownAction = ctrl.action;
-                }
-                if (ctrl.action == Commands::INSERT_ASSET2D) {
-                    // Companion right-side pane for picking the asset; the engineering thread
-                    // arms asset-insert mode through the pushed action above.
-                    window.assetInsertPaneOpen = true;
-                    window.rightPaneOpen = false; // The two panes share the right-side slot.
-                }
-            }
-
-        }
-        else if (ctrl.type == 3) {
-            // Future textbox
-            if (controlVisible) {
+            else if (ctrl.type == 3) {
+                // Future textbox
                 PushRoundedRectangle(ctx, btnX, btnY, btnWidth, btnHeight, roundedCornerRadiusPx,
                     0xFF1E1E1E, uiRes);
             }
-        }
-        else {
-            // Plain label
-            if (controlVisible) {
+            else {
+                // Plain label
                 PushRoundedRectangle(ctx, btnX, btnY, btnWidth, btnHeight, roundedCornerRadiusPx,
                     0xFF2D2D30, uiRes);
             }
-        }
 
-        if (!controlVisible) continue;
-
-        float iconX = btnX + (iconReservedWidthPx - iconSizePx) * 0.5f;
-        float iconY = btnY + (btnHeight - iconSizePx) * 0.5f;
-        if (hasDedicatedSVGIcon) {
-            const uint32_t dedicatedIconColor = ctrl.isEnabled ? 0xFFFFFFFF : uiActiveColors.actionIconDisabled;
-            PushIcon(ctx, iconX, iconY, iconSizePx, iconSizePx, resolvedIconChar, dedicatedIconColor, uiRes);
-        }
-        else if (ctx.iconData && !ctx.iconData->metadata.mixedIconCodepoints.empty()) {
-            const uint32_t randomIconIndex =
-                ((uint32_t)ctrl.action ^ (uint32_t)i) % (uint32_t)ctx.iconData->metadata.mixedIconCodepoints.size();
-            PushIcon(ctx, iconX, iconY, iconSizePx, iconSizePx,
-                ctx.iconData->metadata.mixedIconCodepoints[randomIconIndex], iconColor, uiRes);
-        }
+            float iconX = btnX + (iconReservedWidthPx - iconSizePx) * 0.5f;
+            float iconY = btnY + (btnHeight - iconSizePx) * 0.5f;
+            if (hasDedicatedSVGIcon) {
+                const uint32_t dedicatedIconColor = ctrl.isEnabled ? 0xFFFFFFFF : uiActiveColors.actionIconDisabled;
+                PushIcon(ctx, iconX, iconY, iconSizePx, iconSizePx, resolvedIconChar, dedicatedIconColor, uiRes);
+            }
+            else if (ctx.iconData && !ctx.iconData->metadata.mixedIconCodepoints.empty()) {
+                const uint32_t randomIconIndex =
+                    ((uint32_t)ctrl.action ^ (uint32_t)i) % (uint32_t)ctx.iconData->metadata.mixedIconCodepoints.size();
+                PushIcon(ctx, iconX, iconY, iconSizePx, iconSizePx,
+                    ctx.iconData->metadata.mixedIconCodepoints[randomIconIndex], iconColor, uiRes);
+            }
 
-        if (ctrl.showText) {
-            float textX = btnX + textStartOffsetPx;
-            float textWidth = btnWidth - textStartOffsetPx - textEndInsetPx;
-            uint32_t textColor = 0xFFFFFFFF; // default hovered/active color (white)
-            if (!hovered) {
-                textColor = ctrl.isEnabled ? uiActiveColors.actionText : kUIDisabledTextGray;
+            if (ctrl.showText) {
+                float textX = btnX + textStartOffsetPx;
+                float textWidth = btnWidth - textStartOffsetPx - textEndInsetPx;
+                uint32_t textColor = 0xFFFFFFFF; // default hovered/active color (white)
+                if (!hovered) {
+                    textColor = ctrl.isEnabled ? uiActiveColors.actionText : kUIDisabledTextGray;
+                }
+                pushTextClipped(textX, textBaselineY(btnY, btnHeight, uiTextScale),
+                    label, textWidth, textColor, uiTextScale);
             }
-            pushTextClipped(textX, textBaselineY(btnY, btnHeight, uiTextScale),
-                label, textWidth, textColor, uiTextScale);
         }
-    }
+    });
 
     const int activeTabIndex = window.activeTabIndex;
 
@@ -2074,26 +1902,26 @@ void BuildUIOverlay(SingleUIWindow& window, UIDrawContext& ctx, DX12ResourcesUI&
 
             if (activeTabIndex >= 0 && activeTabIndex < MV_MAX_TABS) {
                 DATASETTAB& tab = allTabs[activeTabIndex];
-                uint64_t singleSelectedId = 0;
+                // The first selected object stands for the whole selection: its fields are shown,
+                // and with more than one selected an edit applies to every selected object of its type.
+                uint64_t firstSelectedId = 0;
                 {
                     std::lock_guard<std::mutex> lock(tab.selection.selectedMutex);
-                    selectionCount = tab.selection.selectedObjectIds.size();
-                    if (selectionCount == 1) singleSelectedId = tab.selection.selectedObjectIds[0];
+                    selectionCount = tab.selection.selectedObjectIds.Size();
+                    if (selectionCount >= 1) firstSelectedId = tab.selection.selectedObjectIds.Ids()[0];
                 }
-                if (selectionCount == 1 && tab.storageObjectsMutex) {
+                if (selectionCount >= 1 && tab.storageObjectsMutex) {
                     std::lock_guard<std::mutex> lock(*tab.storageObjectsMutex);
-                    for (const StoredGeometryObject3D& stored : tab.storageObjects3D) {
-                        if (stored.memoryId == singleSelectedId && stored.object) {
-                            selType = stored.objectType;
-                            selId = stored.object->memoryID;
-                            table = FindPropertyTable(selType);
-                            if (table) {
-                                fieldValueCount = table->fieldCount;
-                                // World space, so a moved object reads out where it is displayed
-                                // rather than where it was authored (10M plan Step 4).
-                                ReadPropertyValuesForDisplay(*table, stored.object, fieldValues);
-                            }
-                            break;
+                    const StoredGeometryObject3D* stored = FindStoredObject3D(tab, firstSelectedId);
+                    if (stored && stored->object) {
+                        selType = stored->objectType;
+                        selId = stored->object->memoryID;
+                        table = FindPropertyTable(selType);
+                        if (table) {
+                            fieldValueCount = table->fieldCount;
+                            // World space, so a moved object reads out where it is displayed
+                            // rather than where it was authored (10M plan Step 4).
+                            ReadPropertyValuesForDisplay(*table, stored->object, fieldValues);
                         }
                     }
                 }
@@ -2136,12 +1964,32 @@ void BuildUIOverlay(SingleUIWindow& window, UIDrawContext& ctx, DX12ResourcesUI&
                 rowY += rowH + rowGap;
             };
 
-            if (selectionCount == 1) {
+            auto drawSelectionCountLine = [&]() {
+                char num[16];
+                { auto r = std::to_chars(num, num + sizeof(num) - 1, static_cast<unsigned long long>(selectionCount));
+                  *r.ptr = '\0'; }
+                char line[48];
+                size_t li = 0;
+                for (const char* p = num; *p && li + 1 < sizeof(line); ++p) line[li++] = *p;
+                for (const char* p = " objects selected"; *p && li + 1 < sizeof(line); ++p) line[li++] = *p;
+                line[li] = '\0';
+                char32_t lineU32[64];
+                asciiToU32(line, lineU32, 64);
+                pushTextClipped(contentX, textBaselineY(rowY, rowH, uiTextScale), lineU32,
+                    rightPaneWidthPx - 2.0f * pad, uiActiveColors.actionText, uiTextScale);
+                rowY += rowH + rowGap;
+            };
+
+            if (selectionCount >= 1 && selId != 0) {
                 drawStaticRow(LocalizedUIString(UITextID::PropObjectType),
                     VishwakarmaStorage::ObjectTypeDisplayName(selType));
-                char idText[vishwakarma::crockford_base32::kEncodedUInt64LengthWithNull];
-                vishwakarma::crockford_base32::EncodeUInt64ToCString(selId, idText);
-                drawStaticRow(LocalizedUIString(UITextID::PropObjectId), idText);
+                if (selectionCount == 1) {
+                    char idText[vishwakarma::crockford_base32::kEncodedUInt64LengthWithNull];
+                    vishwakarma::crockford_base32::EncodeUInt64ToCString(selId, idText);
+                    drawStaticRow(LocalizedUIString(UITextID::PropObjectId), idText);
+                } else {
+                    drawSelectionCountLine(); // No single ID; the fields below are the first object's.
+                }
 
                 bool fieldClicked = false;
                 for (uint8_t i = 0; table && i < fieldValueCount; ++i) {
@@ -2196,8 +2044,13 @@ void BuildUIOverlay(SingleUIWindow& window, UIDrawContext& ctx, DX12ResourcesUI&
                                 double parsed = 0.0;
                                 if (evaluateBuffer(parsed)) {
                                     const uint64_t p1 = (static_cast<uint64_t>(activeTabIndex) << 8) | i;
-                                    PushUIAction(kPropertyCommitUIAction, p1, selId,
-                                        std::bit_cast<uint64_t>(parsed));
+                                    if (selectionCount == 1) {
+                                        PushUIAction(kPropertyCommitUIAction, p1, selId,
+                                            std::bit_cast<uint64_t>(parsed));
+                                    } else { // Same field on every selected object of this type.
+                                        PushUIAction(kPropertySelectionCommitUIAction, p1,
+                                            VishwakarmaStorage::ToNumber(selType), std::bit_cast<uint64_t>(parsed));
+                                    }
                                     edit.focusedFieldKey = 0;
                                     focused = false;
                                 }
@@ -2254,20 +2107,9 @@ void BuildUIOverlay(SingleUIWindow& window, UIDrawContext& ctx, DX12ResourcesUI&
                 // A click anywhere that is not a field drops focus without committing (MVP UX).
                 if (input.leftButtonPressedThisFrame && !fieldClicked) edit.focusedFieldKey = 0;
             } else {
-                // Multi-selection or empty selection: a static count line, no field editing.
+                // Empty selection (or a first object without a 3D record): a static count line, no editing.
                 edit.focusedFieldKey = 0;
-                char num[16];
-                { auto r = std::to_chars(num, num + sizeof(num) - 1, static_cast<unsigned long long>(selectionCount));
-                  *r.ptr = '\0'; }
-                char line[48];
-                size_t li = 0;
-                for (const char* p = num; *p && li + 1 < sizeof(line); ++p) line[li++] = *p;
-                for (const char* p = " objects selected"; *p && li + 1 < sizeof(line); ++p) line[li++] = *p;
-                line[li] = '\0';
-                char32_t lineU32[64];
-                asciiToU32(line, lineU32, 64);
-                pushTextClipped(contentX, textBaselineY(rowY, rowH, uiTextScale), lineU32,
-                    rightPaneWidthPx - 2.0f * pad, uiActiveColors.actionText, uiTextScale);
+                drawSelectionCountLine();
             }
         } else {
             edit.focusedFieldKey = 0; // Pane closed → no active edit.
@@ -11,6 +11,8 @@
 
 #include "ListOfCommands.h"
 #include "SVGIconRenderer.h"
+#include "IconAtlasImage.h"
+#include "UIRetainedGeometry.h" // Retained ribbon subtrees (UIRetainedRibbon).
 #include "FontManager.h" // FreeType font atlas generation
 #include "UserInterface-TextTranslations.h" // localization
 #include "UserInterfaceTranslationCompiled.h"
@@ -210,7 +212,19 @@ struct AtlasBitmap {
     std::vector<uint8_t> pixels;
 };
 
+// Atlas pixels owned by someone else. The MSDF font atlas is baked at build time
+// (msdf_atlas_generator.bat) into the executable's read-only data, which the loader already maps on
+// demand; wrapping those bytes instead of copying them into an AtlasBitmap keeps startup from
+// touching them twice.
+struct AtlasPixelsView {
+    int width;
+    int height;
+    int bytesPerPixel;
+    const uint8_t* pixels;
+};
+
 inline AtlasBitmap BuildFontAtlas() {
+    if (!InitFontSystem()) return AtlasBitmap{}; // FreeType is only brought up for this rasterizer.
     const int atlasW = 512;
     const int atlasH = 512;
 
@@ -316,6 +330,14 @@ struct UITextEditState {
     uint64_t editingObjectId = 0; // Guard: commit only to the object the edit started on.
 };
 
+// Per-window, owned by the render thread drawing the window (like textEditState). The ribbon is
+// split where its inputs differ: hovering a button dirties only `controls`, scrolling leaves the
+// group navigation labels alone.
+struct UIRetainedRibbon {
+    UIRetainedGeometry<UIVertex> groupLabels, subGroupLabels, controls;
+    UIRetainedScratch<UIVertex> scratch;
+};
+
 struct UIColors { // Standard UI Colours (ABGR format for DX12)
     // The default values specified here are for theme "Light". 
     // These can be overridden by other themes (e.g. Dark) or by user customizations.
@@ -353,6 +375,9 @@ struct UIActionEntry {
 // website/content/software/propertiesPane.md §5. p1 = (tabIndex << 8) | fieldIndex,
 // p2 = objectMemoryId, p3 = std::bit_cast<uint64_t>(double value).
 constexpr uint32_t kPropertyCommitUIAction = 0xE0000020u;
+// Same edit applied to the whole selection (more than one object selected): p1 as above,
+// p2 = VishwakarmaStorage::ToNumber(object type) - only selected objects of that type are edited.
+constexpr uint32_t kPropertySelectionCommitUIAction = 0xE0000021u;
 
 namespace InternalSubTabs {
 constexpr uint32_t kOpenUIAction = 0xE0000010u;
@@ -850,8 +875,8 @@ struct UIDrawContext { // Draw context
 
 // CPU-side atlas bitmap builders (MSDF font + icons). Uploaded by the platform InitUIResources /
 // BuildMonitorIconAtlas. The icon atlas cell size (px) is per monitor; BuildIconAtlas fills `out`.
-AtlasBitmap BuildIconAtlas(int iconCellSizePx, IconAtlasCPU& out);
-AtlasBitmap BuildMSDFFontAtlas();
+IconAtlasImage BuildIconAtlas(int iconCellSizePx, IconAtlasCPU& out);
+AtlasPixelsView BuildMSDFFontAtlas();
 
 // Storage accessor for a monitor's icon CPU bundle (lookup + metadata). The array lives in
 // UserInterface.cpp; the platform half writes it via BuildIconAtlas and BuildUIOverlay reads it.
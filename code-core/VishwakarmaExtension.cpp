@@ -12,12 +12,15 @@
 // The host (ExtensionCommunications.cpp) launches it as
 //     VishwakarmaExtension.exe main.py
 // with the extension's folder as the working directory and the IPC pipes on
-// stdin/stdout. The worker is one-shot: it runs the extension entry script and exits.
+// stdin/stdout. The worker is kept warm: the entry script imports its modules once, then
+// serves one import request after another until the host closes the pipe.
 //
 // Defense-in-depth applied here, ahead of the planned AppContainer sandbox:
 //   - Networking does not exist: _socket / select / _ssl were never compiled in and
 //     socket.py / ssl.py are not frozen in, so "import socket" raises ImportError.
-//   - The builtin module table below removes _winapi, winreg, mmap and msvcrt.
+//   - The builtin module table below removes _winapi, winreg, mmap and msvcrt. The one
+//     shared-memory primitive left is _vkshm, which can only map section handles the
+//     process already holds - in practice the two the host passes in the import request.
 //   - Process-creation primitives (nt.system / spawn* / exec* / startfile / kill) are
 //     deleted by an extra Py_mod_exec slot spliced into the nt module definition, so
 //     every creation of the module - including a re-import after deleting
@@ -27,10 +30,14 @@
 
 #include <Python.h>
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cwchar>
 
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
 // ------------------------------------------------------------------ Builtin modules
 // Curated copy of the pinned CPython's PC/config.c inittab. Removed relative to stock:
 // _winapi, winreg, mmap, msvcrt, _lsprof, xxsubtype, _interpreters, _interpchannels,
@@ -148,6 +155,72 @@ static PyObject* PyInit_vk_nt(void) {
     return reinterpret_cast<PyObject*>(&vkNtDef);
 }
 
+// ------------------------------------------------------------------ _vkshm
+// Minimal stand-in for the removed mmap module, used by vishwakarma_api for the host's
+// shared-memory transport (ExtensionIPC.proto SharedFileRegion / SharedResultRing):
+//     _vkshm.map_view(section_handle, offset, length, writable) -> memoryview
+//     _vkshm.unmap_view(view)
+// The memoryview does not own its mapping. The result ring stays mapped for the life of the
+// worker; each job's input view is unmapped explicitly once the job is done, which is refused
+// (BufferError) while any slice of it is still alive.
+static PyObject* VkShmMapView(PyObject*, PyObject* args) {
+    unsigned long long handleValue = 0, offset = 0, length = 0;
+    int writable = 0;
+    if (!PyArg_ParseTuple(args, "KKKp", &handleValue, &offset, &length, &writable)) return nullptr;
+    if (length == 0 || length > (unsigned long long)PY_SSIZE_T_MAX) {
+        PyErr_SetString(PyExc_ValueError, "map_view: length out of range");
+        return nullptr;
+    }
+    SYSTEM_INFO system{};
+    GetSystemInfo(&system);
+    const uint64_t viewOffset = offset - offset % system.dwAllocationGranularity;
+    const uint64_t lead = offset - viewOffset;
+    void* base = MapViewOfFile(reinterpret_cast<HANDLE>(static_cast<uintptr_t>(handleValue)),
+        writable ? FILE_MAP_WRITE : FILE_MAP_READ, (DWORD)(viewOffset >> 32), (DWORD)viewOffset,
+        (SIZE_T)(lead + length));
+    if (!base) return PyErr_SetFromWindowsErr(0);
+    return PyMemoryView_FromMemory(static_cast<char*>(base) + lead, (Py_ssize_t)length,
+        writable ? PyBUF_WRITE : PyBUF_READ);
+}
+
+static PyObject* VkShmUnmapView(PyObject*, PyObject* view) {
+    if (!PyMemoryView_Check(view)) {
+        PyErr_SetString(PyExc_TypeError, "unmap_view: expected a memoryview from map_view");
+        return nullptr;
+    }
+    Py_buffer buffer{};
+    if (PyObject_GetBuffer(view, &buffer, PyBUF_SIMPLE) != 0) return nullptr; // Already released.
+    const void* address = buffer.buf;
+    PyBuffer_Release(&buffer);
+    // Slices share the managed buffer; unmapping under them would leave dangling views.
+    if (reinterpret_cast<PyMemoryViewObject*>(view)->mbuf->exports > 1) {
+        PyErr_SetString(PyExc_BufferError, "unmap_view: the view still has live slices");
+        return nullptr;
+    }
+    MEMORY_BASIC_INFORMATION info{};
+    if (!VirtualQuery(address, &info, sizeof(info)) || info.Type != MEM_MAPPED) {
+        PyErr_SetString(PyExc_ValueError, "unmap_view: not a mapped section view");
+        return nullptr;
+    }
+    PyObject* released = PyObject_CallMethod(view, "release", nullptr);
+    if (!released) return nullptr;
+    Py_DECREF(released);
+    if (!UnmapViewOfFile(info.AllocationBase)) return PyErr_SetFromWindowsErr(0);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef vkShmMethods[] = {
+    {"map_view", VkShmMapView, METH_VARARGS, "Map an inherited section handle as a memoryview."},
+    {"unmap_view", VkShmUnmapView, METH_O, "Release a map_view memoryview and unmap its section view."},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyModuleDef vkShmDef = { PyModuleDef_HEAD_INIT, "_vkshm", nullptr, 0, vkShmMethods };
+
+static PyObject* PyInit__vkshm(void) {
+    return PyModule_Create(&vkShmDef);
+}
+
 static struct _inittab vkBuiltinModules[] = {
     {"_abc", PyInit__abc},
     {"array", PyInit_array},
@@ -209,6 +282,7 @@ static struct _inittab vkBuiltinModules[] = {
     {"_stat", PyInit__stat},
     {"_opcode", PyInit__opcode},
     {"_contextvars", PyInit__contextvars},
+    {"_vkshm", PyInit__vkshm},
     {nullptr, nullptr}
 };
 
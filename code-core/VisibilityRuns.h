@@ -0,0 +1,55 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/* The two halves of a bulk hide / show (SET_VISIBILITY_RANGES, RenderScene3D.h) that need neither
+Windows nor DirectX, so validations/VisibilityRunsTest.cpp checks them against one write per object:
+ApplySceneVisibilityAction folds the affected memoryIDs into a run list, and the copy thread cuts
+the changed mask words into spans of adjacent gpuInstanceIndex, one staging region and one
+CopyBufferRegion each. */
+
+// Flattened inclusive [first, last] memoryID pairs, ascending and non-overlapping, naming exactly
+// `ids` (any order, duplicates allowed). Sorts `ids` in place unless it already is sorted - the
+// store is appended in memoryID order, so Hide Unselected normally is.
+inline std::vector<uint64_t> VisibilityRunsFromIds(std::vector<uint64_t>& ids) {
+    if (!std::is_sorted(ids.begin(), ids.end())) std::sort(ids.begin(), ids.end());
+    std::vector<uint64_t> runs;
+    for (uint64_t id : ids) {
+        if (!runs.empty() && id <= runs.back() + 1) {
+            runs.back() = (std::max)(runs.back(), id); // Extends the run; drops duplicates.
+            continue;
+        }
+        runs.push_back(id);
+        runs.push_back(id);
+    }
+    return runs;
+}
+
+// Number of memoryIDs a run list names (an upper bound on the objects it touches: ids that are not
+// on the GPU, or whose bit is already right, cost nothing).
+inline uint64_t VisibilityRunIdCount(const std::vector<uint64_t>& runs) {
+    uint64_t count = 0;
+    for (size_t i = 0; i + 1 < runs.size(); i += 2) count += runs[i + 1] - runs[i] + 1;
+    return count;
+}
+
+// Sorts (gpuInstanceIndex, new mask word) `updates` by index and calls writeSpan(first, last) for
+// every half-open range [first, last) of them whose indices are consecutive, at most
+// `maxWordsPerSpan` long.
+template <typename WriteSpan>
+void ForEachVisibilityMaskSpan(std::vector<std::pair<uint32_t, uint64_t>>& updates,
+    size_t maxWordsPerSpan, WriteSpan&& writeSpan) {
+    std::sort(updates.begin(), updates.end());
+    for (size_t first = 0; first < updates.size(); ) {
+        size_t last = first + 1;
+        while (last < updates.size() && last - first < maxWordsPerSpan &&
+            updates[last].first == updates[last - 1].first + 1) ++last;
+        writeSpan(first, last);
+        first = last;
+    }
+}
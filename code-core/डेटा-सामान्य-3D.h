@@ -8,6 +8,7 @@
 #include <d3d12.h>
 #include "डेटा.h"
 #include "CommonNamedNumbers.h"
+#include "PrimitiveSurfaces.h"
 #include <random>
 constexpr float M_PI = 3.1415926535f; // TODO: Why it's not coming from cmath library ?
 
@@ -745,35 +746,10 @@ inline GeometryData SPHERE::GetGeometry() {
     geometry.vertices.reserve((stackCount + 1) * sliceCount);
     geometry.indices.reserve(stackCount * sliceCount * 6);
 
-    XMVECTOR vCenter = XMLoadFloat3(&center);
-
-    // Helper for smooth spherical normal
-    auto GetSphericalNormal = [&](XMVECTOR vertexPos) -> XMUBYTE4 {
-        XMFLOAT3 normalFloat;
-        XMStoreFloat3(&normalFloat, XMVector3Normalize(vertexPos - vCenter));
-        return PackNormal(normalFloat);
-    };
-
-    // Generate full latitude rings (including top and bottom)
-    for (int i = 0; i <= stackCount; ++i) {
-
-        float phi = XM_PI * i / stackCount; // 0 → PI
-        float sinPhi = sinf(phi);
-        float cosPhi = cosf(phi);
-
-        for (int j = 0; j < sliceCount; ++j) {
-            float theta = XM_2PI * j / sliceCount; // 0 → 2PI
-
-            XMFLOAT3 pos = {
-                center.x + radius * sinPhi * cosf(theta),
-                center.y + radius * cosPhi,
-                center.z + radius * sinPhi * sinf(theta)
-            };
-
-            XMVECTOR vPos = XMLoadFloat3(&pos);
-            geometry.vertices.push_back( Vertex{ pos, GetSphericalNormal(vPos) } );
-        }
-    }
+    // Full latitude rings (including top and bottom), smooth spherical normals: PrimitiveSurfaces.h.
+    SphereSurface(center, radius, sliceCount, stackCount, [&](const XMFLOAT3& position, const XMFLOAT3& normal) {
+        geometry.vertices.push_back(Vertex{ position, PackNormal(normal) });
+    });
 
     // Connect stacks with quads (2 triangles each)
     for (int i = 0; i < stackCount; ++i) {
@@ -818,25 +794,10 @@ inline GeometryData TORUS::GetGeometry() {
     geometry.vertices.reserve(majorSegments * minorSegments);
     geometry.indices.reserve(majorSegments * minorSegments * 6);
 
-    for (int i = 0; i < majorSegments; ++i) {
-        const float theta = XM_2PI * i / majorSegments;
-        const float cosTheta = cosf(theta);
-        const float sinTheta = sinf(theta);
-
-        for (int j = 0; j < minorSegments; ++j) {
-            const float phi = XM_2PI * j / minorSegments;
-            const float cosPhi = cosf(phi);
-            const float sinPhi = sinf(phi);
-            const float ringRadius = majorRadius + minorRadius * cosPhi;
-            XMFLOAT3 position = {
-                center.x + ringRadius * cosTheta,
-                center.y + minorRadius * sinPhi,
-                center.z + ringRadius * sinTheta
-            };
-            XMFLOAT3 normal = { cosTheta * cosPhi, sinPhi, sinTheta * cosPhi };
+    TorusSurface(center, majorRadius, minorRadius, majorSegments, minorSegments,
+        [&](const XMFLOAT3& position, const XMFLOAT3& normal) {
             geometry.vertices.push_back(Vertex{ position, PackNormal(normal) });
-        }
-    }
+        });
 
     for (int i = 0; i < majorSegments; ++i) {
         const int nextI = (i + 1) % majorSegments;
@@ -878,28 +839,10 @@ inline GeometryData ELLIPSOID::GetGeometry() {
     geometry.vertices.reserve((stackCount + 1) * sliceCount);
     geometry.indices.reserve(stackCount * sliceCount * 6);
 
-    for (int i = 0; i <= stackCount; ++i) {
-        const float phi = XM_PI * i / stackCount;
-        const float sinPhi = sinf(phi);
-        const float cosPhi = cosf(phi);
-
-        for (int j = 0; j < sliceCount; ++j) {
-            const float theta = XM_2PI * j / sliceCount;
-            const float cosTheta = cosf(theta);
-            const float sinTheta = sinf(theta);
-            XMFLOAT3 position = {
-                center.x + radiusX * sinPhi * cosTheta,
-                center.y + radiusY * cosPhi,
-                center.z + radiusZ * sinPhi * sinTheta
-            };
-            XMFLOAT3 normal = {
-                (position.x - center.x) / (radiusX * radiusX),
-                (position.y - center.y) / (radiusY * radiusY),
-                (position.z - center.z) / (radiusZ * radiusZ)
-            };
+    EllipsoidSurface(center, radiusX, radiusY, radiusZ, sliceCount, stackCount,
+        [&](const XMFLOAT3& position, const XMFLOAT3& normal) {
             geometry.vertices.push_back(Vertex{ position, PackNormal(normal) });
-        }
-    }
+        });
 
     for (int i = 0; i < stackCount; ++i) {
         for (int j = 0; j < sliceCount; ++j) {
@@ -15,6 +15,9 @@ This thread is also responsible for engineering calculations, consistency of Dat
 #include <random> // Required for std::uniform_int_distribution
 #include <unordered_map>
 #include <memory>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <bit> // std::bit_cast for the property-edit value payload.
 #include "MemoryManagerCPU.h"
 #include "विश्वकर्मा.h"
@@ -22,7 +25,10 @@ This thread is also responsible for engineering calculations, consistency of Dat
 #include "डेटा-सामान्य-3D.h"
 #include "डेटा-पाइप.h"
 #include "डेटा-संरचना.h"
+#include "EngineeringParallelFor.h"
+#include "PropertyEditCommit.h"
 #include "PropertyPane.h"
+#include "SceneExtentsFit.h"
 #include "ExtensionCommunications.h"
 #include "GPUPlatformSelector.h"
 
@@ -640,6 +646,8 @@ static META_DATA* CreateLogicalElement(DATASETTAB* targetTab, VishwakarmaStorage
     {
         std::lock_guard<std::mutex> lock(*targetTab->storageObjectsMutex);
         targetTab->storageLogicalObjects.push_back({ objectType, object->memoryID, object });
+        targetTab->objectIndex.Insert(object->memoryID, TabObjectStore::Logical,
+            static_cast<uint32_t>(targetTab->storageLogicalObjects.size() - 1));
         if (objectType == VishwakarmaStorage::ObjectType::Scene3D) {
             if (targetTab->defaultScene3DMemoryId == 0) {
                 targetTab->defaultScene3DMemoryId = object->memoryID;
@@ -803,6 +811,8 @@ static void RegisterGeneratedGeometryElement(DATASETTAB* targetTab, VishwakarmaS
     {
         std::lock_guard<std::mutex> lock(*targetTab->storageObjectsMutex);
         targetTab->storageObjects3D.push_back({ objectType, object->memoryID, object });
+        targetTab->objectIndex.Insert(object->memoryID, TabObjectStore::Geometry3D,
+            static_cast<uint32_t>(targetTab->storageObjects3D.size() - 1));
     }
 
     targetTab->allIDsInThisTab.push_back(object->memoryID);
@@ -826,8 +836,14 @@ static void FlushGeneratedGeometryBatch(DATASETTAB* targetTab, GeneratedGeometry
         // Held briefly and once: the render thread takes this mutex every frame in
         // ResolveWindowViewTarget, so per-object locking here stalls rendering during an import.
         std::lock_guard<std::mutex> lock(*targetTab->storageObjectsMutex);
+        const size_t firstSlot = targetTab->storageObjects3D.size();
         targetTab->storageObjects3D.insert(targetTab->storageObjects3D.end(),
             batch.storedObjects.begin(), batch.storedObjects.end());
+        targetTab->objectIndex.Reserve(targetTab->objectIndex.Size() + batch.storedObjects.size());
+        for (size_t i = 0; i < batch.storedObjects.size(); ++i) {
+            targetTab->objectIndex.Insert(batch.storedObjects[i].memoryId, TabObjectStore::Geometry3D,
+                static_cast<uint32_t>(firstSlot + i));
+        }
     }
 
     targetTab->allIDsInThisTab.insert(targetTab->allIDsInThisTab.end(),
@@ -839,55 +855,108 @@ static void FlushGeneratedGeometryBatch(DATASETTAB* targetTab, GeneratedGeometry
     toCopyThreadCV.notify_one();
 }
 
-// Applies one committed property edit: validate against live values (authoritative gate), store the
-// field, bump dataVersion, regenerate geometry and push a MODIFY to the copy thread. The two mutexes
-// are taken strictly one after the other, never nested (matching AppendObjectToTab /
-// RegisterGeneratedGeometryElement). See propertiesPane.md §5.
+// Slot of memoryId in tab.storageObjects3D, or SelectionSet::kNoStoredIndex. Engineering thread only.
+static uint32_t StoredObjectIndexOf(const DATASETTAB& tab, uint64_t memoryId) {
+    const TabObjectSlot found = tab.objectIndex.Find(memoryId);
+    return found.store == TabObjectStore::Geometry3D ? found.slot : SelectionSet::kNoStoredIndex;
+}
+
+// The stored object a selection entry names, via its slot hint; nullptr when the hint went stale
+// (the store was reset since) or the id never was a stored 3D object. Engineering thread only.
+static StoredGeometryObject3D* SelectedStoredObject(DATASETTAB& tab, uint64_t memoryId, uint32_t storedIndex) {
+    if (storedIndex >= tab.storageObjects3D.size()) return nullptr;
+    StoredGeometryObject3D& stored = tab.storageObjects3D[storedIndex];
+    return stored.memoryId == memoryId && stored.object ? &stored : nullptr;
+}
+
+/* PropertyEditCommit.h's Edit for the 3D property tables: one field of objectType set to newValue.
+Validate re-runs the MVP validator against live values. The UI pre-validated, so this only fires on
+races or bugs; a rejection drops the commit for that object. The validation snapshot and the incoming
+value are both in the space the pane showed - WORLD for point components - and every rule is
+placement-invariant, so the verdict is unchanged. A PropertyEditEffect::Placement field skips the
+regeneration: Store moves the placement and fills the transform-only encoding, exactly like
+TranslateSelectedSceneObjects, so dragging a fine TORUS's center costs one instance record instead of
+a re-mesh and a page clone. See propertiesPane.md §5. */
+struct PropertyEdit3D {
+    VishwakarmaStorage::ObjectType objectType;
+    const PropertyTypeDescriptor* table;
+    uint8_t fieldIndex;
+    float newValue;
+    uint64_t tabID;
+
+    bool Validate(META_DATA* object) const {
+        float values[16] = {};
+        ReadPropertyValuesForDisplay(*table, object, values);
+        return ValidatePropertyEdit(*table, values, table->fieldCount, fieldIndex, newValue);
+    }
+    bool Store(META_DATA* object, GeometryData& geometry) const {
+        const bool placementOnly = ApplyPlacementValueFromDisplay(*table, object, fieldIndex, newValue);
+        if (!placementOnly) ApplyPropertyValueFromDisplay(*table, object, fieldIndex, newValue);
+        object->dataVersion++;
+        if (placementOnly) { // No vertices, no indices: the transform-only encoding.
+            geometry.id = object->memoryID;
+            XMStoreFloat4x4(&geometry.worldMatrix, PlacementForObject(objectType, object)->ToMatrix());
+        }
+        return placementOnly;
+    }
+    bool Regenerate(META_DATA* object, GeometryData& geometry) const { // GetGeometry reads only its own object.
+        return GeometryForObject(objectType, object, geometry);
+    }
+    void Emit(META_DATA* object, GeometryData&& geometry) const {
+        commandToCopyThreadQueue.push({ CommandToCopyThreadType::MODIFY, std::move(geometry), object->memoryID,
+            tabID, object->memoryIDParent });
+    }
+};
+
+// Applies one committed property edit: validate, store the field, bump dataVersion, regenerate (or
+// move the placement) and push a MODIFY to the copy thread (CommitPropertyEdit).
 static void ModifyObjectProperty(DATASETTAB* myTab, uint64_t objectId, uint8_t fieldIndex, double value) {
     if (!myTab || !myTab->storageObjectsMutex) return;
 
     // The engineering thread is the sole writer of storageObjects3D, so the lookup needs no lock.
-    META_DATA* object = nullptr;
-    VishwakarmaStorage::ObjectType objectType = VishwakarmaStorage::ObjectType::Unknown;
-    for (const StoredGeometryObject3D& stored : myTab->storageObjects3D) {
-        if (stored.memoryId == objectId) {
-            object = stored.object;
-            objectType = stored.objectType;
-            break;
-        }
+    const StoredGeometryObject3D* stored = FindStoredObject3D(*myTab, objectId);
+    if (!stored || !stored->object) return;
+    const PropertyTypeDescriptor* table = FindPropertyTable(stored->objectType);
+    if (!table || fieldIndex >= table->fieldCount) return;
+
+    PropertyEdit3D edit{ stored->objectType, table, fieldIndex, static_cast<float>(value), myTab->tabID };
+    if (CommitPropertyEdit<GeometryData>(stored->object, edit, *myTab->storageObjectsMutex, toCopyThreadMutex)) {
+        toCopyThreadCV.notify_one();
     }
-    if (!object) return;
+}
 
+/* The batched form of ModifyObjectProperty: one field set to one value on every selected object of
+objectType (the type the pane was showing; other selected types are left alone), through
+CommitPropertyEditBatch - one lock acquisition per mutex for the whole selection, shape edits
+regenerated on EngineeringParallelFor. A new outside diameter that some pipe's inside diameter
+already exceeds leaves that pipe alone, as committing to each pipe in turn would. Returns the
+number of objects edited. */
+static size_t ModifySelectedObjectsProperty(DATASETTAB* myTab, VishwakarmaStorage::ObjectType objectType,
+    uint8_t fieldIndex, double value) {
+    if (!myTab || !myTab->storageObjectsMutex) return 0;
     const PropertyTypeDescriptor* table = FindPropertyTable(objectType);
-    if (!table || fieldIndex >= table->fieldCount) return;
-
-    // Re-run the MVP validator against live values. The UI pre-validated, so this only fires on
-    // races or bugs; on rejection we simply drop the commit.
-    // Both the validation snapshot and the incoming value are in the same space the pane showed -
-    // WORLD for point components. Every rule is placement-invariant, so the verdict is unchanged.
-    float values[16] = {};
-    const uint8_t count = table->fieldCount;
-    ReadPropertyValuesForDisplay(*table, object, values);
-    const float newValue = static_cast<float>(value);
-    if (!ValidatePropertyEdit(*table, values, count, fieldIndex, newValue)) return;
+    if (!table || fieldIndex >= table->fieldCount) return 0;
 
+    SelectionSet selected;
     {
-        // Hold storageObjectsMutex only for the store, so the render thread (which takes it every
-        // frame) is not stalled by geometry generation.
-        std::lock_guard<std::mutex> lock(*myTab->storageObjectsMutex);
-        ApplyPropertyValueFromDisplay(*table, object, fieldIndex, newValue);
-        object->dataVersion++;
+        std::lock_guard<std::mutex> lock(myTab->selection.selectedMutex);
+        selected = myTab->selection.selectedObjectIds;
     }
 
-    GeometryData geo; // Regenerate with no lock held.
-    if (!GeometryForObject(objectType, object, geo)) return;
-
-    {
-        std::lock_guard<std::mutex> lock(toCopyThreadMutex);
-        commandToCopyThreadQueue.push({ CommandToCopyThreadType::MODIFY, std::move(geo), object->memoryID,
-            myTab->tabID, object->memoryIDParent });
+    std::vector<META_DATA*> candidates;
+    candidates.reserve(selected.Size());
+    for (size_t i = 0; i < selected.Size(); ++i) {
+        const StoredGeometryObject3D* stored =
+            SelectedStoredObject(*myTab, selected.Ids()[i], selected.StoredIndices()[i]);
+        if (stored && stored->objectType == objectType) candidates.push_back(stored->object);
     }
-    toCopyThreadCV.notify_one();
+
+    PropertyEdit3D edit{ objectType, table, fieldIndex, static_cast<float>(value), myTab->tabID };
+    EngineeringParallelFor regeneration;
+    const size_t edited = CommitPropertyEditBatch<GeometryData>(candidates, edit, *myTab->storageObjectsMutex,
+        toCopyThreadMutex, regeneration);
+    if (edited != 0) toCopyThreadCV.notify_one();
+    return edited;
 }
 
 static XMFLOAT3 AddPoint(const XMFLOAT3& a, const XMFLOAT3& b) {
@@ -996,9 +1065,11 @@ static void ApplyPickResult(DATASETTAB& tab, bool hit, uint64_t objectId,
     const PickPurpose purpose = static_cast<PickPurpose>(purposeRaw);
     CameraState& cam = ActiveSceneCamera(tab);
     if (purpose == PickPurpose::Select) {
+        // Resolved before taking the mutex: the render thread copies the selection every frame.
+        const uint32_t storedIndex = objectId != 0 ? StoredObjectIndexOf(tab, objectId) : SelectionSet::kNoStoredIndex;
         std::lock_guard<std::mutex> lock(tab.selection.selectedMutex);
-        tab.selection.selectedObjectIds.clear();
-        if (objectId != 0) tab.selection.selectedObjectIds.push_back(objectId); // Single-select.
+        tab.selection.selectedObjectIds.Clear();
+        if (objectId != 0) tab.selection.selectedObjectIds.Insert(objectId, storedIndex); // Single-select.
         /* Selecting deliberately does NOT move the camera. It used to recenter the orbit target on
         the picked object's CG, which meant every click re-framed the whole scene - fine for the
         first pick, disorienting for the tenth. Picking is now a pure selection change; the view is
@@ -1019,6 +1090,15 @@ static void ApplyPickResult(DATASETTAB& tab, bool hit, uint64_t objectId,
     }
 }
 
+// Refreshes stored's zoom-extents cache (StoredGeometryObject3D::bounds*) from the object's mesh.
+// The only mesh generation zoom-to-extents still does: once per object and dataVersion.
+static void RefreshObjectBounds(StoredGeometryObject3D& stored, GeometryData& scratch) {
+    stored.boundsVersion = stored.object->dataVersion;
+    stored.boundsRadius = -1.0f;
+    if (!GeometryForObject(stored.objectType, stored.object, scratch)) return;
+    SceneBoundsOfVertices(scratch.vertices, stored.boundsCenter, stored.boundsExtents, stored.boundsRadius);
+}
+
 // Zoom Max / Zoom Focus for the 3D scene: dolly the camera along its existing view direction so
 // the objects fit the visible frustum. The look target and view direction stay fixed; only the
 // distance between the camera and its target/projection plane changes. selectedOnly limits the
@@ -1026,12 +1106,12 @@ static void ApplyPickResult(DATASETTAB& tab, bool hit, uint64_t objectId,
 static void ZoomSceneToExtents(DATASETTAB* myTab, bool selectedOnly) {
     if (!myTab) return;
 
-    std::vector<uint64_t> selected;
+    SelectionSet selected;
     if (selectedOnly) {
         std::lock_guard<std::mutex> lock(myTab->selection.selectedMutex);
         selected = myTab->selection.selectedObjectIds;
     }
-    const bool filterBySelection = selectedOnly && !selected.empty(); // Empty selection = fit all.
+    const bool filterBySelection = selectedOnly && !selected.Empty(); // Empty selection = fit all.
 
     CameraState& cam = ActiveSceneCamera(*myTab);
     DirectX::XMVECTOR target = DirectX::XMLoadFloat3(&cam.target);
@@ -1056,40 +1136,45 @@ static void ZoomSceneToExtents(DATASETTAB* myTab, bool selectedOnly) {
     const float tanHalfFovX = tanHalfFovY * aspect;
     if (tanHalfFovY <= 0.0001f || tanHalfFovX <= 0.0001f) return;
 
-    // The engineering thread is the sole writer of storageObjects3D, so iteration needs no lock.
-    float requiredDistance = 0.0f;
-    bool hasPoints = false;
-    GeometryData geometry;
-    for (const StoredGeometryObject3D& stored : myTab->storageObjects3D) {
-        if (!stored.object) continue;
-        if (filterBySelection &&
-            std::find(selected.begin(), selected.end(), stored.memoryId) == selected.end()) continue;
-        if (!GeometryForObject(stored.objectType, stored.object, geometry)) continue;
-        /* Vertices come out of the generator in AUTHORED space, so a placed object has to be
-        carried to world space before it can be framed - otherwise zoom-to-fit would point the
-        camera at where the object was drawn rather than where it is displayed. The vertex shader
-        applies exactly this matrix, so doing it here keeps the fit consistent with what is on
-        screen. Identity for anything that has never been moved, which is the common case. */
-        const DirectX::XMMATRIX world = DirectX::XMLoadFloat4x4(&geometry.worldMatrix);
-        for (const Vertex& vertex : geometry.vertices) {
-            const DirectX::XMVECTOR worldPosition = DirectX::XMVector3Transform(
-                DirectX::XMLoadFloat3(&vertex.position), world);
-            DirectX::XMVECTOR offset = DirectX::XMVectorSubtract(worldPosition, target);
-            const float alongForward = DirectX::XMVectorGetX(DirectX::XMVector3Dot(offset, forward));
-            const float alongRight = DirectX::XMVectorGetX(DirectX::XMVector3Dot(offset, right));
-            const float alongUp = DirectX::XMVectorGetX(DirectX::XMVector3Dot(offset, viewUp));
-            // With the camera at distance d behind the target, the point's depth is d + alongForward
-            // and it is inside the frustum when |lateral| <= depth * tanHalfFov. Solve for minimum d.
-            requiredDistance = (std::max)(requiredDistance, std::abs(alongRight) / tanHalfFovX - alongForward);
-            requiredDistance = (std::max)(requiredDistance, std::abs(alongUp) / tanHalfFovY - alongForward);
-            requiredDistance = (std::max)(requiredDistance, cam.nearZ - alongForward);
-            hasPoints = true;
+    // The fit itself, and why the cached bounds give the per-vertex answer, is SceneExtentsFit.h.
+    DirectX::XMFLOAT3 forwardAxis, rightAxis, upAxis;
+    DirectX::XMStoreFloat3(&forwardAxis, forward);
+    DirectX::XMStoreFloat3(&rightAxis, right);
+    DirectX::XMStoreFloat3(&upAxis, viewUp);
+    SceneExtentsFit fit(cam.target, forwardAxis, rightAxis, upAxis, tanHalfFovX, tanHalfFovY);
+
+    // The engineering thread is the sole writer of storageObjects3D (and the only user of the
+    // bounds cache in it), so iteration needs no lock.
+    GeometryData scratch;
+    auto fitObject = [&](StoredGeometryObject3D& stored) {
+        if (stored.boundsVersion != stored.object->dataVersion) RefreshObjectBounds(stored, scratch);
+        if (stored.boundsRadius < 0.0f) return;
+        // The cache is in AUTHORED space; a placed object's bounds go through its placement, the
+        // same one the vertex shader applies. Identity for anything never moved, the common case.
+        const Placement3D* placement = PlacementForObject(stored.objectType, stored.object);
+        if (placement && !placement->IsIdentity()) {
+            fit.AddBounds(stored.boundsCenter, stored.boundsExtents, stored.boundsRadius,
+                placement->origin, placement->rotation);
+        } else {
+            fit.AddBounds(stored.boundsCenter, stored.boundsExtents, stored.boundsRadius);
+        }
+    };
+    if (filterBySelection) {
+        // Only the selected objects are visited, never the whole store.
+        for (size_t i = 0; i < selected.Size(); ++i) {
+            StoredGeometryObject3D* stored =
+                SelectedStoredObject(*myTab, selected.Ids()[i], selected.StoredIndices()[i]);
+            if (stored) fitObject(*stored);
+        }
+    } else {
+        for (StoredGeometryObject3D& stored : myTab->storageObjects3D) {
+            if (stored.object) fitObject(stored);
         }
     }
-    if (!hasPoints) return;
+    if (fit.Empty()) return;
 
     // Same distance clamping as the mouse-wheel zoom.
-    const float newDistance = std::clamp(requiredDistance, 1.0f, cam.farZ - 10.0f);
+    const float newDistance = std::clamp(fit.RequiredDistance(cam.nearZ), 1.0f, cam.farZ - 10.0f);
     DirectX::XMStoreFloat3(&cam.position,
         DirectX::XMVectorSubtract(target, DirectX::XMVectorScale(forward, newDistance)));
     myTab->selection.lastNavInteractionMs.store(GetTickCount64(), std::memory_order_release);
@@ -1098,10 +1183,11 @@ static void ZoomSceneToExtents(DATASETTAB* myTab, bool selectedOnly) {
 /* Per-object hide / show inside the input view's Scene3D (graphics.md, 10M plan Step 5).
 
 The engineering thread decides WHICH objects change; the copy thread owns the membership word and
-does the bit arithmetic. All that crosses between them is one SET_VISIBILITY per affected object,
-and each of those costs one aligned 8-byte write - no geometry page cloned, no argument buffer
-rebuilt, no snapshot published. That is the entire point: hiding half of a ten-million-object scene
-must not touch geometry at all.
+does the bit arithmetic. All that crosses between them is ONE SET_VISIBILITY_RANGES per action -
+a sorted memoryID run list, or a whole-container flag - and each affected object then costs one
+8-byte word inside a span-wide write: no geometry page cloned, no argument buffer rebuilt, no
+snapshot published. Hiding half of a ten-million-object scene must not touch geometry at all, nor
+queue ten million commands (one SET_VISIBILITY per object, as it used to).
 
 The bit is the sub-tab SLOT, so a hide applies to the view the user is looking at rather than to
 every view of the same Scene3D.
@@ -1141,36 +1227,67 @@ static void ApplySceneVisibilityAction(DATASETTAB* myTab, SceneVisibilityAction
     if (bit == kNoSubTabBit) return; // Defensive: every slot has a bit at MV_MAX_SUBTABS 64.
     if (myTab->subTabs[viewSlot].containerMemoryId == 0) return;
 
-    std::vector<uint64_t> selected;
+    SelectionSet selected;
     if (action != SceneVisibilityAction::ShowAll) {
         std::lock_guard<std::mutex> lock(myTab->selection.selectedMutex);
         selected = myTab->selection.selectedObjectIds;
     }
     // Hiding nothing is not the same as hiding everything: with an empty selection both hide
     // actions are no-ops rather than blanking the view or hiding the whole model.
-    if (action != SceneVisibilityAction::ShowAll && selected.empty()) return;
+    if (action != SceneVisibilityAction::ShowAll && selected.Empty()) return;
 
-    // The engineering thread is the sole writer of storageObjects3D, so iteration needs no lock.
     std::vector<CommandToCopyThread> commands;
-    for (const StoredGeometryObject3D& stored : myTab->storageObjects3D) {
-        if (!stored.object) continue;
-        // The whole container SET the sub-tab draws, so a composed container hides too.
-        if (!SubTabDrawsContainer(*myTab, viewSlot, stored.object->memoryIDParent)) continue;
-        const bool isSelected =
-            std::find(selected.begin(), selected.end(), stored.memoryId) != selected.end();
-        if (action == SceneVisibilityAction::HideSelected && !isSelected) continue;
-        if (action == SceneVisibilityAction::HideUnselected && isSelected) continue;
-
+    auto makeCommand = [&](uint64_t containerMemoryId) {
         CommandToCopyThread command;
-        command.type = CommandToCopyThreadType::SET_VISIBILITY;
-        command.id = stored.memoryId;
+        command.type = CommandToCopyThreadType::SET_VISIBILITY_RANGES;
         command.tabID = myTab->tabID;
-        command.containerMemoryId = stored.object->memoryIDParent;
+        command.containerMemoryId = containerMemoryId;
         command.visibilityBits = 1ull << bit;
         command.visibilityVisible = action == SceneVisibilityAction::ShowAll;
-        commands.push_back(std::move(command));
+        return command;
+    };
+    if (action == SceneVisibilityAction::ShowAll) {
+        // Whole containers: the copy thread restores the bit from its hidden-object shadow, so
+        // this walks neither the store nor the scene. The empty-set fallback mirrors
+        // SubTabDrawsContainer.
+        const InternalSubTab& subTab = myTab->subTabs[viewSlot];
+        if (subTab.containers.Empty()) {
+            commands.push_back(makeCommand(subTab.containerMemoryId));
+            commands.back().visibilityWholeContainer = true;
+        }
+        for (uint8_t i = 0; i < subTab.containers.count; ++i) {
+            commands.push_back(makeCommand(subTab.containers.ids[i]));
+            commands.back().visibilityWholeContainer = true;
+        }
+    } else {
+        // The engineering thread is the sole writer of storageObjects3D, so iteration needs no lock.
+        std::vector<uint64_t> ids;
+        auto addObject = [&](const StoredGeometryObject3D& stored) {
+            // The whole container SET the sub-tab draws, so a composed container hides too.
+            if (SubTabDrawsContainer(*myTab, viewSlot, stored.object->memoryIDParent)) {
+                ids.push_back(stored.memoryId);
+            }
+        };
+        if (action == SceneVisibilityAction::HideSelected) {
+            // Walks the selection only; Hide Unselected is inherently over the whole store.
+            for (size_t i = 0; i < selected.Size(); ++i) {
+                const StoredGeometryObject3D* stored =
+                    SelectedStoredObject(*myTab, selected.Ids()[i], selected.StoredIndices()[i]);
+                if (stored) addObject(*stored);
+            }
+        } else {
+            for (const StoredGeometryObject3D& stored : myTab->storageObjects3D) {
+                if (!stored.object) continue;
+                if (selected.Contains(stored.memoryId)) continue;
+                addObject(stored);
+            }
+        }
+        if (ids.empty()) return;
+        // Hide Unselected's complement of a small selection is a handful of runs.
+        commands.push_back(makeCommand(myTab->subTabs[viewSlot].containerMemoryId));
+        commands.back().visibilityIdRuns =
+            std::make_shared<const std::vector<uint64_t>>(VisibilityRunsFromIds(ids));
     }
-    if (commands.empty()) return;
 
     {   // One lock for the whole burst, like FlushGeneratedGeometryBatch: the copy thread's drain
         // takes this same mutex, so holding it across the push is what keeps them in one batch.
@@ -1209,21 +1326,24 @@ static size_t TranslateSelectedSceneObjects(DATASETTAB* myTab, const XMFLOAT3& d
     if (myTab->subTabs[viewSlot].containerType != VishwakarmaStorage::ObjectType::Scene3D) return 0;
     if (myTab->subTabs[viewSlot].containerMemoryId == 0) return 0;
 
-    std::vector<uint64_t> selected;
+    SelectionSet selected;
     {
         std::lock_guard<std::mutex> lock(myTab->selection.selectedMutex);
         selected = myTab->selection.selectedObjectIds;
     }
-    if (selected.empty()) return 0; // Moving nothing is a no-op, not "move everything".
+    if (selected.Empty()) return 0; // Moving nothing is a no-op, not "move everything".
 
-    // The engineering thread is the sole writer of storageObjects3D, so iteration needs no lock;
-    // only the placement WRITE below does.
+    // The engineering thread is the sole writer of storageObjects3D, so the lookups need no lock;
+    // only the placement WRITE below does. Walks the selection, not the store.
     std::vector<CommandToCopyThread> commands;
-    for (const StoredGeometryObject3D& stored : myTab->storageObjects3D) {
-        if (!stored.object) continue;
+    commands.reserve(selected.Size());
+    for (size_t i = 0; i < selected.Size(); ++i) {
+        const StoredGeometryObject3D* selectedStored =
+            SelectedStoredObject(*myTab, selected.Ids()[i], selected.StoredIndices()[i]);
+        if (!selectedStored) continue;
+        const StoredGeometryObject3D& stored = *selectedStored;
         // The whole container SET the sub-tab draws, so a composed container moves too.
         if (!SubTabDrawsContainer(*myTab, viewSlot, stored.object->memoryIDParent)) continue;
-        if (std::find(selected.begin(), selected.end(), stored.memoryId) == selected.end()) continue;
 
         Placement3D* placement = PlacementForObject(stored.objectType, stored.object);
         if (!placement) continue; // Type carries no placement; nothing to move.
@@ -1449,100 +1569,161 @@ static bool CreatePrimitiveGeometryElement(DATASETTAB* targetTab, VishwakarmaSto
     return true;
 }
 
-// Materializes a validated STAAD import: nodes as spheres, profile-mapped members as
-// LINE_MEMBERs, remaining members as placeholder pipes. Runs on the engineering
-// thread — the only writer of model data. The IPC and validation live in
-// ExtensionCommunications.cpp.
-static void ImportStdFileIntoTab(DATASETTAB* myTab, uint64_t payloadId) {
-    std::string error;
-    std::unique_ptr<ExtensionCommunications::ImportedStructuralModel> model(
-        ExtensionCommunications::RunQueuedStdImport(payloadId, error));
-    if (!model) {
-        std::cout << "[std-importer] " << error << "\n";
-        MessageBoxA(nullptr, error.c_str(), "STAAD import failed", MB_OK | MB_ICONERROR);
-        return;
-    }
+// Streamed imports hand accumulated geometry to the copy thread at most this often (plus once at
+// the end). The first batch goes out at once, so the first entities show up while the worker is
+// still sending; after that, one burst per interval keeps the copy thread from cloning pages for
+// every 4096-entity batch.
+constexpr ULONGLONG kImportPublishIntervalMs = 100;
 
-    const uint64_t sceneMemoryId = EnsureActiveScene3D(myTab);
-    if (sceneMemoryId != 0) OpenInternalSubTab(myTab, sceneMemoryId);
+// Materializes a STAAD import batch by batch as the worker streams it: nodes as spheres,
+// profile-mapped members as LINE_MEMBERs, remaining members as placeholder pipes. Runs on the
+// engineering thread — the only writer of model data. The IPC and validation live in
+// ExtensionCommunications.cpp; it guarantees a member's nodes arrived in an earlier batch.
+// Per batch: reserve one memory ID per arriving node and member, construct and tessellate the objects
+// on EngineeringParallelFor - each into its thread's own chunk arena, each carrying first ID + its
+// arrival index, so IDs (and the saved file) match a serial run - then register them in arrival order.
+/* A failed import keeps what arrived before the failure: its batches were already published to the
+copy thread, and rolling them back would mean undoing GPU work mid-flight. So that the partial
+model cannot pass for a complete one once the message box is dismissed, a root folder named for the
+failure is added to the data tree - visible in every view, and saved with the file. */
+static void MarkPartialImport(DATASETTAB* myTab, const char* folderName) {
+    CreateLogicalElement(myTab, VishwakarmaStorage::ObjectType::Folder, 0, folderName);
+}
 
+static void ImportStdFileIntoTab(DATASETTAB* myTab, uint64_t payloadId) {
     constexpr float kNodeRadius = 0.12f;            // Meters; import coordinates are SI.
     constexpr float kMemberOutsideDiameter = 0.25f; // For members without a mapped profile.
     constexpr float kMemberInsideDiameter = 0.10f;
 
-    // Designation -> catalog row for profile-mapped members. All STAAD-name mapping happens
-    // worker-side (profile_mapping.py); this is only an exact lookup into the embedded
-    // catalog. Duplicate designations across codes (JIS/KS mirrors) keep the first row —
-    // identical geometry by design.
-    std::unordered_map<std::string, const SteelProfileRecord*> profileByDesignation;
-    profileByDesignation.reserve(kSteelProfileCount);
-    for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
-        profileByDesignation.emplace(kSteelProfiles[i].designation, &kSteelProfiles[i]);
-    }
     const XMHALF4 nodeColor(0.85f, 0.25f, 0.15f, 1.0f);
     const XMHALF4 memberColor(0.35f, 0.55f, 0.85f, 1.0f);
 
-    std::unordered_map<uint32_t, XMFLOAT3> nodePositions;
-    nodePositions.reserve(model->nodes.size());
-
-    for (const auto& node : model->nodes) {
-        SPHERE* shape = new (myTab->tabNo) SPHERE();
-        shape->center = { node.x, node.y, node.z };
-        shape->radius = kNodeRadius;
-        shape->color = nodeColor;
-        nodePositions.emplace(node.id, shape->center);
-        RegisterGeneratedGeometryElement(myTab, SPHERE::storageObjectType, shape, shape->GetGeometry());
-    }
-
-    size_t createdLineMembers = 0, createdPipes = 0;
-    for (const auto& member : model->members) {
-        const auto start = nodePositions.find(member.startNodeId);
-        const auto end = nodePositions.find(member.endNodeId);
-        if (start == nodePositions.end() || end == nodePositions.end()) continue;
-        const float dx = end->second.x - start->second.x;
-        const float dy = end->second.y - start->second.y;
-        const float dz = end->second.z - start->second.z;
-        if (dx * dx + dy * dy + dz * dz < 1e-8f) continue; // Zero-length member: no axis.
-
-        const SteelProfileRecord* profile = nullptr;
-        if (!member.profileDesignation.empty()) {
-            const auto found = profileByDesignation.find(member.profileDesignation);
-            if (found != profileByDesignation.end()) profile = found->second;
+    // Import-wide node index -> position (ImportedMember::startNode/endNode). Outlives the
+    // batches: members need it.
+    std::vector<XMFLOAT3> nodePositions;
+    GeneratedGeometryBatch pending;
+    ULONGLONG lastPublishTick = 0; // 0 = nothing published yet: the scene is opened then.
+    size_t createdNodes = 0, createdLineMembers = 0, createdPipes = 0;
+
+    // One batch's objects in arrival order (the batch's nodes, then its members), and their meshes
+    // at the same index. A member that is skipped leaves a null object, and its reserved ID unused.
+    struct ImportedObject {
+        VishwakarmaStorage::ObjectType type;
+        META_DATA* object;
+    };
+    std::vector<ImportedObject> batchObjects;
+    std::vector<GeometryData> batchGeometry;
+    EngineeringParallelFor construction;
+    // One per construction slot for the whole import: a thread allocates only from its own chunk.
+    std::vector<राम::ChunkArena> arenas(construction.SlotCount(), राम::ChunkArena{ myTab->tabNo, nullptr });
+
+    auto importBatch = [&](ExtensionCommunications::ImportedStructuralModel& model) {
+        if (lastPublishTick == 0) {
+            const uint64_t sceneMemoryId = EnsureActiveScene3D(myTab);
+            if (sceneMemoryId != 0) OpenInternalSubTab(myTab, sceneMemoryId);
         }
-        if (profile) {
-            LINE_MEMBER* shape = new (myTab->tabNo) LINE_MEMBER();
-            shape->point1 = start->second;
-            shape->point2 = end->second;
-            shape->profileId = profile->id;
-            shape->userParameter1 = static_cast<float>(member.userParameter1 * 1000.0); // Wire meters -> stored mm.
-            shape->userParameter2 = static_cast<float>(member.userParameter2 * 1000.0);
-            shape->colorMain = memberColor;
+        // Node positions first: members of this batch may end on its own nodes.
+        const size_t firstBatchNode = nodePositions.size();
+        for (const auto& node : model.nodes) nodePositions.push_back({ node.x, node.y, node.z });
+        const size_t nodeCount = model.nodes.size();
+        const size_t objectCount = nodeCount + model.members.size();
+        batchObjects.assign(objectCount, ImportedObject{ SPHERE::storageObjectType, nullptr });
+        batchGeometry.resize(objectCount);
+        const uint64_t firstMemoryId = MemoryID::reserve(objectCount);
+
+        // Each call writes only its own slots and reads the batch, the node positions and the
+        // constant steel catalog; GetGeometry reads only its own object.
+        construction.RunWithSlots(objectCount, [&](size_t i, unsigned slot) {
+            राम::ArenaScope arena(arenas[slot]);
+            if (i < nodeCount) {
+                MemoryID::assignNext(firstMemoryId + i);
+                SPHERE* shape = new (myTab->tabNo) SPHERE();
+                shape->center = nodePositions[firstBatchNode + i];
+                shape->radius = kNodeRadius;
+                shape->color = nodeColor;
+                batchObjects[i] = { SPHERE::storageObjectType, shape };
+                batchGeometry[i] = shape->GetGeometry();
+                return;
+            }
+
+            const auto& member = model.members[i - nodeCount];
+            if (member.startNode >= nodePositions.size() || member.endNode >= nodePositions.size()) return;
+            const XMFLOAT3 start = nodePositions[member.startNode];
+            const XMFLOAT3 end = nodePositions[member.endNode];
+            const float dx = end.x - start.x;
+            const float dy = end.y - start.y;
+            const float dz = end.z - start.z;
+            if (dx * dx + dy * dy + dz * dz < 1e-8f) return; // Zero-length member: no axis.
+
+            // Catalog row already resolved from the designation during validation.
+            MemoryID::assignNext(firstMemoryId + i);
+            if (member.profile != kNoSteelProfile) {
+                LINE_MEMBER* shape = new (myTab->tabNo) LINE_MEMBER();
+                shape->point1 = start;
+                shape->point2 = end;
+                shape->profileId = kSteelProfiles[member.profile].id;
+                shape->userParameter1 = static_cast<float>(member.userParameter1 * 1000.0); // Wire meters -> stored mm.
+                shape->userParameter2 = static_cast<float>(member.userParameter2 * 1000.0);
+                shape->colorMain = memberColor;
+                shape->colorInner = memberColor;
+                shape->colorCap = memberColor;
+                batchObjects[i] = { LINE_MEMBER::storageObjectType, shape };
+                batchGeometry[i] = shape->GetGeometry();
+                return;
+            }
+
+            PIPE* shape = new (myTab->tabNo) PIPE();
+            shape->center1 = start;
+            shape->center2 = end;
+            shape->outsideDiameter = kMemberOutsideDiameter;
+            shape->insideDiameter = kMemberInsideDiameter;
+            shape->colorOuter = memberColor;
             shape->colorInner = memberColor;
             shape->colorCap = memberColor;
-            RegisterGeneratedGeometryElement(myTab, LINE_MEMBER::storageObjectType, shape, shape->GetGeometry());
-            ++createdLineMembers;
-            continue;
+            batchObjects[i] = { PIPE::storageObjectType, shape };
+            batchGeometry[i] = shape->GetGeometry();
+        });
+
+        // Registration (tab maps, the pending burst) stays on this thread, in arrival order.
+        for (size_t i = 0; i < objectCount; ++i) {
+            const ImportedObject& imported = batchObjects[i];
+            if (!imported.object) continue;
+            switch (imported.type) {
+            case SPHERE::storageObjectType: ++createdNodes; break;
+            case LINE_MEMBER::storageObjectType: ++createdLineMembers; break;
+            default: ++createdPipes; break;
+            }
+            RegisterGeneratedGeometryElement(myTab, imported.type, imported.object, std::move(batchGeometry[i]), &pending);
         }
 
-        PIPE* shape = new (myTab->tabNo) PIPE();
-        shape->center1 = start->second;
-        shape->center2 = end->second;
-        shape->outsideDiameter = kMemberOutsideDiameter;
-        shape->insideDiameter = kMemberInsideDiameter;
-        shape->colorOuter = memberColor;
-        shape->colorInner = memberColor;
-        shape->colorCap = memberColor;
-        RegisterGeneratedGeometryElement(myTab, PIPE::storageObjectType, shape, shape->GetGeometry());
-        ++createdPipes;
-    }
+        const ULONGLONG now = GetTickCount64();
+        if (lastPublishTick == 0 || now - lastPublishTick >= kImportPublishIntervalMs) {
+            FlushGeneratedGeometryBatch(myTab, pending);
+            lastPublishTick = now;
+        }
+    };
+
+    std::string error;
+    const bool succeeded = ExtensionCommunications::RunQueuedStdImport(payloadId, importBatch, error);
+    FlushGeneratedGeometryBatch(myTab, pending); // Tail burst; on failure what arrived stays imported.
 
-    std::cout << "[std-importer] Created " << model->nodes.size() << " node spheres, "
+    std::cout << "[std-importer] Created " << createdNodes << " node spheres, "
               << createdLineMembers << " profile members and "
               << createdPipes << " placeholder pipes." << std::endl; // Flush: rare event, aids diagnosis.
+    if (!succeeded) {
+        std::cout << "[std-importer] " << error << "\n";
+        const size_t created = createdNodes + createdLineMembers + createdPipes;
+        if (created != 0) {
+            MarkPartialImport(myTab, "INCOMPLETE STAAD import");
+            error += "\n\nThe " + std::to_string(created) + " elements that arrived before the failure were kept;"
+                     " the folder \"INCOMPLETE STAAD import\" marks this model as partial.";
+        }
+        MessageBoxA(nullptr, error.c_str(), "STAAD import failed", MB_OK | MB_ICONERROR);
+    }
 }
 
-// Materializes a validated DXF import into the currently open Page2D through
-// the same copy-thread queue interactive 2D creation uses. Import policy: the
+// Materializes a DXF import into the currently open Page2D batch by batch as the worker streams
+// it, through the same copy-thread queue interactive 2D creation uses. Import policy: the
 // content goes into the *active* Page2D sub-tab only; abort when none is open
 // (the UI pre-checks too, but the state can change while the action is queued).
 // Owner for engineering-thread message boxes: with a null owner the box can open BEHIND the
@@ -1568,133 +1749,132 @@ static void ImportDxfFileIntoTab(DATASETTAB* myTab, uint64_t payloadId) {
         return;
     }
 
-    std::string error;
-    std::unique_ptr<ExtensionCommunications::ImportedPage2DContent> content(
-        ExtensionCommunications::RunQueuedDxfImport(payloadId, error));
-    if (!content) {
-        std::cout << "[dxf-importer] " << error << "\n";
-        MessageBoxA(FirstWindowHandleForEngineeringDialogs(), error.c_str(), "DXF import failed",
-            MB_OK | MB_ICONERROR | MB_SETFOREGROUND);
-        return;
-    }
-
-#ifdef _DEBUG
-    std::cout << "[dxf-import][dbg] received total="
-              << (content->lines.size() + content->texts.size() + content->polygons.size() +
-                  content->assetDefinitions.size() + content->assetInserts.size())
-              << " (lines=" << content->lines.size() << ", texts=" << content->texts.size()
-              << ", polygons=" << content->polygons.size()
-              << ", assetDefs=" << content->assetDefinitions.size()
-              << ", assetInserts=" << content->assetInserts.size()
-              << ") -> container " << pageMemoryId << std::endl;
-#endif
-
-    for (const auto& line : content->lines) {
-        Cad2DLineRecordCPU record{};
-        record.containerMemoryId = pageMemoryId;
-        record.x1 = line.x1;
-        record.y1 = line.y1;
-        record.x2 = line.x2;
-        record.y2 = line.y2;
-        record.lineWeight = 1.0f;
-        record.lineWeightMode = Cad2DLineWeightMode::ScreenPixel;
-        record.colorABGR = 0xFF000000u;
-        record.schemaVersion = VishwakarmaStorage::kGeometry2DLineSchemaVersion;
-        EnqueueCad2DLine(myTab->tabID, pageMemoryId, record);
-    }
-
-    for (const auto& text : content->texts) {
-        Cad2DTextRecordCPU record{};
-        record.containerMemoryId = pageMemoryId;
-        record.x = text.x;
-        record.y = text.y;
-        record.textHeightCU = text.heightCU;
-        record.rotationRadians = text.rotationRadians;
-        record.colorABGR = 0xFF000000u;
-        record.font = 0; // Imported text always renders with the embedded MSDF font.
-        record.justification = static_cast<Cad2DTextJustification>(text.justification);
-        record.text = text.textUtf8;
-        record.schemaVersion = VishwakarmaStorage::kGeometry2DTextSchemaVersion;
-        EnqueueCad2DText(myTab->tabID, pageMemoryId, std::move(record));
-    }
-
-    for (const auto& polygon : content->polygons) {
-        Cad2DPolygonRecordCPU record{};
-        record.containerMemoryId = pageMemoryId;
-        record.lineSegmentCount = polygon.segmentCount;
-        record.centerX = polygon.centerX;
-        record.centerY = polygon.centerY;
-        record.radius = polygon.radius;
-        record.rotationDegrees = polygon.rotationDegrees;
-        record.lineWeight = 1.0f;
-        record.lineWeightMode = Cad2DLineWeightMode::ScreenPixel;
-        record.colorABGR = 0xFF000000u;
-        record.schemaVersion = VishwakarmaStorage::kGeometry2DPolygonSchemaVersion;
-        EnqueueCad2DPolygon(myTab->tabID, pageMemoryId, record);
-    }
-
     // DXF blocks -> Asset2D. Each definition's master geometry (block frame) is stored hidden;
-    // each insert stamps an instance onto the page with its scale / rotation baked into the
-    // members: Cad2DInstantiateAsset maps member = insert + R(rot) * S(scale) * (master - base).
+    // each insert is a reference drawn through member = insert + R(rot) * S(scale) * (master - base).
+    // Definitions always arrive before their inserts, so the key map is complete when they do.
     std::unordered_map<uint32_t, uint64_t> definitionByKey;
-    definitionByKey.reserve(content->assetDefinitions.size());
-    for (const auto& definition : content->assetDefinitions) {
-        std::vector<Cad2DLineRecordCPU> masterLines;
-        std::vector<Cad2DTextRecordCPU> masterTexts;
-        std::vector<Cad2DPolygonRecordCPU> masterPolygons;
-        masterLines.reserve(definition.lines.size());
-        masterTexts.reserve(definition.texts.size());
-        masterPolygons.reserve(definition.polygons.size());
-        for (const auto& line : definition.lines) {
+    size_t createdLines = 0, createdTexts = 0, createdPolygons = 0, placedInserts = 0;
+    ULONGLONG lastInstancesTick = 0;
+    bool instancesPending = false;
+
+    auto importBatch = [&](ExtensionCommunications::ImportedPage2DContent& content) {
+        for (const auto& line : content.lines) {
             Cad2DLineRecordCPU record{};
-            record.x1 = line.x1; record.y1 = line.y1; record.x2 = line.x2; record.y2 = line.y2;
+            record.containerMemoryId = pageMemoryId;
+            record.x1 = line.x1;
+            record.y1 = line.y1;
+            record.x2 = line.x2;
+            record.y2 = line.y2;
             record.lineWeight = 1.0f;
             record.lineWeightMode = Cad2DLineWeightMode::ScreenPixel;
             record.colorABGR = 0xFF000000u;
             record.schemaVersion = VishwakarmaStorage::kGeometry2DLineSchemaVersion;
-            masterLines.push_back(record);
+            EnqueueCad2DLine(myTab->tabID, pageMemoryId, record);
         }
-        for (const auto& text : definition.texts) {
+        createdLines += content.lines.size();
+
+        for (auto& text : content.texts) {
             Cad2DTextRecordCPU record{};
-            record.x = text.x; record.y = text.y;
+            record.containerMemoryId = pageMemoryId;
+            record.x = text.x;
+            record.y = text.y;
             record.textHeightCU = text.heightCU;
             record.rotationRadians = text.rotationRadians;
             record.colorABGR = 0xFF000000u;
-            record.font = 0;
+            record.font = 0; // Imported text always renders with the embedded MSDF font.
             record.justification = static_cast<Cad2DTextJustification>(text.justification);
-            record.text = text.textUtf8;
+            record.text = std::move(text.textUtf8);
             record.schemaVersion = VishwakarmaStorage::kGeometry2DTextSchemaVersion;
-            masterTexts.push_back(std::move(record));
+            EnqueueCad2DText(myTab->tabID, pageMemoryId, std::move(record));
         }
-        for (const auto& polygon : definition.polygons) {
+        createdTexts += content.texts.size();
+
+        for (const auto& polygon : content.polygons) {
             Cad2DPolygonRecordCPU record{};
+            record.containerMemoryId = pageMemoryId;
             record.lineSegmentCount = polygon.segmentCount;
-            record.centerX = polygon.centerX; record.centerY = polygon.centerY;
+            record.centerX = polygon.centerX;
+            record.centerY = polygon.centerY;
             record.radius = polygon.radius;
             record.rotationDegrees = polygon.rotationDegrees;
             record.lineWeight = 1.0f;
             record.lineWeightMode = Cad2DLineWeightMode::ScreenPixel;
             record.colorABGR = 0xFF000000u;
             record.schemaVersion = VishwakarmaStorage::kGeometry2DPolygonSchemaVersion;
-            masterPolygons.push_back(record);
+            EnqueueCad2DPolygon(myTab->tabID, pageMemoryId, record);
         }
-        const uint64_t definitionId = Cad2DCreateAssetDefinition(*myTab, definition.baseX,
-            definition.baseY, masterLines, masterTexts, masterPolygons);
-        if (definitionId != 0) definitionByKey[definition.key] = definitionId;
-    }
-
-    size_t placedInserts = 0;
-    for (const auto& insert : content->assetInserts) {
-        auto it = definitionByKey.find(insert.key);
-        if (it == definitionByKey.end()) continue;
-        if (Cad2DInstantiateAsset(*myTab, pageMemoryId, it->second, insert.x, insert.y,
-                insert.scaleX, insert.scaleY, insert.rotationDegrees)) {
-            ++placedInserts;
+        createdPolygons += content.polygons.size();
+
+        for (auto& definition : content.assetDefinitions) {
+            std::vector<Cad2DLineRecordCPU> masterLines;
+            std::vector<Cad2DTextRecordCPU> masterTexts;
+            std::vector<Cad2DPolygonRecordCPU> masterPolygons;
+            masterLines.reserve(definition.lines.size());
+            masterTexts.reserve(definition.texts.size());
+            masterPolygons.reserve(definition.polygons.size());
+            for (const auto& line : definition.lines) {
+                Cad2DLineRecordCPU record{};
+                record.x1 = line.x1; record.y1 = line.y1; record.x2 = line.x2; record.y2 = line.y2;
+                record.lineWeight = 1.0f;
+                record.lineWeightMode = Cad2DLineWeightMode::ScreenPixel;
+                record.colorABGR = 0xFF000000u;
+                record.schemaVersion = VishwakarmaStorage::kGeometry2DLineSchemaVersion;
+                masterLines.push_back(record);
+            }
+            for (auto& text : definition.texts) {
+                Cad2DTextRecordCPU record{};
+                record.x = text.x; record.y = text.y;
+                record.textHeightCU = text.heightCU;
+                record.rotationRadians = text.rotationRadians;
+                record.colorABGR = 0xFF000000u;
+                record.font = 0;
+                record.justification = static_cast<Cad2DTextJustification>(text.justification);
+                record.text = std::move(text.textUtf8);
+                record.schemaVersion = VishwakarmaStorage::kGeometry2DTextSchemaVersion;
+                masterTexts.push_back(std::move(record));
+            }
+            for (const auto& polygon : definition.polygons) {
+                Cad2DPolygonRecordCPU record{};
+                record.lineSegmentCount = polygon.segmentCount;
+                record.centerX = polygon.centerX; record.centerY = polygon.centerY;
+                record.radius = polygon.radius;
+                record.rotationDegrees = polygon.rotationDegrees;
+                record.lineWeight = 1.0f;
+                record.lineWeightMode = Cad2DLineWeightMode::ScreenPixel;
+                record.colorABGR = 0xFF000000u;
+                record.schemaVersion = VishwakarmaStorage::kGeometry2DPolygonSchemaVersion;
+                masterPolygons.push_back(record);
+            }
+            const uint64_t definitionId = Cad2DCreateAssetDefinition(*myTab, definition.baseX,
+                definition.baseY, masterLines, masterTexts, masterPolygons);
+            if (definitionId != 0) definitionByKey[definition.key] = definitionId;
         }
-    }
 
-    std::cout << "[dxf-importer] Created " << content->lines.size() << " lines, "
-              << content->texts.size() << " texts, " << content->polygons.size()
+        for (const auto& insert : content.assetInserts) {
+            auto it = definitionByKey.find(insert.key);
+            if (it == definitionByKey.end()) continue;
+            if (Cad2DInstantiateAsset(*myTab, pageMemoryId, it->second, insert.x, insert.y,
+                    insert.scaleX, insert.scaleY, insert.rotationDegrees, false)) {
+                ++placedInserts;
+                instancesPending = true;
+            }
+        }
+        // The instance rebuild re-expands every insert of the page, so request it once per publish
+        // interval rather than once per insert batch.
+        const ULONGLONG now = GetTickCount64();
+        if (instancesPending && (lastInstancesTick == 0 || now - lastInstancesTick >= kImportPublishIntervalMs)) {
+            EnqueueCad2DAssetInstancesChanged(myTab->tabID, pageMemoryId);
+            instancesPending = false;
+            lastInstancesTick = now;
+        }
+    };
+
+    std::string error;
+    const bool succeeded = ExtensionCommunications::RunQueuedDxfImport(payloadId, importBatch, error);
+    if (instancesPending) EnqueueCad2DAssetInstancesChanged(myTab->tabID, pageMemoryId);
+
+    std::cout << "[dxf-importer] Created " << createdLines << " lines, "
+              << createdTexts << " texts, " << createdPolygons
               << " polygons, " << definitionByKey.size() << " asset definitions and "
               << placedInserts << " inserts in the open Page2D." << std::endl; // Flush: rare event, aids diagnosis.
 
@@ -1703,6 +1883,18 @@ static void ImportDxfFileIntoTab(DATASETTAB* myTab, uint64_t payloadId) {
     // once the whole import has actually been ingested into the CPU records.
     EnqueueCad2DIngestStatsReport(myTab->tabID, pageMemoryId);
 #endif
+
+    if (!succeeded) {
+        std::cout << "[dxf-importer] " << error << "\n";
+        const size_t created = createdLines + createdTexts + createdPolygons + placedInserts;
+        if (created != 0) {
+            MarkPartialImport(myTab, "INCOMPLETE DXF import");
+            error += "\n\nThe " + std::to_string(created) + " elements that arrived before the failure were kept;"
+                     " the folder \"INCOMPLETE DXF import\" marks this drawing as partial.";
+        }
+        MessageBoxA(FirstWindowHandleForEngineeringDialogs(), error.c_str(), "DXF import failed",
+            MB_OK | MB_ICONERROR | MB_SETFOREGROUND);
+    }
 }
 
 static void BeginPrimitive3DPlacement(DATASETTAB* targetTab, VishwakarmaStorage::ObjectType objectType) {
@@ -2502,6 +2694,10 @@ void विश्वकर्मा(uint64_t tabID) { //Main logic/engineering t
             } else if (nextWorkTODO.actionType == ACTION_TYPE::MODIFY_OBJECT_PROPERTY) {
                 ModifyObjectProperty(myTab, nextWorkTODO.objectId, static_cast<uint8_t>(nextWorkTODO.x),
                     std::bit_cast<double>(nextWorkTODO.auxValue));
+            } else if (nextWorkTODO.actionType == ACTION_TYPE::MODIFY_SELECTED_PROPERTY) {
+                ModifySelectedObjectsProperty(myTab,
+                    static_cast<VishwakarmaStorage::ObjectType>(nextWorkTODO.objectId),
+                    static_cast<uint8_t>(nextWorkTODO.x), std::bit_cast<double>(nextWorkTODO.auxValue));
             } else if (nextWorkTODO.actionType == ACTION_TYPE::ZOOM_MAX_EXTENTS ||
                        nextWorkTODO.actionType == ACTION_TYPE::ZOOM_FOCUS_SELECTED) {
                 const bool selectedOnly = nextWorkTODO.actionType == ACTION_TYPE::ZOOM_FOCUS_SELECTED;
@@ -2535,6 +2731,7 @@ void विश्वकर्मा(uint64_t tabID) { //Main logic/engineering t
         std::lock_guard<std::mutex> lock(*myTab->storageObjectsMutex);
         myTab->storageLogicalObjects.clear();
         myTab->storageObjects3D.clear();
+        myTab->objectIndex.Clear();
         myTab->expandedDataTreeNodeIds.clear();
         CloseAllInternalSubTabsLocked(*myTab);
         myTab->defaultScene3DMemoryId = 0;
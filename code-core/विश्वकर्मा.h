@@ -11,6 +11,7 @@
 #include "UserInputProcessing.h"
 #include "CommonNamedNumbers.h"
 #include "DataTreeView.h"
+#include "TabObjectIndex.h"
 
 #pragma once //It prevents multiple inclusions of the same header file.
 
@@ -70,6 +71,13 @@ struct StoredGeometryObject3D {
     VishwakarmaStorage::ObjectType objectType = VishwakarmaStorage::ObjectType::Unknown;
     uint64_t memoryId = 0;
     META_DATA* object = nullptr;
+    // Zoom-to-extents cache, engineering thread only: AUTHORED-space box (center, half extents)
+    // and bounding sphere (same center) of the object's mesh as of object->dataVersion ==
+    // boundsVersion. 0 = never computed (dataVersion starts at 1); boundsRadius < 0 = empty mesh.
+    uint64_t boundsVersion = 0;
+    DirectX::XMFLOAT3 boundsCenter = { 0.0f, 0.0f, 0.0f };
+    DirectX::XMFLOAT3 boundsExtents = { 0.0f, 0.0f, 0.0f };
+    float boundsRadius = -1.0f;
 };
 
 struct StoredLogicalObject {
@@ -162,6 +170,7 @@ struct DATASETTAB {
     std::vector<uint64_t> allIDsInThisTab; //List of all engineering object IDs in this tab.
     std::vector<StoredLogicalObject> storageLogicalObjects; // Persisted organization objects in this tab.
     std::vector<StoredGeometryObject3D> storageObjects3D; // MVP persisted geometry objects in this tab.
+    TabObjectIndex objectIndex; // memoryId -> slot in the two vectors above; cleared with them.
     std::vector<uint64_t> expandedDataTreeNodeIds; // Expanded logical nodes in the visible data tree.
 
     // Fixed-slot registry of open sub-tabs (views), mirroring the allTabs/activeTabIndexes pattern.
@@ -259,6 +268,20 @@ struct DATASETTAB {
     DATASETTAB& operator=(DATASETTAB&&) noexcept = default;
 };
 
+// O(1) lookups through DATASETTAB::objectIndex; nullptr when memoryId is not in that store. Hold
+// storageObjectsMutex unless calling from the tab's own engineering thread (the only writer).
+inline StoredGeometryObject3D* FindStoredObject3D(DATASETTAB& tab, uint64_t memoryId) {
+    const TabObjectSlot found = tab.objectIndex.Find(memoryId);
+    if (found.store != TabObjectStore::Geometry3D || found.slot >= tab.storageObjects3D.size()) return nullptr;
+    return &tab.storageObjects3D[found.slot];
+}
+
+inline StoredLogicalObject* FindStoredLogicalObject(DATASETTAB& tab, uint64_t memoryId) {
+    const TabObjectSlot found = tab.objectIndex.Find(memoryId);
+    if (found.store != TabObjectStore::Logical || found.slot >= tab.storageLogicalObjects.size()) return nullptr;
+    return &tab.storageLogicalObjects[found.slot];
+}
+
 // Tab 0 id default application launch screen tab. It can't be closed.
 // Tab 0 is also used to do all the experiments and benchmark during development.
 inline uint32_t activeTab = 0; 
@@ -315,6 +338,7 @@ struct SingleUIWindow {
     bool assetInsertPaneOpen = false;
     UIDropdownState assetInsertDropdown;
     UITextEditState textEditState;                    // In-progress property-field edit (render thread owned).
+    UIRetainedRibbon retainedRibbon;                  // Cached ribbon geometry (render thread owned).
     std::atomic<uint64_t> uiKeyboardCaptureCount{ 0 }; // != 0 while a UI text field has focus (WndProc suppresses shortcuts).
     std::atomic<uint32_t> rightOverlayWidthPx{ 0 };    // Icon bar (+ pane) width in px; input guards read it.
 
@@ -1,6 +1,5 @@
 import json
 import sys
-from PIL import Image
 
 def get_float(obj, key, default=0.0):
     return float(obj.get(key, default))
@@ -12,6 +11,8 @@ def cpp_float(value):
     return f"{text}f"
 
 def generate_header(png_path, json_path, out_path):
+    from PIL import Image  # Only needed to decode the PNG; write_header takes decoded pixels.
+
     # 1. Read Image and convert to RGBA
     img = Image.open(png_path).convert('RGBA')
     width, height = img.size
@@ -20,12 +21,15 @@ def generate_header(png_path, json_path, out_path):
     # 2. Read JSON
     with open(json_path, 'r', encoding='utf-8') as f:
         data = json.load(f)
-        
+
+    write_header(out_path, width, height, pixels, data)
+
+def write_header(out_path, width, height, pixels, data):
+    """pixels: width * height RGBA tuples, row by row; data: msdf-atlas-gen's JSON, loaded."""
     with open(out_path, 'w', encoding='utf-8') as f:
         f.write("// AUTO-GENERATED MSDF FONT HEADER\n")
         f.write("#pragma once\n")
-        f.write("#include <cstdint>\n")
-        f.write("#include <unordered_map>\n\n")
+        f.write("#include <cstdint>\n\n")
         
         f.write(f"inline constexpr int NotoSansMSDF_Width = {width};\n")
         f.write(f"inline constexpr int NotoSansMSDF_Height = {height};\n\n")
@@ -54,14 +58,19 @@ def generate_header(png_path, json_path, out_path):
         f.write("    float planeLeft, planeBottom, planeRight, planeTop;\n")
         f.write("    float atlasLeft, atlasBottom, atlasRight, atlasTop;\n")
         f.write("};\n\n")
+        f.write("struct MSDFGlyphEntry {\n")
+        f.write("    char32_t codepoint;\n")
+        f.write("    MSDFGlyph glyph;\n")
+        f.write("};\n\n")
         
-        f.write("inline std::unordered_map<char32_t, MSDFGlyph> NotoSansMSDF_Glyphs = {\n")
+        # A constexpr array, not a std::unordered_map: it lives in read-only data and costs nothing
+        # until BuildMSDFFontAtlas walks it, where a map would be rebuilt by a static initializer on
+        # every launch. Sorted by codepoint so the output is stable across msdf-atlas-gen versions.
+        f.write("inline constexpr MSDFGlyphEntry NotoSansMSDF_Glyphs[] = {\n")
         
-        for g in data.get('glyphs', []):
-            # SAFEGUARD: Skip internal glyph-index-only entries that have no Unicode mapping
-            if 'unicode' not in g:
-                continue
-                
+        # SAFEGUARD: Skip internal glyph-index-only entries that have no Unicode mapping
+        glyphs = sorted((g for g in data.get('glyphs', []) if 'unicode' in g), key=lambda g: int(g['unicode']))
+        for g in glyphs:
             uni = int(g['unicode'])
             adv = g.get('advance', 0.0)
             
@@ -71,7 +80,7 @@ def generate_header(png_path, json_path, out_path):
             
             values = [adv, pb['left'], pb['bottom'], pb['right'], pb['top'],
                       ab['left'], ab['bottom'], ab['right'], ab['top']]
-            f.write(f"    {{ {uni}, {{ {', '.join(cpp_float(v) for v in values)} }} }},\n")
+            f.write(f"    {{ {uni}u, {{ {', '.join(cpp_float(v) for v in values)} }} }},\n")
         
         f.write("};\n")
 
@@ -160,6 +160,79 @@ def parse_csv(path: Path, family_suffix: str) -> list[dict]:
     return rows
 
 
+# Designation perfect hash (CHD: hash, displace, compress). One hash pass per key picks its
+# bucket; each bucket gets the smallest seed whose mix of that hash lands all its keys on free
+# slots, and the slot table has exactly one slot per distinct key. Keys are the designations plus
+# the alt_designation aliases. designation_hash() and designation_slot_hash() must stay identical
+# to their twins in code-core/SteelProfileCatalog.h.
+DESIGNATION_KEYS_PER_BUCKET = 4
+DESIGNATION_MAX_SEED = 0xFFFF  # Seeds are emitted as uint16_t.
+
+
+def designation_hash(data: bytes) -> int:
+    value = 0x811C9DC5 ^ len(data)
+    whole = len(data) & ~3
+    for i in range(0, whole, 4):  # Four bytes per multiply, little-endian.
+        value = ((value ^ int.from_bytes(data[i:i + 4], "little")) * 0x9E3779B1) & 0xFFFFFFFF
+        value ^= value >> 15
+    for byte in data[whole:]:
+        value = ((value ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+def designation_slot_hash(value: int, seed: int) -> int:
+    value = (value ^ (seed * 0x9E3779B1)) & 0xFFFFFFFF  # Then the murmur3 finalizer.
+    value ^= value >> 16
+    value = (value * 0x85EBCA6B) & 0xFFFFFFFF
+    value ^= value >> 13
+    value = (value * 0xC2B2AE35) & 0xFFFFFFFF
+    return value ^ (value >> 16)
+
+
+def build_designation_hash(rows: list[dict]) -> tuple[list[int], list[int]]:
+    """(seed per bucket, row index per slot) over the distinct designations and aliases. A
+    designation shared by several rows (JIS/KS mirrors) maps to its first row in id order; an
+    alias maps to the first row carrying it, unless it is some row's own designation, which wins."""
+    first_row: dict[bytes, int] = {}
+    for index, row in enumerate(rows):
+        first_row.setdefault(row["designation"].encode("utf-8"), index)
+    for index, row in enumerate(rows):
+        if row["altDesignation"]:
+            first_row.setdefault(row["altDesignation"].encode("utf-8"), index)
+    keys = list(first_row)
+    hashes = {key: designation_hash(key) for key in keys}
+    bucket_count = max(1, -(-len(keys) // DESIGNATION_KEYS_PER_BUCKET))
+    buckets: list[list[bytes]] = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[hashes[key] % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [-1] * len(keys)
+    for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+        for seed in range(1, DESIGNATION_MAX_SEED + 1):
+            placed = [designation_slot_hash(hashes[key], seed) % len(slots) for key in buckets[bucket]]
+            if len(set(placed)) == len(placed) and all(slots[slot] < 0 for slot in placed):
+                break
+        else:
+            raise RuntimeError("No perfect hash seed found for the designation table")
+        seeds[bucket] = seed
+        for key, slot in zip(buckets[bucket], placed):
+            slots[slot] = first_row[key]
+
+    for key, index in first_row.items():  # Same probe as FindSteelProfileIndexByDesignation.
+        seed = seeds[hashes[key] % bucket_count]
+        if slots[designation_slot_hash(hashes[key], seed) % len(slots)] != index:
+            raise RuntimeError(f"Designation hash does not round-trip {key!r}")
+    return seeds, slots
+
+
+def cpp_integer_array(values: list[int], per_line: int = 16) -> list[str]:
+    return ["    " + ", ".join(str(v) for v in values[i:i + per_line]) + ","
+            for i in range(0, len(values), per_line)]
+
+
 def cpp_string(text: str) -> str:
     return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
 
@@ -205,6 +278,17 @@ def generate_header(rows: list[dict]) -> str:
         "sizeof(kSteelProfiles) / sizeof(kSteelProfiles[0]);",
         "",
     ]
+    seeds, slots = build_designation_hash(rows)
+    lines += [
+        "// Designation and alias perfect hash; probed by FindSteelProfileIndexByDesignation.",
+        "inline constexpr uint16_t kSteelProfileDesignationSeeds[] = {",
+        *cpp_integer_array(seeds),
+        "};",
+        "inline constexpr uint16_t kSteelProfileDesignationSlots[] = {",
+        *cpp_integer_array(slots),
+        "};",
+        "",
+    ]
     return "\n".join(lines)
 
 
@@ -226,6 +310,8 @@ def main() -> int:
             rows.extend(parse_csv(csv_path, suffix))
 
         rows.sort(key=lambda row: row["id"])  # FindSteelProfileById binary-searches on id.
+        if len(rows) >= 0xFFFF:
+            raise RuntimeError(f"{len(rows)} rows do not fit SteelProfileIndex (uint16_t)")
         for previous, current in zip(rows, rows[1:]):
             if previous["id"] == current["id"]:
                 raise RuntimeError(
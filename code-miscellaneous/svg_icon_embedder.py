@@ -38,9 +38,23 @@ def byte_array_literal(data: bytes) -> str:
     return ",\n".join(lines)
 
 
+FNV64_OFFSET = 0xCBF29CE484222325
+FNV64_PRIME = 0x100000001B3
+
+
+def fnv1a64(data: bytes, seed: int) -> int:
+    """Same hash as AssetCache::Hash in code-core/AssetCache.h."""
+    for byte in data:
+        seed = ((seed ^ byte) * FNV64_PRIME) & 0xFFFFFFFFFFFFFFFF
+    return seed
+
+
 def generate_header(entries: list[tuple[int, str]], svg_dir: Path) -> str:
     arrays: list[str] = []
     table_entries: list[str] = []
+    # Keys the on-disk icon raster cache: any change to an id, a file name or an SVG's bytes
+    # names a new cache file.
+    manifest_hash = FNV64_OFFSET
 
     for icon_id, filename in entries:
         svg_path = svg_dir / filename
@@ -49,6 +63,9 @@ def generate_header(entries: list[tuple[int, str]], svg_dir: Path) -> str:
 
         source = svg_path.read_bytes()
         compressed = zlib.compress(source, level=9)
+        manifest_hash = fnv1a64(icon_id.to_bytes(4, "little"), manifest_hash)
+        manifest_hash = fnv1a64(filename.encode("utf-8") + b"\0", manifest_hash)
+        manifest_hash = fnv1a64(source, manifest_hash)
         symbol = f"kSVGIconData_{icon_id}"
 
         arrays.append(
@@ -81,6 +98,7 @@ def generate_header(entries: list[tuple[int, str]], svg_dir: Path) -> str:
         + "\n};\n\n"
         "inline constexpr std::size_t kSVGIconCount = "
         "sizeof(kSVGIcons) / sizeof(kSVGIcons[0]);\n\n"
+        f"inline constexpr uint64_t kSVGIconManifestHash = 0x{manifest_hash:016X}ull;\n\n"
         "} // namespace SVGIconRenderer::Embedded\n"
     )
 
@@ -18,19 +18,22 @@ discarded by design:
 Symbol tables read: LAYER, LTYPE (line types), STYLE (text styles) and
 DIMSTYLE (dimension styles). All HEADER variables are kept in a dict.
 
-Command line usage prints simple statistics:
-    python InteroperabilityWithDXFFile.py <drawing.dxf>
+Command line usage prints simple statistics (-j parses a large ENTITIES
+section with that many processes):
+    python InteroperabilityWithDXFFile.py [-j processes] <drawing.dxf>
 
 Future use: entities read here will be imported into Page2D logical
 container elements.
 
 Security posture (input files are untrusted):
-  - Hard caps on file size and tag count bound memory before any allocation.
-  - The parser is fully iterative (no recursion) and every loop advances a
-    monotonically increasing index, so no crafted input can hang it.
+  - Hard caps on file size and tag count bound the work. Tags are decoded
+    and split in fixed-size blocks and consumed as they are produced, so no
+    whole-file text or tag list is ever held.
+  - The parser is fully iterative (no recursion) and every loop consumes the
+    tag stream or returns, so no crafted input can hang it.
   - Numeric values are range-checked: non-finite floats (inf/nan) and
     out-of-int32 integers fall back to safe defaults.
-  - C0/C1 control characters are stripped from the whole file up front, so
+  - C0/C1 control characters are stripped from every decoded block, so
     terminal escape sequences cannot survive into names, text or CLI output.
   - Lines are split on '\n' only (never splitlines()), so exotic Unicode
     line separators cannot desynchronise the code/value tag pairing.
@@ -43,12 +46,14 @@ character stripping; consumers must treat them as untrusted data.
 
 from __future__ import annotations
 
+import codecs
 import math
+import os
 import re
 import sys
 from collections import Counter
 from dataclasses import dataclass, field
-from typing import Dict, List, Optional, Tuple
+from typing import Callable, Dict, Iterator, List, Optional, Sequence, Tuple
 
 # Resource caps for untrusted input. Exceeding either raises DxfError.
 MAX_FILE_BYTES = 512 * 1024 * 1024
@@ -323,55 +328,142 @@ class DxfDocument:
 # ---------------------------------------------------------------------------
 
 Tag = Tuple[int, str]
+Span = Tuple[int, int]  # [start, end) byte range of the input
+
+# Bytes decoded per step. Only one block of text (plus the partial line that
+# straddles it) is alive at a time, so reader memory no longer scales with
+# the file: what stays resident is the parsed document, not its tags.
+_READ_BLOCK_BYTES = 1 << 20
+
+
+def _decoded_chunks(data: bytes, spans: Sequence[Span]) -> Iterator[str]:
+    """Decode the `spans` of `data` block by block, as one continuous text.
+    UTF-8 (with optional BOM) is tried first;
+    at the first invalid sequence decoding falls back to cp1252 from the bytes
+    the UTF-8 decoder has not yet turned into text. Earlier blocks were valid
+    UTF-8, which in practice means plain ASCII for a legacy code-page file."""
+    decoder = codecs.getincrementaldecoder('utf-8-sig')()
+    legacy = False
+    for index, (span_start, span_end) in enumerate(spans):
+        last_span = index == len(spans) - 1
+        for start in range(span_start, span_end, _READ_BLOCK_BYTES):
+            # `data` may be a memoryview over the host's file mapping: slice, then copy one block.
+            block = bytes(data[start:min(start + _READ_BLOCK_BYTES, span_end)])
+            final = last_span and start + len(block) >= span_end
+            if not legacy:
+                try:
+                    yield decoder.decode(block, final)
+                    continue
+                except UnicodeDecodeError:
+                    block = decoder.getstate()[0] + block  # a failed decode leaves its buffer intact
+                    decoder = codecs.getincrementaldecoder('cp1252')('replace')
+                    legacy = True
+            yield decoder.decode(block, final)
+
+
+def _is_utf8(data: bytes, start: int, end: int) -> bool:
+    decoder = codecs.getincrementaldecoder('utf-8')()
+    try:
+        for block_start in range(start, end, _READ_BLOCK_BYTES):
+            block_end = min(block_start + _READ_BLOCK_BYTES, end)
+            decoder.decode(bytes(data[block_start:block_end]), block_end >= end)
+    except UnicodeDecodeError:
+        return False
+    return True
 
 
-def _load_tags(data: bytes) -> List[Tag]:
+def _iter_lines(data: bytes, spans: Sequence[Span]) -> Iterator[str]:
+    tail = ''
+    for chunk in _decoded_chunks(data, spans):
+        # Strip C0 controls / DEL so escape sequences cannot reach names, text
+        # values or the terminal. Scan first: clean chunks skip the rewrite.
+        if _CTRL_CHARS_RE.search(chunk):
+            chunk = chunk.translate(_CTRL_STRIP_TABLE)
+        # Split on '\n' only: splitlines() also splits on \x1c-\x1e, \x85,
+        #  etc., which AutoCAD does not, and that mismatch would let a
+        # crafted file desynchronise the code/value pairing.
+        lines = (tail + chunk).split('\n')
+        tail = lines.pop()  # may continue in the next chunk
+        for line in lines:
+            yield line[:-1] if line.endswith('\r') else line
+    yield tail  # no '\n' follows it, so a trailing '\r' stays
+
+
+def _iter_tags(data: bytes, spans: Optional[Sequence[Span]] = None) -> Iterator[Tag]:
+    """Validate the file type up front, then return a lazy (code, value) stream
+    over `spans` (default: the whole file). Malformed content raises DxfError
+    when the stream reaches it."""
     if len(data) > MAX_FILE_BYTES:
         raise DxfError(f'File exceeds the {MAX_FILE_BYTES} byte limit.')
-    if data[:32].lstrip()[:18] == b'AutoCAD Binary DXF':
+    if bytes(data[:32]).lstrip()[:18] == b'AutoCAD Binary DXF':
         raise DxfError('Binary DXF files are not supported; save as ASCII DXF.')
-    try:
-        text = data.decode('utf-8-sig')
-    except UnicodeDecodeError:
-        text = data.decode('cp1252', errors='replace')
-    # Strip C0 controls / DEL so escape sequences cannot reach names, text
-    # values or the terminal. Scan first: clean files skip the rewrite.
-    if _CTRL_CHARS_RE.search(text):
-        text = text.translate(_CTRL_STRIP_TABLE)
-    # Split on '\n' only: splitlines() also splits on \x1c-\x1e, \x85,
-    #  etc., which AutoCAD does not, and that mismatch would let a
-    # crafted file desynchronise the code/value pairing.
-    lines = text.replace('\r\n', '\n').split('\n')
-    del text
-    if len(lines) // 2 > MAX_TAGS:
-        raise DxfError(f'File exceeds the {MAX_TAGS} tag limit.')
-    tags: List[Tag] = []
-    for i in range(0, len(lines) - 1, 2):
-        code_line = lines[i].strip()
+    return _generate_tags(_iter_lines(data, spans or ((0, len(data)),)))
+
+
+def _generate_tags(lines: Iterator[str], first_line: int = 0,
+                   at_eof: bool = True) -> Iterator[Tag]:
+    """Pair `lines` into tags. `first_line` numbers the first line for error
+    messages; `at_eof` is False for a slice of the file that more tags follow,
+    where a blank group code can never be trailing padding."""
+    count = 0
+    line_no = first_line - 1  # becomes the 1-based number of the current code line
+    for code_line in lines:
+        value = next(lines, None)
+        if value is None:  # dangling code line at end of file
+            break
+        line_no += 2
+        code_line = code_line.strip()
         if not code_line:
             # Tolerate blank line(s) at end of file only.
-            if any(lines[k].strip() for k in range(i + 1, len(lines))):
-                raise DxfError(f'Blank group code at line {i + 1}')
+            if value.strip() or not at_eof or any(line.strip() for line in lines):
+                raise DxfError(f'Blank group code at line {line_no}')
             break
         if not code_line.isascii():
-            raise DxfError(f'Non-ASCII group code {code_line[:32]!r} at line {i + 1}')
+            raise DxfError(f'Non-ASCII group code {code_line[:32]!r} at line {line_no}')
         try:
             code = int(code_line)
         except ValueError:
-            raise DxfError(f'Malformed group code {code_line[:32]!r} at line {i + 1}')
+            raise DxfError(f'Malformed group code {code_line[:32]!r} at line {line_no}')
         if not 0 <= code <= _MAX_GROUP_CODE:
-            raise DxfError(f'Group code {code} out of range at line {i + 1}')
-        tags.append((code, lines[i + 1]))
-    if not tags:
+            raise DxfError(f'Group code {code} out of range at line {line_no}')
+        count += 1
+        if count > MAX_TAGS:
+            raise DxfError(f'File exceeds the {MAX_TAGS} tag limit.')
+        yield code, value
+    if not count:
         raise DxfError('Empty or non-DXF file.')
-    return tags
 
 
-def _skip_to_next_zero(tags: List[Tag], i: int) -> int:
-    n = len(tags)
-    while i < n and tags[i][0] != 0:
-        i += 1
-    return i
+class _TagStream:
+    """One-tag lookahead over the lazy tag stream. The section parsers peek at
+    the next tag to decide who owns it and only then consume it, exactly like
+    the index arithmetic they replace, but without the whole-file tag list."""
+
+    __slots__ = ('_tags', '_next')
+
+    def __init__(self, tags: Iterator[Tag]):
+        self._tags = tags
+        self._next: Optional[Tag] = next(tags, None)
+
+    def peek(self) -> Optional[Tag]:
+        return self._next
+
+    def advance(self) -> Optional[Tag]:
+        """Consume and return the current tag (None at end of file)."""
+        tag = self._next
+        if tag is not None:
+            self._next = next(self._tags, None)
+        return tag
+
+    def take_record(self) -> List[Tag]:
+        """Consume the tags up to (not including) the next 0-code tag."""
+        rec: List[Tag] = []
+        tag = self._next
+        while tag is not None and tag[0] != 0:
+            rec.append(tag)
+            tag = next(self._tags, None)
+        self._next = tag
+        return rec
 
 
 # ---------------------------------------------------------------------------
@@ -394,8 +486,7 @@ def _header_value(values: List[Tag]) -> object:
     return [convert(c, v) for c, v in values]
 
 
-def _parse_header(tags: List[Tag], i: int, doc: DxfDocument) -> int:
-    n = len(tags)
+def _parse_header(stream: _TagStream, doc: DxfDocument) -> None:
     name = ''
     values: List[Tag] = []
 
@@ -403,25 +494,26 @@ def _parse_header(tags: List[Tag], i: int, doc: DxfDocument) -> int:
         if name:
             doc.header[name] = _header_value(values) if values else ''
 
-    while i < n:
-        code, value = tags[i]
+    while True:
+        tag = stream.peek()
+        if tag is None:
+            break
+        code, value = tag
         if code == 0:
             stripped = value.strip()
             if stripped == 'ENDSEC':
-                flush()
-                return i + 1
+                stream.advance()
+                break
             if stripped == 'SECTION':  # unterminated section: hand back
-                flush()
-                return i
+                break
         if code == 9:
             flush()
             name = value.strip()
             values = []
         else:
-            values.append((code, value))
-        i += 1
+            values.append(tag)
+        stream.advance()
     flush()
-    return i
 
 
 # ---------------------------------------------------------------------------
@@ -505,22 +597,20 @@ _TABLE_PARSERS = {
 }
 
 
-def _parse_tables(tags: List[Tag], i: int, doc: DxfDocument) -> int:
-    n = len(tags)
-    while i < n:
-        code, value = tags[i]
+def _parse_tables(stream: _TagStream, doc: DxfDocument) -> None:
+    while True:
+        tag = stream.peek()
+        if tag is None:
+            return
+        code, value = tag
         name = value.strip()
-        if code == 0 and name == 'ENDSEC':
-            return i + 1
         if code == 0 and name == 'SECTION':  # unterminated section: hand back
-            return i
+            return
+        stream.advance()
+        if code == 0 and name == 'ENDSEC':
+            return
         if code == 0 and name in _TABLE_PARSERS:
-            j = _skip_to_next_zero(tags, i + 1)
-            _TABLE_PARSERS[name](tags[i + 1:j], doc)
-            i = j
-        else:
-            i += 1
-    return i
+            _TABLE_PARSERS[name](stream.take_record(), doc)
 
 
 # ---------------------------------------------------------------------------
@@ -814,67 +904,68 @@ def _is_paper_space(rec: List[Tag]) -> bool:
     return any(code == 67 and _i(value) == 1 for code, value in rec)
 
 
-def _parse_entity_run(tags: List[Tag], i: int, doc: DxfDocument, sink: List[Entity],
-                      stop_names: Tuple[str, ...], count_read: bool = True) -> int:
-    """Parse a run of entities into `sink`, stopping at (without consuming) the
-    first 0-code tag whose value is in `stop_names`. Shared by the ENTITIES
-    section and BLOCK bodies. Discarded/paper-space entities are counted on doc;
-    model-space reads are counted only when `count_read` is True."""
-    n = len(tags)
-    while i < n:
-        code, value = tags[i]
-        etype = value.strip()
+def _parse_entity_run(stream: _TagStream, doc: DxfDocument, emit: Callable[[Entity], None],
+                      stop_names: Tuple[str, ...], count_read: bool = True) -> None:
+    """Parse a run of entities, passing each to `emit` as soon as its record is
+    complete, and stop at (without consuming) the first 0-code tag whose value
+    is in `stop_names`. Shared by the ENTITIES section and BLOCK bodies.
+    Discarded/paper-space entities are counted on doc; model-space reads are
+    counted only when `count_read` is True."""
+    while True:
+        tag = stream.peek()
+        if tag is None:
+            return
+        code, value = tag
         if code != 0:  # stray tag, should not happen
-            i += 1
+            stream.advance()
             continue
+        etype = value.strip()
         if etype in stop_names:
-            return i
+            return
 
-        j = _skip_to_next_zero(tags, i + 1)
-        rec = tags[i + 1:j]
-        i = j
+        stream.advance()
+        rec = stream.take_record()
 
         if etype == 'POLYLINE':
             # Absorb the VERTEX children and the closing SEQEND.
             vertex_recs: List[List[Tag]] = []
-            while i < n and tags[i][1].strip() == 'VERTEX':
-                j = _skip_to_next_zero(tags, i + 1)
-                vertex_recs.append(tags[i + 1:j])
-                i = j
-            if i < n and tags[i][1].strip() == 'SEQEND':
-                i = _skip_to_next_zero(tags, i + 1)
+            tag = stream.peek()
+            while tag is not None and tag[1].strip() == 'VERTEX':
+                stream.advance()
+                vertex_recs.append(stream.take_record())
+                tag = stream.peek()
+            if tag is not None and tag[1].strip() == 'SEQEND':
+                stream.advance()
+                stream.take_record()
             if _is_paper_space(rec):
                 doc.discarded_counts['POLYLINE'] += 1
                 doc.discarded_counts['VERTEX'] += len(vertex_recs)
             else:
-                sink.append(_parse_polyline(rec, vertex_recs))
                 if count_read:
                     doc.read_counts['POLYLINE'] += 1
+                emit(_parse_polyline(rec, vertex_recs))
             continue
 
         parser = _ENTITY_PARSERS.get(etype)
         if parser is None or _is_paper_space(rec):
             doc.discarded_counts[_safe_type_name(etype)] += 1
             continue
-        sink.append(parser(rec))
         if count_read:
             doc.read_counts[etype] += 1
-    return i
+        emit(parser(rec))
 
 
-def _parse_entities(tags: List[Tag], i: int, doc: DxfDocument) -> int:
-    i = _parse_entity_run(tags, i, doc, doc.entities, ('ENDSEC', 'SECTION'))
-    if i < len(tags) and tags[i][1].strip() == 'ENDSEC':
-        return i + 1  # consume ENDSEC; a bare SECTION is handed back for the caller
-    return i
+def _parse_entities(stream: _TagStream, doc: DxfDocument,
+                    emit: Callable[[Entity], None]) -> None:
+    _parse_entity_run(stream, doc, emit, ('ENDSEC', 'SECTION'))
+    tag = stream.peek()
+    if tag is not None and tag[1].strip() == 'ENDSEC':
+        stream.advance()  # consume ENDSEC; a bare SECTION is handed back for the caller
 
 
-def _parse_one_block(tags: List[Tag], i: int, doc: DxfDocument) -> int:
-    """Parse a single 0 BLOCK ... 0 ENDBLK record. `i` points at the BLOCK tag."""
-    n = len(tags)
-    j = _skip_to_next_zero(tags, i + 1)
-    rec = tags[i + 1:j]
-    i = j
+def _parse_one_block(stream: _TagStream, doc: DxfDocument) -> None:
+    """Parse a single 0 BLOCK ... 0 ENDBLK record. The BLOCK tag is consumed."""
+    rec = stream.take_record()
 
     block = Block()
     bx = by = bz = 0.0
@@ -893,69 +984,288 @@ def _parse_one_block(tags: List[Tag], i: int, doc: DxfDocument) -> int:
 
     # Block-body entities (may include nested INSERTs) are not model space, so
     # they do not inflate the model read statistics.
-    i = _parse_entity_run(tags, i, doc, block.entities,
-                          ('ENDBLK', 'ENDSEC', 'SECTION'), count_read=False)
-    if i < n and tags[i][1].strip() == 'ENDBLK':
-        i = _skip_to_next_zero(tags, i + 1)  # consume the ENDBLK record
+    _parse_entity_run(stream, doc, block.entities.append,
+                      ('ENDBLK', 'ENDSEC', 'SECTION'), count_read=False)
+    tag = stream.peek()
+    if tag is not None and tag[1].strip() == 'ENDBLK':
+        stream.advance()  # consume the ENDBLK record
+        stream.take_record()
 
     if block.name:
         doc.blocks[block.name] = block
-    return i
 
 
-def _parse_blocks(tags: List[Tag], i: int, doc: DxfDocument) -> int:
+def _parse_blocks(stream: _TagStream, doc: DxfDocument) -> None:
     """Parse BLOCK definitions (with their entities) into doc.blocks."""
-    n = len(tags)
-    while i < n:
-        code, value = tags[i]
+    while True:
+        tag = stream.peek()
+        if tag is None:
+            return
+        code, value = tag
         name = value.strip()
-        if code == 0 and name == 'ENDSEC':
-            return i + 1
         if code == 0 and name == 'SECTION':  # unterminated section: hand back
-            return i
+            return
+        stream.advance()
+        if code == 0 and name == 'ENDSEC':
+            return
         if code == 0 and name == 'BLOCK':
-            i = _parse_one_block(tags, i, doc)
-        else:
-            i += 1
-    return i
+            _parse_one_block(stream, doc)
 
 
 # ---------------------------------------------------------------------------
 # Public API
 # ---------------------------------------------------------------------------
 
-def read_dxf_bytes(data: bytes, name: str = '<bytes>') -> DxfDocument:
-    tags = _load_tags(data)
+def read_dxf_bytes(data: bytes, name: str = '<bytes>',
+                   on_entity: Optional[Callable[[DxfDocument, Entity], None]] = None
+                   ) -> DxfDocument:
+    """Parse a whole ASCII DXF file. Model-space entities are collected in
+    doc.entities, or, when `on_entity` is given, handed to it one by one while
+    parsing continues (doc.entities then stays empty). Sections arrive in file
+    order, so by the first model-space entity of a conforming file the HEADER,
+    TABLES and BLOCKS sections are already on `doc`."""
+    return _read_document(data, name, on_entity)
+
+
+def _read_document(data: bytes, name: str,
+                   on_entity: Optional[Callable[[DxfDocument, Entity], None]],
+                   spans: Optional[Sequence[Span]] = None,
+                   entity_shards: Optional[List[object]] = None) -> DxfDocument:
+    """Section dispatch shared by the serial and the sectioned reader. The
+    sectioned reader cuts the first ENTITIES body out of `spans` and passes
+    its parsed shards instead, which are merged where that body would be."""
     doc = DxfDocument(name=name)
-    n = len(tags)
-    i = 0
-    while i < n:
-        code, value = tags[i]
-        if code == 0 and value.strip() == 'SECTION' and i + 1 < n and tags[i + 1][0] == 2:
-            section = tags[i + 1][1].strip()
-            body = i + 2
+    if on_entity is None:
+        emit = doc.entities.append
+    else:
+        def emit(entity: Entity) -> None:
+            on_entity(doc, entity)
+
+    stream = _TagStream(_iter_tags(data, spans))
+    while True:
+        tag = stream.advance()
+        if tag is None:
+            break
+        code, value = tag
+        head = stream.peek()
+        if code == 0 and value.strip() == 'SECTION' and head is not None and head[0] == 2:
+            stream.advance()
+            section = head[1].strip()
             if section == 'HEADER':
-                i = _parse_header(tags, body, doc)
+                _parse_header(stream, doc)
             elif section == 'TABLES':
-                i = _parse_tables(tags, body, doc)
+                _parse_tables(stream, doc)
             elif section == 'BLOCKS':
-                i = _parse_blocks(tags, body, doc)
+                _parse_blocks(stream, doc)
             elif section == 'ENTITIES':
-                i = _parse_entities(tags, body, doc)
-            else:  # CLASSES, OBJECTS, THUMBNAILIMAGE, ...
-                i = body
-        else:
-            i += 1
+                if entity_shards is not None:
+                    # The cut-out body must be the one this header opens: the tail
+                    # span resumes at its closing 0 ENDSEC / SECTION (or at EOF).
+                    tail = stream.peek()
+                    if tail is not None and (tail[0] != 0 or
+                                             tail[1].strip() not in ('ENDSEC', 'SECTION')):
+                        raise _SectionedReadMismatch()
+                    _merge_entity_shards(entity_shards, doc, emit)
+                    entity_shards = None
+                _parse_entities(stream, doc, emit)
+            # else CLASSES, OBJECTS, THUMBNAILIMAGE, ...: skipped tag by tag
+    if entity_shards is not None:  # the cut-out body was never reached
+        raise _SectionedReadMismatch()
     return doc
 
 
-def read_dxf_file(path: str) -> DxfDocument:
+def read_dxf_file(path: str, processes: int = 1) -> DxfDocument:
+    """Read a DXF file from disk. With `processes` > 1 a large ENTITIES section
+    is parsed in shards by a process pool (see _read_dxf_sectioned); the result
+    is identical to the serial read."""
+    import mmap  # Command line only; the extension worker receives the host's mapping instead.
     with open(path, 'rb') as fh:
-        # Read one byte past the cap so _load_tags can reject oversized
-        # files without ever buffering more than the limit.
-        data = fh.read(MAX_FILE_BYTES + 1)
-    doc = read_dxf_bytes(data, name=path)
-    return doc
+        size = os.fstat(fh.fileno()).st_size
+        if size > MAX_FILE_BYTES:
+            raise DxfError(f'File exceeds the {MAX_FILE_BYTES} byte limit.')
+        if size == 0:  # mmap cannot map an empty file
+            raise DxfError('Empty or non-DXF file.')
+        # Mapped, not read: the reader pulls one block at a time from the page cache.
+        with mmap.mmap(fh.fileno(), 0, access=mmap.ACCESS_READ) as view:
+            if processes > 1 and size >= _MIN_SECTIONED_BYTES:
+                doc = _read_dxf_sectioned(view, path, processes)
+                if doc is not None:
+                    return doc
+            return read_dxf_bytes(view, name=path)
+
+
+# ---------------------------------------------------------------------------
+# Sectioned ENTITIES parsing. A byte-level pre-scan finds the ENTITIES body
+# and cuts it at entity boundaries (group code 0 lines); a process pool parses
+# the shards from the same file mapping while the parent reads the remaining
+# sections, and the shards are merged back in file order. The extension worker
+# cannot use this: its sandbox has no multiprocessing, so it stays serial.
+# ---------------------------------------------------------------------------
+
+_MIN_SECTIONED_BYTES = 8 * 1024 * 1024  # smaller files are not worth a pool
+_MAX_BOUNDARY_WALK_LINES = 100_000      # give up on a cut inside one huge entity
+_CTRL_BYTES = bytes(_CTRL_STRIP_TABLE)
+
+
+class _SectionedReadMismatch(Exception):
+    """The serial parse disagrees with the pre-scan; the caller reads serially."""
+
+
+class _LineCounter:
+    """Newlines before a byte offset, counted in C a block at a time from the
+    previous query, so nearby queries are cheap. Tags are line pairs from the
+    start of the file: an even count before a line start means a code line."""
+
+    def __init__(self, data: bytes):
+        self.data = data
+        self.pos = 0
+        self.lines = 0
+
+    def before(self, offset: int) -> int:
+        while self.pos < offset:
+            end = min(offset, self.pos + _READ_BLOCK_BYTES)
+            self.lines += bytes(self.data[self.pos:end]).count(b'\n')
+            self.pos = end
+        while self.pos > offset:
+            start = max(offset, self.pos - _READ_BLOCK_BYTES)
+            self.lines -= bytes(self.data[start:self.pos]).count(b'\n')
+            self.pos = start
+        return self.lines
+
+
+def _line_at(data: bytes, start: int) -> Tuple[bytes, int]:
+    """The line starting at `start` as the tag reader would see it (controls
+    removed, whitespace stripped), and the start of the next line. Byte
+    stripping removes a subset of what the reader strips, so a match here is
+    always a match there; the reverse misses are caught by the shards."""
+    end = data.find(b'\n', start)
+    if end < 0:
+        end = len(data)
+    return bytes(data[start:end]).translate(None, _CTRL_BYTES).strip(), end + 1
+
+
+def _code0_value_line(data: bytes, counter: _LineCounter, value: bytes,
+                      start: int, limit: int) -> int:
+    """Start of the first value line in [start, limit) that reads `value` and
+    belongs to a group code 0 tag; -1 when there is none."""
+    pos = start
+    while True:
+        hit = data.find(value, pos, limit)
+        if hit < 0:
+            return -1
+        pos = hit + len(value)
+        line_start = data.rfind(b'\n', 0, hit) + 1
+        if line_start < start or line_start == 0:
+            continue
+        if _line_at(data, line_start)[0] != value or counter.before(line_start) % 2 == 0:
+            continue
+        code_start = data.rfind(b'\n', 0, line_start - 1) + 1
+        if _line_at(data, code_start)[0] == b'0':
+            return line_start
+
+
+def _plan_entity_shards(data: bytes, shards: int) -> Optional[Tuple[int, int, List[Span]]]:
+    """Find the first ENTITIES body and cut it into up to `shards` spans that
+    each start on a group code 0 line. POLYLINE children (VERTEX / SEQEND)
+    never start a span. Returns (body_start, body_end, spans) or None."""
+    counter = _LineCounter(data)
+    pos = 0
+    while True:  # the SECTION header: 0 / SECTION / 2 / ENTITIES
+        name_start = _code0_value_line(data, counter, b'SECTION', pos, len(data))
+        if name_start < 0:
+            return None
+        code_line, value_start = _line_at(data, _line_at(data, name_start)[1])
+        value, body_start = _line_at(data, value_start)
+        if code_line == b'2' and value == b'ENTITIES':
+            break
+        pos = name_start + 1
+
+    # The body ends at the first code 0 ENDSEC or SECTION, as in _parse_entities.
+    body_end = len(data)
+    for name in (b'ENDSEC', b'SECTION'):
+        name_start = _code0_value_line(data, counter, name, body_start, body_end)
+        if name_start >= 0:
+            body_end = data.rfind(b'\n', 0, name_start - 1) + 1  # the 0 line before the name
+    if body_end <= body_start:
+        return None
+
+    cuts = [body_start]
+    for k in range(1, shards):
+        pos = body_start + (body_end - body_start) * k // shards
+        pos = data.rfind(b'\n', 0, pos) + 1
+        if pos <= cuts[-1]:
+            continue
+        code_line_next = counter.before(pos) % 2 == 0
+        for _ in range(_MAX_BOUNDARY_WALK_LINES):
+            if pos >= body_end:
+                break
+            line, next_pos = _line_at(data, pos)
+            if code_line_next and line == b'0':
+                if _line_at(data, next_pos)[0] not in (b'VERTEX', b'SEQEND'):
+                    cuts.append(pos)
+                    break
+            pos = next_pos
+            code_line_next = not code_line_next
+    cuts.append(body_end)
+    return body_start, body_end, list(zip(cuts[:-1], cuts[1:]))
+
+
+def _parse_entity_shard(path: str, start: int, end: int) -> object:
+    """Pool task: parse the entities in [start, end) of the file. Returns
+    (entities, read_counts, discarded_counts); a DxfError to be raised in file
+    order; or None when the shard cannot be parsed exactly like the serial
+    read would (not plain UTF-8, or the pre-scan missed the section end)."""
+    import mmap
+    with open(path, 'rb') as fh, mmap.mmap(fh.fileno(), 0, access=mmap.ACCESS_READ) as view:
+        # The serial reader switches to cp1252 at a block boundary; mirroring that
+        # per shard is not worth it, so such files fall back to the serial read.
+        if not _is_utf8(view, start, end):
+            return None
+        doc = DxfDocument(name=path)
+        lines = _iter_lines(view, ((start, end),))
+        tags = _generate_tags(lines, _LineCounter(view).before(start), end == len(view))
+        try:
+            stream = _TagStream(tags)
+            _parse_entity_run(stream, doc, doc.entities.append, ('ENDSEC', 'SECTION'))
+        except DxfError as exc:
+            return exc
+        if stream.peek() is not None:
+            return None
+        return doc.entities, doc.read_counts, doc.discarded_counts
+
+
+def _merge_entity_shards(results: List[object], doc: DxfDocument,
+                         emit: Callable[[Entity], None]) -> None:
+    for result in results:
+        if isinstance(result, DxfError):
+            raise result
+        entities, read_counts, discarded_counts = result
+        doc.read_counts.update(read_counts)
+        doc.discarded_counts.update(discarded_counts)
+        for entity in entities:
+            emit(entity)
+
+
+def _read_dxf_sectioned(data: bytes, path: str, processes: int) -> Optional[DxfDocument]:
+    """Parse `path` (mapped as `data`) with the first ENTITIES body split across
+    a process pool. Returns None when the file does not qualify; the caller
+    then reads it serially."""
+    plan = _plan_entity_shards(data, processes)
+    if plan is None:
+        return None
+    body_start, body_end, spans = plan
+    if len(spans) < 2 or not _is_utf8(data, 0, body_start):
+        return None
+    import multiprocessing
+    with multiprocessing.Pool(len(spans)) as pool:
+        results = pool.starmap(_parse_entity_shard, [(path, a, b) for a, b in spans])
+    if any(result is None for result in results):
+        return None
+    # Per-shard tag caps bound each process; the file size cap bounds the total.
+    try:
+        return _read_document(data, path, None, ((0, body_start), (body_end, len(data))), results)
+    except _SectionedReadMismatch:
+        return None
 
 
 # ---------------------------------------------------------------------------
@@ -973,11 +1283,15 @@ def _print_counter(title: str, counts: Counter) -> None:
 
 
 def main(argv: List[str]) -> int:
+    processes = 1
+    if len(argv) == 4 and argv[1] == '-j' and argv[2].isdigit():
+        processes = max(1, int(argv[2]))
+        argv = [argv[0], argv[3]]
     if len(argv) != 2:
-        print(f'Usage: python {argv[0]} <drawing.dxf>')
+        print(f'Usage: python {argv[0]} [-j processes] <drawing.dxf>')
         return 2
     try:
-        doc = read_dxf_file(argv[1])
+        doc = read_dxf_file(argv[1], processes)
     except (OSError, DxfError) as exc:
         print(f'Error: {exc}')
         return 1
@@ -0,0 +1,98 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# Peak RSS and wall time of reading one large synthetic DXF, each way in a fresh process:
+#   streamed:     the worker's path - block by block, every entity handed to on_entity and dropped;
+#   collected:    read_dxf_file - block by block, entities kept on the document;
+#   materialized: the whole file decoded and every tag put in one list before parsing, as the
+#                 reader did before it streamed (one read block holding the whole file).
+#   sharded N:    read_dxf_file with the ENTITIES section parsed in shards by N processes, for
+#                 N = 1, 2, 4, 8 (scaling is bounded by the machine's cores; the peak RSS is
+#                 the reading process's own, the pool's workers are not counted).
+# All of them must see the same entity counts.
+# The materialized read needs roughly 40 times the file size in memory (about 8 GB at 200 MB).
+# Run with: python benchmark_dxf_reader.py [megabytes]   (from this folder, on Linux, for VmHWM)
+
+import mmap
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+import InteroperabilityWithDXFFile as dxf
+from test_InteroperabilityWithDXFFile import synthetic_dxf
+
+
+def write_drawing(path, megabytes):
+    """synthetic_dxf's ENTITIES body repeated until the file reaches `megabytes`."""
+    sample = synthetic_dxf(90000)
+    body_start = sample.index(b'ENTITIES\n') + len(b'ENTITIES\n')
+    body_end = sample.rindex(b'0\nENDSEC\n')
+    body = sample[body_start:body_end]
+    with open(path, 'wb') as fh:
+        fh.write(sample[:body_start])
+        for _ in range(max(1, megabytes * 1024 * 1024 // len(body))):
+            fh.write(body)
+        fh.write(sample[body_end:])
+
+
+def peak_rss_megabytes():
+    with open('/proc/self/status') as status:
+        for line in status:
+            if line.startswith('VmHWM:'):
+                return int(line.split()[1]) / 1024
+    return 0.0
+
+
+def child(mode, path):
+    """Reads `path` one way; prints seconds, peak MB and the read counts."""
+    start = time.perf_counter()
+    if mode == 'collected':
+        doc = dxf.read_dxf_file(path)
+    elif mode.startswith('sharded'):
+        doc = dxf.read_dxf_file(path, int(mode.split()[1]))
+    else:
+        with open(path, 'rb') as fh, mmap.mmap(fh.fileno(), 0, access=mmap.ACCESS_READ) as view:
+            if mode == 'streamed':
+                doc = dxf.read_dxf_bytes(view, name=path, on_entity=lambda doc, entity: None)
+            else:
+                dxf._READ_BLOCK_BYTES = len(view) + 1
+                tags = list(dxf._iter_tags(view))
+                doc = dxf.read_dxf_bytes(view, name=path)
+                del tags
+    seconds = time.perf_counter() - start
+    print(f'{seconds} {peak_rss_megabytes()} {sorted(doc.read_counts.items())} {len(doc.entities)}')
+
+
+def main():
+    megabytes = int(sys.argv[1]) if len(sys.argv) > 1 else 200
+
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, 'drawing.dxf')
+        write_drawing(path, megabytes)
+        print(f'{os.path.getsize(path) / (1024 * 1024):.0f} MB drawing, {os.cpu_count()} CPUs')
+        counts = set()
+        collected = set()
+        serial_seconds = None
+        for mode in ('streamed', 'collected', 'materialized', 'sharded 1', 'sharded 2', 'sharded 4', 'sharded 8'):
+            output = subprocess.run([sys.executable, __file__, '--child', mode, path], check=True,
+                                    capture_output=True, text=True).stdout.strip().split(' ', 2)
+            read_counts, entity_count = output[2].rsplit(' ', 1)
+            counts.add(read_counts)
+            if mode != 'streamed':
+                collected.add(entity_count)
+            seconds = float(output[0])
+            line = f'  {mode + ":":13} {seconds:.1f} s, peak RSS {float(output[1]):.0f} MB'
+            if mode == 'sharded 1':
+                serial_seconds = seconds
+            elif mode.startswith('sharded'):
+                line += f', {serial_seconds / seconds:.2f}x the 1-process read'
+            print(line)
+    if len(counts) != 1 or len(collected) != 1:
+        raise SystemExit('the reads saw different entities')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) > 1 and sys.argv[1] == '--child':
+        child(sys.argv[2], sys.argv[3])
+    else:
+        main()
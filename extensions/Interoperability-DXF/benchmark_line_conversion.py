@@ -0,0 +1,106 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# Conversion throughput of a drawing of about 1M lines: LINEs, LWPOLYLINEs with bulged edges and
+# CIRCLEs through main.py's Converter, then sent in host-sized batches through the real
+# HostChannel into memory. Lines are sent both ways send_page2d_batch accepts them: packed (the
+# flat array('d') as CreatePage2DBatch.line_coordinates, what the importer does) and one
+# Page2DLine submessage per line. Both must decode to the same coordinates.
+# Run with: python benchmark_line_conversion.py [lines]   (from this folder; needs protoc on PATH
+# to generate ExtensionIPC_pb2 as DeployExtensions.ps1 does)
+
+import io
+import os
+import random
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+import InteroperabilityWithDXFFile as dxf
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PROTO_DIR = os.path.join(HERE, '..', '..', 'code-core')
+
+MAX_BATCH_ENTITIES = 4096  # kMaxImportBatchEntities, ExtensionCommunications.h
+
+
+def synthetic_entities(line_count):
+    """Roughly `line_count` converted lines: half plain LINEs, half polyline segments, some
+    tessellated from bulges; one CIRCLE per 50 entities."""
+    rng = random.Random(7)
+    entities = []
+    lines = 0
+    while lines < line_count:
+        x, y = rng.uniform(0, 1000), rng.uniform(0, 1000)
+        if len(entities) % 2 == 0:
+            entities.append(dxf.Line(start=(x, y, 0.0), end=(x + rng.uniform(1, 9), y + 1.0, 0.0)))
+            lines += 1
+        else:
+            vertices = [(x + k, y + (k % 2), 0.5 if k == 2 else 0.0) for k in range(6)]
+            entities.append(dxf.LWPolyline(closed=True, vertices=vertices))
+            lines += 13  # Closed: 5 straight edges and one bulged edge of 8 segments.
+        if len(entities) % 50 == 0:
+            entities.append(dxf.Circle(center=(x, y, 0.0), radius=2.0))
+    return entities
+
+
+def decoded_lines(pb, stream):
+    """Every line in the framed WorkerToHost messages of `stream`, as one flat list."""
+    coordinates = []
+    data = stream.getvalue()
+    offset = 0
+    while offset < len(data):
+        (length,) = struct.unpack_from('<I', data, offset)
+        message = pb.WorkerToHost()
+        message.ParseFromString(data[offset + 4:offset + 4 + length])
+        offset += 4 + length
+        batch = message.create_page2d_batch
+        coordinates.extend(batch.line_coordinates)
+        for line in batch.lines:
+            coordinates.extend((line.x1, line.y1, line.x2, line.y2))
+    return coordinates
+
+
+def main():
+    line_count = int(sys.argv[1]) if len(sys.argv) > 1 else 1_000_000
+
+    with tempfile.TemporaryDirectory() as generated:
+        subprocess.run(['protoc', f'--proto_path={PROTO_DIR}', f'--python_out={generated}',
+                        os.path.join(PROTO_DIR, 'ExtensionIPC.proto')], check=True)
+        sys.path.insert(0, generated)
+        import ExtensionIPC_pb2 as pb
+        import main as importer
+        import vishwakarma_api as vk
+
+    entities = synthetic_entities(line_count)
+    converter = importer.Converter(dxf.DxfDocument())
+    convert_seconds = -time.perf_counter()
+    converter.convert(entities)
+    convert_seconds += time.perf_counter()
+    lines = converter.lines
+    sent = len(lines) // 4
+    print(f'{len(entities)} entities -> {sent} lines, {len(converter.polygons)} circles')
+    print(f'  convert:           {convert_seconds:.2f} s ({sent / convert_seconds / 1e6:.2f} M lines/s)')
+
+    streams = {}
+    step = 4 * MAX_BATCH_ENTITIES
+    for packed in (True, False):
+        channel = vk.HostChannel()
+        channel._out = streams[packed] = io.BytesIO()
+        start = time.perf_counter()
+        for first in range(0, len(lines), step):
+            batch = lines[first:first + step]
+            if not packed:
+                batch = [tuple(batch[i:i + 4]) for i in range(0, len(batch), 4)]
+            channel.send_page2d_batch(lines=batch)
+        seconds = time.perf_counter() - start
+        label = 'send packed:' if packed else 'send per line:'
+        print(f'  {label:18} {seconds:.2f} s ({sent / seconds / 1e6:.2f} M lines/s), '
+              f'{len(streams[packed].getvalue()) / (1024 * 1024):.1f} MB')
+
+    if decoded_lines(pb, streams[True]) != list(lines) or decoded_lines(pb, streams[False]) != list(lines):
+        raise SystemExit('the packed and per-line batches decode to different lines')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,166 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# One large DXF import over the real worker protocol, with this script as the host, through the
+# two transports ExtensionCommunications.cpp offers: everything inline on the pipes (file_bytes
+# in, every batch out as a framed message), and shared memory (file_region over a mapping of the
+# input, batches written into a SharedResultRing and handed over by slot number, with
+# SharedSlotCredit flow control). Both must deliver the same batches in the same order.
+# Linux stand-in for the worker executable's _vkshm builtin: a section handle N names the file
+# sectionN in a tmpfs folder, mapped with mmap, which is what a Windows section is to the host.
+# Reports wall time, bytes through the pipes and the worker's peak RSS (VmHWM) per transport.
+# Run with: python benchmark_shared_memory.py [entities] [runs]   (from this folder, on Linux;
+# needs protoc on PATH to generate ExtensionIPC_pb2 as DeployExtensions.ps1 does)
+
+import hashlib
+import mmap
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+from test_InteroperabilityWithDXFFile import synthetic_dxf
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PROTO_DIR = os.path.join(HERE, '..', '..', 'code-core')
+
+# As the host sets them (ExtensionCommunications.cpp / .h).
+RING_SLOT_BYTES = 1024 * 1024
+RING_SLOT_COUNT = 16
+MAX_BATCH_ENTITIES = 4096
+
+VKSHM_STAND_IN = '''
+import mmap, os
+_views = {}
+def map_view(section_handle, offset, length, writable):
+    path = os.path.join(os.environ['VKSHM_SECTIONS'], f'section{section_handle}')
+    with open(path, 'r+b' if writable else 'rb') as section:
+        mapping = mmap.mmap(section.fileno(), 0, access=mmap.ACCESS_WRITE if writable else mmap.ACCESS_READ)
+    view = memoryview(mapping)[offset:offset + length]
+    _views[id(view)] = mapping
+    return view
+def unmap_view(view):
+    mapping = _views.pop(id(view))
+    view.release()
+    mapping.close()
+'''
+
+
+class Host:
+    """One warm worker and the host side of its transport."""
+
+    def __init__(self, pb, env, sections):
+        self.pb = pb
+        self.sections = sections
+        self.process = subprocess.Popen([sys.executable, os.path.join(HERE, 'main.py')], cwd=HERE,
+                                        env=env, stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+        self.pipe_bytes = 0
+        self.ring = None
+
+    def _write(self, message):
+        payload = message.SerializeToString()
+        self.pipe_bytes += 4 + len(payload)
+        self.process.stdin.write(struct.pack('<I', len(payload)) + payload)
+        self.process.stdin.flush()
+
+    def _read(self):
+        (length,) = struct.unpack('<I', self.process.stdout.read(4))
+        payload = self.process.stdout.read(length)
+        self.pipe_bytes += 4 + length
+        message = self.pb.WorkerToHost()
+        message.ParseFromString(payload)
+        if message.WhichOneof('msg') != 'shared_batch':
+            return message, payload
+        slot, length = message.shared_batch.slot, message.shared_batch.length
+        payload = bytes(self.ring[slot * RING_SLOT_BYTES:slot * RING_SLOT_BYTES + length])
+        message.ParseFromString(payload)
+        credit = self.pb.HostToWorker()
+        credit.shared_slot_credit.slot = slot
+        self._write(credit)
+        return message, payload
+
+    def run(self, name, data, shared):
+        """Imports one file; returns the result and a digest of every batch in arrival order."""
+        request = self.pb.HostToWorker()
+        job = request.import_file_request
+        job.file_name = name
+        job.max_batch_entities = MAX_BATCH_ENTITIES
+        if not shared:
+            job.file_bytes = data
+        else:
+            with open(os.path.join(self.sections, 'section1'), 'wb') as section:
+                section.write(data)
+            job.file_region.section_handle = 1
+            job.file_region.length = len(data)
+            if self.ring is None:
+                ring_path = os.path.join(self.sections, 'section2')
+                with open(ring_path, 'wb') as section:
+                    section.truncate(RING_SLOT_BYTES * RING_SLOT_COUNT)
+                with open(ring_path, 'r+b') as section:
+                    self.ring = mmap.mmap(section.fileno(), 0)
+            job.result_ring.section_handle = 2
+            job.result_ring.slot_bytes = RING_SLOT_BYTES
+            job.result_ring.slot_count = RING_SLOT_COUNT
+        self._write(request)
+        digest = hashlib.sha256()
+        while True:
+            message, payload = self._read()
+            if message.WhichOneof('msg') == 'result':
+                return message.result, digest.hexdigest()
+            if message.WhichOneof('msg') != 'log':
+                digest.update(payload)
+
+    def peak_rss_megabytes(self):
+        with open(f'/proc/{self.process.pid}/status') as status:
+            for line in status:
+                if line.startswith('VmHWM:'):
+                    return int(line.split()[1]) / 1024
+        return 0.0
+
+    def close(self):
+        self.process.stdin.close()  # A closed pipe ends the worker's request loop.
+        self.process.wait()
+        if self.ring is not None:
+            self.ring.close()
+
+
+def main():
+    entities = int(sys.argv[1]) if len(sys.argv) > 1 else 400000
+    runs = int(sys.argv[2]) if len(sys.argv) > 2 else 3
+    tmpfs = '/dev/shm' if os.path.isdir('/dev/shm') else None
+
+    with tempfile.TemporaryDirectory() as generated, tempfile.TemporaryDirectory(dir=tmpfs) as sections:
+        subprocess.run(['protoc', f'--proto_path={PROTO_DIR}', f'--python_out={generated}',
+                        os.path.join(PROTO_DIR, 'ExtensionIPC.proto')], check=True)
+        with open(os.path.join(generated, '_vkshm.py'), 'w') as stand_in:
+            stand_in.write(VKSHM_STAND_IN)
+        sys.path.insert(0, generated)
+        import ExtensionIPC_pb2 as pb
+        env = dict(os.environ, VKSHM_SECTIONS=sections, PYTHONPATH=os.pathsep.join(
+            [generated, HERE, os.environ.get('PYTHONPATH', '')]))
+
+        data = synthetic_dxf(entities)
+        print(f'{entities} entities, {len(data) / (1024 * 1024):.1f} MB, best of {runs}')
+        outcomes = {}
+        for shared in (False, True):
+            host = Host(pb, env, sections)
+            seconds = float('inf')
+            for _ in range(runs):
+                host.pipe_bytes = 0
+                start = time.perf_counter()
+                result, digest = host.run('drawing.dxf', data, shared)
+                seconds = min(seconds, time.perf_counter() - start)
+                if not result.success:
+                    raise SystemExit(f'import failed: {result.error}')
+            outcomes[shared] = (result, digest)
+            label = 'shared memory:' if shared else 'pipes only:   '
+            print(f'  {label} {seconds:.2f} s, {host.pipe_bytes / (1024 * 1024):.2f} MB through the pipes, '
+                  f'worker peak RSS {host.peak_rss_megabytes():.0f} MB')
+            host.close()
+
+    if outcomes[False] != outcomes[True]:
+        raise SystemExit('the two transports delivered different batches')
+
+
+if __name__ == '__main__':
+    main()
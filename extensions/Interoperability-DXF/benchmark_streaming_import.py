@@ -0,0 +1,107 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# Time to first entity and worker peak RSS of one large DXF import over the real worker protocol,
+# with this script as the host. Bounded: max_batch_entities as the host sends it (4096), so the
+# worker streams batches while it is still parsing and the host can import each one as it arrives.
+# Unbounded: a bound no drawing reaches, so lines and polygons are held until parsing ends - the
+# materialized result the streaming replaced (texts still go in groups of TEXTS_PER_BATCH, main.py,
+# so the first entity arrives early either way; the time to half the elements shows the rest).
+# Both runs must deliver the same element counts, and no bounded batch may exceed the bound.
+# Run with: python benchmark_streaming_import.py [entities]   (from this folder, on Linux, for the
+# VmHWM peak RSS; needs protoc on PATH to generate ExtensionIPC_pb2 as DeployExtensions.ps1 does)
+
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+from test_InteroperabilityWithDXFFile import synthetic_dxf
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PROTO_DIR = os.path.join(HERE, '..', '..', 'code-core')
+
+MAX_BATCH_ENTITIES = 4096  # kMaxImportBatchEntities, ExtensionCommunications.h
+UNBOUNDED = 0xFFFFFFFF
+
+
+def batch_entities(batch):
+    """Entities in one CreatePage2DBatch, counted as the host counts them."""
+    return len(batch.lines) + len(batch.line_coordinates) // 4 + len(batch.texts) + len(batch.polygons)
+
+
+def peak_rss_megabytes(pid):
+    with open(f'/proc/{pid}/status') as status:
+        for line in status:
+            if line.startswith('VmHWM:'):
+                return int(line.split()[1]) / 1024
+    return 0.0
+
+
+def import_once(pb, env, name, data, max_batch_entities):
+    """A fresh worker imports one file: (first entity s, half the elements s, total s, elements,
+    batches, largest batch, peak MB)."""
+    process = subprocess.Popen([sys.executable, os.path.join(HERE, 'main.py')], cwd=HERE, env=env,
+                               stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+    # Let the worker finish its imports first, so start-up is not counted against the first entity.
+    time.sleep(1.0)
+    request = pb.HostToWorker()
+    request.import_file_request.file_name = name
+    request.import_file_request.file_bytes = data
+    request.import_file_request.max_batch_entities = max_batch_entities
+    payload = request.SerializeToString()
+    start = time.perf_counter()
+    process.stdin.write(struct.pack('<I', len(payload)) + payload)
+    process.stdin.flush()
+    arrivals = []  # (seconds, elements so far) per batch
+    entities = largest = 0
+    while True:
+        (length,) = struct.unpack('<I', process.stdout.read(4))
+        message = pb.WorkerToHost()
+        message.ParseFromString(process.stdout.read(length))
+        kind = message.WhichOneof('msg')
+        if kind == 'create_page2d_batch':
+            count = batch_entities(message.create_page2d_batch)
+            entities += count
+            largest = max(largest, count)
+            arrivals.append((time.perf_counter() - start, entities))
+        elif kind == 'result':
+            total = time.perf_counter() - start
+            if not message.result.success:
+                raise SystemExit(f'import failed: {message.result.error}')
+            break
+    peak = peak_rss_megabytes(process.pid)
+    process.stdin.close()
+    process.wait()
+    half = next(seconds for seconds, sent in arrivals if 2 * sent >= entities)
+    return arrivals[0][0], half, total, entities, len(arrivals), largest, peak
+
+
+def main():
+    entities = int(sys.argv[1]) if len(sys.argv) > 1 else 400000
+
+    with tempfile.TemporaryDirectory() as generated:
+        subprocess.run(['protoc', f'--proto_path={PROTO_DIR}', f'--python_out={generated}',
+                        os.path.join(PROTO_DIR, 'ExtensionIPC.proto')], check=True)
+        sys.path.insert(0, generated)
+        import ExtensionIPC_pb2 as pb
+        env = dict(os.environ, PYTHONPATH=os.pathsep.join(
+            [generated, HERE, os.environ.get('PYTHONPATH', '')]))
+
+        data = synthetic_dxf(entities)
+        print(f'{entities} entities, {len(data) / (1024 * 1024):.1f} MB')
+        bounded = import_once(pb, env, 'drawing.dxf', data, MAX_BATCH_ENTITIES)
+        unbounded = import_once(pb, env, 'drawing.dxf', data, UNBOUNDED)
+
+    for label, (first, half, total, sent, batches, largest, peak) in (
+            (f'batches of {MAX_BATCH_ENTITIES}:', bounded), ('unbounded:', unbounded)):
+        print(f'  {label:16} first entity {first:.2f} s, half {half:.2f} s, all {total:.2f} s, {sent} elements '
+              f'in {batches} batches (largest {largest}), worker peak RSS {peak:.0f} MB')
+    if bounded[3] != unbounded[3]:
+        raise SystemExit('the bounded import delivered a different number of elements')
+    if bounded[5] > MAX_BATCH_ENTITIES:
+        raise SystemExit('a batch exceeded max_batch_entities')
+
+
+if __name__ == '__main__':
+    main()
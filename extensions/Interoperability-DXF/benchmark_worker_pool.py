@@ -0,0 +1,131 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# Import throughput of a batch of files over the real worker protocol, with this script as the
+# host: a fresh worker per file, one import at a time (before pooling), against a warm pool that
+# keeps one import in flight per worker and takes results in queue order (ExtensionCommunications.cpp).
+# Plain CPython has no _vkshm, so every message goes inline on the pipes; this measures what warm
+# workers save (process start-up and module imports) plus whatever parallelism the machine offers,
+# not the Windows host's shared-memory transport.
+# Run with: python benchmark_worker_pool.py [files] [entities_per_file] [workers]   (from this
+# folder; needs protoc on PATH to generate ExtensionIPC_pb2 as DeployExtensions.ps1 does)
+
+import os
+import queue
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+from test_InteroperabilityWithDXFFile import synthetic_dxf
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PROTO_DIR = os.path.join(HERE, '..', '..', 'code-core')
+
+
+class Worker:
+    """One worker process; a reader thread drains its stdout so a big job never blocks on the pipe
+    while the host waits on another worker."""
+
+    def __init__(self, pb, env):
+        self.pb = pb
+        self.process = subprocess.Popen([sys.executable, os.path.join(HERE, 'main.py')], cwd=HERE,
+                                        env=env, stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+        self.results = queue.Queue()
+        self.reader = threading.Thread(target=self._read, daemon=True)
+        self.reader.start()
+
+    def _read(self):
+        stream = self.process.stdout
+        messages = 0
+        while True:
+            prefix = stream.read(4)
+            if len(prefix) < 4:
+                self.results.put(None)
+                return
+            message = self.pb.WorkerToHost()
+            message.ParseFromString(stream.read(struct.unpack('<I', prefix)[0]))
+            messages += 1
+            if message.WhichOneof('msg') == 'result':
+                self.results.put((message.result, messages))
+                messages = 0
+
+    def send(self, name, data):
+        request = self.pb.HostToWorker()
+        request.import_file_request.file_name = name
+        request.import_file_request.file_bytes = data
+        payload = request.SerializeToString()
+        self.process.stdin.write(struct.pack('<I', len(payload)) + payload)
+        self.process.stdin.flush()
+
+    def result(self):
+        outcome = self.results.get()
+        if outcome is None:
+            raise RuntimeError('worker exited without a result')
+        return outcome
+
+    def close(self):
+        self.process.stdin.close()  # A closed pipe ends the worker's request loop.
+        self.process.wait()
+        self.reader.join()
+
+
+def one_worker_per_file(pb, env, files):
+    outcomes = []
+    for name, data in files:
+        worker = Worker(pb, env)
+        worker.send(name, data)
+        outcomes.append(worker.result())
+        worker.close()
+    return outcomes
+
+
+def warm_pool(pb, env, files, worker_count):
+    workers = [Worker(pb, env) for _ in range(worker_count)]
+    for index in range(min(worker_count, len(files))):
+        workers[index].send(*files[index])
+    outcomes = []
+    for index in range(len(files)):
+        worker = workers[index % worker_count]
+        outcomes.append(worker.result())
+        if index + worker_count < len(files):
+            worker.send(*files[index + worker_count])
+    for worker in workers:
+        worker.close()
+    return outcomes
+
+
+def main():
+    file_count = int(sys.argv[1]) if len(sys.argv) > 1 else 200
+    entities = int(sys.argv[2]) if len(sys.argv) > 2 else 2000
+    worker_count = int(sys.argv[3]) if len(sys.argv) > 3 else 4
+
+    with tempfile.TemporaryDirectory() as generated:
+        subprocess.run(['protoc', f'--proto_path={PROTO_DIR}', f'--python_out={generated}',
+                        os.path.join(PROTO_DIR, 'ExtensionIPC.proto')], check=True)
+        sys.path.insert(0, generated)
+        import ExtensionIPC_pb2 as pb
+        env = dict(os.environ, PYTHONPATH=os.pathsep.join(
+            [generated, HERE, os.environ.get('PYTHONPATH', '')]))
+
+        files = [(f'drawing{n}.dxf', synthetic_dxf(entities + n % 7)) for n in range(file_count)]
+        megabytes = sum(len(data) for _, data in files) / (1024 * 1024)
+        print(f'{file_count} files, {megabytes:.1f} MB, {os.cpu_count()} CPUs')
+
+        start = time.perf_counter()
+        cold = one_worker_per_file(pb, env, files)
+        cold_seconds = time.perf_counter() - start
+        start = time.perf_counter()
+        warm = warm_pool(pb, env, files, worker_count)
+        warm_seconds = time.perf_counter() - start
+
+    for (name, _), (cold_result, _), (warm_result, _) in zip(files, cold, warm):
+        if not (cold_result.success and warm_result.success) or cold_result != warm_result:
+            raise SystemExit(f'{name}: results differ: {cold_result} vs {warm_result}')
+    print(f'  one worker per file: {cold_seconds:.2f} s ({file_count / cold_seconds:.1f} files/s)')
+    print(f'  warm pool of {worker_count}:     {warm_seconds:.2f} s ({file_count / warm_seconds:.1f} files/s), '
+          f'pool start-up included')
+
+
+if __name__ == '__main__':
+    main()
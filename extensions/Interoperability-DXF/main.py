@@ -13,8 +13,9 @@ Conversion policy (MVP, host has no layer concept):
                           everything with its embedded MSDF font)
   DIMENSION            -> Page2D lines + text (host has no dimension element)
   BLOCK + INSERT       -> Asset2D definition + placed instances carrying the
-                          INSERT's scale / rotation / mirror; the host bakes
-                          the transform into each instance's member geometry.
+                          INSERT's scale / rotation / mirror; the host keeps
+                          them as references and draws the definition through
+                          the transform (no per-instance member geometry).
                           Rectangular arrays expand into one instance per
                           cell. Nested INSERTs inside a block are flattened
                           (with their local transforms) into the definition's
@@ -25,6 +26,15 @@ becomes one Page2D ComputerUnit. The converted drawing is translated as a
 whole so its bounding box centers on the Page2D origin: real DXF files often
 sit 10^5..10^6 units away from their origin, which would land far outside the
 host's default view and beyond float32 GPU coordinate precision.
+
+Model-space geometry streams: it is converted entity by entity as the reader
+produces it and sent as soon as a batch fills, while the rest of the file is
+still being parsed. That needs the recenter offset before the extent is known,
+so it is taken from the HEADER's $EXTMIN / $EXTMAX, which every AutoCAD-saved
+file carries ahead of its entities. Files without usable header extents fall
+back to buffering everything and recentering on the converted bounding box.
+Block references are always resolved after parsing: their definitions are
+built from the whole BLOCKS section and must precede the inserts anyway.
 """
 
 from __future__ import annotations
@@ -33,28 +43,30 @@ import math
 import re
 import sys
 import traceback
+from array import array
 from collections import Counter
 
 import vishwakarma_api as vk
 import InteroperabilityWithDXFFile as dxf
 
-LINES_PER_BATCH = 5000
-TEXTS_PER_BATCH = 1000
-POLYGONS_PER_BATCH = 1000
-ASSET_INSERTS_PER_BATCH = 5000
+TEXTS_PER_BATCH = 1000  # Texts are large; lines, polygons and inserts use the host's bound.
 CIRCLE_SEGMENT_COUNT = 64
 ARC_TESSELLATION_STEP = math.pi / 12.0  # 15 degrees per segment on bulge arcs
 MIN_SEGMENT_LENGTH = 1e-9
 FALLBACK_TEXT_HEIGHT = 2.5
 
 # Block/INSERT (Asset2D) policy. Instances carry the INSERT's scale / rotation
-# and the host bakes the transform into the placed member geometry. An INSERT
+# and the host draws the definition through that transform. An INSERT
 # whose scale is ~zero would collapse its members to a point (and the host
 # rejects it), so those are skipped.
 DEGENERATE_SCALE_TOL = 1e-9
 MAX_BLOCK_RECURSION_DEPTH = 16     # Guards pathological / cyclic nested blocks.
 MAX_ARRAY_CELLS = 100_000          # Cap on one INSERT's col*row expansion.
 
+# Header extents beyond this are treated as absent: empty drawings store
+# $EXTMIN / $EXTMAX as +1e20 / -1e20 sentinels.
+MAX_HEADER_EXTENT = 1e15
+
 # Host-side Cad2DTextJustification values (3x3 grid, row-major from top-left).
 JUSTIFY_GRID = ((0, 1, 2),   # top:    TopLeft, TopMiddle, TopRight
                 (3, 4, 5),   # middle: MiddleLeft, Center, MiddleRight
@@ -99,13 +111,13 @@ def mtext_plain_text(value: str) -> str:
 # Geometry helpers
 # ---------------------------------------------------------------------------
 
-def tessellate_bulge(x1, y1, x2, y2, bulge):
-    """Yield straight segments approximating one bulged polyline edge."""
+def bulge_arc_points(x1, y1, x2, y2, bulge):
+    """Interior points (flat x, y list) of the arc replacing one bulged
+    polyline edge; empty when the edge is effectively straight."""
     chord = math.hypot(x2 - x1, y2 - y1)
     sweep = 4.0 * math.atan(bulge)
     if chord < MIN_SEGMENT_LENGTH or abs(sweep) < 1e-6:
-        yield (x1, y1, x2, y2)
-        return
+        return []
 
     radius = chord / (2.0 * math.sin(abs(sweep) / 2.0))  # |sweep|/2 is in (0, pi)
     # Center sits on the chord's perpendicular bisector; signed distance keeps
@@ -118,31 +130,36 @@ def tessellate_bulge(x1, y1, x2, y2, bulge):
 
     start_angle = math.atan2(y1 - center_y, x1 - center_x)
     steps = max(2, math.ceil(abs(sweep) / ARC_TESSELLATION_STEP))
-    prev_x, prev_y = x1, y1
-    for step in range(1, steps + 1):
-        if step == steps:
-            next_x, next_y = x2, y2  # land exactly on the true endpoint
-        else:
-            angle = start_angle + sweep * step / steps
-            next_x = center_x + radius * math.cos(angle)
-            next_y = center_y + radius * math.sin(angle)
-        yield (prev_x, prev_y, next_x, next_y)
-        prev_x, prev_y = next_x, next_y
+    # The last step lands exactly on the true endpoint, which the caller adds.
+    angles = [start_angle + sweep * step / steps for step in range(1, steps)]
+    return [value for angle in angles
+            for value in (center_x + radius * math.cos(angle), center_y + radius * math.sin(angle))]
 
 
-def polyline_to_lines(vertices, closed):
-    """vertices: iterable of (x, y, bulge). Yields (x1, y1, x2, y2) tuples."""
+def append_polyline_lines(out, vertices, closed):
+    """Append a polyline's segments to the flat (x1, y1, x2, y2, ...) array
+    `out`, bulge arcs tessellated. vertices: iterable of (x, y, bulge).
+    Returns the number of segments appended."""
     points = list(vertices)
     if len(points) < 2:
-        return
-    edges = list(zip(points, points[1:]))
+        return 0
     if closed:
-        edges.append((points[-1], points[0]))
-    for (x1, y1, bulge), (x2, y2, _) in edges:
-        for segment in tessellate_bulge(x1, y1, x2, y2, bulge):
-            sx1, sy1, sx2, sy2 = segment
-            if math.hypot(sx2 - sx1, sy2 - sy1) >= MIN_SEGMENT_LENGTH:
-                yield segment
+        points.append(points[0])
+    # Trace the whole outline first, then cut it into segments in one pass.
+    xs, ys = [points[0][0]], [points[0][1]]
+    for (x1, y1, bulge), (x2, y2, _) in zip(points, points[1:]):
+        if bulge:
+            arc = bulge_arc_points(x1, y1, x2, y2, bulge)
+            xs += arc[0::2]
+            ys += arc[1::2]
+        xs.append(x2)
+        ys.append(y2)
+    added = 0
+    for ax, ay, bx, by in zip(xs, ys, xs[1:], ys[1:]):
+        if math.hypot(bx - ax, by - ay) >= MIN_SEGMENT_LENGTH:
+            out.extend((ax, ay, bx, by))
+            added += 1
+    return added
 
 
 def text_justification(halign: int, valign: int) -> int:
@@ -167,11 +184,13 @@ def _style_float(dim_style, code, default):
 
 
 class Converter:
-    """Accumulates Page2D elements from DXF entities and tracks statistics."""
+    """Accumulates Page2D elements from DXF entities and tracks statistics.
+    Lines live in one flat array('d') of x1, y1, x2, y2 per line: a quarter
+    of the memory of tuples, and sent to the host as a packed field."""
 
     def __init__(self, doc):
         self.doc = doc
-        self.lines = []
+        self.lines = array('d')
         self.texts = []
         self.polygons = []
         self.imported = Counter()
@@ -185,24 +204,20 @@ class Converter:
         if math.hypot(x2 - x1, y2 - y1) < MIN_SEGMENT_LENGTH:
             self.skipped['LINE (zero length)'] += 1
             return
-        self.lines.append((x1, y1, x2, y2))
+        self.lines.extend((x1, y1, x2, y2))
         self.imported['LINE'] += 1
 
     def add_lwpolyline(self, e):
-        segments = list(polyline_to_lines(e.vertices, e.closed))
-        if not segments:
+        if not append_polyline_lines(self.lines, e.vertices, e.closed):
             self.skipped['LWPOLYLINE (degenerate)'] += 1
             return
-        self.lines.extend(segments)
         self.imported['LWPOLYLINE'] += 1
 
     def add_polyline(self, e):
         vertices = [(x, y, bulge) for x, y, _z, bulge in e.vertices]
-        segments = list(polyline_to_lines(vertices, e.closed))
-        if not segments:
+        if not append_polyline_lines(self.lines, vertices, e.closed):
             self.skipped['POLYLINE (degenerate)'] += 1
             return
-        self.lines.extend(segments)
         self.imported['POLYLINE'] += 1
 
     def add_circle(self, e):
@@ -286,19 +301,25 @@ class Converter:
         added = False
         for (a, b) in ((p13, e1), (p14, e2), (e1, e2)):
             if math.hypot(b[0] - a[0], b[1] - a[1]) >= MIN_SEGMENT_LENGTH:
-                self.lines.append((a[0], a[1], b[0], b[1]))
+                self.lines.extend((a[0], a[1], b[0], b[1]))
                 added = True
         return added
 
+    def translate(self, dx, dy):
+        self.lines = shift_lines(self.lines, dx, dy)
+        self.texts = shift_texts(self.texts, dx, dy)
+        self.polygons = shift_polygons(self.polygons, dx, dy)
+
     def recenter(self, extra_points=()):
         """Translate this converter's elements so the bounding box of them plus
         `extra_points` (anchors that are translated by the caller, e.g. asset
         insert points) centers on the origin. Returns the applied (dx, dy).
         Scale is untouched."""
         xs, ys = [], []
-        for x1, y1, x2, y2 in self.lines:
-            xs += (x1, x2)
-            ys += (y1, y2)
+        if self.lines:
+            line_xs, line_ys = self.lines[0::2], self.lines[1::2]
+            xs += (min(line_xs), max(line_xs))
+            ys += (min(line_ys), max(line_ys))
         for t in self.texts:
             xs.append(t[0])
             ys.append(t[1])
@@ -314,12 +335,7 @@ class Converter:
         dy = -(min(ys) + max(ys)) / 2.0
         if dx == 0.0 and dy == 0.0:
             return 0.0, 0.0
-        self.lines = [(x1 + dx, y1 + dy, x2 + dx, y2 + dy)
-                      for x1, y1, x2, y2 in self.lines]
-        self.texts = [(x + dx, y + dy, height, rotation, justification, content)
-                      for x, y, height, rotation, justification, content in self.texts]
-        self.polygons = [(cx + dx, cy + dy, radius, count, rot)
-                         for cx, cy, radius, count, rot in self.polygons]
+        self.translate(dx, dy)
         return dx, dy
 
     # -- dispatch ----------------------------------------------------------
@@ -334,13 +350,32 @@ class Converter:
         'Dimension': add_dimension,
     }
 
+    def add(self, entity):
+        handler = self._HANDLERS.get(type(entity).__name__)
+        if handler is not None:
+            handler(self, entity)
+        else:
+            self.skipped[type(entity).__name__.upper()] += 1
+
     def convert(self, entities=None):
         for entity in (self.doc.entities if entities is None else entities):
-            handler = self._HANDLERS.get(type(entity).__name__)
-            if handler is not None:
-                handler(self, entity)
-            else:
-                self.skipped[type(entity).__name__.upper()] += 1
+            self.add(entity)
+
+
+def shift_lines(lines, dx, dy):
+    shifted = array('d', lines)
+    shifted[0::2] = array('d', [x + dx for x in lines[0::2]])
+    shifted[1::2] = array('d', [y + dy for y in lines[1::2]])
+    return shifted
+
+
+def shift_texts(texts, dx, dy):
+    return [(x + dx, y + dy, height, rotation, justification, content)
+            for x, y, height, rotation, justification, content in texts]
+
+
+def shift_polygons(polygons, dx, dy):
+    return [(cx + dx, cy + dy, radius, count, rot) for cx, cy, radius, count, rot in polygons]
 
 
 # ---------------------------------------------------------------------------
@@ -361,11 +396,11 @@ def transform_geometry(geom, tx, ty, base_x, base_y, sx, sy, rotation_rad):
         qx, qy = (px - base_x) * sx, (py - base_y) * sy
         return (tx + qx * cos_r - qy * sin_r, ty + qx * sin_r + qy * cos_r)
 
-    out_lines = []
-    for x1, y1, x2, y2 in lines:
-        ax, ay = xf(x1, y1)
-        bx, by = xf(x2, y2)
-        out_lines.append((ax, ay, bx, by))
+    out_lines = array('d')
+    for i in range(0, len(lines), 4):
+        ax, ay = xf(lines[i], lines[i + 1])
+        bx, by = xf(lines[i + 2], lines[i + 3])
+        out_lines.extend((ax, ay, bx, by))
     out_texts = []
     height_scale = abs(sy) if sy else 1.0
     for x, y, height, rotation, justification, content in texts:
@@ -396,7 +431,7 @@ def resolve_block_geometry(doc, name, cache, visiting=None, depth=0):
     conv = Converter(doc)
     plain = [e for e in block.entities if not isinstance(e, dxf.Insert)]
     conv.convert(plain)
-    lines, texts, polygons = list(conv.lines), list(conv.texts), list(conv.polygons)
+    lines, texts, polygons = array('d', conv.lines), list(conv.texts), list(conv.polygons)
 
     for insert in (e for e in block.entities if isinstance(e, dxf.Insert)):
         child = resolve_block_geometry(doc, insert.name, cache, visiting, depth + 1)
@@ -419,10 +454,7 @@ def geometry_bbox(geometry):
     """Bounding box (min_x, min_y, max_x, max_y) of resolved block geometry
     (lines, texts, polygons) in the block frame; None when empty."""
     lines, texts, polygons = geometry
-    xs, ys = [], []
-    for x1, y1, x2, y2 in lines:
-        xs += (x1, x2)
-        ys += (y1, y2)
+    xs, ys = list(lines[0::2]), list(lines[1::2])
     for t in texts:
         xs.append(t[0])
         ys.append(t[1])
@@ -452,31 +484,90 @@ def array_cells(insert):
                    insert.insert[1] + ox * sin_r + oy * cos_r)
 
 
-def run() -> None:
-    channel = vk.HostChannel()
-    request = channel.recv_import_request()
-
+def header_extents_offset(doc):
+    """Recenter offset from the HEADER's model-space extents ($EXTMIN /
+    $EXTMAX), or None when they are missing, inverted or sentinel values."""
+    low, high = doc.header.get('$EXTMIN'), doc.header.get('$EXTMAX')
+    if not (isinstance(low, tuple) and isinstance(high, tuple)
+            and len(low) >= 2 and len(high) >= 2):
+        return None
+    if any(abs(v) > MAX_HEADER_EXTENT for v in (low[0], low[1], high[0], high[1])):
+        return None
+    if low[0] > high[0] or low[1] > high[1]:
+        return None
+    return -(low[0] + high[0]) / 2.0, -(low[1] + high[1]) / 2.0
+
+
+class ModelSpaceStream:
+    """Receives model-space entities from the reader while it is still parsing.
+    INSERTs are kept for resolution after parsing; everything else is converted
+    at once and, when the header fixed the recenter offset, sent as soon as a
+    batch fills. Without an offset the converted elements buffer until the end."""
+
+    def __init__(self, channel, batch_size):
+        self.channel = channel
+        self.batch_size = batch_size
+        self.text_batch_size = min(batch_size, TEXTS_PER_BATCH)
+        self.converter = None
+        self.offset = None      # (dx, dy) from the header; None = recenter at the end
+        self.inserts = []
+        self.sent_lines = self.sent_texts = self.sent_polygons = 0
+
+    def add(self, doc, entity):
+        if self.converter is None:  # First model-space entity: HEADER and BLOCKS are parsed.
+            self.converter = Converter(doc)
+            self.offset = header_extents_offset(doc)
+        if isinstance(entity, dxf.Insert):
+            self.inserts.append(entity)
+            return
+        self.converter.add(entity)
+        if self.offset is not None:
+            self.send(*self.offset, final=False)
+
+    def send(self, dx, dy, final):
+        """Send every full batch of converted elements shifted by (dx, dy), and
+        the partial remainders too when `final`."""
+        converter = self.converter
+        line_batch = 4 * self.batch_size  # four doubles per line
+        while len(converter.lines) >= line_batch or (final and converter.lines):
+            batch = converter.lines[:line_batch]
+            del converter.lines[:line_batch]
+            self.channel.send_page2d_batch(lines=shift_lines(batch, dx, dy))
+            self.sent_lines += len(batch) // 4
+        while len(converter.texts) >= self.text_batch_size or (final and converter.texts):
+            batch = converter.texts[:self.text_batch_size]
+            del converter.texts[:self.text_batch_size]
+            self.channel.send_page2d_batch(texts=shift_texts(batch, dx, dy))
+            self.sent_texts += len(batch)
+        while len(converter.polygons) >= self.batch_size or (final and converter.polygons):
+            batch = converter.polygons[:self.batch_size]
+            del converter.polygons[:self.batch_size]
+            self.channel.send_page2d_batch(polygons=shift_polygons(batch, dx, dy))
+            self.sent_polygons += len(batch)
+
+
+def import_file(channel: vk.HostChannel, request) -> None:
+    batch_size = channel.batch_entities(request)
+    stream = ModelSpaceStream(channel, batch_size)
     try:
-        doc = dxf.read_dxf_bytes(request.file_bytes, request.file_name)
+        doc = dxf.read_dxf_bytes(channel.request_file_data(request), request.file_name,
+                                 on_entity=stream.add)
     except Exception as exc:  # Parser failure must reach the host, not crash silently.
         channel.send_result(False, f"Failed to parse '{request.file_name}': {exc}")
         return
-
-    # Model-space geometry (everything except block references) converts as before.
-    model_entities = [e for e in doc.entities if not isinstance(e, dxf.Insert)]
-    model_inserts = [e for e in doc.entities if isinstance(e, dxf.Insert)]
-    converter = Converter(doc)
-    converter.convert(model_entities)
+    if stream.converter is None:  # No model-space entities at all.
+        stream.converter = Converter(doc)
+    converter = stream.converter
 
     # Block references. Every INSERT of a defined, non-empty block becomes an
     # Asset2D instance carrying the INSERT's scale / rotation / mirror; the
-    # host bakes that transform into the instance's member geometry.
+    # host draws the definition through that transform.
     block_cache = {}
     definitions = {}        # block name -> definition dict (built lazily)
     bbox_by_key = {}        # definition key -> block-frame geometry bbox
     asset_inserts = []      # (key, x, y, sx, sy, rotation_deg), recentered below
     next_key = 1
-    for insert in model_inserts:
+    for insert in stream.inserts:
         name = insert.name
         # Skip anonymous / system / external-reference blocks (dimensions, layouts).
         if not name or name.startswith('*'):
@@ -511,58 +602,71 @@ def run() -> None:
     # Definitions are created lazily by their first insert, so every one is used.
     definition_list = list(definitions.values())
 
-    # Recenter model geometry and the asset instances together, so block
-    # instances keep their position relative to the plain drawing. Each
-    # instance's extents proxy is its block bbox pushed through the placement
-    # transform: the bare insert point can sit far from the actual geometry
-    # when the block base point is away from its drawn content. Master
-    # geometry, base points and the instance transforms stay in the block frame.
-    defs_by_key = {d['key']: d for d in definition_list}
-    anchors = []
-    for key, cx, cy, sx, sy, rot in asset_inserts:
-        definition = defs_by_key[key]
-        min_x, min_y, max_x, max_y = bbox_by_key[key]
-        theta = math.radians(rot)
-        cos_r, sin_r = math.cos(theta), math.sin(theta)
-        for px, py in ((min_x, min_y), (min_x, max_y), (max_x, min_y), (max_x, max_y)):
-            qx = (px - definition['base_x']) * sx
-            qy = (py - definition['base_y']) * sy
-            anchors.append((cx + qx * cos_r - qy * sin_r, cy + qx * sin_r + qy * cos_r))
-    offset_x, offset_y = converter.recenter(extra_points=anchors)
+    if stream.offset is not None:
+        # Streamed: the elements already sent carry the header offset, so the
+        # rest of the drawing and the asset instances must use it too.
+        offset_x, offset_y = stream.offset
+        stream.send(offset_x, offset_y, final=True)
+    else:
+        # Recenter model geometry and the asset instances together, so block
+        # instances keep their position relative to the plain drawing. Each
+        # instance's extents proxy is its block bbox pushed through the placement
+        # transform: the bare insert point can sit far from the actual geometry
+        # when the block base point is away from its drawn content. Master
+        # geometry, base points and the instance transforms stay in the block frame.
+        defs_by_key = {d['key']: d for d in definition_list}
+        anchors = []
+        for key, cx, cy, sx, sy, rot in asset_inserts:
+            definition = defs_by_key[key]
+            min_x, min_y, max_x, max_y = bbox_by_key[key]
+            theta = math.radians(rot)
+            cos_r, sin_r = math.cos(theta), math.sin(theta)
+            for px, py in ((min_x, min_y), (min_x, max_y), (max_x, min_y), (max_x, max_y)):
+                qx = (px - definition['base_x']) * sx
+                qy = (py - definition['base_y']) * sy
+                anchors.append((cx + qx * cos_r - qy * sin_r, cy + qx * sin_r + qy * cos_r))
+        offset_x, offset_y = converter.recenter(extra_points=anchors)
+        stream.send(0.0, 0.0, final=True)
     if offset_x or offset_y:
         asset_inserts = [(k, x + offset_x, y + offset_y, sx, sy, rot)
                          for k, x, y, sx, sy, rot in asset_inserts]
 
-    page_total = len(converter.lines) + len(converter.texts) + len(converter.polygons)
+    page_total = stream.sent_lines + stream.sent_texts + stream.sent_polygons
     total = page_total + len(definition_list) + len(asset_inserts)
     imported = ', '.join(f'{name} {count}' for name, count in converter.imported.most_common())
     skipped = ', '.join(f'{name} {count}' for name, count in sorted(
         (converter.skipped + doc.discarded_counts).items()))
     channel.send_log(
         f"Parsed '{request.file_name}': {page_total} Page2D elements "
-        f"({len(converter.lines)} lines, {len(converter.texts)} texts, "
-        f"{len(converter.polygons)} polygons), {len(definition_list)} asset "
+        f"({stream.sent_lines} lines, {stream.sent_texts} texts, "
+        f"{stream.sent_polygons} polygons), {len(definition_list)} asset "
         f"definitions with {len(asset_inserts)} instances from [{imported or 'nothing'}]"
         + (f"; recentered by ({offset_x:.3f}, {offset_y:.3f})"
            if offset_x or offset_y else "")
         + (f"; skipped [{skipped}]" if skipped else ""))
 
-    for start in range(0, len(converter.lines), LINES_PER_BATCH):
-        channel.send_page2d_batch(lines=converter.lines[start:start + LINES_PER_BATCH])
-    for start in range(0, len(converter.texts), TEXTS_PER_BATCH):
-        channel.send_page2d_batch(texts=converter.texts[start:start + TEXTS_PER_BATCH])
-    for start in range(0, len(converter.polygons), POLYGONS_PER_BATCH):
-        channel.send_page2d_batch(polygons=converter.polygons[start:start + POLYGONS_PER_BATCH])
-
-    # One definition per batch (each is self-contained); inserts chunked.
+    # One definition per batch (each is self-contained); inserts chunked. Every
+    # definition precedes the inserts: the host drops inserts of unknown keys.
     for definition in definition_list:
         channel.send_asset2d_batch(definitions=[definition])
-    for start in range(0, len(asset_inserts), ASSET_INSERTS_PER_BATCH):
-        channel.send_asset2d_batch(inserts=asset_inserts[start:start + ASSET_INSERTS_PER_BATCH])
+    for start in range(0, len(asset_inserts), batch_size):
+        channel.send_asset2d_batch(inserts=asset_inserts[start:start + batch_size])
 
     channel.send_result(True, "", total_elements=total)
 
 
+def run() -> None:
+    # Pooled, warm worker: the imports above ran once at spawn; each request is
+    # one job, and a closed pipe means the host is done with this worker.
+    channel = vk.HostChannel()
+    while True:
+        request = channel.recv_import_request()
+        if request is None:
+            return
+        import_file(channel, request)
+        channel.finish_request()
+
+
 if __name__ == "__main__":
     try:
         run()
@@ -0,0 +1,172 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# The block-streamed reader must produce the same document whatever the block size, the
+# on_entity path must see exactly the entities the collecting path stores, and a read with the
+# ENTITIES section sharded across processes must equal the serial read.
+# Run with: python -m unittest test_InteroperabilityWithDXFFile   (from this folder)
+
+import mmap
+import os
+import tempfile
+import unittest
+from unittest import mock
+
+import InteroperabilityWithDXFFile as dxf
+
+
+def _tags(*pairs):
+    return ''.join(f'{code}\n{value}\n' for code, value in pairs)
+
+
+def synthetic_dxf(entity_count: int, text: str = 'Ünïcode label', newline: str = '\n') -> bytes:
+    """A small but complete drawing: HEADER, TABLES, one BLOCK and an ENTITIES section that
+    cycles through every shape the reader converts, plus a POLYLINE with VERTEX children, a
+    paper-space entity and an unsupported type."""
+    parts = [_tags((0, 'SECTION'), (2, 'HEADER'), (9, '$ACADVER'), (1, 'AC1024'),
+                   (9, '$INSUNITS'), (70, 4), (9, '$EXTMIN'), (10, 0.0), (20, 0.0), (30, 0.0),
+                   (9, '$EXTMAX'), (10, 1000.0), (20, 500.0), (30, 0.0), (0, 'ENDSEC')),
+             _tags((0, 'SECTION'), (2, 'TABLES'), (0, 'TABLE'), (2, 'LAYER'),
+                   (0, 'LAYER'), (2, 'WALLS'), (62, 3), (6, 'CONTINUOUS'),
+                   (0, 'ENDTAB'), (0, 'ENDSEC')),
+             _tags((0, 'SECTION'), (2, 'BLOCKS'), (0, 'BLOCK'), (2, 'DOOR'), (70, 0),
+                   (10, 0.0), (20, 0.0), (30, 0.0), (0, 'LINE'), (8, '0'),
+                   (10, 0.0), (20, 0.0), (11, 0.9), (21, 0.0),
+                   (0, 'ENDBLK'), (0, 'ENDSEC')),
+             _tags((0, 'SECTION'), (2, 'ENTITIES'))]
+    for n in range(entity_count):
+        x = float(n % 997)
+        kind = n % 9
+        if kind == 0:
+            parts.append(_tags((0, 'LINE'), (5, f'{n:X}'), (8, 'WALLS'),
+                               (10, x), (20, 1.5), (11, x + 2.25), (21, 3.0)))
+        elif kind == 1:
+            parts.append(_tags((0, 'CIRCLE'), (8, '0'), (10, x), (20, 2.0), (40, 0.5)))
+        elif kind == 2:
+            parts.append(_tags((0, 'ARC'), (8, '0'), (10, x), (20, 2.0), (40, 1.0),
+                               (50, 15.0), (51, 120.0)))
+        elif kind == 3:
+            parts.append(_tags((0, 'LWPOLYLINE'), (8, 'WALLS'), (90, 3), (70, 1),
+                               (10, x), (20, 0.0), (10, x + 1), (20, 0.0), (10, x), (20, 1.0)))
+        elif kind == 4:
+            parts.append(_tags((0, 'POLYLINE'), (8, '0'), (66, 1), (70, 0),
+                               (0, 'VERTEX'), (8, '0'), (10, x), (20, 0.0),
+                               (0, 'VERTEX'), (8, '0'), (10, x + 4), (20, 4.0),
+                               (0, 'SEQEND'), (8, '0')))
+        elif kind == 5:
+            parts.append(_tags((0, 'TEXT'), (8, '0'), (10, x), (20, 9.0), (40, 2.5),
+                               (1, f'{text} {n}')))
+        elif kind == 6:
+            parts.append(_tags((0, 'INSERT'), (8, '0'), (2, 'DOOR'), (10, x), (20, 5.0),
+                               (41, 1.0), (42, 1.0), (50, 90.0)))
+        elif kind == 7:
+            parts.append(_tags((0, 'LINE'), (67, 1), (8, '0'),
+                               (10, x), (20, 0.0), (11, x), (21, 1.0)))
+        else:
+            parts.append(_tags((0, 'HATCH'), (8, '0'), (2, 'SOLID')))
+    parts.append(_tags((0, 'ENDSEC'), (0, 'EOF')))
+    return ''.join(parts).replace('\n', newline).encode('utf-8')
+
+
+class StreamedReadTests(unittest.TestCase):
+    def read_with_block(self, data: bytes, block_bytes: int, **kwargs) -> dxf.DxfDocument:
+        with mock.patch.object(dxf, '_READ_BLOCK_BYTES', block_bytes):
+            return dxf.read_dxf_bytes(data, name='synthetic.dxf', **kwargs)
+
+    def assert_same_at_all_block_sizes(self, data: bytes) -> dxf.DxfDocument:
+        # One block holding the whole file is the old decode-everything-then-split reader.
+        whole = self.read_with_block(data, len(data) + 1)
+        for block_bytes in (1, 2, 3, 7, 64, 1000, 4096):
+            with self.subTest(block_bytes=block_bytes):
+                self.assertEqual(self.read_with_block(data, block_bytes), whole)
+        return whole
+
+    def test_block_size_does_not_change_the_document(self):
+        doc = self.assert_same_at_all_block_sizes(synthetic_dxf(400))
+        self.assertEqual(doc.read_counts['POLYLINE'], 44)
+        self.assertEqual(doc.discarded_counts['LINE'], 44)
+        self.assertEqual(doc.discarded_counts['HATCH'], 44)
+        self.assertIn('DOOR', doc.blocks)
+        self.assertEqual(doc.header['$ACADVER'], 'AC1024')
+
+    def test_crlf_and_legacy_code_page_at_all_block_sizes(self):
+        self.assert_same_at_all_block_sizes(synthetic_dxf(200, newline='\r\n'))
+        # Not UTF-8: decoding falls back to cp1252 from the failing block on.
+        legacy = synthetic_dxf(200, text='Grüße').decode('utf-8').encode('cp1252')
+        doc = self.assert_same_at_all_block_sizes(legacy)
+        self.assertTrue(any(isinstance(e, dxf.Text) and e.text.startswith('Grüße')
+                            for e in doc.entities))
+
+    def test_on_entity_sees_the_collected_entities(self):
+        data = synthetic_dxf(400)
+        collected = dxf.read_dxf_bytes(data, name='synthetic.dxf')
+        seen = []
+        streamed = self.read_with_block(
+            data, 64, on_entity=lambda doc, entity: seen.append((len(doc.blocks), entity)))
+        self.assertEqual([entity for _, entity in seen], collected.entities)
+        self.assertEqual(streamed.entities, [])
+        # BLOCKS precedes ENTITIES, so every callback already sees the block definitions.
+        self.assertTrue(all(blocks == 1 for blocks, _ in seen))
+        streamed.entities = collected.entities
+        self.assertEqual(streamed, collected)
+
+
+class ShardedReadTests(unittest.TestCase):
+    def setUp(self):
+        self.directory = tempfile.TemporaryDirectory()
+        self.addCleanup(self.directory.cleanup)
+        # Shard even tiny files; only the parent process consults this threshold.
+        patcher = mock.patch.object(dxf, '_MIN_SECTIONED_BYTES', 0)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+    def write(self, data: bytes) -> str:
+        path = os.path.join(self.directory.name, 'drawing.dxf')
+        with open(path, 'wb') as fh:
+            fh.write(data)
+        return path
+
+    def sectioned(self, path: str, processes: int):
+        with open(path, 'rb') as fh, mmap.mmap(fh.fileno(), 0, access=mmap.ACCESS_READ) as view:
+            return dxf._read_dxf_sectioned(view, path, processes)
+
+    def test_sharded_equals_serial(self):
+        for newline in ('\n', '\r\n'):
+            path = self.write(synthetic_dxf(3000, newline=newline))
+            serial = dxf.read_dxf_file(path, 1)
+            for processes in (2, 3, 8):
+                with self.subTest(newline=repr(newline), processes=processes):
+                    sharded = self.sectioned(path, processes)
+                    self.assertIsNotNone(sharded, 'fell back to the serial read')
+                    self.assertEqual(sharded, serial)
+                    self.assertEqual(dxf.read_dxf_file(path, processes), serial)
+
+    def test_shards_start_on_entities_but_never_inside_a_polyline(self):
+        data = synthetic_dxf(3000)
+        body_start, body_end, spans = dxf._plan_entity_shards(data, 8)
+        self.assertEqual(len(spans), 8)
+        self.assertEqual((spans[0][0], spans[-1][1]), (body_start, body_end))
+        for (_, end), (start, _) in zip(spans, spans[1:]):
+            self.assertEqual(end, start)
+            code, value_start = dxf._line_at(data, start)
+            self.assertEqual(code, b'0')
+            self.assertNotIn(dxf._line_at(data, value_start)[0], (b'VERTEX', b'SEQEND'))
+
+    def test_legacy_code_page_falls_back_to_serial(self):
+        legacy = synthetic_dxf(3000, text='Grüße').decode('utf-8').encode('cp1252')
+        path = self.write(legacy)
+        self.assertIsNone(self.sectioned(path, 3))
+        self.assertEqual(dxf.read_dxf_file(path, 3), dxf.read_dxf_file(path, 1))
+
+    def test_error_in_a_late_shard_matches_serial(self):
+        data = synthetic_dxf(3000)
+        cut = data.rindex(b'0\nLINE\n')
+        path = self.write(data[:cut] + b'0x\nLINE\n' + data[cut + len(b'0\nLINE\n'):])
+        with self.assertRaises(dxf.DxfError) as serial:
+            dxf.read_dxf_file(path, 1)
+        with self.assertRaises(dxf.DxfError) as sharded:
+            dxf.read_dxf_file(path, 3)
+        self.assertEqual(str(sharded.exception), str(serial.exception))
+        self.assertIn('Malformed group code', str(serial.exception))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -5,21 +5,62 @@ Extensions talk to the host only through this module. It encapsulates the
 wire format (length-prefixed Protobuf Lite over the process stdin/stdout
 pipes) so the underlying IPC channel can change without breaking extensions.
 
+When the host offers shared memory, the input file arrives as a read-only view
+of the host's file mapping and outgoing batches are written into slots of a
+host-created result ring; the pipe then carries only slot numbers one way and
+slot credits the other. `_vkshm` is the worker executable's builtin for
+mapping those sections; without it (plain CPython) everything stays inline.
+
+Workers are pooled and kept warm by the host: an entry script loops on
+`recv_import_request()` until it returns None and calls `finish_request()`
+after every job.
+
 This copy adds the Page2D batch used by 2D importers; the .std importer's
 copy predates it. Both remain wire-compatible (same ExtensionIPC schema).
 """
 
 from __future__ import annotations
 
+import gc
 import struct
 import sys
+from array import array
 
 import ExtensionIPC_pb2 as _pb
 
+try:
+    import _vkshm
+except ImportError:  # Not running inside VishwakarmaExtension.exe.
+    _vkshm = None
+
 # The host never sends a message larger than this; a bigger prefix means the
 # stream is corrupt, so fail fast instead of trying to allocate it.
 MAX_MESSAGE_BYTES = 256 * 1024 * 1024
 
+# Entities per result batch when the host states no bound (older hosts).
+DEFAULT_BATCH_ENTITIES = 4096
+
+
+def _varint(value: int) -> bytes:
+    out = bytearray()
+    while value > 0x7F:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def _length_delimited(field_number: int, payload: bytes) -> bytes:
+    return _varint(field_number << 3 | 2) + _varint(len(payload)) + payload
+
+
+def _packed_doubles(field_number: int, values: array) -> bytes:
+    """Wire bytes of a packed `repeated double` field: the array's raw storage."""
+    if sys.byteorder != "little":  # Protobuf doubles are little-endian on the wire.
+        values = array("d", values)
+        values.byteswap()
+    return _length_delimited(field_number, values.tobytes())
+
 
 class HostChannel:
     """Framed protobuf channel to the host over stdin/stdout."""
@@ -27,6 +68,10 @@ class HostChannel:
     def __init__(self):
         self._in = sys.stdin.buffer
         self._out = sys.stdout.buffer
+        self._ring = None          # Writable view of the host's result ring, if offered.
+        self._ring_slot_bytes = 0
+        self._free_slots = []      # Ring slots this worker owns (not yet handed to the host).
+        self._input_view = None    # Current job's mapped input file, if any.
 
     def _read_exact(self, count: int) -> bytes:
         chunks = []
@@ -39,18 +84,95 @@ class HostChannel:
             remaining -= len(chunk)
         return b"".join(chunks)
 
-    def recv_import_request(self) -> "_pb.ImportFileRequest":
+    def _recv_message(self) -> "_pb.HostToWorker":
         (length,) = struct.unpack("<I", self._read_exact(4))
         if length > MAX_MESSAGE_BYTES:
             raise ValueError(f"host message of {length} bytes exceeds limit")
         message = _pb.HostToWorker()
         message.ParseFromString(self._read_exact(length))
-        if message.WhichOneof("msg") != "import_file_request":
+        return message
+
+    def _recv(self, expected: str):
+        message = self._recv_message()
+        if message.WhichOneof("msg") != expected:
             raise ValueError("unexpected message from host")
-        return message.import_file_request
+        return getattr(message, expected)
+
+    def recv_import_request(self):
+        """The next job's ImportFileRequest, or None once the host has closed the
+        pipe (worker pool shutdown or recycle). Slot credits the previous job left
+        unread are collected on the way."""
+        while True:
+            try:
+                message = self._recv_message()
+            except EOFError:
+                return None
+            kind = message.WhichOneof("msg")
+            if kind == "import_file_request":
+                break
+            if kind != "shared_slot_credit":
+                raise ValueError("unexpected message from host")
+            self._free_slots.append(message.shared_slot_credit.slot)
+        request = message.import_file_request
+        # The ring belongs to the worker, not the job: map it once.
+        if self._ring is None and request.HasField("result_ring") and _vkshm is not None:
+            ring = request.result_ring
+            self._ring = _vkshm.map_view(ring.section_handle, 0,
+                                         ring.slot_bytes * ring.slot_count, True)
+            self._ring_slot_bytes = ring.slot_bytes
+            self._free_slots = list(range(ring.slot_count))
+        return request
+
+    def batch_entities(self, request: "_pb.ImportFileRequest") -> int:
+        """Most entities one batch may carry. The host imports every batch as
+        it arrives and rejects larger ones, so importers chunk by this."""
+        return request.max_batch_entities or DEFAULT_BATCH_ENTITIES
+
+    def request_file_data(self, request: "_pb.ImportFileRequest"):
+        """The input file content: a read-only memoryview over the host's file
+        mapping when the host shared one (no copy at all), else the inline bytes.
+        Parsers must therefore accept any bytes-like object."""
+        if not request.HasField("file_region"):
+            return request.file_bytes
+        if _vkshm is None:
+            raise RuntimeError("host shared the input file but this worker cannot map it")
+        region = request.file_region
+        self._input_view = _vkshm.map_view(region.section_handle, region.offset, region.length, False)
+        return self._input_view
+
+    def finish_request(self) -> None:
+        """End of one job: unmap the input file view (the host closes its section
+        handle) and collect the job's garbage before waiting for the next one."""
+        view, self._input_view = self._input_view, None
+        if view is not None:
+            try:
+                _vkshm.unmap_view(view)
+            except BufferError:
+                pass  # Still sliced somewhere; stays mapped until the host recycles us.
+        gc.collect()
+
+    def _acquire_slot(self) -> int:
+        # Every slot is with the host: block until it credits one back.
+        while not self._free_slots:
+            self._free_slots.append(self._recv("shared_slot_credit").slot)
+        return self._free_slots.pop()
 
     def _send(self, message: "_pb.WorkerToHost") -> None:
-        payload = message.SerializeToString()
+        # The result ends the job and stays inline: the worker then waits for its next
+        # request, so it must not block on a slot credit for it.
+        self._send_payload(message.SerializeToString(), message.WhichOneof("msg") == "result")
+
+    def _send_payload(self, payload: bytes, inline: bool = False) -> None:
+        """Send one serialized WorkerToHost."""
+        if (self._ring is not None and not inline
+                and 0 < len(payload) <= self._ring_slot_bytes):
+            slot = self._acquire_slot()
+            offset = slot * self._ring_slot_bytes
+            self._ring[offset:offset + len(payload)] = payload
+            envelope = _pb.WorkerToHost()
+            envelope.shared_batch.slot = slot
+            envelope.shared_batch.length = len(payload)
+            payload = envelope.SerializeToString()
         self._out.write(struct.pack("<I", len(payload)))
         self._out.write(payload)
         self._out.flush()
@@ -61,12 +183,14 @@ class HostChannel:
         self._send(message)
 
     def send_page2d_batch(self, lines=(), texts=(), polygons=()) -> None:
-        """lines: iterable of (x1, y1, x2, y2);
+        """lines: flat array('d') of x1, y1, x2, y2 per line (sent packed), or an
+        iterable of (x1, y1, x2, y2);
         texts: iterable of (x, y, height, rotation_radians, justification, text);
         polygons: iterable of (center_x, center_y, radius, segment_count, rotation_degrees)."""
         message = _pb.WorkerToHost()
         batch = message.create_page2d_batch
-        for x1, y1, x2, y2 in lines:
+        packed = isinstance(lines, array)
+        for x1, y1, x2, y2 in (() if packed else lines):
             line = batch.lines.add()
             line.x1 = x1
             line.y1 = y1
@@ -87,14 +211,22 @@ class HostChannel:
             polygon.radius = radius
             polygon.segment_count = segment_count
             polygon.rotation_degrees = rotation_degrees
-        self._send(message)
+        if not packed or not lines:
+            self._send(message)
+            return
+        # The pure-Python protobuf runtime would check and encode every double one by one:
+        # append the packed field's wire bytes to the batch and wrap the envelope by hand.
+        payload = batch.SerializeToString() + _packed_doubles(
+            _pb.CreatePage2DBatch.LINE_COORDINATES_FIELD_NUMBER, lines)
+        self._send_payload(_length_delimited(
+            _pb.WorkerToHost.CREATE_PAGE2D_BATCH_FIELD_NUMBER, payload))
 
     def send_asset2d_batch(self, definitions=(), inserts=()) -> None:
         """Send DXF blocks as Asset2D definitions + placed instances.
 
         definitions: iterable of dicts with keys
             key (int), name (str), base_x (float), base_y (float),
-            lines    -> iterable of (x1, y1, x2, y2),
+            lines    -> flat array('d') of x1, y1, x2, y2 or iterable of (x1, y1, x2, y2),
             texts    -> iterable of (x, y, height, rotation_radians, justification, text),
             polygons -> iterable of (center_x, center_y, radius, segment_count, rotation_degrees).
         inserts: iterable of (key, x, y, scale_x, scale_y, rotation_degrees).
@@ -109,7 +241,11 @@ class HostChannel:
             record.name = definition.get("name", "")
             record.base_x = definition["base_x"]
             record.base_y = definition["base_y"]
-            for x1, y1, x2, y2 in definition.get("lines", ()):
+            lines = definition.get("lines", ())
+            if isinstance(lines, array):
+                record.line_coordinates.extend(lines)
+                lines = ()
+            for x1, y1, x2, y2 in lines:
                 line = record.lines.add()
                 line.x1 = x1
                 line.y1 = y1
@@ -37,10 +37,13 @@ import argparse
 import json
 import re
 import sys
+from bisect import bisect_left, bisect_right
 from collections import Counter, defaultdict
+from collections.abc import Sequence
 from dataclasses import dataclass, field
+from itertools import chain
 from pathlib import Path
-from typing import Any, Dict, Iterable, List, Optional, Tuple, Union
+from typing import Any, Dict, Iterable, Iterator, List, Optional, Tuple, Union
 
 
 LoadId = Union[int, str]
@@ -48,6 +51,9 @@ LoadId = Union[int, str]
 _INT_RE = re.compile(r"^[+-]?\d+$")
 _FLOAT_RE = re.compile(r"^[+-]?(?:\d+(?:\.\d*)?|\.\d+)(?:[Ee][+-]?\d+)?$")
 
+# First characters of records that can only be data lines, never section keywords.
+_NUMERIC_LEAD = frozenset("0123456789+-.")
+
 # A malformed "1 TO 999999999" range would otherwise exhaust memory on expansion.
 _MAX_RANGE_SPAN = 1_000_000
 
@@ -173,6 +179,8 @@ class LogicalRecord:
     start_line: int
     end_line: int
     raw_lines: List[str] = field(default_factory=list)
+    # Whitespace tokens of `text`, split once by the tokenizer for every parser.
+    tokens: List[str] = field(default_factory=list, repr=False, compare=False)
 
 
 @dataclass
@@ -238,7 +246,10 @@ class STDModel:
     unparsed_records: List[Dict[str, Any]] = field(default_factory=list)
     records: List[LogicalRecord] = field(default_factory=list)
 
-    def to_dict(self, include_records: bool = False) -> Dict[str, Any]:
+    def to_dict(self, include_records: bool = False, compact_ids: bool = False) -> Dict[str, Any]:
+        """Plain dicts and lists, ready for json.dumps. Id specs are expanded to
+        lists of ints unless compact_ids is set, which keeps them as IdRuns (a
+        "1 TO 100000" range stays one object; the caller must serialize them)."""
         data = {
             "path": str(self.path),
             "data_type": self.data_type,
@@ -297,7 +308,7 @@ class STDModel:
                 }
                 for record in self.records
             ]
-        return data
+        return data if compact_ids else _expand_id_runs(data)
 
 
 def _clean_token(token: str) -> str:
@@ -328,69 +339,218 @@ def _parse_load_id(token: str) -> LoadId:
     return cleaned
 
 
-def _expand_range(start: int, end: int) -> Iterable[int]:
-    if end >= start:
-        return range(start, end + 1)
-    return range(start, end - 1, -1)
+class IdRuns(Sequence):
+    """The ids of an id spec in first-seen order without duplicates, held as
+    run-length ranges: "1 TO 100000" is one range object, not 100000 ints.
+    Reads like the list it stands for (iteration, len, indexing, `in`, ==)."""
+
+    __slots__ = ("_runs", "_length", "_lows", "_highs")
+
+    def __init__(self, values: Iterable[int] = ()) -> None:
+        self._runs: List[range] = []
+        self._length = 0
+        # Covered values as sorted, disjoint, non-adjacent inclusive intervals;
+        # built on first use, so a spec of plain ids never pays for it.
+        self._lows: Optional[List[int]] = None
+        self._highs: List[int] = []
+        self.extend(values)
+
+    @property
+    def runs(self) -> List[range]:
+        return list(self._runs)
+
+    def extend(self, values: Iterable[int]) -> None:
+        """Append single ids in order, skipping values already present."""
+        if self._runs:
+            for value in values:
+                self.add_range(value, value)
+            return
+        unique = list(dict.fromkeys(values))
+        if not unique:
+            return
+        runs = self._runs
+        start = previous = unique[0]
+        step = 0
+        for value in unique[1:]:
+            delta = value - previous
+            if (delta == 1 or delta == -1) and (step == 0 or step == delta):
+                step = delta
+            else:
+                runs.append(range(start, previous + (step or 1), step or 1))
+                start = value
+                step = 0
+            previous = value
+        runs.append(range(start, previous + (step or 1), step or 1))
+        self._length = len(unique)
+        self._lows = None
+
+    def add_range(self, start: int, end: int) -> None:
+        """Append start..end inclusive (descending when end < start), skipping
+        values already present."""
+        low, high = (start, end) if start <= end else (end, start)
+        lows, highs = self._intervals()
+        if not lows or low > highs[-1] + 1:
+            pieces = [(low, high)]
+            lows.append(low)
+            highs.append(high)
+        else:
+            pieces = self._uncovered(low, high)
+            if not pieces:
+                return
+            first = bisect_left(highs, low - 1)
+            stop = bisect_right(lows, high + 1)
+            if first < stop:
+                low = min(low, lows[first])
+                high = max(high, highs[stop - 1])
+            lows[first:stop] = [low]
+            highs[first:stop] = [high]
+
+        if end < start:
+            for piece_low, piece_high in reversed(pieces):
+                self._append_run(range(piece_high, piece_low - 1, -1))
+        else:
+            for piece_low, piece_high in pieces:
+                self._append_run(range(piece_low, piece_high + 1))
+
+    def _intervals(self) -> Tuple[List[int], List[int]]:
+        if self._lows is None:
+            spans = sorted((min(run[0], run[-1]), max(run[0], run[-1])) for run in self._runs)
+            lows: List[int] = []
+            highs: List[int] = []
+            for low, high in spans:
+                if highs and low <= highs[-1] + 1:
+                    highs[-1] = max(highs[-1], high)
+                else:
+                    lows.append(low)
+                    highs.append(high)
+            self._lows, self._highs = lows, highs
+        return self._lows, self._highs
+
+    def _uncovered(self, low: int, high: int) -> List[Tuple[int, int]]:
+        lows, highs = self._intervals()
+        index = bisect_right(lows, low)
+        cursor = low
+        if index > 0 and highs[index - 1] >= low:
+            cursor = highs[index - 1] + 1
+        pieces: List[Tuple[int, int]] = []
+        while cursor <= high:
+            if index < len(lows) and lows[index] <= high:
+                if lows[index] > cursor:
+                    pieces.append((cursor, lows[index] - 1))
+                cursor = max(cursor, highs[index] + 1)
+                index += 1
+            else:
+                pieces.append((cursor, high))
+                break
+        return pieces
+
+    def _append_run(self, run: range) -> None:
+        self._length += len(run)
+        if self._runs:
+            last = self._runs[-1]
+            step = run[0] - last[-1]
+            if (
+                step in (1, -1)
+                and (len(last) == 1 or last.step == step)
+                and (len(run) == 1 or run.step == step)
+            ):
+                self._runs[-1] = range(last[0], run[-1] + step, step)
+                return
+        self._runs.append(run)
+
+    def __len__(self) -> int:
+        return self._length
+
+    def __iter__(self) -> Iterator[int]:
+        return chain.from_iterable(self._runs)
+
+    def __contains__(self, value: object) -> bool:
+        if not isinstance(value, int):
+            return False
+        lows, highs = self._intervals()
+        index = bisect_right(lows, value) - 1
+        return index >= 0 and highs[index] >= value
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            return list(self)[index]
+        if index < 0:
+            index += self._length
+        if not 0 <= index < self._length:
+            raise IndexError("IdRuns index out of range")
+        for run in self._runs:
+            if index < len(run):
+                return run[index]
+            index -= len(run)
+        raise IndexError("IdRuns index out of range")
+
+    def __eq__(self, other: object) -> bool:
+        if isinstance(other, IdRuns):
+            return self._runs == other._runs
+        if isinstance(other, list):
+            return list(self) == other
+        return NotImplemented
+
+    __hash__ = None  # type: ignore[assignment]
+
+    def __repr__(self) -> str:
+        return repr(list(self))
+
+
+def _expand_id_runs(value: Any) -> Any:
+    """`value` with every IdRuns inside its dicts and lists replaced by a list."""
+    if isinstance(value, IdRuns):
+        return list(value)
+    if isinstance(value, dict):
+        return {key: _expand_id_runs(item) for key, item in value.items()}
+    if isinstance(value, list):
+        return [_expand_id_runs(item) for item in value]
+    return value
 
 
 def parse_id_spec(tokens: Iterable[str]) -> Dict[str, Any]:
-    cleaned_tokens = [_clean_token(token) for token in tokens if _clean_token(token)]
-    ids: List[int] = []
-    seen_ids: set = set()
+    cleaned_tokens = [cleaned for cleaned in (token.strip().strip(",") for token in tokens) if cleaned]
+    is_int = [bool(_INT_RE.match(token)) for token in cleaned_tokens]
+    ids = IdRuns()
+    singles: List[int] = []  # Pending single ids, added to `ids` in bulk.
     ranges: List[Tuple[int, int]] = []
     groups: List[str] = []
     unparsed: List[str] = []
     all_selected = False
 
     i = 0
-    while i < len(cleaned_tokens):
+    count = len(cleaned_tokens)
+    while i < count:
         token = cleaned_tokens[i]
-        upper = token.upper()
-
-        if upper in {"MEMB", "MEMBER", "JOINT", "ELEMENT", "PLATE", "LIST"}:
-            i += 1
-            continue
-
-        if upper == "ALL":
-            all_selected = True
-            i += 1
-            continue
-
-        if token.startswith("_"):
-            groups.append(token)
-            i += 1
-            continue
 
-        if _is_int_token(token):
+        if is_int[i]:
             start = int(token)
-            if (
-                i + 2 < len(cleaned_tokens)
-                and cleaned_tokens[i + 1].upper() == "TO"
-                and _is_int_token(cleaned_tokens[i + 2])
-            ):
+            if i + 2 < count and is_int[i + 2] and cleaned_tokens[i + 1].upper() == "TO":
                 end = int(cleaned_tokens[i + 2])
                 ranges.append((start, end))
                 if abs(end - start) <= _MAX_RANGE_SPAN:
-                    for value in _expand_range(start, end):
-                        if value not in seen_ids:
-                            seen_ids.add(value)
-                            ids.append(value)
+                    if singles:
+                        ids.extend(singles)
+                        singles = []
+                    ids.add_range(start, end)
                 i += 3
             else:
-                if start not in seen_ids:
-                    seen_ids.add(start)
-                    ids.append(start)
+                singles.append(start)
                 i += 1
             continue
 
-        if upper == "TO":
+        upper = token.upper()
+        if upper in {"MEMB", "MEMBER", "JOINT", "ELEMENT", "PLATE", "LIST"}:
+            pass
+        elif upper == "ALL":
+            all_selected = True
+        elif token.startswith("_"):
+            groups.append(token)
+        else:
             unparsed.append(token)
-            i += 1
-            continue
-
-        unparsed.append(token)
         i += 1
+    if singles:
+        ids.extend(singles)
 
     return {
         "raw": " ".join(cleaned_tokens),
@@ -418,16 +578,17 @@ def _target_kind_from_selector(selector: str, default: Optional[str] = None) ->
 
 
 def _decode_std_bytes(data: bytes) -> str:
+    # str(data, encoding) rather than data.decode(): the worker may pass a memoryview.
     encodings = ("utf-8-sig", "utf-8", "cp1252", "latin-1")
     last_error: Optional[Exception] = None
     for encoding in encodings:
         try:
-            return data.decode(encoding)
+            return str(data, encoding)
         except UnicodeDecodeError as exc:
             last_error = exc
     if last_error:
         raise last_error
-    return data.decode()
+    return str(data, "utf-8")
 
 
 def _read_text(path: Path) -> str:
@@ -435,26 +596,42 @@ def _read_text(path: Path) -> str:
 
 
 def _logical_records_from_text(text: str) -> Tuple[List[LogicalRecord], List[Dict[str, Any]]]:
+    # Single pass: each physical line is stripped once, and each record's
+    # whitespace is collapsed by splitting it into the tokens it keeps.
     records: List[LogicalRecord] = []
     comments: List[Dict[str, Any]] = []
     current_parts: List[str] = []
     current_raw: List[str] = []
     current_start: Optional[int] = None
 
+    def emit(end_line: int) -> None:
+        for part in " ".join(current_parts).split(";"):
+            tokens = part.split()
+            if tokens:
+                records.append(
+                    LogicalRecord(
+                        text=" ".join(tokens),
+                        start_line=current_start,
+                        end_line=end_line,
+                        raw_lines=list(current_raw),
+                        tokens=tokens,
+                    )
+                )
+
     for line_number, raw_line in enumerate(text.splitlines(), start=1):
         stripped = raw_line.strip()
         if not stripped:
             continue
 
         # "*" starts a comment; "<!" / "!>" bracket GUI-generated data blocks.
-        if stripped.startswith(("*", "<!", "!>")):
+        if stripped[0] == "*" or stripped.startswith(("<!", "!>")):
             comments.append({"line": line_number, "text": stripped})
             continue
 
         if current_start is None:
             current_start = line_number
 
-        continuation = stripped.endswith("-")
+        continuation = stripped[-1] == "-"
         if continuation:
             stripped = stripped[:-1].rstrip()
 
@@ -464,36 +641,13 @@ def _logical_records_from_text(text: str) -> Tuple[List[LogicalRecord], List[Dic
         if continuation:
             continue
 
-        combined = re.sub(r"\s+", " ", " ".join(current_parts)).strip()
-        if combined:
-            for part in combined.split(";"):
-                record_text = re.sub(r"\s+", " ", part.strip())
-                if record_text:
-                    records.append(
-                        LogicalRecord(
-                            text=record_text,
-                            start_line=current_start,
-                            end_line=line_number,
-                            raw_lines=list(current_raw),
-                        )
-                    )
+        emit(line_number)
         current_parts = []
         current_raw = []
         current_start = None
 
     if current_parts and current_start is not None:
-        combined = re.sub(r"\s+", " ", " ".join(current_parts)).strip()
-        for part in combined.split(";"):
-            record_text = re.sub(r"\s+", " ", part.strip())
-            if record_text:
-                records.append(
-                    LogicalRecord(
-                        text=record_text,
-                        start_line=current_start,
-                        end_line=current_start + len(current_raw) - 1,
-                        raw_lines=list(current_raw),
-                    )
-                )
+        emit(current_start + len(current_raw) - 1)
 
     return records, comments
 
@@ -1085,8 +1239,10 @@ def _parse_floor_load_details(tokens: List[str]) -> Dict[str, Any]:
     return details
 
 
-def _parse_load_item(kind: str, text: str, line: int) -> Dict[str, Any]:
-    tokens = text.split()
+def _parse_load_item(
+    kind: str, text: str, line: int, tokens: Optional[List[str]] = None
+) -> Dict[str, Any]:
+    tokens = tokens or text.split()
     upper_tokens = [token.upper() for token in tokens]
 
     if kind == "SELFWEIGHT":
@@ -1210,6 +1366,21 @@ def _parse_load_item(kind: str, text: str, line: int) -> Dict[str, Any]:
     return {"kind": kind, "line": line, "raw": text, "tokens": tokens}
 
 
+# Load items are independent of one another, so with processes > 1 they are
+# parsed by a process pool once the record pass is over (command line only; the
+# extension worker's sandbox has no multiprocessing and always parses inline).
+_MIN_POOLED_LOAD_ITEMS = 4096
+
+
+def _parse_load_item_job(
+    job: Tuple[str, str, int, List[str]]
+) -> Tuple[Optional[Dict[str, Any]], Optional[str]]:
+    try:
+        return _parse_load_item(*job), None
+    except Exception as exc:
+        return None, f"{type(exc).__name__}: {exc}"
+
+
 def _normalize_keyed_number_tokens(
     values: List[Any], unit_context: Optional[Dict[str, Any]], quantity: str
 ) -> List[Any]:
@@ -1382,6 +1553,14 @@ def _bounding_box(nodes: Dict[int, Tuple[float, float, float]]) -> Optional[Dict
 
 
 class STDFileReader:
+    def __init__(self, processes: int = 1) -> None:
+        self.processes = max(1, processes)
+        # (items list, slot, kind, record, unparsed_records length) per load item
+        # left for _resolve_load_items; only used when processes > 1.
+        self._pending_load_items: List[
+            Tuple[List[Dict[str, Any]], int, str, LogicalRecord, int]
+        ] = []
+
     def read(self, path: Union[str, Path]) -> STDModel:
         input_path = Path(path)
         return self.read_text(_read_text(input_path), source=input_path)
@@ -1408,11 +1587,13 @@ class STDFileReader:
         in_reference_loads = False
         current_design_block: Optional[Dict[str, Any]] = None
         active_unit_context: Optional[Dict[str, Any]] = None
+        # One read-only copy per UNIT command, shared by every line it governs.
+        line_unit_context: Optional[Dict[str, Any]] = None
 
         for record in records:
             text = record.text
             upper = text.upper()
-            tokens = text.split()
+            tokens = record.tokens or text.split()
 
             if not tokens:
                 continue
@@ -1420,10 +1601,11 @@ class STDFileReader:
             if upper.startswith("UNIT "):
                 active_unit_context = _parse_unit_record(text, record.start_line)
                 model.units.append(active_unit_context)
-                self._remember_unit_context(model, record, active_unit_context)
+                line_unit_context = _copy_unit_context(active_unit_context)
+                self._remember_unit_context(model, record, line_unit_context)
                 continue
 
-            self._remember_unit_context(model, record, active_unit_context)
+            self._remember_unit_context(model, record, line_unit_context)
 
             if upper.startswith("STAAD"):
                 model.title = text
@@ -1446,284 +1628,287 @@ class STDFileReader:
                 model.job_information[key] = value
                 continue
 
-            if upper.startswith("INPUT WIDTH"):
-                if len(tokens) >= 3 and _is_int_token(tokens[2]):
-                    model.input_width = int(tokens[2])
-                model.analysis_commands.append(
-                    {"line": record.start_line, "raw": text, "kind": "INPUT WIDTH"}
-                )
-                continue
-
-            if upper == "DEFINE REFERENCE LOADS":
-                in_reference_loads = True
-                current_section = "REFERENCE LOADS"
-                continue
-
-            if upper == "END DEFINE REFERENCE LOADS":
-                in_reference_loads = False
-                current_section = None
-                current_load = None
-                current_load_collection = None
-                current_load_subtype = None
-                continue
-
-            if upper == "DEFINE ENVELOPE":
-                current_section = "DEFINE ENVELOPE"
-                current_load = None
-                current_load_collection = None
-                current_load_subtype = None
-                current_combination = None
-                continue
+            # Data records (coordinates, incidences, load items) lead with a number
+            # or sign and can never match a section keyword, so skip the keyword chain.
+            if upper[0] not in _NUMERIC_LEAD:
+                if upper.startswith("INPUT WIDTH"):
+                    if len(tokens) >= 3 and _is_int_token(tokens[2]):
+                        model.input_width = int(tokens[2])
+                    model.analysis_commands.append(
+                        {"line": record.start_line, "raw": text, "kind": "INPUT WIDTH"}
+                    )
+                    continue
 
-            if upper == "END DEFINE ENVELOPE":
-                current_section = None
-                continue
+                if upper == "DEFINE REFERENCE LOADS":
+                    in_reference_loads = True
+                    current_section = "REFERENCE LOADS"
+                    continue
 
-            if upper.startswith("LOAD COMB "):
-                current_combination = _parse_load_combination_header(text, record.start_line)
-                combination_id = current_combination["id"]
-                if combination_id is None:
-                    model.unparsed_records.append(
-                        {
-                            "section": "LOAD COMBINATION",
-                            "line": record.start_line,
-                            "raw": text,
-                        }
-                    )
-                    current_combination = None
-                else:
-                    model.load_combinations[combination_id] = current_combination
-                    model.load_combination_order.append(combination_id)
-                current_section = "LOAD COMBINATION"
-                current_load = None
-                current_load_collection = None
-                current_load_subtype = None
-                continue
+                if upper == "END DEFINE REFERENCE LOADS":
+                    in_reference_loads = False
+                    current_section = None
+                    current_load = None
+                    current_load_collection = None
+                    current_load_subtype = None
+                    continue
 
-            if upper.startswith("LOAD ") and not upper.startswith("LOAD LIST"):
-                if len(tokens) > 1 and tokens[1].upper() not in {"COMB", "COMBINATION"}:
-                    current_load = _parse_load_header(text, record.start_line)
+                if upper == "DEFINE ENVELOPE":
+                    current_section = "DEFINE ENVELOPE"
+                    current_load = None
+                    current_load_collection = None
                     current_load_subtype = None
-                    if in_reference_loads:
-                        current_load_collection = model.reference_loads
-                        model.reference_load_order.append(current_load["id"])
-                    else:
-                        current_load_collection = model.loads
-                        model.load_case_order.append(current_load["id"])
-                    current_load_collection[current_load["id"]] = current_load
-                    current_section = "LOAD"
                     current_combination = None
                     continue
 
-            if upper == "JOINT COORDINATES":
-                current_section = "JOINT COORDINATES"
-                continue
-
-            if upper == "MEMBER INCIDENCES":
-                current_section = "MEMBER INCIDENCES"
-                continue
+                if upper == "END DEFINE ENVELOPE":
+                    current_section = None
+                    continue
 
-            if upper.startswith("ELEMENT INCIDENCES") or upper.startswith("PLATE INCIDENCES"):
-                current_section = "ELEMENT INCIDENCES"
-                continue
+                if upper.startswith("LOAD COMB "):
+                    current_combination = _parse_load_combination_header(text, record.start_line)
+                    combination_id = current_combination["id"]
+                    if combination_id is None:
+                        model.unparsed_records.append(
+                            {
+                                "section": "LOAD COMBINATION",
+                                "line": record.start_line,
+                                "raw": text,
+                            }
+                        )
+                        current_combination = None
+                    else:
+                        model.load_combinations[combination_id] = current_combination
+                        model.load_combination_order.append(combination_id)
+                    current_section = "LOAD COMBINATION"
+                    current_load = None
+                    current_load_collection = None
+                    current_load_subtype = None
+                    continue
 
-            if upper == "DEFINE PMEMBER":
-                current_section = "DEFINE PMEMBER"
-                continue
+                if upper.startswith("LOAD ") and not upper.startswith("LOAD LIST"):
+                    if len(tokens) > 1 and tokens[1].upper() not in {"COMB", "COMBINATION"}:
+                        current_load = _parse_load_header(text, record.start_line)
+                        current_load_subtype = None
+                        if in_reference_loads:
+                            current_load_collection = model.reference_loads
+                            model.reference_load_order.append(current_load["id"])
+                        else:
+                            current_load_collection = model.loads
+                            model.load_case_order.append(current_load["id"])
+                        current_load_collection[current_load["id"]] = current_load
+                        current_section = "LOAD"
+                        current_combination = None
+                        continue
+
+                if upper == "JOINT COORDINATES":
+                    current_section = "JOINT COORDINATES"
+                    continue
 
-            if upper == "START GROUP DEFINITION":
-                current_section = "GROUP DEFINITION"
-                current_group_kind = None
-                continue
+                if upper == "MEMBER INCIDENCES":
+                    current_section = "MEMBER INCIDENCES"
+                    continue
 
-            if upper == "END GROUP DEFINITION":
-                current_section = None
-                current_group_kind = None
-                continue
+                if upper.startswith("ELEMENT INCIDENCES") or upper.startswith("PLATE INCIDENCES"):
+                    current_section = "ELEMENT INCIDENCES"
+                    continue
 
-            if upper == "DEFINE MATERIAL START":
-                current_section = "DEFINE MATERIAL"
-                current_material = None
-                continue
+                if upper == "DEFINE PMEMBER":
+                    current_section = "DEFINE PMEMBER"
+                    continue
 
-            if upper == "END DEFINE MATERIAL":
-                current_section = None
-                current_material = None
-                continue
+                if upper == "START GROUP DEFINITION":
+                    current_section = "GROUP DEFINITION"
+                    current_group_kind = None
+                    continue
 
-            if upper == "START USER TABLE":
-                current_section = "USER TABLE"
-                model.user_tables.append({"line": record.start_line, "records": []})
-                continue
+                if upper == "END GROUP DEFINITION":
+                    current_section = None
+                    current_group_kind = None
+                    continue
 
-            if upper == "END" and current_section == "USER TABLE":
-                current_section = None
-                continue
+                if upper == "DEFINE MATERIAL START":
+                    current_section = "DEFINE MATERIAL"
+                    current_material = None
+                    continue
 
-            if upper.startswith("MEMBER PROPERTY"):
-                current_section = "MEMBER PROPERTY"
-                current_property_source = " ".join(tokens[2:]) if len(tokens) > 2 else ""
-                continue
+                if upper == "END DEFINE MATERIAL":
+                    current_section = None
+                    current_material = None
+                    continue
 
-            if upper.startswith("ELEMENT PROPERTY") or upper.startswith("PLATE PROPERTY"):
-                current_section = "ELEMENT PROPERTY"
-                prefix = "ELEMENT PROPERTY" if upper.startswith("ELEMENT PROPERTY") else "PLATE PROPERTY"
-                rest = text[len(prefix) :].strip()
-                if rest:
-                    self._add_element_property_record(model, rest, record.start_line)
-                continue
+                if upper == "START USER TABLE":
+                    current_section = "USER TABLE"
+                    model.user_tables.append({"line": record.start_line, "records": []})
+                    continue
 
-            if upper == "CONSTANTS":
-                current_section = "CONSTANTS"
-                continue
+                if upper == "END" and current_section == "USER TABLE":
+                    current_section = None
+                    continue
 
-            if upper == "SUPPORTS":
-                current_section = "SUPPORTS"
-                continue
+                if upper.startswith("MEMBER PROPERTY"):
+                    current_section = "MEMBER PROPERTY"
+                    current_property_source = " ".join(tokens[2:]) if len(tokens) > 2 else ""
+                    continue
 
-            if upper.startswith("MEMBER RELEASE"):
-                current_section = "MEMBER RELEASE"
-                rest = text[len("MEMBER RELEASE") :].strip()
-                if rest:
-                    model.member_releases.append(
-                        _parse_member_release_record(rest, record.start_line)
-                    )
-                continue
+                if upper.startswith("ELEMENT PROPERTY") or upper.startswith("PLATE PROPERTY"):
+                    current_section = "ELEMENT PROPERTY"
+                    prefix = "ELEMENT PROPERTY" if upper.startswith("ELEMENT PROPERTY") else "PLATE PROPERTY"
+                    rest = text[len(prefix) :].strip()
+                    if rest:
+                        self._add_element_property_record(model, rest, record.start_line)
+                    continue
 
-            if upper.startswith("MEMBER OFFSET"):
-                current_section = "MEMBER OFFSET"
-                rest = text[len("MEMBER OFFSET") :].strip()
-                if rest:
-                    self._add_member_offset_record(model, rest, record.start_line)
-                continue
+                if upper == "CONSTANTS":
+                    current_section = "CONSTANTS"
+                    continue
 
-            if upper.startswith("MEMBER FIREPROOFING"):
-                current_section = "MEMBER FIREPROOFING"
-                rest = text[len("MEMBER FIREPROOFING") :].strip()
-                if rest:
-                    self._add_member_fireproofing_record(model, rest, record.start_line)
-                continue
+                if upper == "SUPPORTS":
+                    current_section = "SUPPORTS"
+                    continue
 
-            if upper.startswith("ELEMENT PLANE"):
-                current_section = "ELEMENT PLANE STRESS"
-                continue
+                if upper.startswith("MEMBER RELEASE"):
+                    current_section = "MEMBER RELEASE"
+                    rest = text[len("MEMBER RELEASE") :].strip()
+                    if rest:
+                        model.member_releases.append(
+                            _parse_member_release_record(rest, record.start_line)
+                        )
+                    continue
 
-            if upper.startswith("INACTIVE "):
-                model.analysis_commands.append(
-                    {
-                        "line": record.start_line,
-                        "raw": text,
-                        "kind": "INACTIVE",
-                        "target": parse_id_spec(tokens[1:]),
-                    }
-                )
-                continue
+                if upper.startswith("MEMBER OFFSET"):
+                    current_section = "MEMBER OFFSET"
+                    rest = text[len("MEMBER OFFSET") :].strip()
+                    if rest:
+                        self._add_member_offset_record(model, rest, record.start_line)
+                    continue
 
-            if upper.startswith("DEFINE WIND"):
-                model.wind_definitions.append(
-                    {"line": record.start_line, "raw": text, "records": []}
-                )
-                current_section = "DEFINE WIND"
-                continue
+                if upper.startswith("MEMBER FIREPROOFING"):
+                    current_section = "MEMBER FIREPROOFING"
+                    rest = text[len("MEMBER FIREPROOFING") :].strip()
+                    if rest:
+                        self._add_member_fireproofing_record(model, rest, record.start_line)
+                    continue
 
-            if upper.startswith("MEMBER TRUSS"):
-                current_section = "MEMBER TRUSS"
-                rest = text[len("MEMBER TRUSS") :].strip()
-                if rest:
-                    model.member_truss.append(
-                        {
-                            "line": record.start_line,
-                            "raw": rest,
-                            "members": parse_id_spec(rest.split()),
-                        }
-                    )
-                continue
+                if upper.startswith("ELEMENT PLANE"):
+                    current_section = "ELEMENT PLANE STRESS"
+                    continue
 
-            if upper.startswith("MEMBER TENSION"):
-                current_section = "MEMBER TENSION"
-                rest = text[len("MEMBER TENSION") :].strip()
-                if rest:
-                    model.member_tension.append(
+                if upper.startswith("INACTIVE "):
+                    model.analysis_commands.append(
                         {
                             "line": record.start_line,
-                            "raw": rest,
-                            "members": parse_id_spec(rest.split()),
+                            "raw": text,
+                            "kind": "INACTIVE",
+                            "target": parse_id_spec(tokens[1:]),
                         }
                     )
-                continue
+                    continue
 
-            if upper.startswith("MEMBER COMPRESSION"):
-                current_section = "MEMBER COMPRESSION"
-                rest = text[len("MEMBER COMPRESSION") :].strip()
-                if rest:
-                    model.member_compression.append(
-                        {
-                            "line": record.start_line,
-                            "raw": rest,
-                            "members": parse_id_spec(rest.split()),
-                        }
+                if upper.startswith("DEFINE WIND"):
+                    model.wind_definitions.append(
+                        {"line": record.start_line, "raw": text, "records": []}
                     )
-                continue
+                    current_section = "DEFINE WIND"
+                    continue
 
-            if upper.startswith("PARAMETER"):
-                block_number: Union[int, str] = (
-                    int(tokens[1]) if len(tokens) > 1 and _is_int_token(tokens[1]) else len(model.design_blocks) + 1
-                )
-                current_design_block = {
-                    "id": block_number,
-                    "context": "PARAMETER",
-                    "line": record.start_line,
-                    "raw": text,
-                    "parameters": [],
-                }
-                model.design_blocks.append(current_design_block)
-                current_section = "DESIGN PARAMETERS"
-                continue
+                if upper.startswith("MEMBER TRUSS"):
+                    current_section = "MEMBER TRUSS"
+                    rest = text[len("MEMBER TRUSS") :].strip()
+                    if rest:
+                        model.member_truss.append(
+                            {
+                                "line": record.start_line,
+                                "raw": rest,
+                                "members": parse_id_spec(rest.split()),
+                            }
+                        )
+                    continue
 
-            if upper == "START CONCRETE DESIGN":
-                current_design_block = {
-                    "id": "CONCRETE DESIGN",
-                    "context": "CONCRETE DESIGN",
-                    "line": record.start_line,
-                    "raw": text,
-                    "parameters": [],
-                }
-                model.design_blocks.append(current_design_block)
-                current_section = "CONCRETE DESIGN"
-                continue
+                if upper.startswith("MEMBER TENSION"):
+                    current_section = "MEMBER TENSION"
+                    rest = text[len("MEMBER TENSION") :].strip()
+                    if rest:
+                        model.member_tension.append(
+                            {
+                                "line": record.start_line,
+                                "raw": rest,
+                                "members": parse_id_spec(rest.split()),
+                            }
+                        )
+                    continue
 
-            if upper == "END CONCRETE DESIGN":
-                current_section = None
-                current_design_block = None
-                continue
+                if upper.startswith("MEMBER COMPRESSION"):
+                    current_section = "MEMBER COMPRESSION"
+                    rest = text[len("MEMBER COMPRESSION") :].strip()
+                    if rest:
+                        model.member_compression.append(
+                            {
+                                "line": record.start_line,
+                                "raw": rest,
+                                "members": parse_id_spec(rest.split()),
+                            }
+                        )
+                    continue
 
-            if upper == "FINISH":
-                model.analysis_commands.append(
-                    {"line": record.start_line, "raw": text, "kind": "FINISH"}
-                )
-                current_section = None
-                continue
+                if upper.startswith("PARAMETER"):
+                    block_number: Union[int, str] = (
+                        int(tokens[1]) if len(tokens) > 1 and _is_int_token(tokens[1]) else len(model.design_blocks) + 1
+                    )
+                    current_design_block = {
+                        "id": block_number,
+                        "context": "PARAMETER",
+                        "line": record.start_line,
+                        "raw": text,
+                        "parameters": [],
+                    }
+                    model.design_blocks.append(current_design_block)
+                    current_section = "DESIGN PARAMETERS"
+                    continue
 
-            if self._is_analysis_command(upper):
-                model.analysis_commands.append(
-                    {
+                if upper == "START CONCRETE DESIGN":
+                    current_design_block = {
+                        "id": "CONCRETE DESIGN",
+                        "context": "CONCRETE DESIGN",
                         "line": record.start_line,
                         "raw": text,
-                        "kind": tokens[0].upper(),
+                        "parameters": [],
                     }
-                )
-                if upper.startswith("LOAD LIST"):
-                    if current_design_block is not None:
-                        parameter = _parse_parameter_record(
-                            text,
-                            record.start_line,
-                            current_design_block["id"],
-                            current_design_block["context"],
-                            default_target_kind="LOAD",
-                        )
-                        current_design_block["parameters"].append(parameter)
-                        model.design_parameters.append(parameter)
-                continue
+                    model.design_blocks.append(current_design_block)
+                    current_section = "CONCRETE DESIGN"
+                    continue
+
+                if upper == "END CONCRETE DESIGN":
+                    current_section = None
+                    current_design_block = None
+                    continue
+
+                if upper == "FINISH":
+                    model.analysis_commands.append(
+                        {"line": record.start_line, "raw": text, "kind": "FINISH"}
+                    )
+                    current_section = None
+                    continue
+
+                if self._is_analysis_command(upper):
+                    model.analysis_commands.append(
+                        {
+                            "line": record.start_line,
+                            "raw": text,
+                            "kind": tokens[0].upper(),
+                        }
+                    )
+                    if upper.startswith("LOAD LIST"):
+                        if current_design_block is not None:
+                            parameter = _parse_parameter_record(
+                                text,
+                                record.start_line,
+                                current_design_block["id"],
+                                current_design_block["context"],
+                                default_target_kind="LOAD",
+                            )
+                            current_design_block["parameters"].append(parameter)
+                            model.design_parameters.append(parameter)
+                    continue
 
             try:
                 if current_section == "JOINT COORDINATES":
@@ -1836,7 +2021,7 @@ class STDFileReader:
                     )
                 elif current_section == "LOAD" and current_load is not None:
                     current_load_subtype = self._parse_load_record(
-                        current_load, record, current_load_subtype
+                        model, current_load, record, current_load_subtype
                     )
                 elif current_section == "LOAD COMBINATION" and current_combination is not None:
                     components = _parse_combination_components(text)
@@ -1881,6 +2066,7 @@ class STDFileReader:
                     }
                 )
 
+        self._resolve_load_items(model)
         self._normalize_model_units(model)
         self._build_design_indexes(model)
         model.support_nodes = sorted(set(model.support_nodes))
@@ -1892,9 +2078,8 @@ class STDFileReader:
         record: LogicalRecord,
         unit_context: Optional[Dict[str, Any]],
     ) -> None:
-        copied = _copy_unit_context(unit_context)
         for line in range(record.start_line, record.end_line + 1):
-            model.unit_context_by_line[line] = copied
+            model.unit_context_by_line[line] = unit_context
 
     @staticmethod
     def _parse_job_information_line(text: str) -> Tuple[str, str]:
@@ -2124,8 +2309,9 @@ class STDFileReader:
         model.materials[current_material]["raw"].append(record.text)
         return current_material
 
-    @staticmethod
     def _parse_load_record(
+        self,
+        model: STDModel,
         current_load: Dict[str, Any],
         record: LogicalRecord,
         current_load_subtype: Optional[str],
@@ -2147,9 +2333,7 @@ class STDFileReader:
             return upper
 
         if upper.startswith("SELFWEIGHT"):
-            current_load["items"].append(
-                _parse_load_item("SELFWEIGHT", text, record.start_line)
-            )
+            self._add_load_item(model, current_load, "SELFWEIGHT", record)
             return current_load_subtype
 
         if upper.startswith("SPECTRUM"):
@@ -2176,15 +2360,64 @@ class STDFileReader:
             return current_load_subtype
 
         if current_load_subtype:
-            current_load["items"].append(
-                _parse_load_item(current_load_subtype, text, record.start_line)
-            )
+            self._add_load_item(model, current_load, current_load_subtype, record)
         else:
             current_load["items"].append(
                 {"kind": "COMMAND", "line": record.start_line, "raw": text}
             )
         return current_load_subtype
 
+    def _add_load_item(
+        self, model: STDModel, current_load: Dict[str, Any], kind: str, record: LogicalRecord
+    ) -> None:
+        items = current_load["items"]
+        if self.processes == 1:
+            items.append(_parse_load_item(kind, record.text, record.start_line, record.tokens))
+            return
+        self._pending_load_items.append(
+            (items, len(items), kind, record, len(model.unparsed_records))
+        )
+        items.append({})
+
+    def _resolve_load_items(self, model: STDModel) -> None:
+        pending, self._pending_load_items = self._pending_load_items, []
+        if not pending:
+            return
+        jobs = [
+            (kind, record.text, record.start_line, record.tokens)
+            for _, _, kind, record, _ in pending
+        ]
+        results = None
+        if len(jobs) >= _MIN_POOLED_LOAD_ITEMS:
+            try:
+                import multiprocessing
+
+                with multiprocessing.Pool(self.processes) as pool:
+                    chunk = max(1, len(jobs) // (self.processes * 8))
+                    results = pool.map(_parse_load_item_job, jobs, chunksize=chunk)
+            except OSError:
+                results = None  # No pool on this platform: parse inline below.
+        if results is None:
+            results = [_parse_load_item_job(job) for job in jobs]
+
+        # A failed item leaves its load, and its retained record lands where the
+        # inline parse would have put it in unparsed_records.
+        failed_lists: Dict[int, List[Dict[str, Any]]] = {}
+        inserted = 0
+        for (items, slot, _, record, unparsed_at), (item, error) in zip(pending, results):
+            if error is None:
+                items[slot] = item
+                continue
+            items[slot] = None
+            failed_lists[id(items)] = items
+            model.unparsed_records.insert(
+                unparsed_at + inserted,
+                {"section": "LOAD", "line": record.start_line, "raw": record.text, "error": error},
+            )
+            inserted += 1
+        for items in failed_lists.values():
+            items[:] = [item for item in items if item is not None]
+
     @staticmethod
     def _unit_for_line(model: STDModel, line: Optional[int]) -> Optional[Dict[str, Any]]:
         if line is None:
@@ -2343,8 +2576,8 @@ class STDFileReader:
         model.design_parameters_by_group = dict(by_group)
 
 
-def read_std_file(path: Union[str, Path]) -> STDModel:
-    return STDFileReader().read(path)
+def read_std_file(path: Union[str, Path], processes: int = 1) -> STDModel:
+    return STDFileReader(processes).read(path)
 
 
 def read_std_text(text: str, source: Union[str, Path] = "<memory>") -> STDModel:
@@ -2510,6 +2743,12 @@ def print_statistics(
                 )
 
 
+def _json_default(value: Any) -> Any:
+    if isinstance(value, IdRuns):
+        return list(value)
+    return str(value)
+
+
 def main(argv: Optional[List[str]] = None) -> int:
     parser = argparse.ArgumentParser(description="Read a .std file and print statistics.")
     parser.add_argument("--file", required=True, help="Path to the .std file to read.")
@@ -2538,15 +2777,28 @@ def main(argv: Optional[List[str]] = None) -> int:
         action="store_true",
         help="Include normalized source records when used with --dump-json.",
     )
+    parser.add_argument(
+        "-j",
+        "--processes",
+        type=int,
+        default=1,
+        help="Parse load items of large files with this many processes.",
+    )
     args = parser.parse_args(argv)
 
     try:
-        model = read_std_file(args.file)
+        model = read_std_file(args.file, processes=args.processes)
     except OSError as exc:
         print(f"Error: cannot read '{args.file}': {exc}", file=sys.stderr)
         return 1
     if args.dump_json:
-        print(json.dumps(model.to_dict(include_records=args.include_records), indent=2, default=str))
+        print(
+            json.dumps(
+                model.to_dict(include_records=args.include_records),
+                indent=2,
+                default=_json_default,
+            )
+        )
     else:
         print_statistics(
             model,
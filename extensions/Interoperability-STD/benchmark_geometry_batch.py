@@ -0,0 +1,155 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# Encode, decode and import time of one large STD model's CreateGeometryBatch stream, with this
+# script standing in for both sides: the worker sends every node, then every member, in
+# host-sized batches into memory, and the host decodes each batch and resolves every member to its
+# endpoint coordinates and profile designation, as ImportStdFileIntoTab needs them.
+#   rows:     a StructuralNode / StructuralMember submessage each, built with the protobuf
+#             runtime (how send_geometry_batch sent them before the columns), resolved by node id;
+#   columnar: vishwakarma_api's send_geometry_batch (StructuralNodeColumns /
+#             StructuralMemberColumns), resolved by node index and the batch's string table.
+# Both must import the same members. The host here is Python; the C++ host decodes with
+# libprotobuf, so only the relative decode and import times carry over. The frozen worker runs the
+# pure-Python protobuf runtime: set PROTOCOL_BUFFERS_PYTHON_IMPLEMENTATION=python to measure it.
+# Run with: python benchmark_geometry_batch.py [members]   (from this folder; needs protoc on PATH
+# to generate ExtensionIPC_pb2 as DeployExtensions.ps1 does)
+
+import io
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PROTO_DIR = os.path.join(HERE, '..', '..', 'code-core')
+
+MAX_BATCH_ENTITIES = 4096  # kMaxImportBatchEntities, ExtensionCommunications.h
+DESIGNATIONS = ('W12X26', 'ISMB300', '', 'HE200A')
+
+
+def synthetic_model(member_count):
+    """A chain of `member_count` members over member_count + 1 nodes: rolled sections, unmapped
+    ones and parametric (PRIS) ones, as main.py hands them to send_geometry_batch."""
+    nodes = [(i, i * 0.5, -1.0 * (i % 7), 0.25 * (i % 3)) for i in range(1, member_count + 2)]
+    members = []
+    for i in range(1, member_count + 1):
+        kind = i % 5
+        if kind == 4:
+            members.append((i, i, i + 1, 'PRIS', 0.3, 0.2))
+        elif kind == 3:
+            members.append((i, i, i + 1))
+        else:
+            members.append((i, i, i + 1, DESIGNATIONS[kind]))
+    return nodes, members
+
+
+def send_rows(pb, channel, nodes, members):
+    message = pb.WorkerToHost()
+    batch = message.create_geometry_batch
+    for node_id, x, y, z in nodes:
+        node = batch.nodes.add()
+        node.node_id = node_id
+        node.x = x
+        node.y = y
+        node.z = z
+    for entry in members:
+        member = batch.members.add()
+        member.member_id = entry[0]
+        member.start_node_id = entry[1]
+        member.end_node_id = entry[2]
+        if len(entry) > 3 and entry[3]:
+            member.profile_designation = entry[3]
+        if len(entry) > 5:
+            member.user_parameter1 = entry[4]
+            member.user_parameter2 = entry[5]
+    channel._send(message)
+
+
+def batches(pb, stream):
+    data = stream.getvalue()
+    offset = 0
+    while offset < len(data):
+        (length,) = struct.unpack_from('<I', data, offset)
+        message = pb.WorkerToHost()
+        message.ParseFromString(data[offset + 4:offset + 4 + length])
+        offset += 4 + length
+        yield message.create_geometry_batch
+
+
+def import_rows(decoded):
+    positions = {}
+    imported = []
+    for batch in decoded:
+        for node in batch.nodes:
+            positions.setdefault(node.node_id, (node.x, node.y, node.z))
+        for member in batch.members:
+            start = positions.get(member.start_node_id)
+            end = positions.get(member.end_node_id)
+            if start is not None and end is not None:
+                imported.append((member.member_id, start, end, member.profile_designation,
+                                 member.user_parameter1, member.user_parameter2))
+    return imported
+
+
+def import_columns(decoded):
+    positions = []  # By node index: every node of the stream, duplicates included.
+    imported = []
+    for batch in decoded:
+        nodes = batch.node_columns
+        xyz = nodes.coordinates
+        positions.extend(zip(xyz[0::3], xyz[1::3], xyz[2::3]))
+        members = batch.member_columns
+        table = list(members.profile_designations)
+        indices = members.node_indices
+        parameters = members.user_parameters
+        for k, (member_id, profile) in enumerate(zip(members.member_ids, members.profile_indices)):
+            imported.append((member_id, positions[indices[2 * k]], positions[indices[2 * k + 1]],
+                             table[profile], parameters[2 * k] if parameters else 0.0,
+                             parameters[2 * k + 1] if parameters else 0.0))
+    return imported
+
+
+def main():
+    member_count = int(sys.argv[1]) if len(sys.argv) > 1 else 1_000_000
+
+    with tempfile.TemporaryDirectory() as generated:
+        subprocess.run(['protoc', f'--proto_path={PROTO_DIR}', f'--python_out={generated}',
+                        os.path.join(PROTO_DIR, 'ExtensionIPC.proto')], check=True)
+        sys.path.insert(0, generated)
+        import ExtensionIPC_pb2 as pb
+        import vishwakarma_api as vk
+        from google.protobuf.internal import api_implementation
+
+    nodes, members = synthetic_model(member_count)
+    print(f'{len(nodes)} nodes, {len(members)} members, protobuf {api_implementation.Type()} runtime')
+    imported = {}
+    for label, send, resolve in (('rows:', send_rows, import_rows),
+                                 ('columnar:', None, import_columns)):
+        channel = vk.HostChannel()
+        channel._out = stream = io.BytesIO()
+        start = time.perf_counter()
+        for items, as_nodes in ((nodes, True), (members, False)):
+            for first in range(0, len(items), MAX_BATCH_ENTITIES):
+                chunk = items[first:first + MAX_BATCH_ENTITIES]
+                arguments = (chunk, []) if as_nodes else ([], chunk)
+                if send is None:
+                    channel.send_geometry_batch(*arguments)
+                else:
+                    send(pb, channel, *arguments)
+        encode = time.perf_counter() - start
+        start = time.perf_counter()
+        decoded = list(batches(pb, stream))
+        decode = time.perf_counter() - start
+        start = time.perf_counter()
+        imported[label] = resolve(decoded)
+        resolved = time.perf_counter() - start
+        print(f'  {label:10} encode {encode:.2f} s, decode {decode:.2f} s, import {resolved:.2f} s, '
+              f'{len(stream.getvalue()) / (1024 * 1024):.1f} MB')
+
+    if imported['rows:'] != imported['columnar:'] or len(imported['rows:']) != len(members):
+        raise SystemExit('the row and columnar batches imported different members')
+
+
+if __name__ == '__main__':
+    main()
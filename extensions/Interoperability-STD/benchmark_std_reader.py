@@ -0,0 +1,62 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# Reading a generated STD file of 100k members and 500 load cases (synthetic_std), each way in a
+# fresh process: with load items parsed inline and in a pool of 2 and 4 processes. Reports wall
+# time and peak RSS (VmHWM; the reading process's own, pool workers not counted), and fails if the
+# reads disagree on the loads.
+# Run with: python benchmark_std_reader.py [members] [load_cases]   (from this folder, on Linux)
+
+import hashlib
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+from InteroperabilityWithSTDFile import read_std_file
+from test_InteroperabilityWithSTDFile import synthetic_std
+
+
+def peak_rss_megabytes():
+    with open('/proc/self/status') as status:
+        for line in status:
+            if line.startswith('VmHWM:'):
+                return int(line.split()[1]) / 1024
+    return 0.0
+
+
+def child(path, processes):
+    """Reads `path`; prints seconds, peak MB and a digest of the loads."""
+    start = time.perf_counter()
+    model = read_std_file(path, processes)
+    seconds = time.perf_counter() - start
+    loads = json.dumps(model.to_dict(compact_ids=True)['loads'], default=list, sort_keys=True)
+    print(f'{seconds} {peak_rss_megabytes()} {hashlib.sha256(loads.encode()).hexdigest()}')
+
+
+def main():
+    members = int(sys.argv[1]) if len(sys.argv) > 1 else 100_000
+    load_cases = int(sys.argv[2]) if len(sys.argv) > 2 else 500
+
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, 'frame.std')
+        with open(path, 'w') as fh:
+            fh.write(synthetic_std(members, load_cases))
+        print(f'{members} members, {load_cases} load cases, {os.path.getsize(path) / (1024 * 1024):.1f} MB, '
+              f'{os.cpu_count()} CPUs')
+        digests = set()
+        for processes in (1, 2, 4):
+            seconds, peak, digest = subprocess.run(
+                [sys.executable, __file__, '--child', path, str(processes)], check=True,
+                capture_output=True, text=True).stdout.split()
+            digests.add(digest)
+            print(f'  {processes} process(es): {float(seconds):.2f} s, peak RSS {float(peak):.0f} MB')
+    if len(digests) != 1:
+        raise SystemExit('the reads disagree on the loads')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) > 1 and sys.argv[1] == '--child':
+        child(sys.argv[2], int(sys.argv[3]))
+    else:
+        main()
@@ -16,7 +16,6 @@ import vishwakarma_api as vk
 import InteroperabilityWithSTDFile as std_reader
 import profile_mapping
 
-BATCH_SIZE = 5000
 UINT32_MAX = 0xFFFFFFFF
 
 
@@ -43,12 +42,9 @@ def _member_entry(member_id, start_id, end_id, profile):
     return (member_id, start_id, end_id, "")
 
 
-def run() -> None:
-    channel = vk.HostChannel()
-    request = channel.recv_import_request()
-
+def import_file(channel: vk.HostChannel, request) -> None:
     try:
-        model = std_reader.read_std_bytes(request.file_bytes, request.file_name)
+        model = std_reader.read_std_bytes(channel.request_file_data(request), request.file_name)
     except Exception as exc:  # Parser failure must reach the host, not crash silently.
         channel.send_result(False, f"Failed to parse '{request.file_name}': {exc}")
         return
@@ -79,14 +75,29 @@ def run() -> None:
         + (f" ({skipped_members} members skipped: missing/invalid node refs)" if skipped_members else "")
     )
 
-    for start in range(0, len(nodes), BATCH_SIZE):
-        channel.send_geometry_batch(nodes[start:start + BATCH_SIZE], [])
-    for start in range(0, len(members), BATCH_SIZE):
-        channel.send_geometry_batch([], members[start:start + BATCH_SIZE])
+    # All nodes go first: the host imports batches as they arrive and drops a
+    # member whose nodes it has not seen yet.
+    batch_size = channel.batch_entities(request)
+    for start in range(0, len(nodes), batch_size):
+        channel.send_geometry_batch(nodes[start:start + batch_size], [])
+    for start in range(0, len(members), batch_size):
+        channel.send_geometry_batch([], members[start:start + batch_size])
 
     channel.send_result(True, "", len(nodes), len(members))
 
 
+def run() -> None:
+    # Pooled, warm worker: the imports above ran once at spawn; each request is
+    # one job, and a closed pipe means the host is done with this worker.
+    channel = vk.HostChannel()
+    while True:
+        request = channel.recv_import_request()
+        if request is None:
+            return
+        import_file(channel, request)
+        channel.finish_request()
+
+
 if __name__ == "__main__":
     try:
         run()
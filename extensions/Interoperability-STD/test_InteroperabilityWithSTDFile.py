@@ -0,0 +1,182 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# STDModel.to_dict: the expanded (default) and compact id representations must describe the same
+# model, and the default one must go straight through json.dumps. The single-pass reader must give
+# the output the per-record reader gave before it, and pooled load items the serial ones.
+# Run with: python -m unittest test_InteroperabilityWithSTDFile   (from this folder)
+
+import hashlib
+import json
+import os
+import random
+import tempfile
+import unittest
+from unittest import mock
+
+import InteroperabilityWithSTDFile as std
+from InteroperabilityWithSTDFile import IdRuns, _json_default, parse_id_spec, read_std_file, read_std_text
+
+SAMPLE_STD = """STAAD SPACE
+UNIT METER KN
+JOINT COORDINATES
+1 0 0 0; 2 5 0 0; 3 10 0 0; 4 15 0 0;
+MEMBER INCIDENCES
+1 1 2; 2 2 3; 3 3 4;
+MEMBER PROPERTY AMERICAN
+1 TO 3 TABLE ST W12X26
+SUPPORTS
+1 4 FIXED
+START GROUP DEFINITION
+MEMBER
+_BEAMS 3 TO 1
+END GROUP DEFINITION
+LOAD 1 LOADTYPE Dead TITLE DL
+MEMBER LOAD
+1 TO 3 UNI GY -1
+PERFORM ANALYSIS
+FINISH
+"""
+
+
+def synthetic_std(members: int, load_cases: int) -> str:
+    """A frame of `members` members in a line with groups, properties, supports and releases,
+    then `load_cases` load cases of member, joint and selfweight loads written in every id spec
+    form (ranges either way, lists, continuation lines, groups) and a mid-file UNIT change."""
+    nodes = members + 1
+    lines = ["STAAD SPACE", "START JOB INFORMATION", "ENGINEER DATE 01-Jan-26", "END JOB INFORMATION",
+             "INPUT WIDTH 79", "UNIT METER KN", "JOINT COORDINATES"]
+    lines += [f"{n} {n * 0.5} {n % 11 * 1.0} {n % 3 * 2.0};" for n in range(1, nodes + 1)]
+    lines.append("MEMBER INCIDENCES")
+    lines += [f"{m} {m} {m + 1};" for m in range(1, members + 1)]
+    half = members // 2
+    lines += ["START GROUP DEFINITION", "MEMBER", f"_LOWER 1 TO {half}", f"_UPPER {members} TO {half + 1}",
+              "END GROUP DEFINITION",
+              "DEFINE MATERIAL START", "ISOTROPIC STEEL", "E 2.05e+08", "POISSON 0.3", "DENSITY 76.8195",
+              "END DEFINE MATERIAL",
+              "MEMBER PROPERTY AMERICAN", f"1 TO {half} TABLE ST W12X26",
+              f"{half + 1} TO {members - 1} TABLE ST W10X12", f"{members} PRIS YD 0.3 ZD 0.2",
+              "CONSTANTS", "MATERIAL STEEL ALL",
+              "SUPPORTS", f"1 {nodes} FIXED", f"2 TO 20 PINNED",
+              "MEMBER RELEASE", "5 7 9 START MZ",
+              "UNIT MMS KN"]
+    for case in range(1, load_cases + 1):
+        lines.append(f"LOAD {case} LOADTYPE {('Dead', 'Live', 'Wind')[case % 3]} TITLE CASE {case}")
+        if case % 5 == 1:
+            lines.append("SELFWEIGHT Y -1")
+        lines.append("MEMBER LOAD")
+        first = case * 37 % members + 1
+        lines.append(f"{first} TO {min(members, first + 400)} UNI GY -{case % 7 + 1}")
+        lines.append(f"{first} {first + 2} {first + 4} -")
+        lines.append(f"{first + 6} CON GY -3 {case % 4 * 100}")
+        lines.append(f"_UPPER LIN Y -2 -4")
+        lines.append(f"{min(members, first + 9)} TO {first} TRAP GY -1 -2 0 500")
+        lines.append("JOINT LOAD")
+        lines.append(f"{case % nodes + 1} {case * 3 % nodes + 1} FY -{case % 9 + 1} MZ 2.5")
+    lines += ["LOAD COMB 1001 COMBINATION", "1 1.2 2 1.6 3 0.5",
+              "UNIT METER KN", "PERFORM ANALYSIS",
+              "PARAMETER 1", "CODE AISC UNIFIED 2010", f"FYLD 345000 MEMB 1 TO {members}",
+              f"LY 3 MEMB _LOWER", "CHECK CODE ALL", "FINISH"]
+    return "\n".join(lines) + "\n"
+
+
+def _id_runs_in(value):
+    """Every IdRuns nested anywhere in `value`."""
+    if isinstance(value, IdRuns):
+        return [value]
+    if isinstance(value, dict):
+        value = list(value.values())
+    if isinstance(value, (list, tuple)):
+        return [runs for item in value for runs in _id_runs_in(item)]
+    return []
+
+
+class ToDictTests(unittest.TestCase):
+    def setUp(self):
+        self.model = read_std_text(SAMPLE_STD)
+
+    def test_default_is_plain_json(self):
+        expanded = self.model.to_dict(include_records=True)
+        self.assertEqual(_id_runs_in(expanded), [])
+        json.dumps(expanded)  # No default= needed.
+
+    def test_compact_and_expanded_describe_the_same_model(self):
+        compact = self.model.to_dict(include_records=True, compact_ids=True)
+        self.assertEqual(len(_id_runs_in(compact)), 4)
+        with self.assertRaises(TypeError):
+            json.dumps(compact)
+        self.assertEqual(
+            json.dumps(self.model.to_dict(include_records=True)),
+            json.dumps(compact, default=_json_default))
+
+    def test_expanded_ids_are_the_list_form(self):
+        data = self.model.to_dict()
+        self.assertEqual(data["groups"]["MEMBER"]["_BEAMS"]["items"]["ids"], [3, 2, 1])
+        self.assertEqual(data["member_properties"][0]["members"]["ids"], [1, 2, 3])
+        self.assertEqual(data["supports"][0]["nodes"]["ids"], [1, 4])
+        self.assertEqual(data["loads"][1]["items"][0]["target"]["ids"], [1, 2, 3])
+
+    def test_long_range_stays_one_run_only_when_compact(self):
+        model = read_std_text(SAMPLE_STD.replace("_BEAMS 3 TO 1", "_BEAMS 1 TO 100000"))
+        compact = model.to_dict(compact_ids=True)["groups"]["MEMBER"]["_BEAMS"]["items"]["ids"]
+        expanded = model.to_dict()["groups"]["MEMBER"]["_BEAMS"]["items"]["ids"]
+        self.assertEqual(compact.runs, [range(1, 100001)])
+        self.assertEqual(expanded, list(range(1, 100001)))
+        self.assertEqual(compact, expanded)
+
+
+def _reference_ids(tokens):
+    """parse_id_spec's ids as the reader computed them before IdRuns: every range expanded in
+    its own direction, first occurrence kept."""
+    ids = []
+    i = 0
+    while i < len(tokens):
+        if tokens[i].lstrip("+-").isdigit():
+            start = int(tokens[i])
+            if i + 2 < len(tokens) and tokens[i + 1].upper() == "TO" and tokens[i + 2].lstrip("+-").isdigit():
+                end = int(tokens[i + 2])
+                ids += range(start, end + 1) if end >= start else range(start, end - 1, -1)
+                i += 3
+                continue
+            ids.append(start)
+        i += 1
+    return list(dict.fromkeys(ids))
+
+
+class DifferentialTests(unittest.TestCase):
+    # SHA-256 of json.dumps(to_dict(include_records=True), sort_keys=True) for synthetic_std(2000, 40)
+    # as read by the per-record reader, before the tokenizer, id runs and pooled load items.
+    BEFORE_TOKENIZER = "c537514f05c37f7a3033c0a68ccfb54ce0617b566410fd266a64f30cbcd2955f"
+
+    def test_output_matches_the_reader_before_tokenizing(self):
+        model = read_std_text(synthetic_std(2000, 40))
+        digest = hashlib.sha256(json.dumps(model.to_dict(include_records=True), sort_keys=True).encode())
+        self.assertEqual(digest.hexdigest(), self.BEFORE_TOKENIZER)
+
+    def test_pooled_load_items_equal_serial(self):
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, "frame.std")
+            with open(path, "w") as fh:
+                fh.write(synthetic_std(500, 60))
+            serial = read_std_file(path).to_dict(include_records=True)
+            with mock.patch.object(std, "_MIN_POOLED_LOAD_ITEMS", 0):
+                pooled = read_std_file(path, 3).to_dict(include_records=True)
+        self.assertEqual(json.dumps(pooled), json.dumps(serial))
+
+    def test_id_runs_match_expanded_ids(self):
+        rng = random.Random(34)
+        for _ in range(2000):
+            tokens = []
+            for _ in range(rng.randint(1, 8)):
+                low = rng.randint(-5, 60)
+                choice = rng.random()
+                if choice < 0.4:
+                    tokens += [str(low), "TO", str(low + rng.randint(-20, 20))]
+                elif choice < 0.8:
+                    tokens.append(str(low))
+                else:
+                    tokens.append(rng.choice(["MEMB", "ALL", "_G", "TO", "X"]))
+            with self.subTest(tokens=tokens):
+                self.assertEqual(list(parse_id_spec(tokens)["ids"]), _reference_ids(tokens))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -4,19 +4,66 @@
 Extensions talk to the host only through this module. It encapsulates the
 wire format (length-prefixed Protobuf Lite over the process stdin/stdout
 pipes) so the underlying IPC channel can change without breaking extensions.
+
+When the host offers shared memory, the input file arrives as a read-only view
+of the host's file mapping and outgoing batches are written into slots of a
+host-created result ring; the pipe then carries only slot numbers one way and
+slot credits the other. `_vkshm` is the worker executable's builtin for
+mapping those sections; without it (plain CPython) everything stays inline.
+
+Workers are pooled and kept warm by the host: an entry script loops on
+`recv_import_request()` until it returns None and calls `finish_request()`
+after every job.
 """
 
 from __future__ import annotations
 
+import gc
 import struct
 import sys
+from array import array
 
 import ExtensionIPC_pb2 as _pb
 
+try:
+    import _vkshm
+except ImportError:  # Not running inside VishwakarmaExtension.exe.
+    _vkshm = None
+
 # The host never sends a message larger than this; a bigger prefix means the
 # stream is corrupt, so fail fast instead of trying to allocate it.
 MAX_MESSAGE_BYTES = 256 * 1024 * 1024
 
+# Entities per result batch when the host states no bound (older hosts).
+DEFAULT_BATCH_ENTITIES = 4096
+
+# array typecode of a 4-byte unsigned int (the wire's fixed32).
+_FIXED32 = "I" if array("I").itemsize == 4 else "L"
+
+
+def _varint(value: int) -> bytes:
+    out = bytearray()
+    while value > 0x7F:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def _length_delimited(field_number: int, payload: bytes) -> bytes:
+    return _varint(field_number << 3 | 2) + _varint(len(payload)) + payload
+
+
+def _packed_array(field_number: int, values: array) -> bytes:
+    """Wire bytes of a packed `repeated double` / `repeated fixed32` field: the
+    array's raw storage. Empty arrays are left out, as proto3 does."""
+    if not values:
+        return b""
+    if sys.byteorder != "little":  # Protobuf fixed-width values are little-endian on the wire.
+        values = array(values.typecode, values)
+        values.byteswap()
+    return _length_delimited(field_number, values.tobytes())
+
 
 class HostChannel:
     """Framed protobuf channel to the host over stdin/stdout."""
@@ -24,6 +71,14 @@ class HostChannel:
     def __init__(self):
         self._in = sys.stdin.buffer
         self._out = sys.stdout.buffer
+        self._ring = None          # Writable view of the host's result ring, if offered.
+        self._ring_slot_bytes = 0
+        self._free_slots = []      # Ring slots this worker owns (not yet handed to the host).
+        self._input_view = None    # Current job's mapped input file, if any.
+        # Current job's node stream: id -> index of its first node sent (see
+        # StructuralMemberColumns), and the count of nodes sent so far.
+        self._node_index_by_id = {}
+        self._nodes_sent = 0
 
     def _read_exact(self, count: int) -> bytes:
         chunks = []
@@ -36,18 +91,97 @@ class HostChannel:
             remaining -= len(chunk)
         return b"".join(chunks)
 
-    def recv_import_request(self) -> "_pb.ImportFileRequest":
+    def _recv_message(self) -> "_pb.HostToWorker":
         (length,) = struct.unpack("<I", self._read_exact(4))
         if length > MAX_MESSAGE_BYTES:
             raise ValueError(f"host message of {length} bytes exceeds limit")
         message = _pb.HostToWorker()
         message.ParseFromString(self._read_exact(length))
-        if message.WhichOneof("msg") != "import_file_request":
+        return message
+
+    def _recv(self, expected: str):
+        message = self._recv_message()
+        if message.WhichOneof("msg") != expected:
             raise ValueError("unexpected message from host")
-        return message.import_file_request
+        return getattr(message, expected)
+
+    def recv_import_request(self):
+        """The next job's ImportFileRequest, or None once the host has closed the
+        pipe (worker pool shutdown or recycle). Slot credits the previous job left
+        unread are collected on the way."""
+        while True:
+            try:
+                message = self._recv_message()
+            except EOFError:
+                return None
+            kind = message.WhichOneof("msg")
+            if kind == "import_file_request":
+                break
+            if kind != "shared_slot_credit":
+                raise ValueError("unexpected message from host")
+            self._free_slots.append(message.shared_slot_credit.slot)
+        request = message.import_file_request
+        self._node_index_by_id = {}
+        self._nodes_sent = 0
+        # The ring belongs to the worker, not the job: map it once.
+        if self._ring is None and request.HasField("result_ring") and _vkshm is not None:
+            ring = request.result_ring
+            self._ring = _vkshm.map_view(ring.section_handle, 0,
+                                         ring.slot_bytes * ring.slot_count, True)
+            self._ring_slot_bytes = ring.slot_bytes
+            self._free_slots = list(range(ring.slot_count))
+        return request
+
+    def batch_entities(self, request: "_pb.ImportFileRequest") -> int:
+        """Most entities one batch may carry. The host imports every batch as
+        it arrives and rejects larger ones, so importers chunk by this."""
+        return request.max_batch_entities or DEFAULT_BATCH_ENTITIES
+
+    def request_file_data(self, request: "_pb.ImportFileRequest"):
+        """The input file content: a read-only memoryview over the host's file
+        mapping when the host shared one (no copy at all), else the inline bytes.
+        Parsers must therefore accept any bytes-like object."""
+        if not request.HasField("file_region"):
+            return request.file_bytes
+        if _vkshm is None:
+            raise RuntimeError("host shared the input file but this worker cannot map it")
+        region = request.file_region
+        self._input_view = _vkshm.map_view(region.section_handle, region.offset, region.length, False)
+        return self._input_view
+
+    def finish_request(self) -> None:
+        """End of one job: unmap the input file view (the host closes its section
+        handle) and collect the job's garbage before waiting for the next one."""
+        view, self._input_view = self._input_view, None
+        if view is not None:
+            try:
+                _vkshm.unmap_view(view)
+            except BufferError:
+                pass  # Still sliced somewhere; stays mapped until the host recycles us.
+        gc.collect()
+
+    def _acquire_slot(self) -> int:
+        # Every slot is with the host: block until it credits one back.
+        while not self._free_slots:
+            self._free_slots.append(self._recv("shared_slot_credit").slot)
+        return self._free_slots.pop()
 
     def _send(self, message: "_pb.WorkerToHost") -> None:
-        payload = message.SerializeToString()
+        # The result ends the job and stays inline: the worker then waits for its next
+        # request, so it must not block on a slot credit for it.
+        self._send_payload(message.SerializeToString(), message.WhichOneof("msg") == "result")
+
+    def _send_payload(self, payload: bytes, inline: bool = False) -> None:
+        """Send one serialized WorkerToHost."""
+        if (self._ring is not None and not inline
+                and 0 < len(payload) <= self._ring_slot_bytes):
+            slot = self._acquire_slot()
+            offset = slot * self._ring_slot_bytes
+            self._ring[offset:offset + len(payload)] = payload
+            envelope = _pb.WorkerToHost()
+            envelope.shared_batch.slot = slot
+            envelope.shared_batch.length = len(payload)
+            payload = envelope.SerializeToString()
         self._out.write(struct.pack("<I", len(payload)))
         self._out.write(payload)
         self._out.flush()
@@ -60,26 +194,64 @@ class HostChannel:
     def send_geometry_batch(self, nodes, members) -> None:
         """nodes: iterable of (id, x, y, z);
         members: iterable of (id, a, b), (id, a, b, profile_designation) or
-        (id, a, b, designation, parameter1, parameter2) — parameters SI meters."""
-        message = _pb.WorkerToHost()
-        batch = message.create_geometry_batch
+        (id, a, b, designation, parameter1, parameter2) — parameters SI meters.
+        A member whose nodes were not sent earlier in this job is left out (the
+        host would drop it anyway)."""
+        # Sent in the columnar form (StructuralNodeColumns / StructuralMemberColumns):
+        # the pure-Python protobuf runtime would build, check and encode a submessage
+        # per node and member, while packed arrays go out as their raw storage.
+        node_index_by_id = self._node_index_by_id
+        node_ids = array(_FIXED32)
+        coordinates = array("d")
         for node_id, x, y, z in nodes:
-            node = batch.nodes.add()
-            node.node_id = node_id
-            node.x = x
-            node.y = y
-            node.z = z
+            node_index_by_id.setdefault(node_id, self._nodes_sent)
+            self._nodes_sent += 1
+            node_ids.append(node_id)
+            coordinates.extend((x, y, z))
+
+        member_ids = array(_FIXED32)
+        node_indices = array(_FIXED32)
+        profile_indices = array(_FIXED32)
+        parameters = array("d")
+        profile_table = {"": 0}
         for entry in members:
-            member = batch.members.add()
-            member.member_id = entry[0]
-            member.start_node_id = entry[1]
-            member.end_node_id = entry[2]
-            if len(entry) > 3 and entry[3]:
-                member.profile_designation = entry[3]
+            start = node_index_by_id.get(entry[1])
+            end = node_index_by_id.get(entry[2])
+            if start is None or end is None:
+                continue
+            member_ids.append(entry[0])
+            node_indices.append(start)
+            node_indices.append(end)
+            designation = entry[3] if len(entry) > 3 else ""
+            profile_indices.append(profile_table.setdefault(designation, len(profile_table)))
             if len(entry) > 5:
-                member.user_parameter1 = entry[4]
-                member.user_parameter2 = entry[5]
-        self._send(message)
+                # Parameters are all-or-nothing per batch: zero-fill the members before.
+                parameters.extend(array("d", bytes(8 * (2 * len(member_ids) - 2 - len(parameters)))))
+                parameters.extend((entry[4], entry[5]))
+        if parameters:
+            parameters.extend(array("d", bytes(8 * (2 * len(member_ids) - len(parameters)))))
+
+        batch = b""
+        if node_ids:
+            columns = _pb.StructuralNodeColumns
+            batch += _length_delimited(
+                _pb.CreateGeometryBatch.NODE_COLUMNS_FIELD_NUMBER,
+                _packed_array(columns.NODE_IDS_FIELD_NUMBER, node_ids)
+                + _packed_array(columns.COORDINATES_FIELD_NUMBER, coordinates))
+        if member_ids:
+            columns = _pb.StructuralMemberColumns
+            table = b"".join(
+                _length_delimited(columns.PROFILE_DESIGNATIONS_FIELD_NUMBER, designation.encode("utf-8"))
+                for designation in profile_table)
+            batch += _length_delimited(
+                _pb.CreateGeometryBatch.MEMBER_COLUMNS_FIELD_NUMBER,
+                _packed_array(columns.MEMBER_IDS_FIELD_NUMBER, member_ids)
+                + _packed_array(columns.NODE_INDICES_FIELD_NUMBER, node_indices)
+                + _packed_array(columns.PROFILE_INDICES_FIELD_NUMBER, profile_indices)
+                + table
+                + _packed_array(columns.USER_PARAMETERS_FIELD_NUMBER, parameters))
+        self._send_payload(_length_delimited(
+            _pb.WorkerToHost.CREATE_GEOMETRY_BATCH_FIELD_NUMBER, batch))
 
     def send_result(self, success: bool, error: str = "",
                     total_nodes: int = 0, total_members: int = 0) -> None:
@@ -7,6 +7,8 @@ installation-key signature over the raw session public key inside the JSON body;
 session-key signature over the exact body bytes travels in the X-MV-Signature header.
 """
 import base64
+import threading
+from collections import OrderedDict
 
 from cryptography.exceptions import InvalidSignature
 from cryptography.hazmat.primitives.asymmetric.ed25519 import Ed25519PublicKey
@@ -14,6 +16,15 @@ from cryptography.hazmat.primitives.asymmetric.ed25519 import Ed25519PublicKey
 RAW_KEY_LENGTH = 32
 RAW_SIGNATURE_LENGTH = 64
 
+# Verified session links, per process: (installation key, session key, session signature)
+# as received -> the loaded session public key. Every upload of one client launch repeats the
+# same triple, so a hit skips the first signature check and both key decodes; only triples
+# that passed verification are stored, so a hit proves exactly what the check would have.
+# The body signature is still verified on every request.
+SESSION_CACHE_SIZE = 4096
+_verified_sessions: "OrderedDict[tuple[str, str, str], Ed25519PublicKey]" = OrderedDict()
+_verified_sessions_lock = threading.Lock()
+
 
 def _decode(b64: str, expected_length: int) -> bytes | None:
     try:
@@ -23,19 +34,46 @@ def _decode(b64: str, expected_length: int) -> bytes | None:
     return raw if len(raw) == expected_length else None
 
 
+def _session_key(installation_key_b64: str, session_key_b64: str,
+                 session_signature_b64: str) -> Ed25519PublicKey | None:
+    """The session public key once the installation key's signature over it checks out."""
+    triple = (installation_key_b64, session_key_b64, session_signature_b64)
+    with _verified_sessions_lock:
+        session_key = _verified_sessions.get(triple)
+        if session_key is not None:
+            _verified_sessions.move_to_end(triple)
+            return session_key
+
+    installation_raw = _decode(installation_key_b64, RAW_KEY_LENGTH)
+    session_raw = _decode(session_key_b64, RAW_KEY_LENGTH)
+    session_sig = _decode(session_signature_b64, RAW_SIGNATURE_LENGTH)
+    if not (installation_raw and session_raw and session_sig):
+        return None
+    try:
+        Ed25519PublicKey.from_public_bytes(installation_raw).verify(session_sig, session_raw)
+        session_key = Ed25519PublicKey.from_public_bytes(session_raw)
+    except (InvalidSignature, ValueError):
+        return None
+
+    with _verified_sessions_lock:
+        _verified_sessions[triple] = session_key
+        if len(_verified_sessions) > SESSION_CACHE_SIZE:
+            _verified_sessions.popitem(last=False)
+    return session_key
+
+
 def verify_request(installation_key_b64: str, session_key_b64: str,
                    session_signature_b64: str, body_signature_b64: str,
                    body: bytes) -> bool:
     """Returns True only when the full signature chain is valid."""
-    installation_raw = _decode(installation_key_b64, RAW_KEY_LENGTH)
-    session_raw = _decode(session_key_b64, RAW_KEY_LENGTH)
-    session_sig = _decode(session_signature_b64, RAW_SIGNATURE_LENGTH)
     body_sig = _decode(body_signature_b64, RAW_SIGNATURE_LENGTH)
-    if not (installation_raw and session_raw and session_sig and body_sig):
+    if not body_sig:
+        return False
+    session_key = _session_key(installation_key_b64, session_key_b64, session_signature_b64)
+    if session_key is None:
         return False
     try:
-        Ed25519PublicKey.from_public_bytes(installation_raw).verify(session_sig, session_raw)
-        Ed25519PublicKey.from_public_bytes(session_raw).verify(body_sig, body)
+        session_key.verify(body_sig, body)
         return True
-    except (InvalidSignature, ValueError):
+    except InvalidSignature:
         return False
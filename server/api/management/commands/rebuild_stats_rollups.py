@@ -0,0 +1,15 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+from django.core.management.base import BaseCommand
+
+from api import rollups
+
+
+class Command(BaseCommand):
+    help = ("Recompute the /api/stats rollup tables from the raw telemetry rows. Needed once "
+            "after the migration that creates them and after regenerating api/gpu_pci_ids.py; "
+            "/api/logs keeps them current otherwise.")
+
+    def handle(self, *args, **options):
+        usage_rows, reports = rollups.rebuild()
+        self.stdout.write("Rolled up %d usage intervals and %d hardware reports." % (usage_rows, reports))
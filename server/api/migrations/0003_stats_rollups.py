@@ -0,0 +1,47 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+import django.db.models.deletion
+from django.db import migrations, models
+
+
+class Migration(migrations.Migration):
+
+    dependencies = [
+        ("api", "0002_reportgpu_reportmonitor"),
+    ]
+
+    operations = [
+        migrations.CreateModel(
+            name="UsageDayRollup",
+            fields=[
+                ("id", models.BigAutoField(auto_created=True, primary_key=True, serialize=False, verbose_name="ID")),
+                ("day", models.DateField(unique=True)),
+                ("records", models.BigIntegerField(default=0)),
+                ("open_seconds", models.BigIntegerField(default=0)),
+                ("focus_seconds", models.BigIntegerField(default=0)),
+            ],
+        ),
+        migrations.CreateModel(
+            name="CommandDayRollup",
+            fields=[
+                ("id", models.BigAutoField(auto_created=True, primary_key=True, serialize=False, verbose_name="ID")),
+                ("day", models.DateField()),
+                ("command_id", models.BigIntegerField()),
+                ("count", models.BigIntegerField(default=0)),
+            ],
+            options={
+                "constraints": [models.UniqueConstraint(fields=("day", "command_id"), name="unique_command_day")],
+            },
+        ),
+        migrations.CreateModel(
+            name="HardwareLabelRollup",
+            fields=[
+                ("id", models.BigAutoField(auto_created=True, primary_key=True, serialize=False, verbose_name="ID")),
+                ("panel", models.CharField(max_length=16)),
+                ("label", models.CharField(max_length=160)),
+                ("installation", models.ForeignKey(on_delete=django.db.models.deletion.CASCADE, related_name="hardware_labels", to="api.installation")),
+            ],
+            options={
+                "constraints": [models.UniqueConstraint(fields=("panel", "label", "installation"), name="unique_panel_label_installation")],
+            },
+        ),
+    ]
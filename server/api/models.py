@@ -85,3 +85,44 @@ class UsageRecord(models.Model):
                                     name="unique_installation_client_row"),
         ]
         indexes = [models.Index(fields=["interval_start_utc"])]
+
+
+# Rollups behind the /api/stats dashboard, maintained by api/rollups.py inside the /api/logs
+# transaction and rebuilt from the raw tables by `manage.py rebuild_stats_rollups`. The
+# dashboard reads only these, so a page view no longer scales with the number of raw rows.
+
+class UsageDayRollup(models.Model):
+    """Usage totals of the intervals starting on one UTC day."""
+    day = models.DateField(unique=True)
+    records = models.BigIntegerField(default=0)
+    open_seconds = models.BigIntegerField(default=0)
+    focus_seconds = models.BigIntegerField(default=0)
+
+
+class CommandDayRollup(models.Model):
+    """Ribbon command invocations in the intervals starting on one UTC day."""
+    day = models.DateField()
+    command_id = models.BigIntegerField()
+    count = models.BigIntegerField(default=0)
+
+    class Meta:
+        constraints = [
+            models.UniqueConstraint(fields=["day", "command_id"], name="unique_command_day"),
+        ]
+
+
+class HardwareLabelRollup(models.Model):
+    """One dashboard label (GPU name, RAM bucket, display mode, ...) an installation has
+    reported at least once. The panels rank labels by distinct installations, which daily
+    counters cannot give without double counting, so this keeps the membership instead:
+    one row per (panel, label, installation), counted with a single GROUP BY."""
+    panel = models.CharField(max_length=16)  # rollups.HARDWARE_PANELS
+    label = models.CharField(max_length=160)
+    installation = models.ForeignKey(Installation, on_delete=models.CASCADE,
+                                     related_name="hardware_labels")
+
+    class Meta:
+        constraints = [
+            models.UniqueConstraint(fields=["panel", "label", "installation"],
+                                    name="unique_panel_label_installation"),
+        ]
@@ -0,0 +1,150 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+"""Incremental rollups for the /api/stats dashboard (models UsageDayRollup, CommandDayRollup,
+HardwareLabelRollup).
+
+/api/logs adds every newly stored usage interval and hardware report here, inside its own
+transaction, so the rollups never disagree with the raw rows they summarize. rebuild()
+recomputes them from scratch: run `manage.py rebuild_stats_rollups` after the first migrate
+that creates them, and after regenerating api/gpu_pci_ids.py (GPU labels are resolved when
+a report is stored)."""
+
+from collections import Counter
+
+from django.db import connection, transaction
+
+from .gpu_names import gpu_label
+from .models import (CommandDayRollup, HardwareLabelRollup, HardwareReport, ReportGpu,
+                     ReportMonitor, UsageDayRollup, UsageRecord)
+
+# Panels ranked by distinct installations, one HardwareLabelRollup.panel value each.
+HARDWARE_PANELS = ("os", "cpu", "ram", "gpu", "vram", "resolution", "refresh", "display_mode")
+
+
+def gb_label(megabytes):
+    """Whole gigabytes, rounded up: the OS always reports slightly less than the installed
+    amount because firmware and integrated graphics reserve a slice of it."""
+    if not megabytes:
+        return ""
+    return "%d GB" % -(-int(megabytes) // 1024)
+
+
+def _hardware_labels(os_name, cpu_name, ram_total_mb, gpus, monitors):
+    """(panel, label) pairs of one hardware report. gpus: (name, vendor_id, device_id, vram_mb,
+    discrete) tuples; monitors: (width_px, height_px, refresh_hz). Empty labels are dropped."""
+    labels = [("os", os_name), ("cpu", cpu_name), ("ram", gb_label(ram_total_mb))]
+    for name, vendor, device, vram, discrete in gpus:
+        labels.append(("gpu", gpu_label(name, vendor, device)))
+        # An integrated GPU's "dedicated" memory is an arbitrary UMA carve-out (495 MB on a
+        # Ryzen 5825U), so only discrete cards get a size bucket.
+        labels.append(("vram", gb_label(vram) if discrete else "Shared / integrated"))
+    for width, height, refresh in monitors:
+        labels.append(("resolution", "%d x %d" % (width, height) if width and height else ""))
+        labels.append(("refresh", "%d Hz" % refresh if refresh else ""))
+        labels.append(("display_mode", "%d x %d @ %d Hz" % (width, height, refresh)
+                       if width and height and refresh else ""))
+    return {(panel, label[:160]) for panel, label in labels if label}
+
+
+def _usage_counters(records):
+    """Per-day totals and per-(day, command) counts of (interval_start_utc, open_seconds,
+    focus_seconds, ribbon_actions) tuples."""
+    days = {}
+    commands = Counter()
+    for start, open_seconds, focus_seconds, actions in records:
+        day = start.date()
+        totals = days.setdefault(day, [0, 0, 0])
+        totals[0] += 1
+        totals[1] += open_seconds
+        totals[2] += focus_seconds
+        if isinstance(actions, dict):
+            for command_id, count in actions.items():
+                try:
+                    commands[day, int(command_id)] += int(count)
+                except (ValueError, TypeError):
+                    continue
+    return days, commands
+
+
+def _add_to_counters(model, key_columns, value_columns, rows):
+    """INSERT ... ON CONFLICT DO UPDATE SET value = value + excluded.value for every row:
+    bulk_create(update_conflicts=True) can only overwrite a counter, not add to it."""
+    if not rows:
+        return
+    table = connection.ops.quote_name(model._meta.db_table)
+    columns = [connection.ops.quote_name(column) for column in (*key_columns, *value_columns)]
+    keys = columns[:len(key_columns)]
+    sql = "INSERT INTO %s (%s) VALUES (%s) ON CONFLICT (%s) DO UPDATE SET %s" % (
+        table, ", ".join(columns), ", ".join(["%s"] * len(columns)), ", ".join(keys),
+        ", ".join("%s = %s.%s + excluded.%s" % (column, table, column, column)
+                  for column in columns[len(key_columns):]))
+    with connection.cursor() as cursor:
+        cursor.executemany(sql, rows)
+
+
+def add_usage(records):
+    """Count newly stored UsageRecords (never retried ones: they would be counted twice)."""
+    days, commands = _usage_counters(
+        (record.interval_start_utc, record.open_seconds, record.focus_seconds,
+         record.ribbon_actions) for record in records)
+    _add_to_counters(UsageDayRollup, ("day",), ("records", "open_seconds", "focus_seconds"),
+                     [(day, *totals) for day, totals in days.items()])
+    _add_to_counters(CommandDayRollup, ("day", "command_id"), ("count",),
+                     [(day, command_id, count) for (day, command_id), count in commands.items()])
+
+
+def add_hardware(report, gpus, monitors):
+    """Record the labels of a newly stored HardwareReport and its ReportGpu / ReportMonitor rows."""
+    labels = _hardware_labels(
+        report.os_name, report.cpu_name, report.ram_total_mb,
+        [(gpu.name, gpu.vendor_id, gpu.device_id, gpu.vram_mb, gpu.discrete) for gpu in gpus],
+        [(monitor.width_px, monitor.height_px, monitor.refresh_hz) for monitor in monitors])
+    HardwareLabelRollup.objects.bulk_create(
+        [HardwareLabelRollup(panel=panel, label=label, installation_id=report.installation_id)
+         for panel, label in labels], ignore_conflicts=True)
+
+
+@transaction.atomic
+def rebuild(chunk_size=5000):
+    """Recompute every rollup from the raw tables, streaming them in chunks. Returns the number
+    of (usage, hardware report) rows read."""
+    UsageDayRollup.objects.all().delete()
+    CommandDayRollup.objects.all().delete()
+    HardwareLabelRollup.objects.all().delete()
+
+    days, commands = _usage_counters(UsageRecord.objects.values_list(
+        "interval_start_utc", "open_seconds", "focus_seconds", "ribbon_actions")
+        .iterator(chunk_size=chunk_size))
+    UsageDayRollup.objects.bulk_create(
+        [UsageDayRollup(day=day, records=records, open_seconds=open_seconds,
+                        focus_seconds=focus_seconds)
+         for day, (records, open_seconds, focus_seconds) in days.items()], batch_size=500)
+    CommandDayRollup.objects.bulk_create(
+        [CommandDayRollup(day=day, command_id=command_id, count=count)
+         for (day, command_id), count in commands.items()], batch_size=500)
+
+    gpus_by_report = {}
+    for report_id, *gpu in ReportGpu.objects.values_list(
+            "report_id", "name", "vendor_id", "device_id", "vram_mb", "discrete") \
+            .iterator(chunk_size=chunk_size):
+        gpus_by_report.setdefault(report_id, []).append(gpu)
+    monitors_by_report = {}
+    for report_id, *monitor in ReportMonitor.objects.values_list(
+            "report_id", "width_px", "height_px", "refresh_hz").iterator(chunk_size=chunk_size):
+        monitors_by_report.setdefault(report_id, []).append(monitor)
+
+    labels = set()
+    reports = 0
+    for report_id, installation_id, os_name, cpu_name, ram_total_mb in \
+            HardwareReport.objects.values_list(
+                "id", "installation_id", "os_name", "cpu_name", "ram_total_mb") \
+            .iterator(chunk_size=chunk_size):
+        reports += 1
+        for panel, label in _hardware_labels(os_name, cpu_name, ram_total_mb,
+                                             gpus_by_report.get(report_id, ()),
+                                             monitors_by_report.get(report_id, ())):
+            labels.add((panel, label, installation_id))
+    HardwareLabelRollup.objects.bulk_create(
+        [HardwareLabelRollup(panel=panel, label=label, installation_id=installation_id)
+         for panel, label, installation_id in labels], batch_size=500)
+    return sum(totals[0] for totals in days.values()), reports
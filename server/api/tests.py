@@ -0,0 +1,320 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+"""/api/logs ingestion and /api/stats rollup tests. Run with: MV_DEBUG=1 python manage.py test api"""
+
+import base64
+import json
+import random
+from collections import Counter
+from datetime import timedelta
+from io import StringIO
+
+from cryptography.hazmat.primitives.asymmetric.ed25519 import Ed25519PrivateKey
+from cryptography.hazmat.primitives.serialization import Encoding, PublicFormat
+from django.core.cache import cache
+from django.core.management import call_command
+from django.db.models import Count, Sum
+from django.test import TestCase
+from django.utils import timezone as django_timezone
+
+from . import crypto
+from .commands import COMMAND_NAMES
+from .gpu_names import gpu_label
+from .models import (CommandDayRollup, HardwareLabelRollup, HardwareReport, Installation,
+                     ReportGpu, ReportMonitor, UsageDayRollup, UsageRecord)
+from .rollups import gb_label
+
+
+def _b64(raw):
+    return base64.b64encode(raw).decode("ascii")
+
+
+def _raw_public(private_key):
+    return private_key.public_key().public_bytes(Encoding.Raw, PublicFormat.Raw)
+
+
+class SignedClient:
+    """One client launch: an installation key and a session key it signed, as AccountManager.cpp
+    produces them."""
+
+    def __init__(self):
+        self.installation = Ed25519PrivateKey.generate()
+        self.session = Ed25519PrivateKey.generate()
+        session_raw = _raw_public(self.session)
+        self.fields = {
+            "installationPublicKey": _b64(_raw_public(self.installation)),
+            "sessionPublicKey": _b64(session_raw),
+            "sessionKeySignature": _b64(self.installation.sign(session_raw)),
+        }
+
+    def body(self, **payload):
+        return json.dumps({**self.fields, "appVersion": 1, **payload}).encode("utf-8")
+
+    def signature(self, body):
+        return _b64(self.session.sign(body))
+
+
+def usage_row(client_row_id, day, actions):
+    return {"id": client_row_id, "start": "2026-03-%02dT10:00:00Z" % day, "interval": 600,
+            "open": 600, "focus": 300 + client_row_id, "left": client_row_id, "middle": 0,
+            "right": 1, "keys": 7, "actions": actions}
+
+
+USAGE = [
+    usage_row(1, 1, {"3": 2}),
+    usage_row(2, 1, {"3": 1, "5": 4}),
+    usage_row(3, 2, {}),
+    usage_row(4, 2, {"5": 1}),
+    usage_row(5, 3, {"7": 9}),
+]
+
+
+class LogsTestBase(TestCase):
+    def setUp(self):
+        cache.clear()  # Rate limiting counts per installation key in the process-wide cache.
+
+    def post(self, client, body, signature=None):
+        return self.client.post("/api/logs", data=body, content_type="application/json",
+                                HTTP_X_MV_SIGNATURE=signature or client.signature(body))
+
+    def post_usage(self, client, usage):
+        response = self.post(client, client.body(usage=usage))
+        self.assertEqual(response.status_code, 200, response.content)
+        return response.json()["ackUsageIds"]
+
+    def stored_state(self):
+        """Everything ingestion writes for usage, minus surrogate keys."""
+        rows = sorted(UsageRecord.objects.values_list(
+            "client_row_id", "interval_start_utc", "interval_seconds", "open_seconds",
+            "focus_seconds", "left_clicks", "middle_clicks", "right_clicks", "key_presses",
+            "ribbon_actions"))
+        days = sorted(UsageDayRollup.objects.values_list(
+            "day", "records", "open_seconds", "focus_seconds"))
+        commands = sorted(CommandDayRollup.objects.values_list("day", "command_id", "count"))
+        return rows, days, commands
+
+    def reset(self):
+        UsageRecord.objects.all().delete()
+        UsageDayRollup.objects.all().delete()
+        CommandDayRollup.objects.all().delete()
+        HardwareLabelRollup.objects.all().delete()
+        HardwareReport.objects.all().delete()
+        Installation.objects.all().delete()
+        cache.clear()
+
+
+class BulkUsageIngestTests(LogsTestBase):
+    def test_bulk_matches_row_by_row(self):
+        """One request carrying every row, then a resubmission of all of them, stores and
+        acknowledges exactly what one request per row (each sent twice) does."""
+        client = SignedClient()
+        bulk_acks = self.post_usage(client, USAGE)
+        resent_acks = self.post_usage(client, USAGE)
+        bulk = self.stored_state()
+
+        self.reset()
+        single_acks = []
+        for row in USAGE:
+            single_acks += self.post_usage(client, [row])
+            single_acks += self.post_usage(client, [row])
+        single = self.stored_state()
+
+        expected_ids = [row["id"] for row in USAGE]
+        self.assertEqual(bulk_acks, expected_ids)
+        self.assertEqual(resent_acks, expected_ids)
+        self.assertEqual(sorted(single_acks), sorted(expected_ids * 2))
+        self.assertEqual(bulk, single)
+        self.assertEqual(len(bulk[0]), len(USAGE))
+        self.assertEqual(sum(records for _, records, _, _ in bulk[1]), len(USAGE))
+
+    def test_partial_resubmission_counts_only_new_rows(self):
+        client = SignedClient()
+        self.post_usage(client, USAGE[:3])
+        self.assertEqual(self.post_usage(client, USAGE), [row["id"] for row in USAGE])
+        overlapping = self.stored_state()
+
+        self.reset()
+        self.post_usage(client, USAGE)
+        self.assertEqual(overlapping, self.stored_state())
+
+    def test_repeated_id_within_one_request_keeps_the_first(self):
+        client = SignedClient()
+        first, second = usage_row(9, 4, {"3": 1}), usage_row(9, 5, {"3": 50})
+        self.assertEqual(self.post_usage(client, [first, second]), [9, 9])
+        self.assertEqual(UsageRecord.objects.get().ribbon_actions, {"3": 1})
+        self.assertEqual(CommandDayRollup.objects.get().count, 1)
+
+    def test_largest_request_is_stored_and_resubmitted(self):
+        """4096 rows: the existing-id lookup must stay under SQLite's variable limit."""
+        client = SignedClient()
+        usage = [usage_row(n, 1 + n % 28, {}) for n in range(4096)]
+        self.assertEqual(len(self.post_usage(client, usage)), 4096)
+        self.assertEqual(len(self.post_usage(client, usage)), 4096)
+        self.assertEqual(UsageRecord.objects.count(), 4096)
+        self.assertEqual(sum(UsageDayRollup.objects.values_list("records", flat=True)), 4096)
+
+
+class SignatureCacheTests(LogsTestBase):
+    def test_tampered_body_rejected_after_cached_session(self):
+        """The first request caches the verified session link; a second body under the same
+        keys and the same X-MV-Signature must still fail its own body check."""
+        client = SignedClient()
+        body = client.body(usage=[usage_row(1, 1, {})])
+        signature = client.signature(body)
+        self.assertEqual(self.post(client, body, signature).status_code, 200)
+        self.assertIn(tuple(client.fields.values()), crypto._verified_sessions)
+
+        tampered = body.replace(b'"keys": 7', b'"keys": 8')
+        self.assertNotEqual(tampered, body)
+        response = self.post(client, tampered, signature)
+        self.assertEqual(response.status_code, 401)
+        self.assertEqual(response.json()["reason"], "invalid signature")
+        self.assertEqual(UsageRecord.objects.get().key_presses, 7)
+
+    def test_forged_session_signature_rejected_after_cached_session(self):
+        """A cache hit needs the exact session signature that was verified, not just the keys."""
+        client = SignedClient()
+        self.assertEqual(self.post(client, client.body()).status_code, 200)
+
+        client.fields["sessionKeySignature"] = _b64(bytes(64))
+        self.assertEqual(self.post(client, client.body()).status_code, 401)
+
+
+OS_NAMES = ["Windows 11 Pro", "Windows 10 Home", "Windows 11 Home", ""]
+CPU_NAMES = ["CPU %d" % n for n in range(11)]
+GPUS = [("NVIDIA GeForce RTX 3060", 0x10DE, 0x2504, 12288, True),
+        ("AMD Radeon(TM) Graphics", 0x1002, 0x1638, 512, False),
+        ("Intel(R) UHD Graphics", 0x8086, 0x9A49, 128, False),
+        ("Radeon RX 7800 XT", 0x1002, 0x747E, 16368, True),
+        ("", 0, 0, 0, False)]
+MODES = [(1920, 1080, 60), (2560, 1440, 144), (3840, 2160, 60), (1920, 1080, 144), (0, 0, 0),
+         (1366, 768, 60), (1280, 800, 0), (3440, 1440, 100), (1600, 900, 75), (2560, 1600, 120)]
+
+
+def random_hardware(rng):
+    return {"osName": rng.choice(OS_NAMES), "cpuName": rng.choice(CPU_NAMES),
+            "ramTotalMB": rng.choice([0, 7900, 8192, 16000, 32600, 65300]),
+            "gpus": [{"name": name, "vendorId": vendor, "deviceId": device, "vramMB": vram,
+                      "discrete": discrete}
+                     for name, vendor, device, vram, discrete in rng.sample(GPUS, rng.randrange(3))],
+            "monitors": [{"widthPx": w, "heightPx": h, "refreshHz": hz}
+                         for w, h, hz in rng.sample(MODES, rng.randrange(4))]}
+
+
+def random_actions(rng):
+    actions = {str(rng.randrange(1, 25)): rng.randrange(1, 9) for _ in range(rng.randrange(4))}
+    if rng.random() < 0.1:
+        actions["not-a-command"] = 3  # Skipped by every aggregation.
+    return actions
+
+
+def aggregated_stats_context():
+    """/api/stats as it was computed from the raw rows before the rollups existed, with ties
+    broken by label (and command id) the way the rollup view breaks them."""
+    month_ago = django_timezone.now() - timedelta(days=30)
+    totals = UsageRecord.objects.aggregate(
+        open_seconds=Sum("open_seconds"), focus_seconds=Sum("focus_seconds"), records=Count("id"))
+
+    def ranked(items):
+        peak = items[0][1] if items else 1
+        return [{"label": label, "count": n, "percent": round(100 * n / peak)} for label, n in items]
+
+    def top_counts(field):
+        return ranked([(row[field], row["n"]) for row in HardwareReport.objects.exclude(**{field: ""})
+                       .values(field).annotate(n=Count("installation", distinct=True))
+                       .order_by("-n", field)[:8]])
+
+    def top_labels(pairs):
+        installations = {}
+        for label, installation_id in pairs:
+            if label:
+                installations.setdefault(label, set()).add(installation_id)
+        return ranked(sorted(((label, len(ids)) for label, ids in installations.items()),
+                             key=lambda item: (-item[1], item[0]))[:8])
+
+    gpu_rows = list(ReportGpu.objects.values_list(
+        "name", "vendor_id", "device_id", "vram_mb", "discrete", "report__installation_id"))
+    monitor_rows = list(ReportMonitor.objects.values_list(
+        "width_px", "height_px", "refresh_hz", "report__installation_id"))
+    commands = Counter()
+    for actions in UsageRecord.objects.values_list("ribbon_actions", flat=True):
+        for command_id, count in actions.items():
+            try:
+                commands[int(command_id)] += int(count)
+            except (ValueError, TypeError):
+                continue
+    top_commands = sorted(commands.items(), key=lambda item: (-item[1], item[0]))[:15]
+
+    return {
+        "installations": Installation.objects.count(),
+        "active_30d": Installation.objects.filter(last_seen__gte=month_ago).count(),
+        "open_hours": round((totals["open_seconds"] or 0) / 3600, 1),
+        "focus_hours": round((totals["focus_seconds"] or 0) / 3600, 1),
+        "records": totals["records"] or 0,
+        "os_list": top_counts("os_name"),
+        "cpu_list": top_counts("cpu_name"),
+        "gpu_list": top_labels((gpu_label(name, vendor, device), installation)
+                               for name, vendor, device, _, _, installation in gpu_rows),
+        "vram_list": top_labels((gb_label(vram) if discrete else "Shared / integrated", installation)
+                                for _, _, _, vram, discrete, installation in gpu_rows),
+        "ram_list": top_labels((gb_label(mb), installation) for mb, installation in
+                               HardwareReport.objects.values_list("ram_total_mb", "installation_id")),
+        "resolution_list": top_labels(("%d x %d" % (w, h) if w and h else "", installation)
+                                      for w, h, _, installation in monitor_rows),
+        "refresh_list": top_labels(("%d Hz" % hz if hz else "", installation)
+                                   for _, _, hz, installation in monitor_rows),
+        "display_mode_list": top_labels(
+            ("%d x %d @ %d Hz" % (w, h, hz) if w and h and hz else "", installation)
+            for w, h, hz, installation in monitor_rows),
+        "commands": ranked([(COMMAND_NAMES.get(cid, str(cid)), n) for cid, n in top_commands]),
+    }
+
+
+class StatsRollupTests(LogsTestBase):
+    def populate(self, seed):
+        """Randomized traffic from a dozen installations: hardware reports, usage uploads and
+        retries of rows already sent (which must not be counted twice)."""
+        rng = random.Random(seed)
+        clients = [SignedClient() for _ in range(12)]
+        sent = {client: [] for client in clients}
+        for _ in range(80):
+            client = rng.choice(clients)
+            payload = {}
+            if rng.random() < 0.4:
+                payload["hardware"] = random_hardware(rng)
+            usage = [usage_row(len(sent[client]) + n + 1, rng.randrange(1, 29), random_actions(rng))
+                     for n in range(rng.randrange(12))]
+            sent[client] += usage
+            if sent[client] and rng.random() < 0.3:
+                usage += rng.sample(sent[client], min(3, len(sent[client])))
+            response = self.post(client, client.body(usage=usage, **payload))
+            self.assertEqual(response.status_code, 200, response.content)
+
+    def rollup_state(self):
+        return (sorted(UsageDayRollup.objects.values_list(
+                    "day", "records", "open_seconds", "focus_seconds")),
+                sorted(CommandDayRollup.objects.values_list("day", "command_id", "count")),
+                sorted(HardwareLabelRollup.objects.values_list("panel", "label", "installation_id")))
+
+    def test_rebuild_reproduces_incremental_rollups(self):
+        for seed in range(4):
+            with self.subTest(seed=seed):
+                self.reset()
+                self.populate(seed)
+                incremental = self.rollup_state()
+                self.assertTrue(all(incremental))
+                call_command("rebuild_stats_rollups", stdout=StringIO())
+                self.assertEqual(self.rollup_state(), incremental)
+
+    def test_stats_matches_the_raw_row_aggregation(self):
+        for seed in range(3):
+            with self.subTest(seed=seed):
+                self.reset()
+                self.populate(100 + seed)
+                cache.clear()  # /api/stats is cache_page'd.
+                response = self.client.get("/api/stats")
+                self.assertEqual(response.status_code, 200)
+                expected = aggregated_stats_context()
+                for key, value in expected.items():
+                    self.assertEqual(response.context[key], value, key)
+                self.assertGreater(len(expected["cpu_list"]), 0)
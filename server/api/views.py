@@ -2,7 +2,6 @@
 
 import json
 import logging
-from collections import Counter
 from datetime import datetime, timedelta, timezone
 
 from django.core.cache import cache
@@ -17,13 +16,15 @@ from django.views.decorators.http import require_GET, require_POST
 
 from .commands import COMMAND_NAMES
 from .crypto import verify_request
-from .gpu_names import gpu_label
-from .models import HardwareReport, Installation, ReportGpu, ReportMonitor, UsageRecord
+from . import rollups
+from .models import (CommandDayRollup, HardwareLabelRollup, HardwareReport, Installation,
+                     ReportGpu, ReportMonitor, UsageDayRollup, UsageRecord)
 
 logger = logging.getLogger("api")
 
 MAX_BODY_BYTES = 1 * 1024 * 1024
 MAX_USAGE_ROWS_PER_REQUEST = 4096
+USAGE_LOOKUP_CHUNK = 500  # Ids per "IN (...)": SQLite builds before 3.32 cap a query at 999 variables.
 MAX_GPUS_PER_REPORT = 8
 MAX_MONITORS_PER_REPORT = 16
 RATE_LIMIT_PER_HOUR = 120  # Per installation key; normal clients need ~2 requests a day.
@@ -45,9 +46,10 @@ def _int(value, limit):
 
 
 def _store_gpus(report, gpus):
-    """One ReportGpu row per adapter. Element 0 is the highest-VRAM one (client sorts them)."""
+    """One ReportGpu row per adapter. Element 0 is the highest-VRAM one (client sorts them).
+    Returns the stored rows."""
     if not isinstance(gpus, list):
-        return
+        return []
     rows = [ReportGpu(
         report=report,
         name=str(gpu.get("name", ""))[:128],
@@ -57,13 +59,13 @@ def _store_gpus(report, gpus):
         driver_version=str(gpu.get("driverVersion", ""))[:32],
         discrete=bool(gpu.get("discrete", False)),
     ) for gpu in gpus[:MAX_GPUS_PER_REPORT] if isinstance(gpu, dict)]
-    ReportGpu.objects.bulk_create(rows)
+    return ReportGpu.objects.bulk_create(rows)
 
 
 def _store_monitors(report, monitors):
-    """One ReportMonitor row per attached display."""
+    """One ReportMonitor row per attached display. Returns the stored rows."""
     if not isinstance(monitors, list):
-        return
+        return []
     rows = [ReportMonitor(
         report=report,
         width_px=_int(monitor.get("widthPx"), 100000),
@@ -72,7 +74,67 @@ def _store_monitors(report, monitors):
         width_mm=_int(monitor.get("widthMm"), 10000),
         height_mm=_int(monitor.get("heightMm"), 10000),
     ) for monitor in monitors[:MAX_MONITORS_PER_REPORT] if isinstance(monitor, dict)]
-    ReportMonitor.objects.bulk_create(rows)
+    return ReportMonitor.objects.bulk_create(rows)
+
+
+def _upsert_installation(public_key, app_version):
+    """One INSERT ... ON CONFLICT DO UPDATE instead of SELECT, INSERT and UPDATE. Bumps
+    last_seen (auto_now) and app_version; the returned object carries the primary key."""
+    installation, = Installation.objects.bulk_create(
+        [Installation(public_key=public_key, app_version=app_version)],
+        update_conflicts=True, unique_fields=["public_key"],
+        update_fields=["app_version", "last_seen"])
+    return installation
+
+
+def _store_usage(installation, usage):
+    """Bulk insert of the usage rows; returns the client row ids to acknowledge. Rows already
+    stored (client retries) are filtered out and acknowledged again. The caller's transaction
+    holds the database write lock (BEGIN IMMEDIATE, see settings.DATABASES), so no concurrent
+    request can store one of these ids between that check and the insert: exactly the rows
+    inserted here are added to the rollups. Within one request the first row of a repeated id
+    wins, as it did with get_or_create."""
+    ack_ids = []
+    records = {}
+    for row in usage[:MAX_USAGE_ROWS_PER_REQUEST]:
+        if not isinstance(row, dict):
+            continue
+        client_row_id = row.get("id")
+        start = _parse_iso_utc(row.get("start"))
+        if not isinstance(client_row_id, int) or start is None:
+            continue
+        actions = row.get("actions")
+        if not isinstance(actions, dict):
+            actions = {}
+        if client_row_id not in records:
+            records[client_row_id] = UsageRecord(
+                installation=installation,
+                client_row_id=client_row_id,
+                interval_start_utc=start,
+                interval_seconds=int(row.get("interval", 0) or 0),
+                open_seconds=int(row.get("open", 0) or 0),
+                focus_seconds=int(row.get("focus", 0) or 0),
+                left_clicks=int(row.get("left", 0) or 0),
+                middle_clicks=int(row.get("middle", 0) or 0),
+                right_clicks=int(row.get("right", 0) or 0),
+                key_presses=int(row.get("keys", 0) or 0),
+                ribbon_actions=actions,
+            )
+        ack_ids.append(client_row_id)
+
+    if records:
+        client_row_ids = list(records)
+        stored = set()
+        for first in range(0, len(client_row_ids), USAGE_LOOKUP_CHUNK):
+            stored.update(UsageRecord.objects.filter(
+                installation=installation,
+                client_row_id__in=client_row_ids[first:first + USAGE_LOOKUP_CHUNK])
+                .values_list("client_row_id", flat=True))
+        new_records = [record for client_row_id, record in records.items()
+                       if client_row_id not in stored]
+        UsageRecord.objects.bulk_create(new_records)
+        rollups.add_usage(new_records)
+    return ack_ids
 
 
 def _rate_limited(key: str) -> bool:
@@ -122,9 +184,7 @@ def logs(request):
         app_version = 0
 
     with transaction.atomic():
-        installation, _ = Installation.objects.get_or_create(public_key=installation_key)
-        installation.app_version = app_version
-        installation.save(update_fields=["app_version", "last_seen"])
+        installation = _upsert_installation(installation_key, app_version)
 
         hardware_acked = False
         hardware = payload.get("hardware")
@@ -145,39 +205,12 @@ def logs(request):
                 os_build=int(hardware.get("osBuild", 0) or 0),
                 gpu_name=str(primary_gpu.get("name", ""))[:128],
             )
-            _store_gpus(report, gpus)
-            _store_monitors(report, hardware.get("monitors"))
+            rollups.add_hardware(report, _store_gpus(report, gpus),
+                                 _store_monitors(report, hardware.get("monitors")))
             hardware_acked = True
 
-        ack_ids = []
         usage = payload.get("usage")
-        if isinstance(usage, list):
-            for row in usage[:MAX_USAGE_ROWS_PER_REQUEST]:
-                if not isinstance(row, dict):
-                    continue
-                client_row_id = row.get("id")
-                start = _parse_iso_utc(row.get("start"))
-                if not isinstance(client_row_id, int) or start is None:
-                    continue
-                actions = row.get("actions")
-                if not isinstance(actions, dict):
-                    actions = {}
-                UsageRecord.objects.get_or_create(
-                    installation=installation,
-                    client_row_id=client_row_id,
-                    defaults={
-                        "interval_start_utc": start,
-                        "interval_seconds": int(row.get("interval", 0) or 0),
-                        "open_seconds": int(row.get("open", 0) or 0),
-                        "focus_seconds": int(row.get("focus", 0) or 0),
-                        "left_clicks": int(row.get("left", 0) or 0),
-                        "middle_clicks": int(row.get("middle", 0) or 0),
-                        "right_clicks": int(row.get("right", 0) or 0),
-                        "key_presses": int(row.get("keys", 0) or 0),
-                        "ribbon_actions": actions,
-                    },
-                )
-                ack_ids.append(client_row_id)
+        ack_ids = _store_usage(installation, usage) if isinstance(usage, list) else []
 
     return JsonResponse({"status": "ok", "ackUsageIds": ack_ids,
                          "hardwareAcked": hardware_acked})
@@ -191,73 +224,33 @@ def login(request):
     return JsonResponse({"status": "not_implemented"}, status=501)
 
 
-def _gb_label(megabytes):
-    """Whole gigabytes, rounded up: the OS always reports slightly less than the installed
-    amount because firmware and integrated graphics reserve a slice of it."""
-    if not megabytes:
-        return ""
-    return "%d GB" % -(-int(megabytes) // 1024)
-
-
 @require_GET
 @cache_page(600)
 def stats(request):
-    """Public dashboard of global, fully aggregated usage statistics."""
+    """Public dashboard of global, fully aggregated usage statistics. Reads only the rollup
+    tables (api/rollups.py) and the installation count, never the raw telemetry rows."""
     now = django_timezone.now()
     month_ago = now - timedelta(days=30)
 
-    totals = UsageRecord.objects.aggregate(
+    totals = UsageDayRollup.objects.aggregate(
         open_seconds=Sum("open_seconds"), focus_seconds=Sum("focus_seconds"),
-        records=Count("id"))
+        records=Sum("records"))
 
-    def top_counts(queryset, field, limit=8):
-        rows = (queryset.exclude(**{field: ""}).values(field)
-                .annotate(n=Count("installation", distinct=True)).order_by("-n")[:limit])
-        items = [(r[field], r["n"]) for r in rows]
+    def ranked(items):
         peak = items[0][1] if items else 1
         return [{"label": label, "count": n, "percent": round(100 * n / peak)}
                 for label, n in items]
 
-    def top_labels(pairs, limit=8):
-        """Same ranking as top_counts for values that have to be computed in python (unit
-        conversion, bucketing, joining several columns into one label). pairs yields
-        (label, installation_id); empty labels are dropped."""
-        installations_per_label = {}
-        for label, installation_id in pairs:
-            if label:
-                installations_per_label.setdefault(label, set()).add(installation_id)
-        items = sorted(((label, len(ids)) for label, ids in installations_per_label.items()),
-                       key=lambda item: (-item[1], item[0]))[:limit]
-        peak = items[0][1] if items else 1
-        return [{"label": label, "count": n, "percent": round(100 * n / peak)}
-                for label, n in items]
+    # Distinct installations per label, ties alphabetical; one GROUP BY for all panels.
+    panels = {panel: [] for panel in rollups.HARDWARE_PANELS}
+    for panel, label, n in (HardwareLabelRollup.objects.values_list("panel", "label")
+                            .annotate(n=Count("installation_id")).order_by("panel", "-n", "label")):
+        if panel in panels and len(panels[panel]) < 8:
+            panels[panel].append((label, n))
 
-    # Latest hardware report per installation would need window functions; for dashboard
-    # purposes counting distinct installations per value is a good approximation.
-    hardware = HardwareReport.objects.all()
-
-    # One row per adapter / per display, so multi-GPU and multi-monitor machines contribute
-    # to every bucket they actually occupy.
-    gpu_rows = list(ReportGpu.objects.values_list(
-        "name", "vendor_id", "device_id", "vram_mb", "discrete", "report__installation_id"))
-    # The EDID panel size is stored per monitor but deliberately not aggregated: physical
-    # millimetres vary by a millimetre or two between otherwise identical panels.
-    monitor_rows = list(ReportMonitor.objects.values_list(
-        "width_px", "height_px", "refresh_hz", "report__installation_id"))
-
-    command_counter = Counter()
-    for actions in (UsageRecord.objects.exclude(ribbon_actions={})
-                    .values_list("ribbon_actions", flat=True)[:100000]):
-        if isinstance(actions, dict):
-            for command_id, count in actions.items():
-                try:
-                    command_counter[int(command_id)] += int(count)
-                except (ValueError, TypeError):
-                    continue
-    top_commands = command_counter.most_common(15)
-    peak_command = top_commands[0][1] if top_commands else 1
-    commands = [{"label": COMMAND_NAMES.get(cid, str(cid)), "count": n,
-                 "percent": round(100 * n / peak_command)} for cid, n in top_commands]
+    top_commands = list(CommandDayRollup.objects.values_list("command_id")
+                        .annotate(n=Sum("count")).order_by("-n", "command_id")[:15])
+    commands = ranked([(COMMAND_NAMES.get(cid, str(cid)), n) for cid, n in top_commands])
 
     context = {
         "generated_utc": now.strftime("%Y-%m-%d %H:%M UTC"),
@@ -266,28 +259,14 @@ def stats(request):
         "open_hours": round((totals["open_seconds"] or 0) / 3600, 1),
         "focus_hours": round((totals["focus_seconds"] or 0) / 3600, 1),
         "records": totals["records"] or 0,
-        "os_list": top_counts(hardware, "os_name"),
-        "cpu_list": top_counts(hardware, "cpu_name"),
-        "gpu_list": top_labels(
-            (gpu_label(name, vendor, device), installation)
-            for name, vendor, device, _vram, _discrete, installation in gpu_rows),
-        # An integrated GPU's "dedicated" memory is an arbitrary UMA carve-out (495 MB on a
-        # Ryzen 5825U), so only discrete cards get a size bucket.
-        "vram_list": top_labels(
-            (_gb_label(vram) if discrete else "Shared / integrated", installation)
-            for _name, _vendor, _device, vram, discrete, installation in gpu_rows),
-        "ram_list": top_labels(
-            (_gb_label(mb), installation)
-            for mb, installation in hardware.values_list("ram_total_mb", "installation_id")),
-        "resolution_list": top_labels(
-            ("%d x %d" % (w, h) if w and h else "", installation)
-            for w, h, _hz, installation in monitor_rows),
-        "refresh_list": top_labels(
-            ("%d Hz" % hz if hz else "", installation)
-            for _w, _h, hz, installation in monitor_rows),
-        "display_mode_list": top_labels(
-            ("%d x %d @ %d Hz" % (w, h, hz) if w and h and hz else "", installation)
-            for w, h, hz, installation in monitor_rows),
+        "os_list": ranked(panels["os"]),
+        "cpu_list": ranked(panels["cpu"]),
+        "gpu_list": ranked(panels["gpu"]),
+        "vram_list": ranked(panels["vram"]),
+        "ram_list": ranked(panels["ram"]),
+        "resolution_list": ranked(panels["resolution"]),
+        "refresh_list": ranked(panels["refresh"]),
+        "display_mode_list": ranked(panels["display_mode"]),
         "commands": commands,
     }
     return render(request, "api/stats.html", context)
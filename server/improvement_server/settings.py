@@ -58,6 +58,11 @@ DATABASES = {
         "NAME": os.environ.get("MV_DB_PATH", BASE_DIR / "db.sqlite3"),
         "OPTIONS": {
             "init_command": "PRAGMA journal_mode=WAL; PRAGMA busy_timeout=5000;",
+            # Every atomic block here writes. BEGIN IMMEDIATE takes the write lock up front, so
+            # /api/logs checks which usage rows are already stored under the same lock it
+            # inserts and rolls them up with (and waits on busy_timeout instead of failing on a
+            # read-to-write upgrade).
+            "transaction_mode": "IMMEDIATE",
         },
     }
 }
@@ -0,0 +1,193 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+
+"""Local load test for /api/logs: requests per second and latency percentiles of signed usage
+uploads, on SQLite, with nothing beyond the server's own requirements.
+
+By default it migrates a throwaway database and starts its own server on it: gunicorn with
+gunicorn.conf.py when gunicorn is installed (the deployment setup), else `manage.py runserver`.
+--url points it at a server that is already running instead. Requests are signed exactly as
+Vishwakarma.exe signs them (api.tests.SignedClient); every client switches to a fresh
+installation key before the per-installation rate limit would start answering 429.
+
+    cd server
+    python tools/load_logs.py --requests 2000 --concurrency 8 --rows 100
+"""
+
+import argparse
+import http.client
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import urllib.parse
+
+SERVER_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+sys.path.insert(0, SERVER_DIR)
+os.environ.setdefault("DJANGO_SETTINGS_MODULE", "improvement_server.settings")
+os.environ.setdefault("MV_DEBUG", "1")
+
+import django  # noqa: E402
+
+django.setup()
+
+from api.tests import SignedClient, usage_row  # noqa: E402
+from api.views import RATE_LIMIT_PER_HOUR  # noqa: E402
+
+HARDWARE = {"cpuName": "Load Test CPU", "cpuPhysicalCores": 8, "ramTotalMB": 16000,
+            "osName": "Windows 11", "osBuild": 26100,
+            "gpus": [{"name": "Load Test GPU", "vendorId": 0x10DE, "deviceId": 0x2504,
+                      "vramMB": 12288, "discrete": True}],
+            "monitors": [{"widthPx": 2560, "heightPx": 1440, "refreshHz": 144}]}
+
+
+def start_server(port, database):
+    """Migrate `database` and serve it on 127.0.0.1:port; returns (process, description)."""
+    env = dict(os.environ, MV_DB_PATH=database, MV_DEBUG="1")
+    subprocess.run([sys.executable, "manage.py", "migrate", "--verbosity", "0"], cwd=SERVER_DIR,
+                   env=env, check=True)
+    if shutil.which("gunicorn"):
+        command = ["gunicorn", "-c", "gunicorn.conf.py", "--bind", "127.0.0.1:%d" % port,
+                   "--access-logfile", "/dev/null", "improvement_server.wsgi"]
+        description = "gunicorn (gunicorn.conf.py)"
+    else:
+        command = [sys.executable, "manage.py", "runserver", "--noreload", "127.0.0.1:%d" % port]
+        description = "manage.py runserver (gunicorn not installed)"
+    process = subprocess.Popen(command, cwd=SERVER_DIR, env=env,
+                               stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    for _ in range(100):
+        try:
+            connection = http.client.HTTPConnection("127.0.0.1", port, timeout=1)
+            connection.request("GET", "/api/health")
+            if connection.getresponse().status == 200:
+                return process, description
+        except OSError:
+            pass
+        time.sleep(0.1)
+    process.kill()
+    raise SystemExit("the server did not come up")
+
+
+class Uploader:
+    """One simulated client on its own keep-alive connection. Each installation key sends at
+    most RATE_LIMIT_PER_HOUR - 1 requests; its first one carries a hardware report."""
+
+    def __init__(self, url, rows, seed):
+        self.url = urllib.parse.urlsplit(url)
+        self.rows = rows
+        self.random = random.Random(seed)
+        self.client = None
+        self.sent = 0
+        self.next_row_id = 0
+        self.connection = None
+
+    def body(self):
+        if self.client is None or self.sent == RATE_LIMIT_PER_HOUR - 1:
+            self.client = SignedClient()
+            self.sent = 0
+        extra = {"hardware": HARDWARE} if self.sent == 0 else {}
+        usage = []
+        for _ in range(self.rows):
+            self.next_row_id += 1
+            actions = {str(self.random.randrange(1, 60)): self.random.randrange(1, 5)
+                       for _ in range(self.random.randrange(0, 4))}
+            usage.append(usage_row(self.next_row_id, self.random.randrange(1, 29), actions))
+        self.sent += 1
+        return self.client.body(usage=usage, **extra)
+
+    def post(self):
+        """Seconds for one signed upload; raises on anything but 200."""
+        body = self.body()
+        headers = {"Content-Type": "application/json",
+                   "X-MV-Signature": self.client.signature(body)}
+        start = time.perf_counter()
+        for attempt in (0, 1):
+            if self.connection is None:
+                self.connection = http.client.HTTPConnection(self.url.hostname, self.url.port or 80,
+                                                             timeout=30)
+            try:
+                self.connection.request("POST", self.url.path or "/api/logs", body, headers)
+                response = self.connection.getresponse()
+                response.read()
+                break
+            except (http.client.RemoteDisconnected, ConnectionResetError, BrokenPipeError):
+                self.connection.close()  # Keep-alive closed by the server; retry once.
+                self.connection = None
+                if attempt:
+                    raise
+        if response.status != 200:
+            raise RuntimeError("HTTP %d" % response.status)
+        return time.perf_counter() - start
+
+
+def percentile(sorted_values, fraction):
+    return sorted_values[min(len(sorted_values) - 1, int(fraction * len(sorted_values)))]
+
+
+def run(url, requests, concurrency, rows):
+    latencies = []
+    errors = []
+    lock = threading.Lock()
+    per_thread = [requests // concurrency + (1 if n < requests % concurrency else 0)
+                  for n in range(concurrency)]
+
+    def worker(index):
+        uploader = Uploader(url, rows, seed=index)
+        for _ in range(per_thread[index]):
+            try:
+                seconds = uploader.post()
+            except Exception as error:  # Counted and reported, the run goes on.
+                with lock:
+                    errors.append(str(error))
+                continue
+            with lock:
+                latencies.append(seconds)
+
+    threads = [threading.Thread(target=worker, args=(n,)) for n in range(concurrency)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.perf_counter() - start
+
+    latencies.sort()
+    print("%d requests of %d usage rows, %d concurrent: %.1f req/s" % (
+        len(latencies), rows, concurrency, len(latencies) / elapsed))
+    if latencies:
+        print("latency ms: p50 %.1f  p90 %.1f  p99 %.1f  max %.1f" % tuple(
+            1000 * value for value in (percentile(latencies, 0.50), percentile(latencies, 0.90),
+                                       percentile(latencies, 0.99), latencies[-1])))
+    if errors:
+        print("%d failed requests, first: %s" % (len(errors), errors[0]))
+    return not errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--url", help="existing /api/logs endpoint (default: start a server)")
+    parser.add_argument("--requests", type=int, default=2000)
+    parser.add_argument("--concurrency", type=int, default=8)
+    parser.add_argument("--rows", type=int, default=100, help="usage rows per request")
+    parser.add_argument("--port", type=int, default=8765, help="port of the started server")
+    args = parser.parse_args()
+
+    if args.url:
+        sys.exit(0 if run(args.url, args.requests, args.concurrency, args.rows) else 1)
+    with tempfile.TemporaryDirectory() as directory:
+        process, description = start_server(args.port, os.path.join(directory, "load.sqlite3"))
+        print("server: %s on a fresh SQLite database" % description)
+        try:
+            ok = run("http://127.0.0.1:%d/api/logs" % args.port, args.requests, args.concurrency,
+                     args.rows)
+        finally:
+            process.terminate()
+            process.wait()
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,121 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// A Page2D Rotate-copy of a large selection (an imported DXF, two thirds selected), lines and
+// twenty-point polylines:
+//   before: ApplyTransform2DToSelection's serial loop, one push_back per transformed record;
+//   now:    Cad2DTransformSelectedRecords on EngineeringParallelFor, at 1, 2, 4 and 8 threads.
+// Every run must produce the serial loop's records bit for bit. Argument: line count (default
+// 600000; a sixth as many polylines).
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "Cad2DSelectionTransform.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr uint64_t kContainer = 7;
+
+bool TransformLine(const Cad2DLineRecordCPU& r, Cad2DLineRecordCPU& out, const Cad2DPointMapper& map) {
+    const Cad2DPoint2D a = map.Map(r.x1, r.y1), b = map.Map(r.x2, r.y2);
+    out.x1 = a.x; out.y1 = a.y; out.x2 = b.x; out.y2 = b.y;
+    out.objectId = 0;
+    out.persistedId = 0;
+    return true;
+}
+
+bool TransformPolyline(const Cad2DPolylineRecordCPU&, Cad2DPolylineRecordCPU& out, const Cad2DPointMapper& map) {
+    for (Cad2DPoint2D& p : out.points) p = map.Map(p.x, p.y);
+    out.objectId = 0;
+    out.persistedId = 0;
+    return true;
+}
+
+bool SameOutput(const std::vector<Cad2DLineRecordCPU>& lines, const std::vector<Cad2DLineRecordCPU>& expectedLines,
+    const std::vector<Cad2DPolylineRecordCPU>& polylines, const std::vector<Cad2DPolylineRecordCPU>& expectedPolylines) {
+    if (lines.size() != expectedLines.size() || polylines.size() != expectedPolylines.size()) return false;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const double a[4] = { lines[i].x1, lines[i].y1, lines[i].x2, lines[i].y2 };
+        const double b[4] = { expectedLines[i].x1, expectedLines[i].y1, expectedLines[i].x2, expectedLines[i].y2 };
+        if (std::memcmp(a, b, sizeof(a)) != 0) return false;
+    }
+    for (size_t i = 0; i < polylines.size(); ++i) {
+        const std::vector<Cad2DPoint2D>& a = polylines[i].points;
+        const std::vector<Cad2DPoint2D>& b = expectedPolylines[i].points;
+        if (a.size() != b.size() || std::memcmp(a.data(), b.data(), a.size() * sizeof(Cad2DPoint2D)) != 0) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t lineCount = ValidationSizeArgument(argc, argv, 600000);
+    const size_t polylineCount = lineCount / 6;
+    std::mt19937_64 random(50);
+    std::uniform_real_distribution<double> coordinate(-1.0e5, 1.0e5);
+    std::vector<Cad2DLineRecordCPU> pageLines(lineCount);
+    std::vector<Cad2DPolylineRecordCPU> pagePolylines(polylineCount);
+    std::unordered_set<uint64_t> selected;
+    uint64_t id = 1;
+    for (Cad2DLineRecordCPU& line : pageLines) {
+        line.objectId = id++;
+        line.containerMemoryId = kContainer;
+        line.x1 = coordinate(random); line.y1 = coordinate(random);
+        line.x2 = coordinate(random); line.y2 = coordinate(random);
+        if (random() % 3 != 0) selected.insert(line.objectId);
+    }
+    for (Cad2DPolylineRecordCPU& polyline : pagePolylines) {
+        polyline.objectId = id++;
+        polyline.containerMemoryId = kContainer;
+        polyline.points.resize(20);
+        for (Cad2DPoint2D& p : polyline.points) p = { coordinate(random), coordinate(random) };
+        if (random() % 3 != 0) selected.insert(polyline.objectId);
+    }
+
+    Cad2DPointMapper map;
+    const double c = std::cos(0.3), s = std::sin(0.3);
+    map.pivotX = 1.0; map.pivotY = 2.0; map.baseX = 1.0; map.baseY = 2.0;
+    map.m00 = c; map.m01 = -s; map.m10 = s; map.m11 = c;
+    auto wanted = [&](const auto& r) {
+        return !r.isDeleted && r.containerMemoryId == kContainer && selected.count(r.objectId) != 0;
+    };
+
+    std::printf("%zu lines, %zu polylines, %zu selected, %u hardware threads\n", lineCount, polylineCount,
+        selected.size(), std::thread::hardware_concurrency());
+
+    std::vector<Cad2DLineRecordCPU> serialLines;
+    std::vector<Cad2DPolylineRecordCPU> serialPolylines;
+    const double serialMs = TimeMilliseconds([&] {
+        for (const Cad2DLineRecordCPU& r : pageLines) {
+            if (!wanted(r)) continue;
+            Cad2DLineRecordCPU out = r;
+            if (TransformLine(r, out, map)) serialLines.push_back(out);
+        }
+        for (const Cad2DPolylineRecordCPU& r : pagePolylines) {
+            if (!wanted(r)) continue;
+            Cad2DPolylineRecordCPU out = r;
+            if (TransformPolyline(r, out, map)) serialPolylines.push_back(std::move(out));
+        }
+    });
+    std::printf("  before (serial loop):  %8.1f ms\n", serialMs);
+
+    for (unsigned threads : { 1u, 2u, 4u, 8u }) {
+        EngineeringParallelFor pool(threads);
+        std::vector<Cad2DLineRecordCPU> lines;
+        std::vector<Cad2DPolylineRecordCPU> polylines;
+        const double ms = TimeMilliseconds([&] {
+            Cad2DTransformSelectedRecords(pool, pageLines, lines, wanted,
+                [&](const Cad2DLineRecordCPU& r, Cad2DLineRecordCPU& out) { return TransformLine(r, out, map); });
+            Cad2DTransformSelectedRecords(pool, pagePolylines, polylines, wanted,
+                [&](const Cad2DPolylineRecordCPU& r, Cad2DPolylineRecordCPU& out) { return TransformPolyline(r, out, map); });
+        });
+        CHECK(SameOutput(lines, serialLines, polylines, serialPolylines));
+        std::printf("  now, %u thread(s):     %8.1f ms\n", threads, ms);
+    }
+    return ValidationExitCode();
+}
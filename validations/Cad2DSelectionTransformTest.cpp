@@ -0,0 +1,164 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Page2D selection transforms on EngineeringParallelFor (Cad2DSelectionTransform.h): for lines and
+// polylines, selected or not, deleted, on another page, and dropped by a degenerate transform, the
+// output must be bit-identical to the serial loop ApplyTransform2DToSelection used before, for
+// every thread count, with each picked record transformed exactly once.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "Cad2DSelectionTransform.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr uint64_t kContainer = 7;
+
+struct Page {
+    std::vector<Cad2DLineRecordCPU> lines;
+    std::vector<Cad2DPolylineRecordCPU> polylines;
+    std::unordered_set<uint64_t> selected;
+};
+
+Page MakePage(size_t lineCount, size_t polylineCount, uint64_t seed) {
+    std::mt19937_64 random(seed);
+    std::uniform_real_distribution<double> coordinate(-1.0e5, 1.0e5);
+    Page page;
+    uint64_t id = 1;
+    auto place = [&](auto& record) {
+        record.objectId = id++;
+        record.containerMemoryId = random() % 10 == 0 ? kContainer + 1 : kContainer;
+        record.isDeleted = random() % 20 == 0;
+        record.persistedId = record.objectId + 1000;
+        if (random() % 3 != 0) page.selected.insert(record.objectId);
+    };
+    page.lines.resize(lineCount);
+    for (Cad2DLineRecordCPU& line : page.lines) {
+        place(line);
+        line.x1 = coordinate(random); line.y1 = coordinate(random);
+        // One in sixteen is zero length, which the offset drops.
+        line.x2 = random() % 16 == 0 ? line.x1 : coordinate(random);
+        line.y2 = line.x2 == line.x1 ? line.y1 : coordinate(random);
+    }
+    page.polylines.resize(polylineCount);
+    for (Cad2DPolylineRecordCPU& polyline : page.polylines) {
+        place(polyline);
+        polyline.points.resize(2 + random() % 30);
+        for (Cad2DPoint2D& p : polyline.points) p = { coordinate(random), coordinate(random) };
+    }
+    return page;
+}
+
+// ApplyTransform2DToSelection's line transforms: a rigid map, or an offset that drops zero length.
+bool TransformLine(const Cad2DLineRecordCPU& r, Cad2DLineRecordCPU& out, const Cad2DPointMapper& map, bool offset) {
+    if (offset) {
+        const double dirX = r.x2 - r.x1, dirY = r.y2 - r.y1;
+        const double len = std::hypot(dirX, dirY);
+        if (len <= 1.0e-12) return false;
+        out.x1 += -dirY / len * 25.0; out.y1 += dirX / len * 25.0;
+        out.x2 += -dirY / len * 25.0; out.y2 += dirX / len * 25.0;
+    } else {
+        const Cad2DPoint2D a = map.Map(r.x1, r.y1), b = map.Map(r.x2, r.y2);
+        out.x1 = a.x; out.y1 = a.y; out.x2 = b.x; out.y2 = b.y;
+    }
+    out.objectId = 0; // As a copy: asNewObject.
+    out.persistedId = 0;
+    return true;
+}
+
+bool TransformPolyline(const Cad2DPolylineRecordCPU&, Cad2DPolylineRecordCPU& out, const Cad2DPointMapper& map) {
+    for (Cad2DPoint2D& p : out.points) p = map.Map(p.x, p.y);
+    return true;
+}
+
+bool SameLine(const Cad2DLineRecordCPU& a, const Cad2DLineRecordCPU& b) {
+    return a.objectId == b.objectId && a.containerMemoryId == b.containerMemoryId && a.persistedId == b.persistedId &&
+        std::memcmp(&a.x1, &b.x1, sizeof(double)) == 0 && std::memcmp(&a.y1, &b.y1, sizeof(double)) == 0 &&
+        std::memcmp(&a.x2, &b.x2, sizeof(double)) == 0 && std::memcmp(&a.y2, &b.y2, sizeof(double)) == 0;
+}
+
+bool SamePolyline(const Cad2DPolylineRecordCPU& a, const Cad2DPolylineRecordCPU& b) {
+    return a.objectId == b.objectId && a.points.size() == b.points.size() &&
+        std::memcmp(a.points.data(), b.points.data(), a.points.size() * sizeof(Cad2DPoint2D)) == 0;
+}
+
+void Compare(size_t lineCount, size_t polylineCount, uint64_t seed) {
+    const Page page = MakePage(lineCount, polylineCount, seed);
+    Cad2DPointMapper map;
+    const double c = std::cos(0.3), s = std::sin(0.3);
+    map.pivotX = 1.0; map.pivotY = 2.0; map.baseX = 5.0; map.baseY = 6.0;
+    map.m00 = c; map.m01 = -s; map.m10 = s; map.m11 = c;
+    auto wanted = [&](const auto& r) {
+        return !r.isDeleted && r.containerMemoryId == kContainer && page.selected.count(r.objectId) != 0;
+    };
+
+    for (bool offset : { false, true }) {
+        // The serial loop ApplyTransform2DToSelection ran before.
+        std::vector<Cad2DLineRecordCPU> serialLines;
+        std::vector<Cad2DPolylineRecordCPU> serialPolylines;
+        for (const Cad2DLineRecordCPU& r : page.lines) {
+            if (!wanted(r)) continue;
+            Cad2DLineRecordCPU out = r;
+            if (TransformLine(r, out, map, offset)) serialLines.push_back(out);
+        }
+        for (const Cad2DPolylineRecordCPU& r : page.polylines) {
+            if (!wanted(r)) continue;
+            Cad2DPolylineRecordCPU out = r;
+            if (TransformPolyline(r, out, map)) serialPolylines.push_back(std::move(out));
+        }
+
+        for (unsigned threads : { 1u, 2u, 4u, 16u }) {
+            EngineeringParallelFor pool(threads);
+            std::atomic<size_t> calls{ 0 };
+            std::vector<Cad2DLineRecordCPU> lines;
+            std::vector<Cad2DPolylineRecordCPU> polylines;
+            Cad2DTransformSelectedRecords(pool, page.lines, lines, wanted,
+                [&](const Cad2DLineRecordCPU& r, Cad2DLineRecordCPU& out) {
+                    calls.fetch_add(1, std::memory_order_relaxed);
+                    return TransformLine(r, out, map, offset);
+                });
+            Cad2DTransformSelectedRecords(pool, page.polylines, polylines, wanted,
+                [&](const Cad2DPolylineRecordCPU& r, Cad2DPolylineRecordCPU& out) {
+                    calls.fetch_add(1, std::memory_order_relaxed);
+                    return TransformPolyline(r, out, map);
+                });
+
+            size_t pickedCount = 0;
+            for (const Cad2DLineRecordCPU& r : page.lines) pickedCount += wanted(r) ? 1 : 0;
+            for (const Cad2DPolylineRecordCPU& r : page.polylines) pickedCount += wanted(r) ? 1 : 0;
+            CHECK(calls.load() == pickedCount);
+
+            CHECK(lines.size() == serialLines.size());
+            CHECK(polylines.size() == serialPolylines.size());
+            for (size_t i = 0; i < (std::min)(lines.size(), serialLines.size()); ++i) CHECK(SameLine(lines[i], serialLines[i]));
+            for (size_t i = 0; i < (std::min)(polylines.size(), serialPolylines.size()); ++i) {
+                CHECK(SamePolyline(polylines[i], serialPolylines[i]));
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    Compare(0, 0, 1);          // Empty page.
+    Compare(40, 10, 2);        // Below EngineeringParallelFor's parallel threshold: runs inline.
+    Compare(60000, 8000, 3);   // Many chunks per thread.
+
+    // Outputs are appended: what the caller already holds stays in front.
+    const Page page = MakePage(1000, 0, 4);
+    EngineeringParallelFor pool(4);
+    std::vector<Cad2DLineRecordCPU> lines(3);
+    Cad2DTransformSelectedRecords(pool, page.lines, lines, [](const Cad2DLineRecordCPU&) { return true; },
+        [](const Cad2DLineRecordCPU&, Cad2DLineRecordCPU&) { return true; });
+    CHECK(lines.size() == 1003);
+    CHECK(lines[0].objectId == 0 && lines[3].objectId == page.lines[0].objectId);
+    CHECK(lines.back().objectId == page.lines.back().objectId);
+
+    return ValidationExitCode();
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Icon atlas build (BuildIconAtlasImage) per monitor, cold and warm, at 1x, 1.5x and 2x the 24 px
+// cell: 100%, 150% and 200% display scaling. Cold rasterizes every embedded SVG with lunasvg, packs
+// and stores the atlas; warm maps the stored file. The warm time is given with and without reading
+// every pixel once, as the texture upload does, so page faults on the mapping are counted too.
+// Built only when the lunasvg submodule is checked out (CMakeLists.txt). Uses its own cache folder.
+// Argument: runs per cell size (default 5); the best run is reported.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+#include "IconAtlasImage.h"
+#include "ValidationCheck.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// What the upload costs on top of the mapping: one pass over the pixels.
+uint32_t ReadEveryPixel(const IconAtlasImage& atlas) {
+    uint32_t sum = 0;
+    const uint8_t* pixels = atlas.Pixels();
+    for (size_t i = 0; i < atlas.PixelBytes(); i += 4) sum += pixels[i + 3];
+    return sum;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const size_t runs = (std::max)(ValidationSizeArgument(argc, argv, 5), size_t{ 1 });
+    const fs::path scratch = fs::current_path() / "IconAtlasBenchmark.cache";
+    fs::remove_all(scratch);
+    fs::create_directories(scratch);
+#ifndef _WIN32
+    setenv("XDG_CACHE_HOME", scratch.c_str(), 1);
+#endif
+
+    std::printf("%zu run(s) per cell size, best reported\n", runs);
+    for (const int cellSize : { 24, 36, 48 }) {
+        double rasterizeMs = 1e30, coldMs = 1e30, warmMs = 1e30, warmReadMs = 1e30;
+        IconAtlasImage reference;
+        for (size_t run = 0; run < runs; ++run) {
+            fs::remove(IconAtlasCachePath(cellSize));
+            rasterizeMs = (std::min)(rasterizeMs,
+                TimeMilliseconds([&] { SVGIconRenderer::RenderEmbeddedSVGIcons(cellSize); }));
+            IconAtlasImage cold;
+            coldMs = (std::min)(coldMs, TimeMilliseconds([&] { cold = BuildIconAtlasImage(cellSize); }));
+            CHECK(!cold.FromCache());
+
+            IconAtlasImage warm;
+            warmMs = (std::min)(warmMs, TimeMilliseconds([&] { warm = BuildIconAtlasImage(cellSize); }));
+            CHECK(warm.FromCache());
+            uint32_t warmSum = 0;
+            warmReadMs = (std::min)(warmReadMs, TimeMilliseconds([&] {
+                IconAtlasImage mapped = BuildIconAtlasImage(cellSize);
+                warmSum = ReadEveryPixel(mapped);
+            }));
+            CHECK(warmSum == ReadEveryPixel(cold));
+            CHECK(warm.width == cold.width && warm.cells.size() == cold.cells.size());
+            if (run == 0) reference = std::move(cold);
+        }
+        std::printf("  %2d px cell (%.1fx), %dx%d atlas, %zu icons:\n", cellSize, cellSize / 24.0, reference.width,
+            reference.height, reference.cells.size());
+        std::printf("    cold: %.2f ms (rasterize alone %.2f ms)\n", coldMs, rasterizeMs);
+        std::printf("    warm: %.3f ms mapped, %.3f ms with every pixel read\n", warmMs, warmReadMs);
+    }
+
+    fs::remove_all(scratch);
+    return ValidationExitCode();
+}
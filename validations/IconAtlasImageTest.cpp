@@ -0,0 +1,183 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// The icon atlas cache (IconAtlasImage.h): a stored atlas maps back with the same pixels, cells and
+// 9-slice; a warm BuildIconAtlasImage rasterizes nothing and equals the cold one; a missing,
+// foreign, truncated or damaged file falls back to packing. The rasterizer is a stand-in (the real
+// one needs lunasvg) drawing a few square icons and one wide one, as the word-mark is.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "IconAtlasImage.h"
+#include "ValidationCheck.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+uint64_t manifestHash = 0x5EED0001ull;
+int rasterizations = 0;
+
+SVGIconRenderer::RenderedSVGIcon StandInIcon(uint32_t id, int width, int height) {
+    SVGIconRenderer::RenderedSVGIcon icon;
+    icon.id = id;
+    icon.width = width;
+    icon.height = height;
+    icon.rgba.resize(static_cast<size_t>(width) * height * 4u);
+    for (size_t i = 0; i < icon.rgba.size(); ++i) icon.rgba[i] = static_cast<uint8_t>(i * 31u + id);
+    return icon;
+}
+
+}
+
+// Stand-ins for SVGIconRenderer.cpp.
+namespace SVGIconRenderer {
+std::vector<RenderedSVGIcon> RenderEmbeddedSVGIcons(int pixelSize) {
+    ++rasterizations;
+    std::vector<RenderedSVGIcon> icons;
+    for (uint32_t id = 0xE200; id < 0xE20C; ++id) icons.push_back(StandInIcon(id, pixelSize, pixelSize));
+    icons.push_back(StandInIcon(0xE300, pixelSize * 5 / 2, pixelSize)); // Wide: a run of 3 cells.
+    return icons;
+}
+uint64_t EmbeddedManifestHash() noexcept { return manifestHash; }
+uint32_t RasterizerVersion() noexcept { return 30100; }
+}
+
+namespace {
+
+bool SameRect(const IconAtlasRect& a, const IconAtlasRect& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+bool SameAtlas(const IconAtlasImage& a, const IconAtlasImage& b) {
+    if (a.width != b.width || a.height != b.height || a.cells.size() != b.cells.size()) return false;
+    for (size_t i = 0; i < a.cells.size(); ++i) {
+        if (a.cells[i].codepoint != b.cells[i].codepoint || !SameRect(a.cells[i].rect, b.cells[i].rect) ||
+            a.cells[i].inFallbackPool != b.cells[i].inFallbackPool) return false;
+    }
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            if (!SameRect(a.roundedRectangle[row][col], b.roundedRectangle[row][col])) return false;
+        }
+    }
+    return std::memcmp(a.Pixels(), b.Pixels(), a.PixelBytes()) == 0;
+}
+
+std::vector<char> ReadFile(const fs::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const fs::path& path, const std::vector<char>& bytes) {
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+void CheckPacking(const IconAtlasImage& atlas, int cellSize) {
+    CHECK(atlas.cells.size() == kIconPlaceholderCodepoints.size() + 13);
+    for (size_t i = 0; i < atlas.cells.size(); ++i) {
+        const IconAtlasCell& cell = atlas.cells[i];
+        const bool placeholder = i < kIconPlaceholderCodepoints.size();
+        CHECK(cell.inFallbackPool == (placeholder ? 1u : 0u));
+        if (placeholder) CHECK(cell.codepoint == kIconPlaceholderCodepoints[i]);
+        CHECK(cell.rect.height == cellSize);
+        CHECK(cell.rect.x >= 0 && cell.rect.x + cell.rect.width <= atlas.width);
+        CHECK(cell.rect.y >= 0 && cell.rect.y + cell.rect.height <= atlas.height);
+        for (size_t j = 0; j < i; ++j) {
+            const IconAtlasRect& a = cell.rect;
+            const IconAtlasRect& b = atlas.cells[j].rect;
+            CHECK(a.x >= b.x + b.width || b.x >= a.x + a.width || a.y >= b.y + b.height || b.y >= a.y + a.height);
+        }
+    }
+    CHECK(atlas.cells.back().codepoint == U'\uE300');
+    CHECK(atlas.cells.back().rect.width > 2 * cellSize); // The wide icon's run spans 3 cells and their gaps.
+}
+
+}
+
+int main() {
+    // Keep the cache out of the user's own: the XDG folder is the one AssetCache uses off Windows.
+    const fs::path scratch = fs::current_path() / "IconAtlasImageTest.cache";
+    fs::remove_all(scratch);
+    fs::create_directories(scratch);
+#ifndef _WIN32
+    setenv("XDG_CACHE_HOME", scratch.c_str(), 1);
+#endif
+
+    // Pack, store, map back.
+    const IconAtlasImage packed = PackIconAtlas(24, SVGIconRenderer::RenderEmbeddedSVGIcons(24));
+    CheckPacking(packed, 24);
+    CHECK(!packed.FromCache());
+    const fs::path file = scratch / "atlas.bin";
+    CHECK(StoreIconAtlas(file, 24, packed));
+    IconAtlasImage loaded;
+    CHECK(LoadIconAtlas(file, 24, loaded));
+    CHECK(loaded.FromCache());
+    CHECK(SameAtlas(packed, loaded));
+    CHECK(reinterpret_cast<uintptr_t>(loaded.Pixels()) % 64 == 0);
+    const IconAtlasImage moved = std::move(loaded); // The mapping, and the pixel pointer into it, move along.
+    CHECK(moved.FromCache() && SameAtlas(packed, moved));
+
+    // Anything not written by this build for this cell size is refused, leaving `out` as it was.
+    IconAtlasImage refused;
+    CHECK(!LoadIconAtlas(file, 36, refused));
+    CHECK(refused.width == 0 && refused.cells.empty() && !refused.FromCache());
+    CHECK(!LoadIconAtlas(scratch / "missing.bin", 24, refused));
+    manifestHash ^= 1;
+    CHECK(!LoadIconAtlas(file, 24, refused));
+    manifestHash ^= 1;
+    const std::vector<char> good = ReadFile(file);
+    std::vector<char> bad(good.begin(), good.end() - 1);
+    WriteFile(scratch / "truncated.bin", bad);
+    CHECK(!LoadIconAtlas(scratch / "truncated.bin", 24, refused));
+    bad = good;
+    // The first cell's x, just past the right edge; cells follow the 184-byte header.
+    const int32_t outside = packed.width;
+    std::memcpy(bad.data() + 184 + offsetof(IconAtlasCell, rect), &outside, sizeof(outside));
+    WriteFile(scratch / "damaged.bin", bad);
+    CHECK(!LoadIconAtlas(scratch / "damaged.bin", 24, refused));
+    bad = good;
+    bad[0] = 'X';
+    WriteFile(scratch / "foreign.bin", bad);
+    CHECK(!LoadIconAtlas(scratch / "foreign.bin", 24, refused));
+    CHECK(refused.cells.empty());
+
+    // BuildIconAtlasImage: cold packs and stores, warm maps what cold stored.
+#ifndef _WIN32
+    CHECK(IconAtlasCachePath(24).string().rfind(scratch.string(), 0) == 0);
+#endif
+    for (const int cellSize : { 24, 36, 48 }) fs::remove(IconAtlasCachePath(cellSize));
+    rasterizations = 0;
+    for (const int cellSize : { 24, 36, 48 }) {
+        const IconAtlasImage cold = BuildIconAtlasImage(cellSize);
+        CHECK(!cold.FromCache());
+        CheckPacking(cold, cellSize);
+        const IconAtlasImage warm = BuildIconAtlasImage(cellSize);
+        CHECK(warm.FromCache());
+        CHECK(SameAtlas(cold, warm));
+    }
+    CHECK(rasterizations == 3);
+
+    // A different manifest is a different key: cold again, and the old file is left alone.
+    manifestHash += 1;
+    CHECK(!BuildIconAtlasImage(24).FromCache());
+    CHECK(rasterizations == 4);
+    manifestHash -= 1;
+    CHECK(BuildIconAtlasImage(24).FromCache());
+
+    // A damaged cache file is repacked and rewritten.
+    WriteFile(IconAtlasCachePath(36), std::vector<char>(100, '\0'));
+    CHECK(!BuildIconAtlasImage(36).FromCache());
+    CHECK(BuildIconAtlasImage(36).FromCache());
+    CHECK(rasterizations == 5);
+
+    for (const int cellSize : { 24, 36, 48 }) fs::remove(IconAtlasCachePath(cellSize));
+    manifestHash += 1;
+    fs::remove(IconAtlasCachePath(24));
+    fs::remove_all(scratch);
+    return ValidationExitCode();
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Object construction of a STAAD import (ImportStdFileIntoTab) at 1 to 16 threads. Each 4096-entity
+// batch reserves its memory IDs, is constructed on EngineeringParallelFor with one राम::ChunkArena
+// per slot, and is then registered on the calling thread in arrival order. The serial path it
+// replaced, which drew IDs one by one through the tab's shared active chunk, is timed alongside.
+// The objects are stand-ins of LINE_MEMBER's size with the same per-member work: catalog row, end
+// points, parameters. The real classes need DirectXMath, and tessellation, which the import runs
+// in the same parallel pass, is left out. Every thread count must give the 1-thread run's objects,
+// IDs included, in the same order.
+// Argument: member count (default 300k).
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "EngineeringParallelFor.h"
+#include "ID.h"
+#include "MemoryManagerCPU.h"
+#include "SteelProfileCatalog.h"
+#include "ValidationCheck.h"
+
+राम cpu; // As विश्वकर्मा.cpp defines it for the application; डेटा.h declares it.
+
+namespace {
+
+constexpr size_t kBatchEntities = 4096; // As the worker streams them (kMaxImportBatchEntities).
+
+struct Point3 { float x, y, z; };
+
+struct ImportedMember {
+    uint32_t startNode, endNode;
+    SteelProfileIndex profile;
+    double userParameter1, userParameter2;
+};
+
+// META_DATA's fields and a LINE_MEMBER's, allocated the way META_DATA's operator new does.
+struct MemberObject {
+    uint64_t memoryID, memoryIDParent = 0, persistedId = 0, persistedParentId = 0;
+    uint32_t xxxFileIndex = 0;
+    uint16_t dataType = 0, schemaVersion = 0;
+    uint64_t dataVersion = 1;
+    bool isDeleted = false;
+    Point3 point1 = {}, point2 = {};
+    uint64_t profileId = 0;
+    uint64_t colorMain = 0, colorInner = 0, colorCap = 0;
+    float userParameter1 = 0.0f, userParameter2 = 0.0f;
+    uint64_t optionalFieldsFlags = 0;
+    uint32_t systemFlags = 0, objectLifeCycleFlags = 0;
+    float placement[16] = {};
+
+    MemberObject() : memoryID(MemoryID::next()) {}
+    void* operator new(size_t size, uint32_t memoryGroupNo) { return cpu.Allocate(size, memoryGroupNo); }
+    void operator delete(void* ptr, uint32_t) { cpu.Free(static_cast<std::byte*>(ptr)); }
+};
+
+MemberObject* ConstructMember(uint32_t memoryGroupNo, const ImportedMember& member, const std::vector<Point3>& nodes) {
+    MemberObject* object = new (memoryGroupNo) MemberObject();
+    object->point1 = nodes[member.startNode];
+    object->point2 = nodes[member.endNode];
+    object->profileId = member.profile != kNoSteelProfile ? kSteelProfiles[member.profile].id : 0;
+    object->userParameter1 = static_cast<float>(member.userParameter1 * 1000.0);
+    object->userParameter2 = static_cast<float>(member.userParameter2 * 1000.0);
+    object->colorMain = object->colorInner = object->colorCap = 0x3C003B663A663B00ull;
+    return object;
+}
+
+// The tab's side of registration: the ID index and the arrival-ordered object list.
+struct Registered {
+    std::unordered_map<uint64_t, MemberObject*> byMemoryId;
+    std::vector<MemberObject*> objects;
+};
+
+void Register(Registered& tab, MemberObject* object) {
+    tab.byMemoryId.emplace(object->memoryID, object);
+    tab.objects.push_back(object);
+}
+
+// The serial path: construct in arrival order through the tab's active chunk, IDs one at a time.
+void ImportSerially(uint32_t memoryGroupNo, const std::vector<ImportedMember>& members,
+    const std::vector<Point3>& nodes, Registered& tab) {
+    for (const ImportedMember& member : members) {
+        if (member.startNode == member.endNode) continue; // Zero-length: skipped, as the import does.
+        Register(tab, ConstructMember(memoryGroupNo, member, nodes));
+    }
+}
+
+// The parallel path, batch by batch as ImportStdFileIntoTab runs it.
+void ImportInParallel(uint32_t memoryGroupNo, unsigned threads, const std::vector<ImportedMember>& members,
+    const std::vector<Point3>& nodes, Registered& tab, double& registrationMs) {
+    EngineeringParallelFor construction(threads);
+    std::vector<राम::ChunkArena> arenas(construction.SlotCount(), राम::ChunkArena{ memoryGroupNo, nullptr });
+    std::vector<MemberObject*> batchObjects;
+    for (size_t batchStart = 0; batchStart < members.size(); batchStart += kBatchEntities) {
+        const size_t count = (std::min)(kBatchEntities, members.size() - batchStart);
+        batchObjects.assign(count, nullptr);
+        const uint64_t firstMemoryId = MemoryID::reserve(count);
+        construction.RunWithSlots(count, [&](size_t i, unsigned slot) {
+            const ImportedMember& member = members[batchStart + i];
+            if (member.startNode == member.endNode) return;
+            राम::ArenaScope arena(arenas[slot]);
+            MemoryID::assignNext(firstMemoryId + i);
+            batchObjects[i] = ConstructMember(memoryGroupNo, member, nodes);
+        });
+        registrationMs += TimeMilliseconds([&] {
+            for (MemberObject* object : batchObjects) {
+                if (object) Register(tab, object);
+            }
+        });
+    }
+}
+
+// Same fields in the same order, IDs compared relative to each run's first.
+bool SameObjects(const Registered& a, const Registered& b) {
+    if (a.objects.size() != b.objects.size()) return false;
+    if (a.objects.empty()) return true;
+    const uint64_t baseA = a.objects[0]->memoryID, baseB = b.objects[0]->memoryID;
+    auto samePoint = [](const Point3& p, const Point3& q) { return p.x == q.x && p.y == q.y && p.z == q.z; };
+    for (size_t i = 0; i < a.objects.size(); ++i) {
+        const MemberObject& x = *a.objects[i];
+        const MemberObject& y = *b.objects[i];
+        if (x.memoryID - baseA != y.memoryID - baseB || !samePoint(x.point1, y.point1) ||
+            !samePoint(x.point2, y.point2) || x.profileId != y.profileId ||
+            x.userParameter1 != y.userParameter1 || x.userParameter2 != y.userParameter2) return false;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    const size_t memberCount = ValidationSizeArgument(argc, argv, 300000);
+
+    // A frame: three members per node, every ninth member unmapped (a placeholder pipe in the
+    // import), a few zero-length ones.
+    const size_t nodeCount = memberCount / 3 + 2;
+    std::vector<Point3> nodes(nodeCount);
+    for (size_t n = 0; n < nodeCount; ++n) {
+        nodes[n] = { float(n % 100) * 3.0f, float((n / 100) % 100) * 3.0f, float(n / 10000) * 4.0f };
+    }
+    std::vector<ImportedMember> members(memberCount);
+    for (size_t i = 0; i < memberCount; ++i) {
+        const uint32_t start = uint32_t(i / 3);
+        const uint32_t end = i % 997 == 0 ? start : uint32_t((start + 1 + (i % 3) * 99) % nodeCount);
+        const SteelProfileIndex profile = i % 9 == 0 ? kNoSteelProfile : SteelProfileIndex(i % kSteelProfileCount);
+        members[i] = { start, end, profile, double(i % 5) * 0.05, double(i % 7) * 0.05 };
+    }
+
+    // The allocator logs every chunk it acquires and releases; muted for the runs.
+    std::cout.setstate(std::ios::failbit);
+    uint32_t memoryGroupNo = 100; // A fresh tab per run, closed afterwards.
+    Registered serial;
+    const double serialMs = TimeMilliseconds([&] { ImportSerially(memoryGroupNo, members, nodes, serial); });
+    const size_t objectCount = serial.objects.size();
+    cpu.notifyTabClosed(memoryGroupNo++);
+
+    std::cout.clear();
+    std::printf("%zu members -> %zu objects of %zu bytes, %u hardware threads\n", memberCount, objectCount,
+        sizeof(MemberObject), std::thread::hardware_concurrency());
+    std::printf("  serial, shared active chunk: %.1f ms\n", serialMs);
+
+    Registered reference;
+    const uint32_t referenceGroupNo = memoryGroupNo; // Kept open until every run is compared with it.
+    for (unsigned threads : { 1u, 2u, 4u, 8u, 16u }) {
+        Registered tab;
+        double registrationMs = 0.0;
+        std::cout.setstate(std::ios::failbit);
+        const double totalMs = TimeMilliseconds([&] {
+            ImportInParallel(memoryGroupNo, threads, members, nodes, tab, registrationMs);
+        });
+        CHECK(tab.objects.size() == objectCount);
+        CHECK(tab.byMemoryId.size() == objectCount); // No ID handed out twice.
+        if (threads == 1) {
+            reference = std::move(tab);
+        } else {
+            CHECK(SameObjects(reference, tab));
+            cpu.notifyTabClosed(memoryGroupNo);
+        }
+        ++memoryGroupNo;
+        std::cout.clear();
+        std::printf("  %2u thread(s), per-slot arenas: %.1f ms (registration %.1f ms)\n", threads, totalMs,
+            registrationMs);
+    }
+    std::cout.setstate(std::ios::failbit);
+    cpu.notifyTabClosed(referenceGroupNo);
+    std::cout.clear();
+    return ValidationExitCode();
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Startup cost of the MSDF font tables, on the synthetic atlas of msdf_atlas_fixture.py:
+//   before: the glyph table was an inline std::unordered_map built by a static initializer before
+//           main, the pixels were copied into an AtlasBitmap, and glyphLookup grew as it was filled;
+//   now:    the table and pixels are constant data used in place, and glyphLookup is reserved
+//           (BuildMSDFFontAtlas).
+// Both must produce the same glyphLookup. Argument: repetitions (default 200).
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+#include "NotoSansMSDF_Compiled.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+struct Glyph { // As UserInterface.h's.
+    float uvMinX, uvMinY, uvMaxX, uvMaxY;
+    int width, height;
+    int bearingX, bearingY;
+    int advanceX;
+};
+
+// BuildMSDFFontAtlas's per-glyph conversion to pixel metrics.
+Glyph ToGlyph(const MSDFGlyph& msdf, int atlasWidth, int atlasHeight) {
+    Glyph glyph{};
+    glyph.uvMinX = msdf.atlasLeft / (float)atlasWidth;
+    glyph.uvMaxX = msdf.atlasRight / (float)atlasWidth;
+    glyph.uvMinY = ((float)atlasHeight - msdf.atlasTop) / (float)atlasHeight;
+    glyph.uvMaxY = ((float)atlasHeight - msdf.atlasBottom) / (float)atlasHeight;
+    glyph.width = std::max(0, (int)std::ceil((msdf.planeRight - msdf.planeLeft) * NotoSansMSDF_Size));
+    glyph.height = std::max(0, (int)std::ceil((msdf.planeTop - msdf.planeBottom) * NotoSansMSDF_Size));
+    glyph.bearingX = (int)std::floor(msdf.planeLeft * NotoSansMSDF_Size);
+    glyph.bearingY = (int)std::ceil(msdf.planeTop * NotoSansMSDF_Size);
+    glyph.advanceX = std::max(0, (int)std::round(msdf.advance * NotoSansMSDF_Size));
+    return glyph;
+}
+
+bool SameLookup(const std::unordered_map<char32_t, Glyph>& a, const std::unordered_map<char32_t, Glyph>& b) {
+    if (a.size() != b.size()) return false;
+    for (const auto& [codepoint, glyph] : a) {
+        auto it = b.find(codepoint);
+        if (it == b.end() || std::memcmp(&glyph, &it->second, sizeof(Glyph)) != 0) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t repetitions = ValidationSizeArgument(argc, argv, 200);
+    const size_t pixelBytes = std::size(NotoSansMSDF_Pixels);
+    std::printf("%zu glyphs, %dx%d atlas (%zu KB), mean of %zu startups\n", std::size(NotoSansMSDF_Glyphs),
+        NotoSansMSDF_Width, NotoSansMSDF_Height, pixelBytes / 1024, repetitions);
+
+    std::unordered_map<char32_t, Glyph> before, now;
+    size_t checksum = 0;
+    const double beforeMs = TimeMilliseconds([&] {
+        for (size_t r = 0; r < repetitions; ++r) {
+            // The static initializer: the map was built from a brace list of (codepoint, glyph) pairs.
+            std::unordered_map<char32_t, MSDFGlyph> table;
+            for (const MSDFGlyphEntry& entry : NotoSansMSDF_Glyphs) table.emplace(entry.codepoint, entry.glyph);
+            std::vector<uint8_t> pixels(NotoSansMSDF_Pixels, NotoSansMSDF_Pixels + pixelBytes);
+            std::unordered_map<char32_t, Glyph> lookup;
+            for (const auto& [codepoint, msdf] : table) lookup[codepoint] = ToGlyph(msdf, NotoSansMSDF_Width, NotoSansMSDF_Height);
+            checksum += pixels[r % pixels.size()];
+            if (r + 1 == repetitions) before = std::move(lookup);
+        }
+    });
+    const double nowMs = TimeMilliseconds([&] {
+        for (size_t r = 0; r < repetitions; ++r) {
+            const uint8_t* pixels = NotoSansMSDF_Pixels;
+            std::unordered_map<char32_t, Glyph> lookup;
+            lookup.reserve(std::size(NotoSansMSDF_Glyphs));
+            for (const MSDFGlyphEntry& entry : NotoSansMSDF_Glyphs) {
+                lookup[entry.codepoint] = ToGlyph(entry.glyph, NotoSansMSDF_Width, NotoSansMSDF_Height);
+            }
+            checksum += pixels[r % pixelBytes];
+            if (r + 1 == repetitions) now = std::move(lookup);
+        }
+    });
+
+    CHECK(SameLookup(before, now));
+    CHECK(checksum > 0);
+    std::printf("  before: %8.1f us per startup\n  now:    %8.1f us per startup\n",
+        1000.0 * beforeMs / repetitions, 1000.0 * nowMs / repetitions);
+    return ValidationExitCode();
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// The MSDF font header as msdf_atlas_json_parser.py writes it, from the synthetic atlas of
+// msdf_atlas_fixture.py: the glyph table is a constant expression (so it sits in read-only data
+// with no static initializer), sorted and unique by codepoint, holds every Unicode-mapped glyph of
+// the JSON with its values intact and none of the index-only ones, and the pixels are the atlas's
+// RGBA bytes row by row.
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "NotoSansMSDF_Compiled.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr bool StrictlyAscending() {
+    for (size_t i = 1; i < std::size(NotoSansMSDF_Glyphs); ++i) {
+        if (NotoSansMSDF_Glyphs[i - 1].codepoint >= NotoSansMSDF_Glyphs[i].codepoint) return false;
+    }
+    return true;
+}
+// Evaluated by the compiler: a table that needed running code to build would not compile here.
+static_assert(StrictlyAscending(), "NotoSansMSDF_Glyphs must be sorted by codepoint, without repeats");
+static_assert(NotoSansMSDF_Glyphs[0].codepoint == U' ');
+
+// msdf_atlas_fixture.py's fixture_codepoints and fixture_glyph.
+std::vector<char32_t> FixtureCodepoints(size_t count) {
+    std::vector<char32_t> codepoints;
+    for (char32_t c = 0x20; c < 0x7F; ++c) codepoints.push_back(c);
+    for (char32_t c = 0x900; c < 0x980; ++c) codepoints.push_back(c);
+    for (char32_t c = 0x100; codepoints.size() < count; ++c) {
+        if (c < 0x900 || c >= 0x980) codepoints.push_back(c);
+    }
+    codepoints.resize(count);
+    std::sort(codepoints.begin(), codepoints.end());
+    return codepoints;
+}
+
+MSDFGlyph FixtureGlyph(char32_t codepoint) {
+    MSDFGlyph glyph{};
+    glyph.advance = 0.25f + static_cast<float>(codepoint % 7) * 0.0625f;
+    if (codepoint == U' ') return glyph; // Whitespace: no bounds in the JSON, zeros in the table.
+    const float k = static_cast<float>(codepoint % 64);
+    const float row = static_cast<float>(codepoint % 61);
+    glyph.planeLeft = -0.125f;
+    glyph.planeBottom = -0.25f;
+    glyph.planeRight = 0.5f + k / 128.0f;
+    glyph.planeTop = 0.75f;
+    glyph.atlasLeft = k * 8.0f + 0.5f;
+    glyph.atlasBottom = row + 0.5f;
+    glyph.atlasRight = k * 8.0f + 6.5f;
+    glyph.atlasTop = row + 10.5f;
+    return glyph;
+}
+
+bool SameGlyph(const MSDFGlyph& a, const MSDFGlyph& b) {
+    return a.advance == b.advance && a.planeLeft == b.planeLeft && a.planeBottom == b.planeBottom &&
+        a.planeRight == b.planeRight && a.planeTop == b.planeTop && a.atlasLeft == b.atlasLeft &&
+        a.atlasBottom == b.atlasBottom && a.atlasRight == b.atlasRight && a.atlasTop == b.atlasTop;
+}
+
+} // namespace
+
+int main() {
+    CHECK(NotoSansMSDF_Width == MSDF_FIXTURE_SIZE && NotoSansMSDF_Height == MSDF_FIXTURE_SIZE);
+    CHECK(NotoSansMSDF_Size == 48.0f && NotoSansMSDF_PxRange == 6.0f);
+    CHECK(NotoSansMSDF_Ascender == 1.069f && NotoSansMSDF_Descender == -0.293f && NotoSansMSDF_LineHeight == 1.362f);
+
+    // Every Unicode-mapped glyph, once, in order; the index-only glyph is not there.
+    const std::vector<char32_t> codepoints = FixtureCodepoints(MSDF_FIXTURE_GLYPHS);
+    CHECK(std::size(NotoSansMSDF_Glyphs) == codepoints.size());
+    for (size_t i = 0; i < (std::min)(std::size(NotoSansMSDF_Glyphs), codepoints.size()); ++i) {
+        CHECK(NotoSansMSDF_Glyphs[i].codepoint == codepoints[i]);
+        CHECK(SameGlyph(NotoSansMSDF_Glyphs[i].glyph, FixtureGlyph(codepoints[i])));
+    }
+
+    CHECK(std::size(NotoSansMSDF_Pixels) == size_t{ 4 } * NotoSansMSDF_Width * NotoSansMSDF_Height);
+    for (int y = 0; y < NotoSansMSDF_Height; ++y) {
+        for (int x = 0; x < NotoSansMSDF_Width; ++x) {
+            const uint8_t* pixel = NotoSansMSDF_Pixels + 4 * (static_cast<size_t>(y) * NotoSansMSDF_Width + x);
+            CHECK(pixel[0] == x % 256 && pixel[1] == y % 256 && pixel[2] == (x ^ y) % 256 && pixel[3] == 255);
+        }
+    }
+    return ValidationExitCode();
+}
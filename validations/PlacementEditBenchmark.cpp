@@ -0,0 +1,114 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Latency of one TORUS center edit from the Properties Pane, committed both ways: as a Shape edit
+// (the mesh regenerated - TorusSurface plus GetGeometry's packing and indices - and its bytes copied
+// once, as the MODIFY carries them to the copy thread) and as the Placement edit it is (the origin
+// shifted, the 64-byte world matrix sent instead). At the application's 36 x 18 tessellation and at
+// finer ones up to the 16-bit index limit. The GPU side is not included: a regenerated mesh also
+// costs a geometry page clone there, a transform-only one an instance record.
+// Argument: edits per resolution (default 200).
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "PrimitiveSurfaces.h"
+#include "PropertyPane.h"
+#include "SceneExtentsMeshes.h" // Float3, Float4, RotatePoint, RandomRotation.
+#include "ValidationCheck.h"
+
+namespace {
+
+struct PackedVertex { Float3 position; uint32_t normal; }; // Vertex's 16 bytes.
+
+uint32_t PackNormal(const Float3& n) {
+    auto unit = [](float v) { return uint32_t((v * 0.5f + 0.5f) * 255.0f + 0.5f) & 0xFF; };
+    return unit(n.x) | (unit(n.y) << 8) | (unit(n.z) << 16);
+}
+
+struct Mesh {
+    std::vector<PackedVertex> vertices;
+    std::vector<uint16_t> indices;
+};
+
+// TORUS::GetGeometry at the given resolution.
+void Regenerate(const Float3& center, float majorRadius, float minorRadius, int majorSegments, int minorSegments,
+    Mesh& mesh) {
+    mesh.vertices.clear();
+    mesh.indices.clear();
+    mesh.vertices.reserve(size_t(majorSegments) * minorSegments);
+    mesh.indices.reserve(size_t(majorSegments) * minorSegments * 6);
+    TorusSurface(center, majorRadius, minorRadius, majorSegments, minorSegments,
+        [&](const Float3& position, const Float3& normal) { mesh.vertices.push_back({ position, PackNormal(normal) }); });
+    for (int i = 0; i < majorSegments; ++i) {
+        const int nextI = (i + 1) % majorSegments;
+        for (int j = 0; j < minorSegments; ++j) {
+            const int nextJ = (j + 1) % minorSegments;
+            const uint16_t a = uint16_t(i * minorSegments + j), b = uint16_t(nextI * minorSegments + j);
+            const uint16_t c = uint16_t(nextI * minorSegments + nextJ), d = uint16_t(i * minorSegments + nextJ);
+            mesh.indices.insert(mesh.indices.end(), { a, b, d, d, b, c });
+        }
+    }
+}
+
+// Placement3D::ToMatrix: rotate, then translate, row-vector layout.
+void WorldMatrix(const Float3& origin, const Float4& q, float matrix[16]) {
+    const float x = q.x, y = q.y, z = q.z, w = q.w;
+    const float rows[16] = {
+        1 - 2 * (y * y + z * z), 2 * (x * y + z * w), 2 * (x * z - y * w), 0,
+        2 * (x * y - z * w), 1 - 2 * (x * x + z * z), 2 * (y * z + x * w), 0,
+        2 * (x * z + y * w), 2 * (y * z - x * w), 1 - 2 * (x * x + y * y), 0,
+        origin.x, origin.y, origin.z, 1 };
+    std::memcpy(matrix, rows, sizeof(rows));
+}
+
+}
+
+int main(int argc, char** argv) {
+    const size_t edits = ValidationSizeArgument(argc, argv, 200);
+    std::mt19937 random(44);
+    std::uniform_real_distribution<float> move(-5.0f, 5.0f);
+    const float majorRadius = 2.0f, minorRadius = 0.5f;
+    const Float4 rotation = RandomRotation(random);
+    std::printf("TORUS center edit, mean of %zu edits\n", edits);
+    std::printf("  %-12s %9s %12s %12s %9s\n", "tessellation", "vertices", "regenerate", "transform", "ratio");
+
+    const int resolutions[][2] = { { 36, 18 }, { 96, 48 }, { 128, 128 }, { 256, 255 } };
+    for (const auto& resolution : resolutions) {
+        const int majorSegments = resolution[0], minorSegments = resolution[1];
+        Float3 center{ 10.0f, 5.0f, -3.0f };
+        Float3 origin{ 100.0f, 0.0f, 0.0f };
+        Mesh mesh;
+        std::vector<uint8_t> modify; // The MODIFY's payload.
+        const double regenerateMs = TimeMilliseconds([&] {
+            for (size_t e = 0; e < edits; ++e) {
+                center.x += move(random);
+                Regenerate(center, majorRadius, minorRadius, majorSegments, minorSegments, mesh);
+                const size_t vertexBytes = mesh.vertices.size() * sizeof(PackedVertex);
+                modify.resize(vertexBytes + mesh.indices.size() * sizeof(uint16_t));
+                std::memcpy(modify.data(), mesh.vertices.data(), vertexBytes);
+                std::memcpy(modify.data() + vertexBytes, mesh.indices.data(), mesh.indices.size() * sizeof(uint16_t));
+            }
+        });
+        CHECK(mesh.vertices.size() == size_t(majorSegments) * minorSegments);
+
+        float matrix[16] = {};
+        const double transformMs = TimeMilliseconds([&] {
+            for (size_t e = 0; e < edits; ++e) {
+                const Float3 rotated = RotatePoint(rotation, center);
+                const Float3 world{ rotated.x + origin.x, rotated.y + origin.y, rotated.z + origin.z };
+                origin = PlacementOriginForWorldValue(origin, world, 0, world.x + move(random));
+                WorldMatrix(origin, rotation, matrix);
+                modify.assign(reinterpret_cast<const uint8_t*>(matrix), reinterpret_cast<const uint8_t*>(matrix) + sizeof(matrix));
+            }
+        });
+        CHECK(modify.size() == 64);
+
+        const double regenerateUs = 1000.0 * regenerateMs / double(edits);
+        const double transformUs = 1000.0 * transformMs / double(edits);
+        std::printf("  %4d x %-5d %9zu %9.1f us %9.3f us %8.0fx\n", majorSegments, minorSegments, mesh.vertices.size(),
+            regenerateUs, transformUs, transformUs > 0.0 ? regenerateUs / transformUs : 0.0);
+    }
+    return ValidationExitCode();
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Every PropertyEditEffect::Placement field in kPropertyTables (PropertyPane.cpp) committed the
+// transform-only way - the placement origin shifted by PlacementOriginForWorldValue, the mesh left
+// as it is - against committing it as a Shape edit: the point inverse-transformed into authored space
+// and the mesh regenerated there. Both must draw the same world geometry, for identity and rotated
+// placements, on each axis. The meshes are the real tessellation (PrimitiveSurfaces.h).
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "PrimitiveSurfaces.h"
+#include "PropertyPane.h"
+#include "SceneExtentsMeshes.h" // Float3, Float4, RotatePoint, RandomRotation.
+#include "ValidationCheck.h"
+
+namespace {
+
+struct SurfaceVertex { Float3 position, normal; };
+using Surface = std::function<std::vector<SurfaceVertex>(const Float3& center)>;
+
+// The types whose table marks fields as Placement, and those fields: center X/Y/Z, fields 0-2, of
+// SPHERE, TORUS and ELLIPSOID. Every other field of every table is Shape and always regenerates.
+struct PlacementTable {
+    const char* name;
+    std::function<Surface(std::mt19937&)> randomSurface; // Random scalar fields, at GetGeometry's resolution.
+};
+
+template <typename Generate>
+std::vector<SurfaceVertex> Collect(Generate&& generate) {
+    std::vector<SurfaceVertex> vertices;
+    generate([&](const Float3& position, const Float3& normal) { vertices.push_back({ position, normal }); });
+    return vertices;
+}
+
+const PlacementTable kPlacementTables[] = {
+    { "SPHERE", [](std::mt19937& random) -> Surface {
+        const float radius = std::uniform_real_distribution<float>(0.1f, 5.0f)(random);
+        return [=](const Float3& center) {
+            return Collect([&](auto&& emit) { SphereSurface(center, radius, 36, 18, emit); });
+        };
+    } },
+    { "TORUS", [](std::mt19937& random) -> Surface {
+        const float majorRadius = std::uniform_real_distribution<float>(0.5f, 5.0f)(random);
+        const float minorRadius = majorRadius * std::uniform_real_distribution<float>(0.1f, 0.5f)(random);
+        return [=](const Float3& center) {
+            return Collect([&](auto&& emit) { TorusSurface(center, majorRadius, minorRadius, 36, 18, emit); });
+        };
+    } },
+    { "ELLIPSOID", [](std::mt19937& random) -> Surface {
+        std::uniform_real_distribution<float> radius(0.1f, 5.0f);
+        const float radiusX = radius(random), radiusY = radius(random), radiusZ = radius(random);
+        return [=](const Float3& center) {
+            return Collect([&](auto&& emit) { EllipsoidSurface(center, radiusX, radiusY, radiusZ, 36, 18, emit); });
+        };
+    } },
+};
+
+Float3 Inverse(const Float4& rotation, const Float3& v) {
+    return RotatePoint({ -rotation.x, -rotation.y, -rotation.z, rotation.w }, v);
+}
+
+Float3 Add(const Float3& a, const Float3& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+Float3 Subtract(const Float3& a, const Float3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+float Component(const Float3& v, uint8_t axis) { return axis == 0 ? v.x : axis == 1 ? v.y : v.z; }
+
+float Distance(const Float3& a, const Float3& b) {
+    const Float3 d = Subtract(a, b);
+    return std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+}
+
+float Length(const Float3& v) { return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z); }
+
+// World vertices as the vertex shader places them: rotate, then translate; normals rotate only.
+std::vector<SurfaceVertex> ToWorld(const std::vector<SurfaceVertex>& authored, const Float3& origin,
+    const Float4& rotation) {
+    std::vector<SurfaceVertex> world;
+    world.reserve(authored.size());
+    for (const SurfaceVertex& vertex : authored) {
+        world.push_back({ Add(RotatePoint(rotation, vertex.position), origin), RotatePoint(rotation, vertex.normal) });
+    }
+    return world;
+}
+
+// Float rounding only: positions relative to the scene's coordinates, normals to their own length.
+bool SameWorldGeometry(const std::vector<SurfaceVertex>& a, const std::vector<SurfaceVertex>& b, float scale) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (Distance(a[i].position, b[i].position) > 2e-5f * scale) return false;
+        if (Distance(a[i].normal, b[i].normal) > 1e-3f * (std::max)(1.0f, Length(a[i].normal))) return false;
+    }
+    return true;
+}
+
+void CheckTable(const PlacementTable& table, std::mt19937& random) {
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> move(-20.0f, 20.0f);
+    int mismatches = 0, misplaced = 0;
+    for (int trial = 0; trial < 200; ++trial) {
+        const Surface surface = table.randomSurface(random);
+        const Float3 center{ coordinate(random), coordinate(random), coordinate(random) };
+        const bool placed = trial % 4 != 0; // Identity for a quarter: never moved.
+        const Float3 origin = placed ? Float3{ coordinate(random), coordinate(random), coordinate(random) } : Float3{};
+        const Float4 rotation = placed ? RandomRotation(random) : Float4{};
+        const std::vector<SurfaceVertex> mesh = surface(center);
+        const Float3 world = Add(RotatePoint(rotation, center), origin); // What the pane displays.
+
+        for (uint8_t axis = 0; axis < 3; ++axis) {
+            const float newValue = Component(world, axis) + move(random);
+
+            // Transform-only: the origin moves, the mesh already on the GPU is reused.
+            const Float3 movedOrigin = PlacementOriginForWorldValue(origin, world, axis, newValue);
+            const std::vector<SurfaceVertex> transformed = ToWorld(mesh, movedOrigin, rotation);
+
+            // Regenerated: the edited world point back to authored space, a new mesh about it.
+            Float3 editedWorld = world;
+            (axis == 0 ? editedWorld.x : axis == 1 ? editedWorld.y : editedWorld.z) = newValue;
+            const Float3 editedCenter = Inverse(rotation, Subtract(editedWorld, origin));
+            const std::vector<SurfaceVertex> regenerated = ToWorld(surface(editedCenter), origin, rotation);
+
+            if (!SameWorldGeometry(transformed, regenerated, 300.0f)) ++mismatches;
+            // And the pane reads back the value typed, the other two axes unchanged.
+            const Float3 shown = Add(RotatePoint(rotation, center), movedOrigin);
+            if (Distance(shown, editedWorld) > 1e-4f) ++misplaced;
+        }
+    }
+    if (mismatches || misplaced) std::fprintf(stderr, "%s: %d mismatches, %d misplaced\n", table.name, mismatches, misplaced);
+    CHECK(mismatches == 0);
+    CHECK(misplaced == 0);
+}
+
+}
+
+int main() {
+    std::mt19937 random(44);
+    for (const PlacementTable& table : kPlacementTables) CheckTable(table, random);
+    return ValidationExitCode();
+}
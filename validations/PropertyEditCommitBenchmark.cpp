@@ -0,0 +1,60 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// One property edit committed to N selected pipes: one object at a time (CommitPropertyEdit per
+// object, as ModifyObjectProperty did for each) against the batched commit
+// (CommitPropertyEditBatch, ModifySelectedObjectsProperty) at 1 to 16 regeneration threads.
+// Stand-in pipes (PropertyEditPipes.h) tessellated at PIPE's fine 32 segments. Nothing else holds
+// the mutexes here, so the one-at-a-time lock round trips are uncontended - in the application the
+// render thread takes the store mutex every frame and the copy thread the queue mutex.
+// Argument: pipe count (default 100k).
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "EngineeringParallelFor.h"
+#include "PropertyEditCommit.h"
+#include "PropertyEditPipes.h"
+#include "ValidationCheck.h"
+
+int main(int argc, char** argv) {
+    const size_t pipeCount = ValidationSizeArgument(argc, argv, 100000);
+    std::mutex storeMutex, queueMutex;
+
+    // Outside diameter 4.5: every stand-in pipe accepts it and regenerates.
+    std::vector<Pipe> serialPipes = RandomPipes(pipeCount, 5);
+    for (Pipe& pipe : serialPipes) pipe.outsideDiameter = (std::min)(pipe.outsideDiameter, 4.0f);
+    const std::vector<Pipe> originalPipes = serialPipes;
+    std::vector<Modify> serialQueue;
+    serialQueue.reserve(pipeCount);
+    PipeEdit serialEdit{ kOutsideDiameter, 4.5f, &serialQueue, 32 };
+    size_t serialEdited = 0;
+    const double serialMs = TimeMilliseconds([&] {
+        for (Pipe& pipe : serialPipes) {
+            if (CommitPropertyEdit<Geometry>(&pipe, serialEdit, storeMutex, queueMutex)) ++serialEdited;
+        }
+    });
+    CHECK(serialEdited == pipeCount);
+    std::printf("Outside diameter of %zu selected pipes, %u hardware threads\n", pipeCount,
+        std::thread::hardware_concurrency());
+    std::printf("  one at a time:          %.1f ms\n", serialMs);
+
+    for (unsigned threads : { 1u, 2u, 4u, 8u, 16u }) {
+        std::vector<Pipe> pipes = originalPipes;
+        std::vector<Pipe*> candidates;
+        for (Pipe& pipe : pipes) candidates.push_back(&pipe);
+        std::vector<Modify> queue;
+        queue.reserve(pipeCount);
+        PipeEdit edit{ kOutsideDiameter, 4.5f, &queue, 32 };
+        EngineeringParallelFor regeneration(threads);
+        size_t edited = 0;
+        const double batchedMs = TimeMilliseconds([&] {
+            edited = CommitPropertyEditBatch<Geometry>(candidates, edit, storeMutex, queueMutex, regeneration);
+        });
+        CHECK(edited == serialEdited);
+        CHECK(queue.size() == serialQueue.size() && SameGeometry(queue.back().geometry, serialQueue.back().geometry));
+        std::printf("  batched, %2u thread(s): %.1f ms\n", threads, batchedMs);
+    }
+    return ValidationExitCode();
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// The batched property commit (CommitPropertyEditBatch, ModifySelectedObjectsProperty) against
+// committing the same edit to each object in turn (CommitPropertyEdit, ModifyObjectProperty), on
+// stand-in pipes: the objects must end up identical and the copy thread must receive the same
+// MODIFY commands in the same order, at every regeneration thread count.
+
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "EngineeringParallelFor.h"
+#include "PropertyEditCommit.h"
+#include "PropertyEditPipes.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+// A selection: a shuffled subset, so candidate order is not storage order.
+std::vector<size_t> RandomSelection(size_t count, uint32_t seed) {
+    std::vector<size_t> selection;
+    std::mt19937 random(seed);
+    for (size_t i = 0; i < count; ++i) {
+        if (random() % 3 != 0) selection.push_back(i);
+    }
+    std::shuffle(selection.begin(), selection.end(), random);
+    return selection;
+}
+
+void CheckEquivalent(uint8_t fieldIndex, float newValue, unsigned threads, uint32_t seed) {
+    const size_t pipeCount = 2000; // Above EngineeringParallelFor's inline threshold.
+    std::vector<Pipe> serialPipes = RandomPipes(pipeCount, seed);
+    std::vector<Pipe> batchedPipes = serialPipes;
+    const std::vector<size_t> selection = RandomSelection(pipeCount, seed + 1);
+    std::mutex storeMutex, queueMutex;
+
+    std::vector<Modify> serialQueue;
+    PipeEdit serialEdit{ fieldIndex, newValue, &serialQueue };
+    size_t serialEdited = 0;
+    for (size_t index : selection) {
+        if (CommitPropertyEdit<Geometry>(&serialPipes[index], serialEdit, storeMutex, queueMutex)) ++serialEdited;
+    }
+
+    std::vector<Modify> batchedQueue;
+    PipeEdit batchedEdit{ fieldIndex, newValue, &batchedQueue };
+    std::vector<Pipe*> candidates;
+    for (size_t index : selection) candidates.push_back(&batchedPipes[index]);
+    EngineeringParallelFor regeneration(threads);
+    const size_t batchedEdited =
+        CommitPropertyEditBatch<Geometry>(candidates, batchedEdit, storeMutex, queueMutex, regeneration);
+
+    CHECK(batchedEdited == serialEdited);
+    CHECK(serialEdited > 0);
+    bool sameObjects = true;
+    for (size_t i = 0; i < pipeCount; ++i) {
+        const Pipe& a = serialPipes[i];
+        const Pipe& b = batchedPipes[i];
+        sameObjects = sameObjects && a.outsideDiameter == b.outsideDiameter &&
+            a.insideDiameter == b.insideDiameter && a.placementX == b.placementX && a.dataVersion == b.dataVersion;
+    }
+    CHECK(sameObjects);
+    CHECK(batchedQueue.size() == serialQueue.size());
+    bool sameCommands = batchedQueue.size() == serialQueue.size();
+    for (size_t i = 0; sameCommands && i < serialQueue.size(); ++i) {
+        sameCommands = serialQueue[i].id == batchedQueue[i].id &&
+            SameGeometry(serialQueue[i].geometry, batchedQueue[i].geometry);
+    }
+    CHECK(sameCommands);
+}
+
+}
+
+int main() {
+    for (unsigned threads : { 1u, 4u, 16u }) {
+        for (uint32_t seed : { 1u, 2u }) {
+            // Shape edits, some rejected (inside >= new outside), some dropped (too large to mesh).
+            CheckEquivalent(kOutsideDiameter, 1.5f, threads, seed);
+            CheckEquivalent(kInsideDiameter, 0.8f, threads, seed);
+            // A placement edit: transform-only, never regenerated, so even the huge pipes emit.
+            CheckEquivalent(kCenterX, 12.5f, threads, seed);
+        }
+    }
+    return ValidationExitCode();
+}
@@ -0,0 +1,97 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+// Stand-in pipes and their PropertyEditCommit.h Edit, for PropertyEditCommitTest and
+// PropertyEditCommitBenchmark. The real PIPE needs DirectXMath; its property table, in miniature,
+// is what matters here: the validation rules, which fields are placement-only, and a regeneration
+// that reads only its own object.
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+// A PIPE's property table in miniature: outside and inside diameter are shape fields, center X is a
+// placement field (PropertyEditEffect::Placement).
+enum PipeField : uint8_t { kOutsideDiameter, kInsideDiameter, kCenterX, kFieldCount };
+constexpr float kLargestTessellatedDiameter = 50.0f; // Regeneration fails beyond: the MODIFY is dropped.
+
+struct Pipe {
+    uint64_t memoryID = 0;
+    float outsideDiameter = 1.0f, insideDiameter = 0.5f, length = 3.0f;
+    float placementX = 0.0f;
+    uint64_t dataVersion = 1;
+};
+
+struct Geometry {
+    uint64_t id = 0;
+    float placementX = 0.0f;      // The transform-only encoding.
+    std::vector<float> vertices;  // Empty for a transform-only MODIFY.
+};
+
+struct Modify {
+    uint64_t id;
+    Geometry geometry;
+};
+
+inline bool SameGeometry(const Geometry& a, const Geometry& b) {
+    return a.id == b.id && a.placementX == b.placementX && a.vertices == b.vertices;
+}
+
+// Same rules as the pipe's table: 0 < inside < outside.
+struct PipeEdit {
+    uint8_t fieldIndex;
+    float newValue;
+    std::vector<Modify>* queue;
+    int segments = 8; // Around the circumference; PIPE's fine tessellation is 32.
+
+    bool Validate(Pipe* pipe) const {
+        switch (fieldIndex) {
+        case kOutsideDiameter: return newValue > 0.0f && pipe->insideDiameter < newValue;
+        case kInsideDiameter: return newValue > 0.0f && newValue < pipe->outsideDiameter;
+        default: return std::isfinite(newValue);
+        }
+    }
+    bool Store(Pipe* pipe, Geometry& geometry) const {
+        pipe->dataVersion++;
+        switch (fieldIndex) {
+        case kOutsideDiameter: pipe->outsideDiameter = newValue; return false;
+        case kInsideDiameter: pipe->insideDiameter = newValue; return false;
+        default:
+            pipe->placementX = newValue;
+            geometry.id = pipe->memoryID;
+            geometry.placementX = newValue;
+            return true;
+        }
+    }
+    bool Regenerate(Pipe* pipe, Geometry& geometry) const {
+        if (pipe->outsideDiameter > kLargestTessellatedDiameter) return false;
+        geometry.id = pipe->memoryID;
+        geometry.placementX = pipe->placementX;
+        for (int segment = 0; segment < segments; ++segment) {
+            const float angle = float(segment) * 6.2831853f / float(segments);
+            for (float radius : { 0.5f * pipe->outsideDiameter, 0.5f * pipe->insideDiameter }) {
+                geometry.vertices.push_back(radius * std::cos(angle));
+                geometry.vertices.push_back(radius * std::sin(angle));
+                geometry.vertices.push_back(pipe->length);
+            }
+        }
+        return true;
+    }
+    void Emit(Pipe* pipe, Geometry&& geometry) const { queue->push_back({ pipe->memoryID, std::move(geometry) }); }
+};
+
+inline std::vector<Pipe> RandomPipes(size_t count, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> diameter(0.1f, 4.0f);
+    std::vector<Pipe> pipes(count);
+    for (size_t i = 0; i < count; ++i) {
+        pipes[i].memoryID = 1000 + i;
+        pipes[i].outsideDiameter = diameter(random);
+        pipes[i].insideDiameter = pipes[i].outsideDiameter * 0.5f;
+        if (i % 13 == 0) pipes[i].outsideDiameter = 60.0f; // Too large to tessellate.
+        pipes[i].placementX = float(i);
+    }
+    return pipes;
+}
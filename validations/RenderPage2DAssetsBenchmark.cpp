@@ -0,0 +1,157 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Memory and page-rebuild time of N inserts of one definition: baked member records (the old
+// Cad2DInstantiateAsset, RenderPage2DBakedAssets.h) against reference inserts expanded by the copy
+// thread from the definition cache. The rebuild is the CPU side of a page build - records to GPU
+// records - after a definition edit, which the baked page has to re-bake for every insert.
+// Argument: insert count (default 100k).
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CommonNamedNumbers.h"
+#include "RenderPage2D.h"
+#include "RenderPage2DBakedAssets.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr uint64_t kPage = 900;
+constexpr uint64_t kDefinition = 1;
+
+// A title-block sized definition: 24 lines, 4 polylines of 6 points, 4 circles, 4 arcs, 6 texts.
+Cad2DRecordSet Masters() {
+    Cad2DRecordSet masters;
+    for (int i = 0; i < 24; ++i) {
+        Cad2DLineRecordCPU line;
+        line.parentObjectId = kDefinition;
+        line.x1 = i; line.y1 = 0.0; line.x2 = i; line.y2 = 10.0 + i % 3;
+        masters.lines.push_back(line);
+    }
+    for (int i = 0; i < 4; ++i) {
+        Cad2DPolylineRecordCPU polyline;
+        polyline.parentObjectId = kDefinition;
+        for (int p = 0; p < 6; ++p) polyline.points.push_back({ 4.0 * i + p, 12.0 + (p % 2) });
+        masters.polylines.push_back(polyline);
+
+        Cad2DCircleRecordCPU circle;
+        circle.parentObjectId = kDefinition;
+        circle.centerX = 5.0 * i; circle.centerY = -3.0; circle.radius = 1.0 + i;
+        masters.circles.push_back(circle);
+
+        Cad2DArcRecordCPU arc;
+        arc.parentObjectId = kDefinition;
+        arc.centerX = 5.0 * i; arc.centerY = 15.0; arc.radiusX = arc.radiusY = 2.0;
+        arc.startX = arc.centerX + 2.0; arc.startY = arc.centerY;
+        arc.endX = arc.centerX; arc.endY = arc.centerY + 2.0;
+        masters.arcs.push_back(arc);
+    }
+    for (int i = 0; i < 6; ++i) {
+        Cad2DTextRecordCPU text;
+        text.parentObjectId = kDefinition;
+        text.x = 3.0 * i; text.y = 20.0;
+        text.text = "Drawing no. " + std::to_string(i);
+        masters.texts.push_back(text);
+    }
+    return masters;
+}
+
+template <typename Record>
+size_t VectorBytes(const std::vector<Record>& records) { return records.capacity() * sizeof(Record); }
+
+// What the records keep resident on the CPU side, heap included.
+size_t RecordSetBytes(const Cad2DRecordSet& set) {
+    size_t bytes = VectorBytes(set.lines) + VectorBytes(set.polylines) + VectorBytes(set.polygons) +
+        VectorBytes(set.circles) + VectorBytes(set.ellipses) + VectorBytes(set.arcs) + VectorBytes(set.texts);
+    for (const Cad2DPolylineRecordCPU& polyline : set.polylines) bytes += VectorBytes(polyline.points);
+    for (const Cad2DTextRecordCPU& text : set.texts) {
+        if (text.text.capacity() > sizeof(std::string)) bytes += text.text.capacity() + 1;
+    }
+    return bytes;
+}
+
+double Megabytes(size_t bytes) { return double(bytes) / (1024.0 * 1024.0); }
+
+}
+
+int main(int argc, char** argv) {
+    const size_t insertCount = ValidationSizeArgument(argc, argv, 100000);
+    Cad2DRecordSet masters = Masters();
+    std::vector<Cad2DAssetDefinitionRecordCPU> definitions(1);
+    definitions[0].objectId = kDefinition;
+    definitions[0].baseX = 10.0;
+    definitions[0].baseY = 10.0;
+    definitions[0].revision = 1;
+
+    std::vector<Cad2DAssetInsertRecordCPU> inserts(insertCount);
+    for (size_t i = 0; i < insertCount; ++i) {
+        Cad2DAssetInsertRecordCPU& insert = inserts[i];
+        insert.objectId = 1000 + i;
+        insert.containerMemoryId = kPage;
+        insert.definitionObjectId = kDefinition;
+        insert.x = 60.0 * double(i % 1000);
+        insert.y = 60.0 * double(i / 1000);
+        insert.rotationDegrees = double(i % 8) * 45.0;
+        insert.scaleX = (i % 5 == 0) ? -1.0 : 1.0;
+        insert.schemaVersion = VishwakarmaStorage::kAsset2DInsertInstancedSchemaVersion;
+    }
+
+    // Baked: every insert owns copies of the masters, re-baked whenever the definition changes.
+    Cad2DRecordSet baked;
+    std::vector<Cad2DLineGPURecord> bakedLines;
+    std::vector<Cad2DCurveGPURecord> bakedCurves;
+    const double bakeMs = TimeMilliseconds([&] {
+        for (const Cad2DAssetInsertRecordCPU& insert : inserts) {
+            BakeAssetMembers(masters, kDefinition, definitions[0].baseX, definitions[0].baseY, insert,
+                insert.objectId, baked);
+        }
+    });
+    const double bakedBuildMs = TimeMilliseconds([&] {
+        AppendBakedGpuRecords(baked, 0.0, 0.0, bakedLines, bakedCurves);
+    });
+
+    // Instanced: the page keeps the inserts; the copy thread converts the masters once.
+    std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU> cache;
+    std::vector<Cad2DLineGPURecord> instancedLines;
+    std::vector<Cad2DCurveGPURecord> instancedCurves;
+    std::vector<Cad2DTextRecordCPU> instancedTexts;
+    auto instancedBuild = [&] {
+        instancedLines = {}; // From empty, like the baked conversion.
+        instancedCurves = {};
+        instancedTexts = {};
+        Cad2DRefreshAssetDefinitionCache(cache, definitions, masters.lines, masters.polylines, masters.polygons,
+            masters.circles, masters.ellipses, masters.arcs, masters.texts);
+        std::vector<Cad2DAssetInstance> instances;
+        Cad2DExpandAssetInstances(definitions, inserts, kPage, instances);
+        AppendInstancedGpuRecords(cache, instances, 0.0, 0.0, instancedLines, instancedCurves, instancedTexts);
+    };
+    const double instancedColdMs = TimeMilliseconds(instancedBuild); // First build: pages fault in.
+    definitions[0].revision = 2; // A definition edit: the cache entry re-converts.
+    const double instancedEditMs = TimeMilliseconds(instancedBuild);
+    const double instancedWarmMs = TimeMilliseconds(instancedBuild); // Cache hit: expansion and stamping only.
+
+    CHECK(instancedLines.size() == bakedLines.size());
+    CHECK(instancedCurves.size() == bakedCurves.size());
+    CHECK(instancedTexts.size() == baked.texts.size());
+
+    size_t cacheBytes = 0;
+    for (const auto& [id, entry] : cache) {
+        cacheBytes += sizeof(entry) + VectorBytes(entry.lines) + VectorBytes(entry.curves) + VectorBytes(entry.texts);
+    }
+    const size_t bakedBytes = RecordSetBytes(baked);
+    const size_t instancedBytes = VectorBytes(inserts) + RecordSetBytes(masters) + cacheBytes;
+    const size_t gpuBytes = VectorBytes(bakedLines) + VectorBytes(bakedCurves);
+
+    std::printf("%zu inserts of one %zu-record definition -> %zu line + %zu curve GPU records (%.1f MB)\n",
+        insertCount, masters.lines.size() + masters.polylines.size() + masters.circles.size() +
+        masters.arcs.size() + masters.texts.size(), bakedLines.size(), bakedCurves.size(), Megabytes(gpuBytes));
+    std::printf("  page CPU records: baked %.1f MB, instanced %.2f MB (inserts + masters + cache)\n",
+        Megabytes(bakedBytes), Megabytes(instancedBytes));
+    std::printf("  rebuild after a definition edit: baked %.1f ms (re-bake %.1f + convert %.1f), "
+        "instanced %.1f ms (first build %.1f ms)\n", bakeMs + bakedBuildMs, bakeMs, bakedBuildMs,
+        instancedEditMs, instancedColdMs);
+    std::printf("  rebuild without an edit: baked %.1f ms (convert), instanced %.1f ms (cache hit)\n",
+        bakedBuildMs, instancedWarmMs);
+    return ValidationExitCode();
+}
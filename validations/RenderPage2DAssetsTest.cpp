@@ -0,0 +1,319 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Reference inserts (RenderPage2DAssets.cpp + the definition cache in RenderPage2DRecords.cpp) must
+// draw what baking member records drew (RenderPage2DBakedAssets.h): record for record, after both go
+// to GPU records on the same precision tile. Covers rotation, mirror on either or both axes,
+// non-uniform scale, nested inserts, a definition that inserts itself through another, and the cache
+// following revision bumps, base-point moves and deletions.
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CommonNamedNumbers.h"
+#include "RenderPage2D.h"
+#include "RenderPage2DBakedAssets.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr uint64_t kPage = 900;
+constexpr double kPiTest = 3.14159265358979323846;
+constexpr double kInsertX = 3.0 * kCad2DPrecisionTileSizeCU + 1234.5; // Away from the page origin.
+constexpr double kInsertY = -2.0 * kCad2DPrecisionTileSizeCU + 777.25;
+
+// Float records relative to a tile origin: compare with a relative tolerance.
+bool Near(double a, double b) { return std::abs(a - b) <= 2.0e-3 + 2.0e-6 * std::abs(b); }
+bool NearAngle(double a, double b) {
+    const double d = std::remainder(a - b, 2.0 * kPiTest);
+    return std::abs(d) <= 1.0e-4;
+}
+
+bool SameStyle(const Cad2DLineGPURecord& a, const Cad2DLineGPURecord& b) {
+    return a.lineWeight == b.lineWeight && a.lineWeightMode == b.lineWeightMode && a.colorABGR == b.colorABGR &&
+        a.flags == b.flags;
+}
+
+// A polygon whose vertex order a mirror reversed draws the same segments end to end.
+bool SameLine(const Cad2DLineGPURecord& a, const Cad2DLineGPURecord& b) {
+    if (!SameStyle(a, b)) return false;
+    const bool forward = Near(a.x1, b.x1) && Near(a.y1, b.y1) && Near(a.x2, b.x2) && Near(a.y2, b.y2);
+    const bool backward = Near(a.x1, b.x2) && Near(a.y1, b.y2) && Near(a.x2, b.x1) && Near(a.y2, b.y1);
+    return forward || backward;
+}
+
+bool SameCurve(const Cad2DCurveGPURecord& a, const Cad2DCurveGPURecord& b) {
+    if (a.curveType != b.curveType || a.lineWeight != b.lineWeight || a.lineWeightMode != b.lineWeightMode ||
+        a.colorABGR != b.colorABGR || a.flags != b.flags) {
+        return false;
+    }
+    if (!Near(a.centerX, b.centerX) || !Near(a.centerY, b.centerY) || !Near(a.radiusX, b.radiusX) ||
+        !Near(a.radiusY, b.radiusY) || !Near(a.startX, b.startX) || !Near(a.startY, b.startY) ||
+        !Near(a.endX, b.endX) || !Near(a.endY, b.endY)) {
+        return false;
+    }
+    // A circle's shader ignores rotation; the instanced path carries the map's angle there anyway.
+    return a.curveType == kCad2DCurveTypeCircle || NearAngle(a.rotationRadians, b.rotationRadians);
+}
+
+bool SameText(const Cad2DTextRecordCPU& a, const Cad2DTextRecordCPU& b) {
+    return a.text == b.text && Near(a.x, b.x) && Near(a.y, b.y) && Near(a.textHeightCU, b.textHeightCU) &&
+        NearAngle(a.rotationRadians, b.rotationRadians) && a.xOffsetCU == b.xOffsetCU &&
+        a.yOffsetCU == b.yOffsetCU && a.colorABGR == b.colorABGR;
+}
+
+// Every expected record pairs with its own actual record. Order is not compared: nesting and the
+// cache emit the same records in a different sequence.
+template <typename Record>
+bool SameRecords(const char* what, const std::vector<Record>& expected, const std::vector<Record>& actual,
+    const std::function<bool(const Record&, const Record&)>& same) {
+    if (expected.size() != actual.size()) {
+        std::fprintf(stderr, "%s: %zu expected, %zu instanced\n", what, expected.size(), actual.size());
+        return false;
+    }
+    std::vector<bool> used(actual.size(), false);
+    for (size_t e = 0; e < expected.size(); ++e) {
+        bool found = false;
+        for (size_t a = 0; a < actual.size() && !found; ++a) {
+            if (!used[a] && same(expected[e], actual[a])) used[a] = found = true;
+        }
+        if (!found) {
+            std::fprintf(stderr, "%s: expected record %zu has no instanced counterpart\n", what, e);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Drawing {
+    Cad2DRecordSet masters;
+    std::vector<Cad2DAssetDefinitionRecordCPU> definitions;
+    std::vector<Cad2DAssetInsertRecordCPU> inserts;
+    std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU> cache;
+
+    void Define(uint64_t id, double baseX, double baseY) {
+        Cad2DAssetDefinitionRecordCPU definition;
+        definition.objectId = id;
+        definition.baseX = baseX;
+        definition.baseY = baseY;
+        definition.revision = 1;
+        definitions.push_back(definition);
+    }
+
+    // One master record of every kind, around (x, y) in the definition's frame.
+    void AddMasters(uint64_t definitionId, double x, double y, bool roundShapes) {
+        Cad2DLineRecordCPU line;
+        line.parentObjectId = definitionId;
+        line.x1 = x - 3.0; line.y1 = y + 1.0; line.x2 = x + 4.5; line.y2 = y - 2.0;
+        line.colorABGR = 0xFF0000FFu;
+        masters.lines.push_back(line);
+
+        Cad2DPolylineRecordCPU polyline;
+        polyline.parentObjectId = definitionId;
+        polyline.points = { { x, y }, { x + 2.0, y + 5.0 }, { x + 6.0, y + 5.5 }, { x + 7.0, y - 1.0 } };
+        polyline.lineWeightMode = Cad2DLineWeightMode::ModelComputerUnit;
+        masters.polylines.push_back(polyline);
+
+        Cad2DEllipseRecordCPU ellipse;
+        ellipse.parentObjectId = definitionId;
+        ellipse.centerX = x + 1.0; ellipse.centerY = y - 4.0;
+        ellipse.radiusX = 3.0; ellipse.radiusY = 1.25; ellipse.rotationRadians = 0.3;
+        masters.ellipses.push_back(ellipse);
+
+        Cad2DArcRecordCPU arc;
+        arc.parentObjectId = definitionId;
+        arc.centerX = x - 2.0; arc.centerY = y + 3.0;
+        arc.radiusX = 2.0; arc.radiusY = 2.0; arc.rotationRadians = 0.0;
+        arc.startX = arc.centerX + 2.0; arc.startY = arc.centerY;
+        arc.endX = arc.centerX; arc.endY = arc.centerY + 2.0;
+        masters.arcs.push_back(arc);
+
+        Cad2DTextRecordCPU text;
+        text.parentObjectId = definitionId;
+        text.x = x + 0.5; text.y = y + 8.0; text.xOffsetCU = 1.5f; text.yOffsetCU = -0.75f;
+        text.textHeightCU = 2.5f; text.rotationRadians = 0.2f;
+        text.text = std::to_string(definitionId);
+        masters.texts.push_back(text);
+
+        if (!roundShapes) return; // Approximated differently by the two paths under non-uniform scale.
+        Cad2DPolygonRecordCPU polygon;
+        polygon.parentObjectId = definitionId;
+        polygon.lineSegmentCount = 5;
+        polygon.centerX = x + 5.0; polygon.centerY = y + 2.0; polygon.radius = 1.75; polygon.rotationDegrees = 30.0;
+        masters.polygons.push_back(polygon);
+
+        Cad2DCircleRecordCPU circle;
+        circle.parentObjectId = definitionId;
+        circle.centerX = x - 5.0; circle.centerY = y - 1.0; circle.radius = 1.5;
+        masters.circles.push_back(circle);
+    }
+
+    void Insert(uint64_t id, uint64_t definitionId, uint64_t parentDefinitionId, double x, double y,
+        double scaleX, double scaleY, double rotationDegrees) {
+        Cad2DAssetInsertRecordCPU insert;
+        insert.objectId = id;
+        insert.containerMemoryId = parentDefinitionId == 0 ? kPage : 0;
+        insert.parentObjectId = parentDefinitionId;
+        insert.definitionObjectId = definitionId;
+        insert.x = x; insert.y = y;
+        insert.scaleX = scaleX; insert.scaleY = scaleY; insert.rotationDegrees = rotationDegrees;
+        insert.schemaVersion = VishwakarmaStorage::kAsset2DInsertInstancedSchemaVersion;
+        inserts.push_back(insert);
+    }
+
+    void Refresh() {
+        Cad2DRefreshAssetDefinitionCache(cache, definitions, masters.lines, masters.polylines, masters.polygons,
+            masters.circles, masters.ellipses, masters.arcs, masters.texts);
+    }
+
+    // Instanced and baked GPU records on the tile of the first insert; false on the first mismatch.
+    bool DrawsLikeBaked(const char* scenario, size_t* instanceCount = nullptr) {
+        Refresh();
+        std::vector<Cad2DAssetInstance> instances;
+        Cad2DExpandAssetInstances(definitions, inserts, kPage, instances);
+        if (instanceCount) *instanceCount = instances.size();
+
+        const double originX = Cad2DPrecisionTileOrigin(Cad2DPrecisionTileIndex(kInsertX));
+        const double originY = Cad2DPrecisionTileOrigin(Cad2DPrecisionTileIndex(kInsertY));
+        std::vector<Cad2DLineGPURecord> instancedLines, bakedLines;
+        std::vector<Cad2DCurveGPURecord> instancedCurves, bakedCurves;
+        std::vector<Cad2DTextRecordCPU> instancedTexts;
+        AppendInstancedGpuRecords(cache, instances, originX, originY, instancedLines, instancedCurves, instancedTexts);
+
+        Cad2DRecordSet baked = BakeAssetInserts(masters, definitions, inserts);
+        AppendBakedGpuRecords(baked, originX, originY, bakedLines, bakedCurves);
+        for (Cad2DTextRecordCPU& text : baked.texts) {
+            text.x -= originX;
+            text.y -= originY;
+        }
+
+        std::fprintf(stderr, "%s: %zu instances, %zu lines, %zu curves, %zu texts\n", scenario,
+            instances.size(), bakedLines.size(), bakedCurves.size(), baked.texts.size());
+        const bool lines = SameRecords<Cad2DLineGPURecord>("lines", bakedLines, instancedLines, SameLine);
+        const bool curves = SameRecords<Cad2DCurveGPURecord>("curves", bakedCurves, instancedCurves, SameCurve);
+        const bool texts = SameRecords<Cad2DTextRecordCPU>("texts", baked.texts, instancedTexts, SameText);
+        return lines && curves && texts;
+    }
+};
+
+// Rotation and mirror on either or both axes, uniform |scale|: every record kind must agree.
+void SingleLevel() {
+    Drawing drawing;
+    drawing.Define(1, 10.0, 20.0);
+    drawing.AddMasters(1, 12.0, 18.0, true);
+    const double placements[][3] = { { 1.0, 1.0, 0.0 }, { 2.0, 2.0, 37.0 }, { -1.0, 1.0, 0.0 },
+        { 1.0, -1.0, 75.0 }, { -1.5, -1.5, 200.0 }, { 0.5, 0.5, -90.0 }, { -3.0, 3.0, 123.0 } };
+    uint64_t id = 100;
+    for (const auto& p : placements) {
+        drawing.Insert(id, 1, 0, kInsertX + 40.0 * double(id - 100), kInsertY + 3.0 * double(id - 100),
+            p[0], p[1], p[2]);
+        ++id;
+    }
+    CHECK(drawing.DrawsLikeBaked("single level"));
+}
+
+// Non-uniform scale, with and without mirror. Lines, arcs, ellipses and text map the same way; a
+// circle becomes the ellipse the old path approximated by its larger radius.
+void NonUniformScale() {
+    Drawing drawing;
+    drawing.Define(1, -5.0, 2.0);
+    drawing.AddMasters(1, -4.0, 0.0, false);
+    drawing.Insert(100, 1, 0, kInsertX, kInsertY, 2.0, 0.5, 0.0);
+    drawing.Insert(101, 1, 0, kInsertX + 50.0, kInsertY, -3.0, 1.0, 0.0);
+    drawing.Insert(102, 1, 0, kInsertX, kInsertY + 50.0, 1.0, -0.25, 0.0);
+    drawing.Insert(103, 1, 0, kInsertX - 50.0, kInsertY, 2.0, 0.5, 90.0);
+    CHECK(drawing.DrawsLikeBaked("non-uniform scale"));
+
+    Cad2DCircleRecordCPU circle;
+    circle.centerX = 3.0; circle.centerY = 4.0; circle.radius = 2.0;
+    Cad2DCurveGPURecord curve = Cad2DToGpuCircleRecord(circle, 0.0, 0.0);
+    Cad2DAffine2D squash;
+    squash.m00 = 3.0; squash.m11 = 0.5;
+    Cad2DTransformCurveGPURecord(curve, squash);
+    CHECK(curve.curveType == kCad2DCurveTypeEllipse);
+    CHECK(Near(curve.radiusX, 6.0) && Near(curve.radiusY, 1.0));
+    CHECK(Near(curve.centerX, 9.0) && Near(curve.centerY, 2.0));
+}
+
+// Three levels: A inserts B (mirrored, rotated), B inserts C. Each level's masters land where
+// exploding the nested inserts into their owners and then baking would have put them. Scales stay
+// uniform: a non-uniform scale with a rotation inside it shears, which neither path represents.
+void Nested() {
+    Drawing drawing;
+    drawing.Define(1, 0.0, 0.0);
+    drawing.Define(2, 50.0, 50.0);
+    drawing.Define(3, -20.0, 10.0);
+    drawing.AddMasters(1, 1.0, 2.0, true);
+    drawing.AddMasters(2, 52.0, 47.0, true);
+    drawing.AddMasters(3, -18.0, 12.0, true);
+    drawing.Insert(10, 2, 1, 25.0, -5.0, -0.5, 0.5, 60.0);
+    drawing.Insert(11, 3, 2, 48.0, 55.0, 2.0, 2.0, 15.0);
+    drawing.Insert(12, 3, 1, -30.0, 8.0, -1.0, -1.0, 0.0);
+    drawing.Insert(100, 1, 0, kInsertX, kInsertY, 1.5, 1.5, 30.0);
+    drawing.Insert(101, 1, 0, kInsertX + 200.0, kInsertY, 1.0, -1.0, -45.0);
+    size_t instances = 0;
+    CHECK(drawing.DrawsLikeBaked("nested", &instances));
+    CHECK(instances == 2 * 4); // Per top-level insert: A, B, C through B, C directly.
+}
+
+// A inserts B and B inserts A: the expansion cuts the repeat and draws each definition once.
+void Cycle() {
+    Drawing drawing;
+    drawing.Define(1, 0.0, 0.0);
+    drawing.Define(2, 10.0, 0.0);
+    drawing.AddMasters(1, 0.0, 0.0, true);
+    drawing.AddMasters(2, 10.0, 0.0, true);
+    drawing.Insert(10, 2, 1, 20.0, 0.0, 1.0, 1.0, 90.0);
+    drawing.Insert(11, 1, 2, 0.0, 30.0, -1.0, 1.0, 0.0);
+    drawing.Insert(12, 2, 2, 5.0, 5.0, 1.0, 1.0, 0.0); // B inserting itself directly.
+    drawing.Insert(100, 1, 0, kInsertX, kInsertY, 1.0, 1.0, 10.0);
+    size_t instances = 0;
+    CHECK(drawing.DrawsLikeBaked("cycle", &instances));
+    CHECK(instances == 2);
+}
+
+// Entries re-convert when the revision or base point moves, stay put otherwise, and go away with
+// their definition. Every state still draws like baking.
+void CacheFollowsDefinitions() {
+    Drawing drawing;
+    drawing.Define(1, 0.0, 0.0);
+    drawing.Define(2, 30.0, 0.0);
+    drawing.AddMasters(1, 0.0, 0.0, true);
+    drawing.AddMasters(2, 30.0, 0.0, true);
+    drawing.Insert(10, 2, 1, 15.0, 0.0, 1.0, 1.0, 0.0);
+    drawing.Insert(100, 1, 0, kInsertX, kInsertY, 2.0, 2.0, 45.0);
+    drawing.Insert(101, 2, 0, kInsertX + 80.0, kInsertY, -1.0, 1.0, 0.0);
+    CHECK(drawing.DrawsLikeBaked("cache: initial"));
+    CHECK(drawing.cache.size() == 2);
+    const Cad2DLineGPURecord* untouched = drawing.cache[2].lines.data();
+
+    const float cachedX2 = drawing.cache[1].lines[0].x2;
+    drawing.masters.lines[0].x2 += 7.0; // Definition 1's line.
+    drawing.Refresh();
+    CHECK(drawing.cache[1].lines[0].x2 == cachedX2); // Not invalidated yet: the old record stays.
+    drawing.definitions[0].revision = 2;
+    CHECK(drawing.DrawsLikeBaked("cache: revision bump"));
+    CHECK(drawing.cache[2].lines.data() == untouched);
+
+    drawing.definitions[1].baseX = 33.0;
+    drawing.definitions[1].baseY = -4.0;
+    CHECK(drawing.DrawsLikeBaked("cache: base point moved"));
+    CHECK(drawing.cache[2].baseX == 33.0 && drawing.cache[2].baseY == -4.0);
+
+    drawing.definitions[1].isDeleted = true;
+    CHECK(drawing.DrawsLikeBaked("cache: definition deleted"));
+    CHECK(drawing.cache.size() == 1 && drawing.cache.count(2) == 0);
+}
+
+}
+
+int main() {
+    SingleLevel();
+    NonUniformScale();
+    Nested();
+    Cycle();
+    CacheFollowsDefinitions();
+    return ValidationExitCode();
+}
@@ -0,0 +1,183 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+// The member-record baking that reference inserts replaced (Cad2DInstantiateAsset before schema v3):
+// every insert copied its definition's master records through the insert transform onto the page.
+// Kept here as the reference the instanced path (Cad2DExpandAssetInstances + the definition cache)
+// is checked and timed against. A nested insert is baked into its owning definition's master frame
+// first, the way exploding it there would have, with the same cycle cut as the expansion.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "RenderPage2D.h"
+
+struct Cad2DRecordSet {
+    std::vector<Cad2DLineRecordCPU> lines;
+    std::vector<Cad2DPolylineRecordCPU> polylines;
+    std::vector<Cad2DPolygonRecordCPU> polygons;
+    std::vector<Cad2DCircleRecordCPU> circles;
+    std::vector<Cad2DEllipseRecordCPU> ellipses;
+    std::vector<Cad2DArcRecordCPU> arcs;
+    std::vector<Cad2DTextRecordCPU> texts;
+};
+
+// Copies the records of `master` owned by definitionObjectId through the insert transform into `out`,
+// with the old path's angle handling and radius approximations.
+inline void BakeAssetMembers(const Cad2DRecordSet& master, uint64_t definitionObjectId, double baseX,
+    double baseY, const Cad2DAssetInsertRecordCPU& insert, uint64_t memberParentId, Cad2DRecordSet& out) {
+    constexpr double kPi = 3.14159265358979323846;
+    const double theta = insert.rotationDegrees * kPi / 180.0;
+    const double cosT = std::cos(theta), sinT = std::sin(theta);
+    const double m00 = cosT * insert.scaleX, m01 = -sinT * insert.scaleY;
+    const double m10 = sinT * insert.scaleX, m11 = cosT * insert.scaleY;
+    auto mapPoint = [&](double px, double py) -> Cad2DPoint2D {
+        const double vx = px - baseX, vy = py - baseY;
+        return { insert.x + m00 * vx + m01 * vy, insert.y + m10 * vx + m11 * vy };
+    };
+
+    const bool negX = insert.scaleX < 0.0, negY = insert.scaleY < 0.0;
+    const bool mirrored = negX != negY;
+    const double thetaEff = (negX && negY) ? theta + kPi : theta;
+    const double mirrorPhi = negX ? kPi / 2.0 : 0.0;
+    auto mapRotationRadians = [&](double rot) {
+        return mirrored ? (2.0 * mirrorPhi - rot) + thetaEff : rot + thetaEff;
+    };
+    auto mapPolygonDegrees = [&](double a) {
+        const double thetaEffDeg = thetaEff * 180.0 / kPi;
+        return mirrored ? (180.0 - 2.0 * mirrorPhi * 180.0 / kPi - a) - thetaEffDeg : a - thetaEffDeg;
+    };
+    const double absX = std::abs(insert.scaleX), absY = std::abs(insert.scaleY);
+    const double radiusScale = (std::max)(absX, absY);
+
+    auto instantiate = [&](const auto& records, auto& into, auto&& transform) {
+        for (const auto& r : records) {
+            if (r.isDeleted || r.parentObjectId != definitionObjectId) continue;
+            auto member = r;
+            member.parentObjectId = memberParentId;
+            member.containerMemoryId = insert.containerMemoryId;
+            transform(member);
+            into.push_back(std::move(member));
+        }
+    };
+    instantiate(master.lines, out.lines, [&](Cad2DLineRecordCPU& r) {
+        const Cad2DPoint2D a = mapPoint(r.x1, r.y1);
+        const Cad2DPoint2D b = mapPoint(r.x2, r.y2);
+        r.x1 = a.x; r.y1 = a.y; r.x2 = b.x; r.y2 = b.y; });
+    instantiate(master.polylines, out.polylines, [&](Cad2DPolylineRecordCPU& r) {
+        for (Cad2DPoint2D& p : r.points) p = mapPoint(p.x, p.y); });
+    instantiate(master.polygons, out.polygons, [&](Cad2DPolygonRecordCPU& r) {
+        const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
+        r.centerX = c.x; r.centerY = c.y;
+        r.radius *= radiusScale;
+        r.rotationDegrees = mapPolygonDegrees(r.rotationDegrees); });
+    instantiate(master.circles, out.circles, [&](Cad2DCircleRecordCPU& r) {
+        const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
+        r.centerX = c.x; r.centerY = c.y;
+        r.radius *= radiusScale; });
+    instantiate(master.ellipses, out.ellipses, [&](Cad2DEllipseRecordCPU& r) {
+        const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
+        r.centerX = c.x; r.centerY = c.y;
+        r.radiusX *= absX;
+        r.radiusY *= absY;
+        r.rotationRadians = mapRotationRadians(r.rotationRadians); });
+    instantiate(master.arcs, out.arcs, [&](Cad2DArcRecordCPU& r) {
+        const Cad2DPoint2D c = mapPoint(r.centerX, r.centerY);
+        const Cad2DPoint2D st = mapPoint(r.startX, r.startY);
+        const Cad2DPoint2D en = mapPoint(r.endX, r.endY);
+        r.centerX = c.x; r.centerY = c.y;
+        r.radiusX *= absX;
+        r.radiusY *= absY;
+        r.rotationRadians = mapRotationRadians(r.rotationRadians);
+        r.startX = mirrored ? en.x : st.x; r.startY = mirrored ? en.y : st.y;
+        r.endX = mirrored ? st.x : en.x; r.endY = mirrored ? st.y : en.y; });
+    instantiate(master.texts, out.texts, [&](Cad2DTextRecordCPU& r) {
+        const Cad2DPoint2D o = mapPoint(r.x + (double)r.xOffsetCU, r.y + (double)r.yOffsetCU);
+        r.x = o.x - (double)r.xOffsetCU;
+        r.y = o.y - (double)r.yOffsetCU;
+        r.textHeightCU = (float)((double)r.textHeightCU * absY);
+        r.rotationRadians = (float)mapRotationRadians((double)r.rotationRadians); });
+}
+
+// Bakes one insert (top-level or nested) and, recursively, the inserts nested in its definition.
+// `path` holds the definitions on the current nesting chain, as in Cad2DExpandAssetInstances.
+inline void BakeAssetInsert(const Cad2DRecordSet& master,
+    const std::vector<Cad2DAssetDefinitionRecordCPU>& definitions,
+    const std::vector<Cad2DAssetInsertRecordCPU>& inserts, const Cad2DAssetInsertRecordCPU& insert,
+    std::vector<uint64_t>& path, Cad2DRecordSet& out) {
+    const Cad2DAssetDefinitionRecordCPU* definition = nullptr;
+    for (const Cad2DAssetDefinitionRecordCPU& d : definitions) {
+        if (!d.isDeleted && d.objectId == insert.definitionObjectId) definition = &d;
+    }
+    if (!definition || std::find(path.begin(), path.end(), definition->objectId) != path.end()) return;
+
+    // The definition's masters with its nested inserts exploded into them.
+    Cad2DRecordSet exploded = master;
+    path.push_back(definition->objectId);
+    for (const Cad2DAssetInsertRecordCPU& nested : inserts) {
+        if (nested.isDeleted || nested.parentObjectId != definition->objectId) continue;
+        BakeAssetInsert(master, definitions, inserts, nested, path, exploded);
+    }
+    path.pop_back();
+    BakeAssetMembers(exploded, definition->objectId, definition->baseX, definition->baseY, insert,
+        insert.parentObjectId != 0 ? insert.parentObjectId : insert.objectId, out);
+}
+
+// Every top-level insert of the page baked to member records.
+inline Cad2DRecordSet BakeAssetInserts(const Cad2DRecordSet& master,
+    const std::vector<Cad2DAssetDefinitionRecordCPU>& definitions,
+    const std::vector<Cad2DAssetInsertRecordCPU>& inserts) {
+    Cad2DRecordSet out;
+    std::vector<uint64_t> path;
+    for (const Cad2DAssetInsertRecordCPU& insert : inserts) {
+        if (insert.isDeleted || insert.parentObjectId != 0 || insert.containerMemoryId == 0) continue;
+        BakeAssetInsert(master, definitions, inserts, insert, path, out);
+    }
+    return out;
+}
+
+// GPU records of baked member records, as the page build converts plain page objects.
+inline void AppendBakedGpuRecords(const Cad2DRecordSet& baked, double originX, double originY,
+    std::vector<Cad2DLineGPURecord>& lines, std::vector<Cad2DCurveGPURecord>& curves) {
+    for (const Cad2DLineRecordCPU& r : baked.lines) lines.push_back(Cad2DToGpuLineRecord(r, originX, originY));
+    for (const Cad2DPolylineRecordCPU& r : baked.polylines) Cad2DAppendPolylineLineRecords(r, originX, originY, lines);
+    for (const Cad2DPolygonRecordCPU& r : baked.polygons) Cad2DAppendPolygonLineRecords(r, originX, originY, lines);
+    for (const Cad2DCircleRecordCPU& r : baked.circles) {
+        if (r.radius > 0.0) curves.push_back(Cad2DToGpuCircleRecord(r, originX, originY));
+    }
+    for (const Cad2DEllipseRecordCPU& r : baked.ellipses) {
+        if (r.radiusX > 0.0 && r.radiusY > 0.0) curves.push_back(Cad2DToGpuEllipseRecord(r, originX, originY));
+    }
+    for (const Cad2DArcRecordCPU& r : baked.arcs) {
+        if (r.radiusX > 0.0 && r.radiusY > 0.0) curves.push_back(Cad2DToGpuArcRecord(r, originX, originY));
+    }
+}
+
+// GPU records of the instanced path, as the page build stamps each instance from the cache.
+inline void AppendInstancedGpuRecords(const std::unordered_map<uint64_t, Cad2DAssetDefinitionGPU>& cache,
+    const std::vector<Cad2DAssetInstance>& instances, double originX, double originY,
+    std::vector<Cad2DLineGPURecord>& lines, std::vector<Cad2DCurveGPURecord>& curves,
+    std::vector<Cad2DTextRecordCPU>& texts) {
+    for (const Cad2DAssetInstance& instance : instances) {
+        auto cached = cache.find(instance.definitionObjectId);
+        if (cached == cache.end()) continue;
+        Cad2DAffine2D tileTransform = instance.transform;
+        tileTransform.tx -= originX;
+        tileTransform.ty -= originY;
+        for (Cad2DLineGPURecord gpuLine : cached->second.lines) {
+            Cad2DTransformLineGPURecord(gpuLine, tileTransform);
+            lines.push_back(gpuLine);
+        }
+        for (Cad2DCurveGPURecord gpuCurve : cached->second.curves) {
+            Cad2DTransformCurveGPURecord(gpuCurve, tileTransform);
+            curves.push_back(gpuCurve);
+        }
+        for (Cad2DTextRecordCPU text : cached->second.texts) {
+            Cad2DTransformTextRecord(text, tileTransform);
+            texts.push_back(std::move(text));
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Copy-thread tile bucketing of line records, shaped like the page build in
+// RenderPage2D-DirectX12.cpp: a std::map of tiles, the first reserving the container total, and every
+// segment cut at tile edges (Cad2DCutSegmentAtTileEdges) with each piece rebased on its tile. Timed
+// against bucketing each whole line by its start point, as before the cut. Argument: line count
+// (default 1M).
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "RenderPage2D.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+struct TileBuild {
+    double originX = 0.0;
+    double originY = 0.0;
+    std::vector<Cad2DLineGPURecord> lines;
+};
+
+Cad2DLineGPURecord ToGpu(const Cad2DLineRecordCPU& line, double x1, double y1, double x2, double y2, const TileBuild& tile) {
+    Cad2DLineGPURecord gpuLine{};
+    gpuLine.x1 = static_cast<float>(x1 - tile.originX);
+    gpuLine.y1 = static_cast<float>(y1 - tile.originY);
+    gpuLine.x2 = static_cast<float>(x2 - tile.originX);
+    gpuLine.y2 = static_cast<float>(y2 - tile.originY);
+    gpuLine.lineWeight = line.lineWeight;
+    gpuLine.lineWeightMode = static_cast<uint32_t>(line.lineWeightMode);
+    gpuLine.colorABGR = line.colorABGR;
+    return gpuLine;
+}
+
+struct BucketResult {
+    size_t tiles = 0;
+    size_t records = 0;
+};
+
+template <bool cutAtEdges>
+BucketResult Bucket(const std::vector<Cad2DLineRecordCPU>& lines) {
+    std::map<std::pair<int64_t, int64_t>, TileBuild> tiles;
+    std::pair<int64_t, int64_t> lastKey;
+    TileBuild* lastTile = nullptr;
+    auto tileAt = [&](double anchorX, double anchorY) -> TileBuild& {
+        const std::pair<int64_t, int64_t> key{ Cad2DPrecisionTileIndex(anchorX), Cad2DPrecisionTileIndex(anchorY) };
+        if (lastTile && key == lastKey) return *lastTile;
+        auto [it, inserted] = tiles.try_emplace(key);
+        if (inserted) {
+            it->second.originX = Cad2DPrecisionTileOrigin(key.first);
+            it->second.originY = Cad2DPrecisionTileOrigin(key.second);
+            if (tiles.size() == 1) it->second.lines.reserve(lines.size());
+        }
+        lastKey = key;
+        lastTile = &it->second;
+        return it->second;
+    };
+    std::vector<double> segmentCuts;
+    for (const Cad2DLineRecordCPU& line : lines) {
+        if constexpr (cutAtEdges) {
+            Cad2DCutSegmentAtTileEdges(line.x1, line.y1, line.x2, line.y2, segmentCuts, [&](double ax, double ay, double bx, double by) {
+                TileBuild& tile = tileAt((ax + bx) * 0.5, (ay + by) * 0.5);
+                tile.lines.push_back(ToGpu(line, ax, ay, bx, by, tile));
+            });
+        } else {
+            TileBuild& tile = tileAt(line.x1, line.y1);
+            tile.lines.push_back(ToGpu(line, line.x1, line.y1, line.x2, line.y2, tile));
+        }
+    }
+    BucketResult result{ tiles.size(), 0 };
+    for (const auto& entry : tiles) result.records += entry.second.lines.size();
+    return result;
+}
+
+std::vector<Cad2DLineRecordCPU> MakeLines(size_t count, double baseX, double baseY, double siteSize, double maxLength, uint32_t seed) {
+    std::mt19937_64 random(seed);
+    std::uniform_real_distribution<double> site(0.0, siteSize), offset(-maxLength, maxLength);
+    std::vector<Cad2DLineRecordCPU> lines(count);
+    for (Cad2DLineRecordCPU& line : lines) {
+        line.x1 = baseX + site(random);
+        line.y1 = baseY + site(random);
+        line.x2 = line.x1 + offset(random);
+        line.y2 = line.y1 + offset(random);
+    }
+    return lines;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = ValidationSizeArgument(argc, argv, 1000000);
+    const double tile = kCad2DPrecisionTileSizeCU;
+    struct Scenario { const char* name; std::vector<Cad2DLineRecordCPU> lines; };
+    const Scenario scenarios[] = {
+        { "building sheet, one tile      ", MakeLines(count, 1000.0, 1000.0, 40000.0, 500.0, 1) },
+        { "survey site, 10x10 tiles      ", MakeLines(count, 4500000.0, 2100000.0, 10.0 * tile, 2000.0, 2) },
+        { "long lines up to 8 tiles each ", MakeLines(count, 4500000.0, 2100000.0, 40.0 * tile, 4.0 * tile, 3) },
+    };
+    std::printf("%zu line records, copy-thread bucketing:\n", count);
+    for (const Scenario& scenario : scenarios) {
+        BucketResult anchored, cut;
+        const double anchoredMs = TimeMilliseconds([&] { anchored = Bucket<false>(scenario.lines); });
+        const double cutMs = TimeMilliseconds([&] { cut = Bucket<true>(scenario.lines); });
+        CHECK(anchored.records == count);
+        CHECK(cut.records >= count);
+        std::printf("  %s by start point %7.1f ms (%4zu tiles)   cut at edges %7.1f ms (%4zu tiles, %zu pieces)\n",
+            scenario.name, anchoredMs, anchored.tiles, cutMs, cut.tiles, cut.records);
+    }
+    return ValidationExitCode();
+}
@@ -0,0 +1,172 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Page-local precision tiles (RenderPage2D.h): survey-grid coordinates survive the index -> origin ->
+// float-relative conversion to well under 0.01 CU, the index clamps instead of overflowing, tile
+// edges fall on the right side, and segments are cut into contiguous single-tile pieces up to
+// kCad2DMaxSegmentTileCrossings.
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "RenderPage2D.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr double kTile = kCad2DPrecisionTileSizeCU;
+constexpr double kHalfTile = kTile * 0.5;
+
+// |x - origin| in float, back in double: what a GPU record stores and what it means.
+double RoundTrip(double x, double origin) { return origin + static_cast<double>(static_cast<float>(x - origin)); }
+
+void SurveyCoordinates() {
+    std::mt19937_64 random(5);
+    std::uniform_real_distribution<double> easting(100000.0, 9999999.999); // 6-7 digit eastings/northings.
+    double worstTiled = 0.0, worstViewRelative = 0.0, worstAbsolute = 0.0;
+    for (int n = 0; n < 1000000; ++n) {
+        const double x = std::round(easting(random) * 1000.0) / 1000.0; // Millimetre-rounded survey values.
+        const int64_t tile = Cad2DPrecisionTileIndex(x);
+        const double origin = Cad2DPrecisionTileOrigin(tile);
+        CHECK(std::abs(x - origin) <= kHalfTile);
+        worstTiled = (std::max)(worstTiled, std::abs(RoundTrip(x, origin) - x));
+
+        // The vertex shader adds the float tile offset (origin - view center, rebased in double) to
+        // the float local. With the view centered anywhere in the same tile the sum stays in float
+        // range below 65,536, so the position relative to the view is good to a float step there.
+        const double viewCenter = origin + (std::uniform_real_distribution<double>(-kHalfTile, kHalfTile))(random);
+        const Cad2DTileConstants constants = Cad2DMakeTileConstants(origin, 0.0, viewCenter, 0.0);
+        const float local = static_cast<float>(x - origin);
+        const double shaderRelative = static_cast<double>(constants.tileOffsetCU.x + local);
+        worstViewRelative = (std::max)(worstViewRelative, std::abs(shaderRelative - (x - viewCenter)));
+
+        worstAbsolute = (std::max)(worstAbsolute, std::abs(static_cast<double>(static_cast<float>(x)) - x));
+    }
+    CHECK(worstTiled <= 1.0 / 512.0);         // Half a float step at 32,768.
+    CHECK(worstViewRelative <= 0.01);         // The figure 2Drendering.md promises.
+    CHECK(worstAbsolute > 0.1);               // Without tiles: the problem this solves.
+    std::printf("survey coordinates: tile-relative error %.5f CU, view-relative %.5f CU, absolute float %.3f CU\n",
+        worstTiled, worstViewRelative, worstAbsolute);
+}
+
+void IndexClampAndEdges() {
+    const int64_t limit = kCad2DPrecisionTileIndexLimit;
+    CHECK(Cad2DPrecisionTileIndex(std::numeric_limits<double>::quiet_NaN()) == -limit);
+    CHECK(Cad2DPrecisionTileIndex(std::numeric_limits<double>::infinity()) == limit);
+    CHECK(Cad2DPrecisionTileIndex(-std::numeric_limits<double>::infinity()) == -limit);
+    CHECK(Cad2DPrecisionTileIndex(1e300) == limit);
+    CHECK(Cad2DPrecisionTileIndex(-1e300) == -limit);
+    CHECK(Cad2DPrecisionTileIndex(std::ldexp(1.0, 40) * kTile) == limit);       // Exactly at the clamp.
+    CHECK(Cad2DPrecisionTileIndex(std::ldexp(1.0, 40) * kTile * 2.0) == limit);
+    CHECK(Cad2DPrecisionTileIndex(-std::ldexp(1.0, 40) * kTile) == -limit);
+    CHECK(Cad2DPrecisionTileIndex(std::ldexp(1.0, 39) * kTile) == (int64_t(1) << 39)); // Inside it.
+    CHECK(std::isfinite(Cad2DPrecisionTileOrigin(limit)) && std::isfinite(Cad2DPrecisionTileOrigin(-limit)));
+
+    // An edge belongs to the tile above it; one ulp below belongs to the tile below.
+    for (int64_t k : { int64_t(-3), int64_t(-1), int64_t(0), int64_t(1), int64_t(152), int64_t(1) << 20 }) {
+        const double edge = static_cast<double>(k) * kTile;
+        CHECK(Cad2DPrecisionTileIndex(edge) == k);
+        // Below 0 that is a denormal, which the division flushes to -0: tile 0, on its edge.
+        if (k != 0) CHECK(Cad2DPrecisionTileIndex(std::nextafter(edge, -1e300)) == k - 1);
+        CHECK(Cad2DPrecisionTileIndex(std::nextafter(edge, 1e300)) == k);
+        CHECK(Cad2DPrecisionTileOrigin(k) - edge == kHalfTile);
+    }
+    CHECK(Cad2DPrecisionTileIndex(-0.0) == 0);
+    CHECK(Cad2DPrecisionTileIndex(-1e-300) == -1);
+}
+
+struct Piece { double ax, ay, bx, by; };
+
+std::vector<Piece> Cut(double x1, double y1, double x2, double y2) {
+    std::vector<double> cuts;
+    std::vector<Piece> pieces;
+    Cad2DCutSegmentAtTileEdges(x1, y1, x2, y2, cuts, [&](double ax, double ay, double bx, double by) {
+        pieces.push_back({ ax, ay, bx, by });
+    });
+    return pieces;
+}
+
+int64_t Crossings(double x1, double y1, double x2, double y2) {
+    return std::abs(Cad2DPrecisionTileIndex(x2) - Cad2DPrecisionTileIndex(x1)) +
+        std::abs(Cad2DPrecisionTileIndex(y2) - Cad2DPrecisionTileIndex(y1));
+}
+
+// Contiguous from start to end, and every piece inside the tile of its midpoint (where the copy
+// thread files it) up to the rounding of the cut point itself.
+void CheckPieces(const std::vector<Piece>& pieces, double x1, double y1, double x2, double y2) {
+    CHECK(!pieces.empty());
+    CHECK(pieces.front().ax == x1 && pieces.front().ay == y1);
+    CHECK(pieces.back().bx == x2 && pieces.back().by == y2);
+    for (size_t i = 1; i < pieces.size(); ++i) CHECK(pieces[i].ax == pieces[i - 1].bx && pieces[i].ay == pieces[i - 1].by);
+    for (const Piece& piece : pieces) {
+        const double originX = Cad2DPrecisionTileOrigin(Cad2DPrecisionTileIndex((piece.ax + piece.bx) * 0.5));
+        const double originY = Cad2DPrecisionTileOrigin(Cad2DPrecisionTileIndex((piece.ay + piece.by) * 0.5));
+        const double slack = kHalfTile * (1.0 + 1e-9);
+        CHECK(std::abs(piece.ax - originX) <= slack && std::abs(piece.bx - originX) <= slack);
+        CHECK(std::abs(piece.ay - originY) <= slack && std::abs(piece.by - originY) <= slack);
+    }
+}
+
+void SegmentCutting() {
+    std::mt19937_64 random(9);
+    size_t cutSegments = 0;
+    for (int n = 0; n < 200000; ++n) {
+        const double base = std::uniform_real_distribution<double>(-9999999.0, 9999999.0)(random);
+        const double reach = std::ldexp(1.0, static_cast<int>(random() % 24)); // 1 CU .. 8M CU (~128 tiles).
+        std::uniform_real_distribution<double> around(-reach, reach);
+        const double x1 = base + around(random), y1 = base * 0.5 + around(random);
+        const double x2 = x1 + around(random), y2 = (n % 7 == 0) ? y1 : y1 + around(random); // Some horizontal.
+        const std::vector<Piece> pieces = Cut(x1, y1, x2, y2);
+        const int64_t crossings = Crossings(x1, y1, x2, y2);
+        if (crossings > kCad2DMaxSegmentTileCrossings) {
+            CHECK(pieces.size() == 1); // Goes whole to its midpoint's tile.
+            continue;
+        }
+        CHECK(static_cast<int64_t>(pieces.size()) <= crossings + 1);
+        CHECK(static_cast<int64_t>(pieces.size()) >= (crossings + 1) / 2); // Corners merge two cuts.
+        CheckPieces(pieces, x1, y1, x2, y2);
+        cutSegments += crossings > 0;
+    }
+    CHECK(cutSegments > 10000);
+
+    // Exactly at the crossing limit: cut; one more: whole.
+    const double start = 0.25 * kTile;
+    const double atLimit = start + static_cast<double>(kCad2DMaxSegmentTileCrossings) * kTile;
+    const std::vector<Piece> limitPieces = Cut(start, 100.0, atLimit, 100.0);
+    CHECK(static_cast<int64_t>(limitPieces.size()) == kCad2DMaxSegmentTileCrossings + 1);
+    CheckPieces(limitPieces, start, 100.0, atLimit, 100.0);
+    CHECK(Cut(start, 100.0, atLimit + kTile, 100.0).size() == 1);
+
+    // Through a tile corner: the X and Y edges give the same cut, which is taken once.
+    const std::vector<Piece> corner = Cut(-kHalfTile, -kHalfTile, kHalfTile, kHalfTile);
+    CHECK(corner.size() == 2);
+    CheckPieces(corner, -kHalfTile, -kHalfTile, kHalfTile, kHalfTile);
+
+    // Vertical, reversed, ending exactly on an edge, and degenerate segments.
+    CheckPieces(Cut(10.0, 3.5 * kTile, 10.0, -2.5 * kTile), 10.0, 3.5 * kTile, 10.0, -2.5 * kTile);
+    CHECK(Cut(10.0, 3.5 * kTile, 10.0, -2.5 * kTile).size() == 7);
+    CHECK(Cut(0.5 * kTile, 5.0, 2.0 * kTile, 5.0).size() == 2); // The end's own tile holds a zero-length piece.
+    CHECK(Cut(7.0, 7.0, 7.0, 7.0).size() == 1);
+
+    // Survey-grid line work: every piece's float locals stay good to a float step at 32,768.
+    std::uniform_real_distribution<double> site(4500000.0, 4500000.0 + 10.0 * kTile);
+    double worst = 0.0;
+    for (int n = 0; n < 50000; ++n) {
+        const double x1 = site(random), y1 = site(random), x2 = site(random), y2 = site(random);
+        for (const Piece& piece : Cut(x1, y1, x2, y2)) {
+            const double originX = Cad2DPrecisionTileOrigin(Cad2DPrecisionTileIndex((piece.ax + piece.bx) * 0.5));
+            worst = (std::max)({ worst, std::abs(RoundTrip(piece.ax, originX) - piece.ax),
+                std::abs(RoundTrip(piece.bx, originX) - piece.bx) });
+        }
+    }
+    CHECK(worst <= 1.0 / 256.0);
+}
+
+} // namespace
+
+int main() {
+    SurveyCoordinates();
+    IndexClampAndEdges();
+    SegmentCutting();
+    return ValidationExitCode();
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Zoom Max over N objects: the cached fit ZoomSceneToExtents runs (SceneExtentsFit::AddBounds per
+// object) against the per-vertex fit it replaced (every vertex to world space, then AddPoint), plus
+// the one-time cost of filling the cache (SceneBoundsOfVertices per object, as the first zoom after
+// load or an edit pays it). Stand-in 24-vertex box meshes, one in four placed. The meshes are
+// generated up front and are not timed, so the per-vertex figure understates the old path, which
+// regenerated every mesh on every zoom. Both fits must give the same distance.
+// Argument: object count (default 1M).
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "SceneExtentsFit.h"
+#include "SceneExtentsMeshes.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+struct CachedBounds {
+    Float3 center, extents;
+    float radius = -1.0f;
+};
+
+}
+
+int main(int argc, char** argv) {
+    const size_t objectCount = ValidationSizeArgument(argc, argv, 1000000);
+    std::mt19937 random(1000000);
+    std::uniform_real_distribution<float> coordinate(-2000.0f, 2000.0f);
+    std::uniform_real_distribution<float> size(0.2f, 6.0f);
+    std::vector<SceneObject> objects(objectCount);
+    for (SceneObject& object : objects) {
+        const Float3 at{ coordinate(random), coordinate(random), coordinate(random) * 0.05f };
+        object.vertices = BoxMesh(at, { at.x + size(random), at.y + size(random), at.z + size(random) });
+        object.placed = random() % 4 == 0;
+        if (object.placed) {
+            object.rotation = RandomRotation(random);
+            object.origin = { coordinate(random) * 0.01f, coordinate(random) * 0.01f, 0.0f };
+        }
+    }
+    const CameraFrame camera = LookingAlong({ 0.0f, 0.0f, 0.0f }, { 1.0f, 2.0f, -1.5f });
+    const float tanHalfFovY = 0.3f, tanHalfFovX = 0.3f * 16.0f / 9.0f, nearZ = 0.1f;
+
+    float perVertexDistance = 0.0f;
+    const double perVertexMs = TimeMilliseconds([&] {
+        SceneExtentsFit fit(camera.target, camera.forward, camera.right, camera.up, tanHalfFovX, tanHalfFovY);
+        for (const SceneObject& object : objects) {
+            for (const MeshVertex& vertex : object.vertices) fit.AddPoint(WorldPoint(object, vertex.position));
+        }
+        perVertexDistance = fit.RequiredDistance(nearZ);
+    });
+
+    std::vector<CachedBounds> cache(objectCount);
+    const double refreshMs = TimeMilliseconds([&] {
+        for (size_t i = 0; i < objectCount; ++i) {
+            SceneBoundsOfVertices(objects[i].vertices, cache[i].center, cache[i].extents, cache[i].radius);
+        }
+    });
+
+    float cachedDistance = 0.0f;
+    const double cachedMs = TimeMilliseconds([&] {
+        SceneExtentsFit fit(camera.target, camera.forward, camera.right, camera.up, tanHalfFovX, tanHalfFovY);
+        for (size_t i = 0; i < objectCount; ++i) {
+            const CachedBounds& bounds = cache[i];
+            if (objects[i].placed) {
+                fit.AddBounds(bounds.center, bounds.extents, bounds.radius, objects[i].origin, objects[i].rotation);
+            } else {
+                fit.AddBounds(bounds.center, bounds.extents, bounds.radius);
+            }
+        }
+        cachedDistance = fit.RequiredDistance(nearZ);
+    });
+
+    CHECK(std::abs(cachedDistance - perVertexDistance) <= 1e-4f * perVertexDistance);
+    std::printf("Zoom Max over %zu objects (24-vertex boxes, 1 in 4 placed)\n", objectCount);
+    std::printf("  per vertex, meshes already built: %.1f ms (distance %.3f)\n", perVertexMs, perVertexDistance);
+    std::printf("  cached bounds:                    %.1f ms (distance %.3f)\n", cachedMs, cachedDistance);
+    std::printf("  filling the cache, once:          %.1f ms\n", refreshMs);
+    return ValidationExitCode();
+}
@@ -0,0 +1,145 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Zoom Max / Zoom Focus from cached bounds (SceneExtentsFit::AddBounds, what ZoomSceneToExtents
+// does per object) against the per-vertex fit it replaced (AddPoint over every world vertex), for
+// random cameras, placements and meshes: equal for boxes, within a percent for fine spheres, and
+// never closer than per-vertex for anything.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "SceneExtentsFit.h"
+#include "SceneExtentsMeshes.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr float kNearZ = 0.1f;
+
+struct Scene {
+    CameraFrame camera;
+    float tanHalfFovX = 0.0f, tanHalfFovY = 0.0f;
+    std::vector<SceneObject> objects;
+};
+
+struct CachedBounds {
+    Float3 center, extents;
+    float radius = -1.0f;
+};
+
+float PerVertexDistance(const Scene& scene) {
+    SceneExtentsFit fit(scene.camera.target, scene.camera.forward, scene.camera.right, scene.camera.up,
+        scene.tanHalfFovX, scene.tanHalfFovY);
+    for (const SceneObject& object : scene.objects) {
+        for (const MeshVertex& vertex : object.vertices) fit.AddPoint(WorldPoint(object, vertex.position));
+    }
+    return fit.RequiredDistance(kNearZ);
+}
+
+float CachedDistance(const Scene& scene) {
+    SceneExtentsFit fit(scene.camera.target, scene.camera.forward, scene.camera.right, scene.camera.up,
+        scene.tanHalfFovX, scene.tanHalfFovY);
+    for (const SceneObject& object : scene.objects) {
+        CachedBounds bounds;
+        if (!SceneBoundsOfVertices(object.vertices, bounds.center, bounds.extents, bounds.radius)) continue;
+        if (object.placed) {
+            fit.AddBounds(bounds.center, bounds.extents, bounds.radius, object.origin, object.rotation);
+        } else {
+            fit.AddBounds(bounds.center, bounds.extents, bounds.radius);
+        }
+    }
+    return fit.RequiredDistance(kNearZ);
+}
+
+enum class MeshKind { Box, Sphere, Cloud };
+
+Scene RandomScene(std::mt19937& random, MeshKind kind, size_t objectCount) {
+    std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.2f, 8.0f);
+    std::uniform_real_distribution<float> fov(0.3f, 1.4f);
+    std::uniform_real_distribution<float> aspect(0.5f, 2.5f);
+    std::normal_distribution<float> normal;
+
+    Scene scene;
+    scene.camera = LookingAlong({ coordinate(random), coordinate(random), coordinate(random) },
+        { normal(random), normal(random), normal(random) });
+    scene.tanHalfFovY = std::tan(fov(random) * 0.5f) * 0.95f;
+    scene.tanHalfFovX = scene.tanHalfFovY * aspect(random);
+    for (size_t i = 0; i < objectCount; ++i) {
+        SceneObject object;
+        const Float3 at{ coordinate(random), coordinate(random), coordinate(random) };
+        if (kind == MeshKind::Box) {
+            object.vertices = BoxMesh(at, { at.x + size(random), at.y + size(random), at.z + size(random) });
+        } else if (kind == MeshKind::Sphere) {
+            object.vertices = SphereMesh(at, size(random), 256, 128);
+        } else {
+            const int count = 1 + int(random() % 40);
+            for (int v = 0; v < count; ++v) {
+                object.vertices.push_back({ { at.x + normal(random) * 3.0f, at.y + normal(random),
+                    at.z + normal(random) * 0.5f } });
+            }
+        }
+        object.placed = random() % 2 == 0;
+        if (object.placed) {
+            object.rotation = RandomRotation(random);
+            object.origin = { coordinate(random), coordinate(random), coordinate(random) };
+        }
+        scene.objects.push_back(std::move(object));
+    }
+    return scene;
+}
+
+// Float rounding of the two evaluation orders, relative to the scene's scale.
+bool Close(float a, float b, float relative) {
+    return std::abs(a - b) <= relative * (std::max)({ 1.0f, std::abs(a), std::abs(b) });
+}
+
+}
+
+int main() {
+    std::mt19937 random(41);
+
+    // Boxes: the box hugs the mesh, so the cached fit is the per-vertex fit.
+    int boxMismatches = 0;
+    for (int trial = 0; trial < 400; ++trial) {
+        const Scene scene = RandomScene(random, MeshKind::Box, 1 + trial % 20);
+        if (!Close(CachedDistance(scene), PerVertexDistance(scene), 1e-4f)) ++boxMismatches;
+    }
+    CHECK(boxMismatches == 0);
+
+    // Fine spheres: the sphere bound takes over; the mesh's chords sit just inside it.
+    int sphereMismatches = 0;
+    for (int trial = 0; trial < 40; ++trial) {
+        const Scene scene = RandomScene(random, MeshKind::Sphere, 1 + trial % 5);
+        const float cached = CachedDistance(scene), perVertex = PerVertexDistance(scene);
+        if (cached < perVertex - 1e-3f || !Close(cached, perVertex, 0.01f)) ++sphereMismatches;
+    }
+    CHECK(sphereMismatches == 0);
+
+    // Anything: never closer than per-vertex, so the fitted objects are always fully in view.
+    int clipped = 0;
+    for (int trial = 0; trial < 400; ++trial) {
+        const Scene scene = RandomScene(random, MeshKind::Cloud, 1 + trial % 30);
+        const float perVertex = PerVertexDistance(scene);
+        if (CachedDistance(scene) < perVertex - 1e-4f * (std::max)(1.0f, perVertex)) ++clipped;
+    }
+    CHECK(clipped == 0);
+
+    // The near plane decides for a small object right at the target.
+    Scene small;
+    small.camera = LookingAlong({ 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f });
+    small.tanHalfFovX = small.tanHalfFovY = 1.0f;
+    small.objects.emplace_back();
+    small.objects.back().vertices = BoxMesh({ -0.01f, -0.01f, -0.01f }, { 0.01f, 0.01f, 0.01f });
+    CHECK(Close(CachedDistance(small), kNearZ + 0.01f, 1e-5f));
+    CHECK(Close(PerVertexDistance(small), kNearZ + 0.01f, 1e-5f));
+
+    // Nothing to fit: no distance, and ZoomSceneToExtents leaves the camera alone.
+    SceneExtentsFit empty(small.camera.target, small.camera.forward, small.camera.right, small.camera.up, 1.0f, 1.0f);
+    CHECK(empty.Empty() && empty.RequiredDistance(kNearZ) == 0.0f);
+    Float3 center, extents;
+    float radius = 0.0f;
+    CHECK(!SceneBoundsOfVertices(std::vector<MeshVertex>{}, center, extents, radius));
+    return ValidationExitCode();
+}
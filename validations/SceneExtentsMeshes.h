@@ -0,0 +1,98 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+// Stand-in scene objects for SceneExtentsFitTest and SceneExtentsFitBenchmark: an authored mesh and
+// a Placement3D (origin, unit quaternion) each, carried to world space by a plain quaternion product
+// written out here - deliberately not SceneExtentsFit.h's rotation matrix, so the two are checked
+// against each other rather than against themselves.
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+struct Float3 { float x = 0.0f, y = 0.0f, z = 0.0f; };
+struct Float4 { float x = 0.0f, y = 0.0f, z = 0.0f, w = 1.0f; };
+struct MeshVertex { Float3 position; }; // The part of Vertex the bounds read.
+
+struct SceneObject {
+    std::vector<MeshVertex> vertices; // Authored space.
+    Float3 origin;
+    Float4 rotation;
+    bool placed = false;              // False: identity placement, as for anything never moved.
+};
+
+// q * v * conj(q), for a unit q: what XMVector3Rotate computes.
+inline Float3 RotatePoint(const Float4& q, const Float3& v) {
+    // t = q * (v, 0)
+    const float tw = -q.x * v.x - q.y * v.y - q.z * v.z;
+    const float tx = q.w * v.x + q.y * v.z - q.z * v.y;
+    const float ty = q.w * v.y + q.z * v.x - q.x * v.z;
+    const float tz = q.w * v.z + q.x * v.y - q.y * v.x;
+    // t * conj(q)
+    return { -tw * q.x + tx * q.w - ty * q.z + tz * q.y,
+             -tw * q.y + ty * q.w - tz * q.x + tx * q.z,
+             -tw * q.z + tz * q.w - tx * q.y + ty * q.x };
+}
+
+inline Float3 WorldPoint(const SceneObject& object, const Float3& authored) {
+    if (!object.placed) return authored;
+    const Float3 rotated = RotatePoint(object.rotation, authored);
+    return { rotated.x + object.origin.x, rotated.y + object.origin.y, rotated.z + object.origin.z };
+}
+
+inline Float4 RandomRotation(std::mt19937& random) {
+    std::normal_distribution<float> normal;
+    Float4 q{ normal(random), normal(random), normal(random), normal(random) };
+    const float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    return { q.x / length, q.y / length, q.z / length, q.w / length };
+}
+
+// An axis-aligned box as the primitives emit one: 24 vertices, four per face, all on the 8 corners.
+inline std::vector<MeshVertex> BoxMesh(const Float3& low, const Float3& high) {
+    std::vector<MeshVertex> vertices;
+    for (int face = 0; face < 6; ++face) {
+        for (int corner = 0; corner < 4; ++corner) {
+            const int bits = face < 3 ? (corner | ((face & 1) << 2)) : ((corner << 1) | (face & 1));
+            vertices.push_back({ { bits & 1 ? high.x : low.x, bits & 2 ? high.y : low.y, bits & 4 ? high.z : low.z } });
+        }
+    }
+    return vertices;
+}
+
+// A UV sphere of the given resolution.
+inline std::vector<MeshVertex> SphereMesh(const Float3& center, float radius, int segments, int rings) {
+    const float pi = 3.14159265358979f;
+    std::vector<MeshVertex> vertices;
+    for (int ring = 0; ring <= rings; ++ring) {
+        const float polar = pi * float(ring) / float(rings);
+        for (int segment = 0; segment < segments; ++segment) {
+            const float azimuth = 2.0f * pi * float(segment) / float(segments);
+            vertices.push_back({ { center.x + radius * std::sin(polar) * std::cos(azimuth),
+                center.y + radius * std::sin(polar) * std::sin(azimuth), center.z + radius * std::cos(polar) } });
+        }
+    }
+    return vertices;
+}
+
+// Camera frame looking along direction, with +Z up unless that is the view axis, built as
+// ZoomSceneToExtents builds it: right = up x forward, viewUp = forward x right.
+struct CameraFrame { Float3 target, forward, right, up; };
+
+inline Float3 Normalized(const Float3& v) {
+    const float length = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+    return { v.x / length, v.y / length, v.z / length };
+}
+
+inline Float3 Cross(const Float3& a, const Float3& b) {
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+inline CameraFrame LookingAlong(const Float3& target, const Float3& direction) {
+    CameraFrame frame;
+    frame.target = target;
+    frame.forward = Normalized(direction);
+    const Float3 worldUp = std::abs(frame.forward.z) > 0.99f ? Float3{ 0.0f, 1.0f, 0.0f } : Float3{ 0.0f, 0.0f, 1.0f };
+    frame.right = Normalized(Cross(worldUp, frame.forward));
+    frame.up = Cross(frame.forward, frame.right);
+    return frame;
+}
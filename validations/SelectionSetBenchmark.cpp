@@ -0,0 +1,119 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Selection-driven move / hide / zoom over a model-sized store, at 10, 10k and 100k selected,
+// shaped like TranslateSelectedSceneObjects, ApplySceneVisibilityAction and ZoomSceneToExtents:
+// copy the set (as they do under selectedMutex), then walk the selection through its slot hints.
+// The old selected-id vector (store walk x linear membership) is timed where it finishes.
+// Argument: stored object count (default 1M).
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "SelectionSet.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+struct StoredObject { // The fields of StoredGeometryObject3D + placement these operations touch.
+    uint64_t memoryId = 0;
+    float origin[3] = {};
+    float boundsCenter[3] = {};
+    float boundsRadius = 0.0f;
+};
+
+const StoredObject* Resolve(const std::vector<StoredObject>& store, uint64_t id, uint32_t hint) {
+    return hint < store.size() && store[hint].memoryId == id ? &store[hint] : nullptr;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t objectCount = ValidationSizeArgument(argc, argv, 1000000);
+    std::vector<StoredObject> store(objectCount);
+    for (size_t i = 0; i < objectCount; ++i) {
+        StoredObject& object = store[i];
+        object.memoryId = 1000 + i;
+        for (int axis = 0; axis < 3; ++axis) object.boundsCenter[axis] = object.origin[axis] = static_cast<float>((i * (axis + 7)) % 5000);
+        object.boundsRadius = 1.0f + static_cast<float>(i % 13);
+    }
+    std::vector<size_t> order(objectCount);
+    std::iota(order.begin(), order.end(), size_t{ 0 });
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(11));
+
+    std::printf("%zu stored objects\n", objectCount);
+    for (size_t selectedCount : { size_t{ 10 }, size_t{ 10000 }, size_t{ 100000 } }) {
+        selectedCount = (std::min)(selectedCount, objectCount);
+        SelectionSet selection;
+        const double selectMs = TimeMilliseconds([&] {
+            for (size_t n = 0; n < selectedCount; ++n) selection.Insert(store[order[n]].memoryId, static_cast<uint32_t>(order[n]));
+        });
+
+        const double moveMs = TimeMilliseconds([&] {
+            const SelectionSet selected = selection;
+            for (size_t i = 0; i < selected.Size(); ++i) {
+                StoredObject* object = const_cast<StoredObject*>(Resolve(store, selected.Ids()[i], selected.StoredIndices()[i]));
+                if (object) object->origin[0] += 1.0f;
+            }
+        });
+
+        std::vector<uint64_t> hidden;
+        const double hideMs = TimeMilliseconds([&] {
+            const SelectionSet selected = selection;
+            for (size_t i = 0; i < selected.Size(); ++i) {
+                if (Resolve(store, selected.Ids()[i], selected.StoredIndices()[i])) hidden.push_back(selected.Ids()[i]);
+            }
+            std::sort(hidden.begin(), hidden.end());
+        });
+        CHECK(hidden.size() == selectedCount);
+
+        size_t unselected = 0;
+        const double hideUnselectedMs = TimeMilliseconds([&] {
+            const SelectionSet selected = selection;
+            for (const StoredObject& object : store) unselected += selected.Contains(object.memoryId) ? 0 : 1;
+        });
+        CHECK(unselected == objectCount - selectedCount);
+
+        float reach = 0.0f;
+        const double zoomMs = TimeMilliseconds([&] {
+            const SelectionSet selected = selection;
+            for (size_t i = 0; i < selected.Size(); ++i) {
+                const StoredObject* object = Resolve(store, selected.Ids()[i], selected.StoredIndices()[i]);
+                if (!object) continue;
+                const float* c = object->boundsCenter;
+                reach = (std::max)(reach, std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]) + object->boundsRadius);
+            }
+        });
+        CHECK(reach > 0.0f);
+
+        // Ctrl+click deselect and reselect of the middle entry: renumbers the later half.
+        const uint64_t middle = selection.Ids()[selectedCount / 2];
+        const uint32_t middleHint = selection.StoredIndices()[selectedCount / 2];
+        const double toggleMs = TimeMilliseconds([&] {
+            CHECK(selection.Erase(middle));
+            CHECK(selection.Insert(middle, middleHint));
+        });
+
+        std::printf("  %6zu selected: select %8.3f ms  move %7.3f ms  hide %7.3f ms  hide unselected %7.2f ms"
+            "  zoom %7.3f ms  deselect+reselect %6.3f ms\n",
+            selectedCount, selectMs, moveMs, hideMs, hideUnselectedMs, zoomMs, toggleMs);
+
+        // The replaced representation: every operation walked the store and searched the vector.
+        if (selectedCount * objectCount <= 200000000ull) {
+            const std::vector<uint64_t> selectedVector = selection.Ids();
+            size_t moved = 0;
+            const double oldMoveMs = TimeMilliseconds([&] {
+                for (StoredObject& object : store) {
+                    if (std::find(selectedVector.begin(), selectedVector.end(), object.memoryId) != selectedVector.end()) {
+                        object.origin[0] += 1.0f;
+                        ++moved;
+                    }
+                }
+            });
+            CHECK(moved == selectedCount);
+            std::printf("  %6zu selected, old vector scan: move %.2f ms\n", selectedCount, oldMoveMs);
+        }
+    }
+    return ValidationExitCode();
+}
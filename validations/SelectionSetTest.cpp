@@ -0,0 +1,117 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// SelectionSet against std::unordered_set (membership) plus a vector (click order and slot hints)
+// under randomized insert / erase / clear, including long erase runs that empty the set.
+
+#include <algorithm>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "SelectionSet.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+struct Reference {
+    std::unordered_set<uint64_t> members;
+    std::vector<uint64_t> ids;
+    std::vector<uint32_t> hints;
+};
+
+void CheckAll(const SelectionSet& set, const Reference& reference, uint64_t idLimit) {
+    CHECK(set.Size() == reference.members.size());
+    CHECK(set.Empty() == reference.members.empty());
+    CHECK(set.Ids() == reference.ids);
+    CHECK(set.StoredIndices() == reference.hints);
+    for (uint64_t id : reference.ids) CHECK(set.Contains(id));
+    for (uint64_t id = 0; id <= (std::min)(idLimit, uint64_t{ 4096 }); ++id) {
+        CHECK(set.Contains(id) == (reference.members.count(id) != 0));
+    }
+}
+
+void RandomOperations(uint64_t idLimit, int operationCount, int insertPercent, uint32_t seed) {
+    std::mt19937_64 random(seed);
+    SelectionSet set;
+    Reference reference;
+    for (int op = 0; op < operationCount; ++op) {
+        const uint64_t id = random() % (idLimit + 1); // 0 is an ordinary id here.
+        const int kind = static_cast<int>(random() % 100);
+        if (kind < insertPercent) {
+            const uint32_t hint = (random() & 3) ? static_cast<uint32_t>(random() % 1000000) : SelectionSet::kNoStoredIndex;
+            const bool added = reference.members.insert(id).second;
+            CHECK(set.Insert(id, hint) == added);
+            if (added) {
+                reference.ids.push_back(id);
+                reference.hints.push_back(hint);
+            }
+        } else if (kind < 99) {
+            const bool removed = reference.members.erase(id) != 0;
+            CHECK(set.Erase(id) == removed);
+            if (removed) {
+                const size_t position = std::find(reference.ids.begin(), reference.ids.end(), id) - reference.ids.begin();
+                reference.ids.erase(reference.ids.begin() + position);
+                reference.hints.erase(reference.hints.begin() + position);
+            }
+        } else if (random() % 20 == 0) {
+            set.Clear();
+            reference = {};
+        }
+        CHECK(set.Contains(id) == (reference.members.count(id) != 0));
+        if (op % 499 == 0) CheckAll(set, reference, idLimit);
+    }
+    CheckAll(set, reference, idLimit);
+}
+
+// Sequential ids erased front to back, back to front and from the middle out: every erase shifts
+// the probe chains the splitmix-scattered ids share.
+void EraseOrders() {
+    for (int order = 0; order < 3; ++order) {
+        SelectionSet set;
+        std::vector<uint64_t> ids;
+        for (uint64_t id = 1000; id < 3000; ++id) {
+            set.Insert(id, static_cast<uint32_t>(id * 2));
+            ids.push_back(id);
+        }
+        std::vector<uint64_t> eraseOrder = ids;
+        if (order == 1) std::reverse(eraseOrder.begin(), eraseOrder.end());
+        if (order == 2) std::rotate(eraseOrder.begin(), eraseOrder.begin() + eraseOrder.size() / 2, eraseOrder.end());
+        for (size_t n = 0; n < eraseOrder.size(); ++n) {
+            CHECK(set.Erase(eraseOrder[n]));
+            CHECK(!set.Contains(eraseOrder[n]));
+            ids.erase(std::find(ids.begin(), ids.end(), eraseOrder[n]));
+            if (n % 97 == 0) {
+                CHECK(set.Ids() == ids);
+                for (size_t i = 0; i < ids.size(); ++i) {
+                    CHECK(set.Contains(ids[i]));
+                    CHECK(set.StoredIndices()[i] == ids[i] * 2);
+                }
+            }
+        }
+        CHECK(set.Empty());
+        CHECK(set.Insert(1500)); // Still usable once emptied by erases.
+        CHECK(set.Contains(1500) && !set.Contains(1501));
+    }
+}
+
+void DuplicateInsertKeepsHint() {
+    SelectionSet set;
+    CHECK(!set.Contains(5));
+    CHECK(!set.Erase(5)); // Empty table.
+    CHECK(set.Insert(5, 10));
+    CHECK(!set.Insert(5, 20));
+    CHECK(set.StoredIndices().size() == 1 && set.StoredIndices()[0] == 10);
+    const SelectionSet copy = set; // Copies carry their index.
+    CHECK(copy.Contains(5));
+}
+
+} // namespace
+
+int main() {
+    DuplicateInsertKeepsHint();
+    EraseOrders();
+    RandomOperations(40, 200000, 50, 1);      // Tiny table, constant churn.
+    RandomOperations(3000, 200000, 70, 2);    // Grows through rehashes.
+    RandomOperations(3000, 200000, 30, 3);    // Mostly erases: keeps draining to empty.
+    RandomOperations(1ull << 40, 50000, 60, 4); // Sparse ids, erases mostly miss.
+    return ValidationExitCode();
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Designation lookups through the generated perfect hash against the per-import
+// std::unordered_map<std::string, index> it replaced, whose build is timed separately. The query
+// mix is every designation and alias plus one near miss per row, shuffled. Best of three runs.
+// Argument: lookup count (default 10M).
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SteelProfileCatalog.h"
+#include "ValidationCheck.h"
+
+int main(int argc, char** argv) {
+    const size_t lookupCount = ValidationSizeArgument(argc, argv, 10000000);
+    std::vector<std::string> queries;
+    for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
+        queries.emplace_back(kSteelProfiles[i].designation);
+        if (kSteelProfiles[i].altDesignation[0] != '\0') queries.emplace_back(kSteelProfiles[i].altDesignation);
+        queries.push_back(std::string(kSteelProfiles[i].designation) + "X"); // Miss.
+    }
+    std::shuffle(queries.begin(), queries.end(), std::mt19937_64(3));
+
+    auto buildMap = [] {
+        std::unordered_map<std::string, SteelProfileIndex> byName;
+        for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
+            byName.emplace(kSteelProfiles[i].designation, static_cast<SteelProfileIndex>(i));
+        }
+        for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
+            if (kSteelProfiles[i].altDesignation[0] != '\0') byName.emplace(kSteelProfiles[i].altDesignation, static_cast<SteelProfileIndex>(i));
+        }
+        return byName;
+    };
+
+    double hashMs = 1e30, mapMs = 1e30, buildUs = 1e30;
+    uint64_t hashSum = 0, mapSum = 0;
+    for (int run = 0; run < 3; ++run) {
+        hashSum = mapSum = 0;
+        hashMs = (std::min)(hashMs, TimeMilliseconds([&] {
+            for (size_t n = 0, q = 0; n < lookupCount; ++n, q = q + 1 == queries.size() ? 0 : q + 1) {
+                hashSum += FindSteelProfileIndexByDesignation(queries[q]);
+            }
+        }));
+        std::unordered_map<std::string, SteelProfileIndex> byName;
+        buildUs = (std::min)(buildUs, 1000.0 * TimeMilliseconds([&] { byName = buildMap(); }));
+        mapMs = (std::min)(mapMs, TimeMilliseconds([&] {
+            for (size_t n = 0, q = 0; n < lookupCount; ++n, q = q + 1 == queries.size() ? 0 : q + 1) {
+                const auto found = byName.find(queries[q]);
+                mapSum += found == byName.end() ? kNoSteelProfile : found->second;
+            }
+        }));
+    }
+    CHECK(hashSum == mapSum); // Same answers, misses included.
+
+    std::printf("%zu designation lookups over %zu distinct queries:\n"
+        "  perfect hash   %.1f ms (%.1f ns each), nothing to build\n"
+        "  unordered_map  %.1f ms (%.1f ns each), plus %.0f us to build it per import\n",
+        lookupCount, queries.size(), hashMs, hashMs * 1e6 / lookupCount, mapMs, mapMs * 1e6 / lookupCount, buildUs);
+    return ValidationExitCode();
+}
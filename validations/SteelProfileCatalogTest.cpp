@@ -0,0 +1,64 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Every catalog row's designation and alt_designation alias resolves through the generated perfect
+// hash to its own row (the first row carrying it; a designation beats another row's alias), every
+// id resolves through the binary search, and near misses resolve to nothing.
+
+#include <string>
+#include <string_view>
+
+#include "SteelProfileCatalog.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+// What FindSteelProfileIndexByDesignation promises, by linear scan.
+SteelProfileIndex ExpectedIndex(std::string_view text) {
+    if (text.empty()) return kNoSteelProfile;
+    for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
+        if (text == kSteelProfiles[i].designation) return static_cast<SteelProfileIndex>(i);
+    }
+    for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
+        if (text == kSteelProfiles[i].altDesignation) return static_cast<SteelProfileIndex>(i);
+    }
+    return kNoSteelProfile;
+}
+
+} // namespace
+
+int main() {
+    CHECK(kSteelProfileCount > 0);
+    size_t aliasCount = 0;
+    for (uint32_t i = 0; i < kSteelProfileCount; ++i) {
+        const SteelProfileRecord& row = kSteelProfiles[i];
+        const SteelProfileIndex byDesignation = FindSteelProfileIndexByDesignation(row.designation);
+        CHECK(byDesignation == ExpectedIndex(row.designation));
+        CHECK(byDesignation <= i && std::string_view(kSteelProfiles[byDesignation].designation) == row.designation);
+        if (row.altDesignation[0] != '\0') {
+            ++aliasCount;
+            const SteelProfileIndex byAlias = FindSteelProfileIndexByDesignation(row.altDesignation);
+            CHECK(byAlias == ExpectedIndex(row.altDesignation));
+            CHECK(byAlias != kNoSteelProfile);
+        }
+        CHECK(FindSteelProfileById(row.id) == &row);
+
+        // Near misses: case, padding, truncation, an extra character.
+        const std::string designation = row.designation;
+        std::string lower = designation;
+        for (char& c : lower) c = static_cast<char>(c >= 'A' && c <= 'Z' ? c + 32 : c);
+        for (const std::string& miss : { lower, " " + designation, designation + " ",
+                 designation.substr(0, designation.size() - 1), designation + "0" }) {
+            CHECK(FindSteelProfileIndexByDesignation(miss) == ExpectedIndex(miss));
+        }
+    }
+    CHECK(aliasCount > 0);
+    CHECK(FindSteelProfileIndexByDesignation("") == kNoSteelProfile);
+    CHECK(FindSteelProfileIndexByDesignation("NOT A PROFILE") == kNoSteelProfile);
+    CHECK(FindSteelProfileById(0) == nullptr);
+
+    // An alias that is also its own row's designation elsewhere resolves to that row.
+    const SteelProfileIndex ipe200 = FindSteelProfileIndexByDesignation("IPE 200");
+    CHECK(ipe200 != kNoSteelProfile && std::string_view(kSteelProfiles[ipe200].designation) == "IPE 200");
+    const SteelProfileIndex npb200 = FindSteelProfileIndexByDesignation("NPB 200");
+    CHECK(npb200 != kNoSteelProfile && std::string_view(kSteelProfiles[npb200].altDesignation) == "IPE 200");
+    return ValidationExitCode();
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// TabObjectIndex build and lookup cost at tab scale. Argument: entry count (default 1M).
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "TabObjectIndex.h"
+#include "ValidationCheck.h"
+
+int main(int argc, char** argv) {
+    const size_t count = ValidationSizeArgument(argc, argv, 1000000);
+    const size_t lookupCount = (std::max)(count / 10, size_t{ 1 });
+    TabObjectIndex index;
+
+    const double insertMs = TimeMilliseconds([&] {
+        for (size_t i = 0; i < count; ++i) index.Insert(i + 1, TabObjectStore::Geometry3D, static_cast<uint32_t>(i));
+    });
+
+    std::mt19937_64 random(7);
+    std::vector<uint64_t> ids(lookupCount);
+    for (uint64_t& id : ids) id = 1 + random() % count;
+    uint64_t slotSum = 0;
+    const double findMs = TimeMilliseconds([&] {
+        for (uint64_t id : ids) slotSum += index.Find(id).slot;
+    });
+    uint64_t expectedSum = 0;
+    for (uint64_t id : ids) expectedSum += id - 1;
+    CHECK(slotSum == expectedSum);
+
+    const double eraseMs = TimeMilliseconds([&] {
+        for (size_t i = 0; i < count; i += 2) index.Erase(i + 1);
+    });
+    CHECK(index.Size() == count / 2);
+
+    std::printf("TabObjectIndex, %zu entries: insert %.1f ms, %zu random finds %.2f ms, erase half %.1f ms\n",
+        count, insertMs, lookupCount, findMs, eraseMs);
+    return ValidationExitCode();
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// TabObjectIndex against std::unordered_map under randomized insert / repoint / erase / reserve /
+// clear, with ids drawn from a small range so tombstones are revived and probe chains cross them.
+
+#include <random>
+#include <unordered_map>
+
+#include "TabObjectIndex.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+bool SameSlot(TabObjectSlot a, TabObjectSlot b) { return a.store == b.store && a.slot == b.slot; }
+
+void CheckAll(const TabObjectIndex& index, const std::unordered_map<uint64_t, TabObjectSlot>& reference,
+    uint64_t idLimit) {
+    CHECK(index.Size() == reference.size());
+    for (uint64_t id = 0; id <= idLimit; ++id) {
+        const auto found = reference.find(id);
+        CHECK(SameSlot(index.Find(id), found == reference.end() ? TabObjectSlot{} : found->second));
+    }
+}
+
+void RandomOperations(uint64_t idLimit, int operationCount, uint32_t seed) {
+    std::mt19937_64 random(seed);
+    TabObjectIndex index;
+    std::unordered_map<uint64_t, TabObjectSlot> reference;
+    for (int op = 0; op < operationCount; ++op) {
+        const uint64_t id = random() % (idLimit + 1); // 0 included: never stored.
+        const int kind = static_cast<int>(random() % 100);
+        if (kind < 55) {
+            const TabObjectStore store = (random() & 1) ? TabObjectStore::Logical : TabObjectStore::Geometry3D;
+            const uint32_t slot = static_cast<uint32_t>(random());
+            index.Insert(id, store, slot);
+            if (id != 0) reference[id] = { store, slot };
+        } else if (kind < 97) {
+            index.Erase(id);
+            reference.erase(id);
+        } else if (kind < 99) {
+            const size_t count = static_cast<size_t>(random() % (2 * idLimit + 1));
+            index.Reserve(count);
+            if ((count + 1) * 4 > index.BucketCount() * 3) CHECK(false); // Reserve must make room.
+        } else if (random() % 50 == 0) {
+            index.Clear();
+            reference.clear();
+        }
+        CHECK(SameSlot(index.Find(id), reference.count(id) ? reference[id] : TabObjectSlot{}));
+        if (op % 997 == 0) CheckAll(index, reference, idLimit);
+    }
+    CheckAll(index, reference, idLimit);
+}
+
+// Insert and erase fresh ids forever: tombstones must be recycled by rehashing, not grow the table.
+void ChurnKeepsTableBounded() {
+    TabObjectIndex index;
+    for (uint64_t id = 1; id <= 100; ++id) index.Insert(id, TabObjectStore::Logical, static_cast<uint32_t>(id));
+    for (uint64_t id = 101; id <= 1000000; ++id) {
+        index.Insert(id, TabObjectStore::Geometry3D, static_cast<uint32_t>(id));
+        index.Erase(id);
+    }
+    CHECK(index.Size() == 100);
+    CHECK(index.BucketCount() <= 512);
+    for (uint64_t id = 1; id <= 100; ++id) CHECK(SameSlot(index.Find(id), { TabObjectStore::Logical, static_cast<uint32_t>(id) }));
+    CHECK(index.Find(500000).store == TabObjectStore::None);
+}
+
+void EdgeCases() {
+    TabObjectIndex index;
+    CHECK(index.Find(1).store == TabObjectStore::None); // Empty table.
+    index.Erase(1);
+    index.Insert(0, TabObjectStore::Logical, 5);        // memoryId 0 is the empty marker.
+    index.Insert(7, TabObjectStore::None, 5);           // None is "not in this tab".
+    CHECK(index.Size() == 0);
+    index.Insert(7, TabObjectStore::Logical, 5);
+    index.Erase(7);
+    index.Erase(7);                                     // Erasing a tombstone is a no-op.
+    CHECK(index.Size() == 0);
+    index.Insert(7, TabObjectStore::Geometry3D, 9);     // Revives its own tombstone.
+    CHECK(index.Size() == 1);
+    CHECK(SameSlot(index.Find(7), { TabObjectStore::Geometry3D, 9 }));
+}
+
+} // namespace
+
+int main() {
+    EdgeCases();
+    RandomOperations(64, 200000, 1);      // Dense: the table is mostly tombstones and live entries.
+    RandomOperations(5000, 400000, 2);    // Grows through several rehashes.
+    RandomOperations(200000, 300000, 3);  // Sparse: mostly misses.
+    ChurnKeepsTableBounded();
+    return ValidationExitCode();
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Ribbon cost per frame, immediate against retained (UIRetainedGeometry.h), for a ribbon of N
+// labelled controls shaped like BuildUIOverlay's: each label measured, then one glyph quad per
+// character looked up in a glyph table, plus a rounded-rectangle background. Three cases:
+//   steady:  nothing changes, every subtree is replayed;
+//   hover:   the hovered control changes every frame, so the controls subtree is rebuilt;
+//   scroll:  the scroll offset changes every frame, so the labels and controls are rebuilt.
+// Retained output must equal immediate output in every frame. Argument: control count (default 200).
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "UIRetainedGeometry.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+constexpr uint32_t kMaxVertices = 65536, kMaxIndices = 65536 * 3; // DX12ResourcesUI defaults.
+
+struct UIVertex {
+    float x, y, u, v;
+    uint32_t color;
+    uint32_t atlasIndex;
+};
+
+struct UIDrawContext {
+    UIVertex* vertexPtr;
+    uint16_t* indexPtr;
+    uint32_t vertexCount, indexCount;
+};
+
+struct Glyph {
+    float uvMinX, uvMinY, uvMaxX, uvMaxY;
+    int width, height, bearingX, bearingY, advanceX;
+};
+
+std::unordered_map<char32_t, Glyph> glyphs;
+
+void PushQuad(UIDrawContext& ctx, float x, float y, float w, float h, float u0, float v0, float u1, float v1,
+    uint32_t color, uint32_t atlas) {
+    if (ctx.vertexCount + 4 > kMaxVertices || ctx.indexCount + 6 > kMaxIndices) return;
+    const uint16_t base = static_cast<uint16_t>(ctx.vertexCount);
+    ctx.vertexPtr[0] = { x, y, u0, v0, color, atlas };
+    ctx.vertexPtr[1] = { x + w, y, u1, v0, color, atlas };
+    ctx.vertexPtr[2] = { x + w, y + h, u1, v1, color, atlas };
+    ctx.vertexPtr[3] = { x, y + h, u0, v1, color, atlas };
+    const uint16_t quad[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int k = 0; k < 6; ++k) ctx.indexPtr[k] = static_cast<uint16_t>(base + quad[k]);
+    ctx.vertexPtr += 4;
+    ctx.indexPtr += 6;
+    ctx.vertexCount += 4;
+    ctx.indexCount += 6;
+}
+
+float MeasureWidth(const std::u32string& text) {
+    float width = 0.0f;
+    for (char32_t c : text) width += static_cast<float>(glyphs.at(c).advanceX);
+    return width;
+}
+
+void PushText(UIDrawContext& ctx, float x, float y, const std::u32string& text, uint32_t color) {
+    for (char32_t c : text) {
+        const Glyph& g = glyphs.at(c);
+        PushQuad(ctx, x + g.bearingX, y - g.bearingY, static_cast<float>(g.width), static_cast<float>(g.height),
+            g.uvMinX, g.uvMinY, g.uvMaxX, g.uvMaxY, color, 0);
+        x += static_cast<float>(g.advanceX);
+    }
+}
+
+// PushRoundedRectangle's vertex count: a centre quad plus eight-segment corner fans.
+void PushRounded(UIDrawContext& ctx, float x, float y, float w, float h, uint32_t color) {
+    PushQuad(ctx, x + 4, y, w - 8, h, 0, 0, 0, 0, color, 1);
+    for (int corner = 0; corner < 4; ++corner) {
+        for (int s = 0; s < 2; ++s) {
+            const float angle = 0.39f * static_cast<float>(corner * 2 + s);
+            PushQuad(ctx, x + 2 * std::cos(angle), y + 2 * std::sin(angle), 4, 4, 0, 0, 0, 0, color, 1);
+        }
+    }
+}
+
+struct Ribbon {
+    std::vector<std::u32string> labels;
+    std::vector<std::u32string> groupLabels;
+};
+
+void DrawGroupLabels(UIDrawContext& ctx, const Ribbon& ribbon, const UIRetainedKey& key) {
+    for (size_t g = 0; g < ribbon.groupLabels.size(); ++g) {
+        PushText(ctx, 80.0f * g - key.scrollOffsetPx + 0.5f * (80.0f - MeasureWidth(ribbon.groupLabels[g])), 20.0f,
+            ribbon.groupLabels[g], 0xFF202020u);
+    }
+}
+
+void DrawControls(UIDrawContext& ctx, const Ribbon& ribbon, const UIRetainedKey& key) {
+    for (size_t i = 0; i < ribbon.labels.size(); ++i) {
+        const float x = 60.0f * i - key.scrollOffsetPx;
+        if (x + 60.0f < 0.0f || x > key.widthPx) continue;
+        const bool hovered = static_cast<int32_t>(i) == key.hoveredIndex;
+        PushRounded(ctx, x, 40.0f, 56.0f, 40.0f, hovered ? 0xFFFFE0C0u : 0xFFF0F0F0u);
+        PushText(ctx, x + 0.5f * (56.0f - MeasureWidth(ribbon.labels[i])), 70.0f, ribbon.labels[i], 0xFF000000u);
+    }
+}
+
+struct Frame {
+    std::vector<UIVertex> vertices = std::vector<UIVertex>(kMaxVertices);
+    std::vector<uint16_t> indices = std::vector<uint16_t>(kMaxIndices);
+    UIDrawContext Begin() { return { vertices.data(), indices.data(), 0, 0 }; }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t controlCount = ValidationSizeArgument(argc, argv, 200);
+    for (char32_t c = U' '; c <= U'z'; ++c) {
+        glyphs[c] = Glyph{ 0.01f * (c % 16), 0.01f * (c / 16), 0.01f * (c % 16) + 0.01f, 0.01f * (c / 16) + 0.01f,
+            6, 10, 1, 9, 7 };
+    }
+    Ribbon ribbon;
+    for (size_t i = 0; i < controlCount; ++i) ribbon.labels.push_back(U"Control " + std::u32string(1, U'A' + i % 26) + U"x");
+    for (size_t g = 0; g < (controlCount + 9) / 10; ++g) ribbon.groupLabels.push_back(U"Group " + std::u32string(1, U'a' + g % 26));
+
+    constexpr int kFrames = 500;
+    const float width = 60.0f * static_cast<float>(controlCount);
+    std::printf("%zu controls, %zu groups, mean of %d frames\n", controlCount, ribbon.groupLabels.size(), kFrames);
+    for (int mode = 0; mode < 3; ++mode) {
+        auto keyFor = [&](int frameIndex, bool controls) {
+            UIRetainedKey key;
+            key.dpiX = key.dpiY = 96.0f;
+            key.widthPx = width;
+            if (mode == 2) key.scrollOffsetPx = static_cast<float>(frameIndex % 40);
+            if (controls && mode == 1) key.hoveredIndex = frameIndex % static_cast<int32_t>(controlCount);
+            return key;
+        };
+
+        Frame immediate, retained;
+        uint32_t immediateVertices = 0;
+        const double immediateMs = TimeMilliseconds([&] {
+            for (int frameIndex = 0; frameIndex < kFrames; ++frameIndex) {
+                UIDrawContext ctx = immediate.Begin();
+                DrawGroupLabels(ctx, ribbon, keyFor(frameIndex, false));
+                DrawControls(ctx, ribbon, keyFor(frameIndex, true));
+                immediateVertices = ctx.vertexCount;
+            }
+        });
+
+        UIRetainedGeometry<UIVertex> groupCache, controlCache;
+        UIRetainedScratch<UIVertex> scratch;
+        uint32_t retainedVertices = 0;
+        const double retainedMs = TimeMilliseconds([&] {
+            for (int frameIndex = 0; frameIndex < kFrames; ++frameIndex) {
+                UIDrawContext ctx = retained.Begin();
+                const UIRetainedKey groupKey = keyFor(frameIndex, false), controlKey = keyFor(frameIndex, true);
+                EmitRetainedUI(ctx, groupCache, scratch, groupKey, kMaxVertices, kMaxIndices,
+                    [&]() { DrawGroupLabels(ctx, ribbon, groupKey); });
+                EmitRetainedUI(ctx, controlCache, scratch, controlKey, kMaxVertices, kMaxIndices,
+                    [&]() { DrawControls(ctx, ribbon, controlKey); });
+                retainedVertices = ctx.vertexCount;
+            }
+        });
+
+        CHECK(retainedVertices == immediateVertices);
+        CHECK(std::memcmp(immediate.vertices.data(), retained.vertices.data(), immediateVertices * sizeof(UIVertex)) == 0);
+        CHECK(std::memcmp(immediate.indices.data(), retained.indices.data(), immediateVertices / 4 * 6 * sizeof(uint16_t)) == 0);
+        const char* label = mode == 0 ? "steady:" : mode == 1 ? "hover: " : "scroll:";
+        std::printf("  %s %6u vertices  immediate %8.2f us/frame  retained %8.2f us/frame\n", label, immediateVertices,
+            1000.0 * immediateMs / kFrames, 1000.0 * retainedMs / kFrames);
+    }
+    return ValidationExitCode();
+}
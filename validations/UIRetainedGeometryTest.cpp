@@ -0,0 +1,149 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Retained UI subtrees (UIRetainedGeometry.h) against immediate tessellation: over a run of frames
+// whose keys, and the geometry drawn ahead of the subtree, change at random, the frame buffers must
+// come out byte-identical to drawing everything every frame, and the subtree must be tessellated
+// exactly when its key changed, its cached range no longer fits, or its last build was truncated.
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "UIRetainedGeometry.h"
+#include "ValidationCheck.h"
+
+namespace {
+
+struct UIVertex { // As UserInterface.h's.
+    float x, y, u, v;
+    uint32_t color;
+    uint32_t atlasIndex;
+};
+
+struct UIDrawContext {
+    UIVertex* vertexPtr;
+    uint16_t* indexPtr;
+    uint32_t vertexCount, indexCount;
+};
+
+struct Frame {
+    std::vector<UIVertex> vertices;
+    std::vector<uint16_t> indices;
+    UIDrawContext ctx;
+    Frame(uint32_t maxVertices, uint32_t maxIndices)
+        : vertices(maxVertices), indices(maxIndices), ctx{ vertices.data(), indices.data(), 0, 0 } {}
+};
+
+// PushRect's shape: capacity-checked, silently dropped when it does not fit.
+void PushQuad(UIDrawContext& ctx, uint32_t maxVertices, uint32_t maxIndices, float x, float y, uint32_t color) {
+    if (ctx.vertexCount + 4 > maxVertices || ctx.indexCount + 6 > maxIndices) return;
+    const uint16_t base = static_cast<uint16_t>(ctx.vertexCount);
+    ctx.vertexPtr[0] = { x, y, 0.0f, 0.0f, color, 0 };
+    ctx.vertexPtr[1] = { x + 1.0f, y, 1.0f, 0.0f, color, 0 };
+    ctx.vertexPtr[2] = { x + 1.0f, y + 1.0f, 1.0f, 1.0f, color, 1 };
+    ctx.vertexPtr[3] = { x, y + 1.0f, 0.0f, 1.0f, color, 1 };
+    const uint16_t quad[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int k = 0; k < 6; ++k) ctx.indexPtr[k] = static_cast<uint16_t>(base + quad[k]);
+    ctx.vertexPtr += 4;
+    ctx.indexPtr += 6;
+    ctx.vertexCount += 4;
+    ctx.indexCount += 6;
+}
+
+// A subtree whose geometry depends on every key field it is built from.
+void DrawSubtree(UIDrawContext& ctx, uint32_t maxVertices, uint32_t maxIndices, const UIRetainedKey& key, int quads) {
+    for (int q = 0; q < quads; ++q) {
+        const uint32_t color = q == key.hoveredIndex ? (key.pressed ? 0xFF0000FFu : 0xFF00FF00u) : 0xFFFFFFFFu;
+        PushQuad(ctx, maxVertices, maxIndices, q * key.dpiX - key.scrollOffsetPx, key.widthPx, color);
+    }
+}
+
+bool SameFrame(const Frame& a, const Frame& b) {
+    return a.ctx.vertexCount == b.ctx.vertexCount && a.ctx.indexCount == b.ctx.indexCount &&
+        std::memcmp(a.vertices.data(), b.vertices.data(), a.ctx.vertexCount * sizeof(UIVertex)) == 0 &&
+        std::memcmp(a.indices.data(), b.indices.data(), a.ctx.indexCount * sizeof(uint16_t)) == 0;
+}
+
+void RunFrames(uint32_t maxVertices, uint32_t maxIndices, int subtreeQuads, uint64_t seed) {
+    std::mt19937_64 random(seed);
+    UIRetainedGeometry<UIVertex> first, second;
+    UIRetainedScratch<UIVertex> scratch;
+    UIRetainedKey firstKey, secondKey;
+    firstKey.dpiX = secondKey.dpiX = 1.0f;
+    bool firstBuilt = false, secondBuilt = false;
+    bool expectFirstBuild = true, expectSecondBuild = true;
+    for (int frameIndex = 0; frameIndex < 400; ++frameIndex) {
+        // What is drawn ahead of each subtree changes size now and then: the rebase path.
+        const int before = static_cast<int>(random() % 8 == 0 ? random() % 40 : 3);
+        const int between = static_cast<int>(random() % 8 == 0 ? random() % 40 : 5);
+        UIRetainedKey nextFirst = firstKey, nextSecond = secondKey;
+        switch (random() % 6) {
+        case 0: nextFirst.hoveredIndex = static_cast<int32_t>(random() % subtreeQuads) - 1; break;
+        case 1: nextSecond.pressed = !nextSecond.pressed; break;
+        case 2: nextSecond.scrollOffsetPx = static_cast<float>(random() % 50); break;
+        case 3: nextFirst.widthPx = nextSecond.widthPx = static_cast<float>(random() % 3); break;
+        default: break; // Most frames change nothing.
+        }
+
+        Frame immediate(maxVertices, maxIndices), retained(maxVertices, maxIndices);
+        for (Frame* frame : { &immediate, &retained }) {
+            for (int q = 0; q < before; ++q) PushQuad(frame->ctx, maxVertices, maxIndices, -1.0f, static_cast<float>(q), 7);
+        }
+        DrawSubtree(immediate.ctx, maxVertices, maxIndices, nextFirst, subtreeQuads);
+        const bool firstFits = retained.ctx.vertexCount + first.vertices.size() <= maxVertices &&
+            retained.ctx.indexCount + first.indices.size() <= maxIndices;
+        expectFirstBuild = expectFirstBuild || !(nextFirst == firstKey) || !firstFits;
+        firstBuilt = false;
+        EmitRetainedUI(retained.ctx, first, scratch, nextFirst, maxVertices, maxIndices, [&]() {
+            firstBuilt = true;
+            DrawSubtree(retained.ctx, maxVertices, maxIndices, nextFirst, subtreeQuads);
+        });
+        CHECK(firstBuilt == expectFirstBuild);
+        expectFirstBuild = !first.valid;
+
+        for (Frame* frame : { &immediate, &retained }) {
+            for (int q = 0; q < between; ++q) PushQuad(frame->ctx, maxVertices, maxIndices, -2.0f, static_cast<float>(q), 9);
+        }
+        DrawSubtree(immediate.ctx, maxVertices, maxIndices, nextSecond, subtreeQuads / 2);
+        const bool secondFits = retained.ctx.vertexCount + second.vertices.size() <= maxVertices &&
+            retained.ctx.indexCount + second.indices.size() <= maxIndices;
+        expectSecondBuild = expectSecondBuild || !(nextSecond == secondKey) || !secondFits;
+        secondBuilt = false;
+        EmitRetainedUI(retained.ctx, second, scratch, nextSecond, maxVertices, maxIndices, [&]() {
+            secondBuilt = true;
+            DrawSubtree(retained.ctx, maxVertices, maxIndices, nextSecond, subtreeQuads / 2);
+        });
+        CHECK(secondBuilt == expectSecondBuild);
+        expectSecondBuild = !second.valid;
+
+        for (Frame* frame : { &immediate, &retained }) PushQuad(frame->ctx, maxVertices, maxIndices, 99.0f, 99.0f, 3);
+        CHECK(SameFrame(immediate, retained));
+        firstKey = nextFirst;
+        secondKey = nextSecond;
+    }
+}
+
+} // namespace
+
+int main() {
+    RunFrames(65536, 65536 * 3, 200, 47);  // The frame buffers' real capacity: nothing truncates.
+    RunFrames(1200, 1800, 200, 48);        // Tight: builds run into the limit and are not cached.
+    RunFrames(4000, 1500, 200, 49);        // Index-bound rather than vertex-bound.
+
+    // A subtree replayed from the cache costs no tessellation however many frames it is drawn.
+    UIRetainedGeometry<UIVertex> cache;
+    UIRetainedScratch<UIVertex> scratch;
+    UIRetainedKey key;
+    key.dpiX = 1.0f;
+    int builds = 0;
+    for (int frameIndex = 0; frameIndex < 100; ++frameIndex) {
+        Frame frame(65536, 65536 * 3);
+        EmitRetainedUI(frame.ctx, cache, scratch, key, 65536, 65536 * 3, [&]() {
+            ++builds;
+            DrawSubtree(frame.ctx, 65536, 65536 * 3, key, 50);
+        });
+        CHECK(frame.ctx.vertexCount == 200 && frame.ctx.indexCount == 300);
+    }
+    CHECK(builds == 1);
+
+    return ValidationExitCode();
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal checking for the validations/ executables: a failed CHECK prints where and why, the
+// executable keeps going, and ValidationExitCode() makes ctest see the failure.
+inline int& ValidationFailureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            ++ValidationFailureCount(); \
+        } \
+    } while (0)
+
+inline int ValidationExitCode() {
+    if (ValidationFailureCount() == 0) return EXIT_SUCCESS;
+    std::fprintf(stderr, "%d check(s) failed\n", ValidationFailureCount());
+    return EXIT_FAILURE;
+}
+
+// Benchmarks take an optional size as their first argument.
+inline size_t ValidationSizeArgument(int argc, char** argv, size_t defaultSize) {
+    return argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : defaultSize;
+}
+
+// Milliseconds spent in work().
+template <typename Work>
+double TimeMilliseconds(Work&& work) {
+    const auto start = std::chrono::steady_clock::now();
+    work();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
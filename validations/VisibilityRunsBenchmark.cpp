@@ -0,0 +1,156 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Hide Unselected with one object selected, the worst case for the per-object encoding, end to end
+// on the CPU: the engineering thread queues the action under the queue mutex, the copy thread
+// drains the batch by value (as ProcessScene3DCopyBatch does), finds each object's instance index
+// and stages its new mask word.
+//   per object: one SET_VISIBILITY each, in a stand-in shaped like CommandToCopyThread (empty
+//               optional GeometryData and all), one 8-byte staging write and copy each;
+//   run list:   one SET_VISIBILITY_RANGES (VisibilityRunsFromIds), staged span by span
+//               (ForEachVisibilityMaskSpan), as the copy thread does now.
+// Both must leave the same mask words. Argument: object count (default 1M; 10M needs about 4 GB
+// for the per-object queue).
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <vector>
+
+#include "ValidationCheck.h"
+#include "VisibilityRuns.h"
+
+namespace {
+
+constexpr uint64_t kVisibleInAllSubTabs = ~0ull;
+constexpr size_t kMaxWordsPerCopy = 65536;
+
+struct GeometryData { // Layout stand-in for डेटा.h's: two vectors, a color, a world matrix.
+    uint64_t id = 0;
+    std::vector<float> vertices;
+    std::vector<uint16_t> indices;
+    float color[4] = {};
+    float worldMatrix[16] = {};
+};
+
+struct Command { // Layout stand-in for CommandToCopyThread.
+    int type = 0;
+    std::optional<GeometryData> geometry;
+    uint64_t id = 0, tabID = 0, containerMemoryId = 0, visibilityBits = 0;
+    bool visibilityVisible = true, visibilityWholeContainer = false;
+    std::shared_ptr<const std::vector<uint64_t>> visibilityIdRuns;
+};
+
+struct CopyThread {
+    std::vector<uint32_t> indexOfMemoryId; // Dense by memoryID - 1, like the registry's Find.
+    std::vector<uint64_t> masks;
+    std::vector<uint8_t> staging;
+    size_t copies = 0;
+
+    explicit CopyThread(size_t objectCount)
+        : indexOfMemoryId(objectCount), masks(objectCount, kVisibleInAllSubTabs), staging(kMaxWordsPerCopy * 8) {
+        for (size_t i = 0; i < objectCount; ++i) indexOfMemoryId[i] = static_cast<uint32_t>(i);
+    }
+
+    void Stage(uint32_t index, const uint64_t* words, size_t count) {
+        std::memcpy(staging.data(), words, count * sizeof(uint64_t));
+        std::memcpy(&masks[index], staging.data(), count * sizeof(uint64_t));
+        ++copies;
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t objectCount = ValidationSizeArgument(argc, argv, 1000000);
+    const uint64_t selectedId = objectCount / 2 + 1;
+    const uint64_t hideBit = 1;
+    std::printf("%zu objects, Hide Unselected with one selected; sizeof(command) %zu bytes\n",
+        objectCount, sizeof(Command));
+
+    std::mutex queueMutex;
+    std::queue<Command> queue;
+
+    CopyThread perObject(objectCount);
+    const double perObjectQueueMs = TimeMilliseconds([&] {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        for (uint64_t id = 1; id <= objectCount; ++id) {
+            if (id == selectedId) continue;
+            Command command;
+            command.type = 4;
+            command.id = id;
+            command.visibilityBits = hideBit;
+            command.visibilityVisible = false;
+            queue.push(std::move(command));
+        }
+    });
+    const double perObjectApplyMs = TimeMilliseconds([&] {
+        std::vector<Command> batch;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            while (!queue.empty()) {
+                batch.push_back(queue.front());
+                queue.pop();
+            }
+        }
+        for (const Command& command : batch) {
+            const uint32_t index = perObject.indexOfMemoryId[command.id - 1];
+            const uint64_t current = perObject.masks[index];
+            const uint64_t updated = command.visibilityVisible
+                ? (current | command.visibilityBits) : (current & ~command.visibilityBits);
+            if (updated != current) perObject.Stage(index, &updated, 1);
+        }
+    });
+
+    CopyThread ranged(objectCount);
+    const double runsQueueMs = TimeMilliseconds([&] {
+        std::vector<uint64_t> ids;
+        for (uint64_t id = 1; id <= objectCount; ++id) {
+            if (id != selectedId) ids.push_back(id);
+        }
+        Command command;
+        command.type = 6;
+        command.visibilityBits = hideBit;
+        command.visibilityVisible = false;
+        command.visibilityIdRuns = std::make_shared<const std::vector<uint64_t>>(VisibilityRunsFromIds(ids));
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push(std::move(command));
+    });
+    const double runsApplyMs = TimeMilliseconds([&] {
+        std::vector<Command> batch;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            while (!queue.empty()) {
+                batch.push_back(queue.front());
+                queue.pop();
+            }
+        }
+        for (const Command& command : batch) {
+            std::vector<std::pair<uint32_t, uint64_t>> updates;
+            const std::vector<uint64_t>& runs = *command.visibilityIdRuns;
+            for (size_t r = 0; r + 1 < runs.size(); r += 2) {
+                for (uint64_t id = runs[r]; id <= runs[r + 1]; ++id) {
+                    const uint32_t index = ranged.indexOfMemoryId[id - 1];
+                    const uint64_t current = ranged.masks[index];
+                    const uint64_t updated = current & ~command.visibilityBits;
+                    if (updated != current) updates.emplace_back(index, updated);
+                }
+            }
+            std::vector<uint64_t> words;
+            ForEachVisibilityMaskSpan(updates, kMaxWordsPerCopy, [&](size_t first, size_t last) {
+                words.clear();
+                for (size_t u = first; u < last; ++u) words.push_back(updates[u].second);
+                ranged.Stage(updates[first].first, words.data(), words.size());
+            });
+        }
+    });
+
+    CHECK(ranged.masks == perObject.masks);
+    CHECK(perObject.copies == objectCount - 1);
+    CHECK(ranged.copies <= 2 + objectCount / kMaxWordsPerCopy);
+    std::printf("  per object: queue %8.1f ms  drain+apply %8.1f ms  %zu copies\n",
+        perObjectQueueMs, perObjectApplyMs, perObject.copies);
+    std::printf("  run list:   queue %8.1f ms  drain+apply %8.1f ms  %zu copies\n",
+        runsQueueMs, runsApplyMs, ranged.copies);
+    return ValidationExitCode();
+}
@@ -0,0 +1,152 @@
+// Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+// Bulk hide / show (VisibilityRuns.h) against one SET_VISIBILITY per object: run lists name
+// exactly the ids they were built from, in maximal ascending runs, and a run list applied through
+// mask spans leaves every visibility word as the per-object writes do - ids missing from the GPU,
+// unchanged bits and scattered instance indices included.
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "ValidationCheck.h"
+#include "VisibilityRuns.h"
+
+namespace {
+
+constexpr uint64_t kVisibleInAllSubTabs = ~0ull;
+constexpr size_t kMaxWordsPerCopy = 64; // Small, so spans split on length as well as on gaps.
+
+std::vector<uint64_t> Expand(const std::vector<uint64_t>& runs) {
+    std::vector<uint64_t> ids;
+    for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+        for (uint64_t id = runs[i]; id <= runs[i + 1]; ++id) ids.push_back(id);
+    }
+    return ids;
+}
+
+void CheckRuns(std::vector<uint64_t> ids) {
+    std::vector<uint64_t> unique = ids;
+    std::sort(unique.begin(), unique.end());
+    unique.erase(std::unique(unique.begin(), unique.end()), unique.end());
+
+    const std::vector<uint64_t> runs = VisibilityRunsFromIds(ids);
+    CHECK(runs.size() % 2 == 0);
+    CHECK(Expand(runs) == unique);
+    CHECK(VisibilityRunIdCount(runs) == unique.size());
+    for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+        CHECK(runs[i] <= runs[i + 1]);
+        if (i >= 2) CHECK(runs[i] > runs[i - 1] + 1); // Maximal: adjacent runs would have merged.
+    }
+}
+
+// The copy thread's view of one tab: memoryID -> gpuInstanceIndex and the mask words, with the
+// hidden-object shadow implied by words that are not all-visible.
+struct Tab {
+    std::unordered_map<uint64_t, uint32_t> indexOfMemoryId;
+    std::vector<uint64_t> masks;
+};
+
+// SET_VISIBILITY, once per id.
+void ApplyPerObject(Tab& tab, const std::vector<uint64_t>& ids, uint64_t bits, bool visible) {
+    for (uint64_t id : ids) {
+        auto it = tab.indexOfMemoryId.find(id);
+        if (it == tab.indexOfMemoryId.end()) continue;
+        uint64_t& mask = tab.masks[it->second];
+        mask = visible ? (mask | bits) : (mask & ~bits);
+    }
+}
+
+// SET_VISIBILITY_RANGES over a run list, written span by span. Returns the span count.
+size_t ApplyRuns(Tab& tab, const std::vector<uint64_t>& runs, uint64_t bits, bool visible) {
+    std::vector<std::pair<uint32_t, uint64_t>> updates;
+    for (size_t r = 0; r + 1 < runs.size(); r += 2) {
+        for (uint64_t id = runs[r]; id <= runs[r + 1]; ++id) {
+            auto it = tab.indexOfMemoryId.find(id);
+            if (it == tab.indexOfMemoryId.end()) continue;
+            const uint64_t current = tab.masks[it->second];
+            const uint64_t updated = visible ? (current | bits) : (current & ~bits);
+            if (updated != current) updates.emplace_back(it->second, updated);
+        }
+    }
+    const std::vector<std::pair<uint32_t, uint64_t>> unsorted = updates;
+    size_t spans = 0, written = 0;
+    ForEachVisibilityMaskSpan(updates, kMaxWordsPerCopy, [&](size_t first, size_t last) {
+        CHECK(first == written && last > first && last - first <= kMaxWordsPerCopy);
+        // A span ends at a gap in the indices or at the length cap, never earlier.
+        CHECK(last == updates.size() || last - first == kMaxWordsPerCopy ||
+            updates[last].first != updates[last - 1].first + 1);
+        for (size_t u = first; u < last; ++u) {
+            CHECK(updates[u].first == updates[first].first + (u - first));
+            tab.masks[updates[u].first] = updates[u].second;
+        }
+        written = last;
+        ++spans;
+    });
+    CHECK(written == updates.size());
+    CHECK(std::is_permutation(unsorted.begin(), unsorted.end(), updates.begin()));
+    return spans;
+}
+
+} // namespace
+
+int main() {
+    CheckRuns({});
+    CheckRuns({ 7 });
+    std::vector<uint64_t> unsortedIds{ 5, 3, 4, 4, 9, 10, 12 };
+    CHECK(VisibilityRunsFromIds(unsortedIds) == (std::vector<uint64_t>{ 3, 5, 9, 10, 12, 12 }));
+    CheckRuns({ 2, 0, 1, 3, 1 });
+
+    std::mt19937_64 random(46);
+    for (int round = 0; round < 200; ++round) {
+        const uint64_t base = random() % 1000000;
+        const size_t count = random() % 3000;
+        std::vector<uint64_t> ids(count);
+        for (uint64_t& id : ids) id = base + random() % (1 + count * (1 + round % 4));
+        CheckRuns(ids);
+    }
+
+    // Objects 1000..1000+n on the GPU in an order that is contiguous in places and scattered in
+    // others; some ids never reached it.
+    for (int round = 0; round < 40; ++round) {
+        const size_t objectCount = 1 + random() % 5000;
+        std::vector<uint32_t> indices(objectCount);
+        std::iota(indices.begin(), indices.end(), 0u);
+        for (size_t i = 0; i < objectCount; i += 1 + random() % 200) {
+            const size_t end = (std::min)(objectCount, i + 1 + random() % 50);
+            std::shuffle(indices.begin() + i, indices.begin() + end, random);
+        }
+        Tab perObject;
+        perObject.masks.assign(objectCount, kVisibleInAllSubTabs);
+        for (size_t i = 0; i < objectCount; ++i) {
+            if (random() % 20 != 0) perObject.indexOfMemoryId.emplace(1000 + i, indices[i]);
+        }
+        Tab ranged = perObject;
+
+        for (int action = 0; action < 6; ++action) {
+            const uint64_t bits = 1ull << (random() % 4);
+            const bool visible = random() % 3 == 0;
+            std::vector<uint64_t> ids;
+            const size_t stride = 1 + random() % 4;
+            for (size_t i = random() % stride; i < objectCount + 20; i += stride) ids.push_back(1000 + i);
+            if (random() % 2) std::shuffle(ids.begin(), ids.end(), random);
+            ApplyPerObject(perObject, ids, bits, visible);
+            ApplyRuns(ranged, VisibilityRunsFromIds(ids), bits, visible);
+            CHECK(ranged.masks == perObject.masks);
+        }
+    }
+
+    // A whole container added in one go: hiding it is one span per kMaxWordsPerCopy words.
+    Tab contiguous;
+    contiguous.masks.assign(1000, kVisibleInAllSubTabs);
+    for (uint32_t i = 0; i < 1000; ++i) contiguous.indexOfMemoryId.emplace(1 + i, i);
+    std::vector<uint64_t> all(1000);
+    std::iota(all.begin(), all.end(), 1ull);
+    const std::vector<uint64_t> runs = VisibilityRunsFromIds(all);
+    CHECK(runs.size() == 2);
+    CHECK(ApplyRuns(contiguous, runs, 1, false) == (1000 + kMaxWordsPerCopy - 1) / kMaxWordsPerCopy);
+    CHECK(ApplyRuns(contiguous, runs, 1, false) == 0); // Already hidden: nothing to write.
+
+    return ValidationExitCode();
+}
@@ -0,0 +1,57 @@
+# Copyright (c) 2026-Present : Ram Shanker: All rights reserved.
+# A synthetic MSDF font header for MSDFGlyphTableTest / MSDFGlyphTableBenchmark: an msdf-atlas-gen
+# style JSON (glyphs out of order, one without a Unicode mapping, whitespace without bounds) and
+# RGBA pixels, written by code-miscellaneous/msdf_atlas_json_parser.py exactly as the pre-build
+# step writes NotoSansMSDF_Compiled.h. The real atlas needs msdf-atlas-gen and the font, which only
+# the Windows build has. Glyph values are exact binary fractions of the codepoint, so the tests
+# recompute them (MSDFFixtureGlyph in the test).
+# Usage: msdf_atlas_fixture.py <out_header> [glyphs] [atlas_size]
+
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'code-miscellaneous'))
+from msdf_atlas_json_parser import write_header
+
+
+def fixture_codepoints(count):
+    """Printable ASCII, then Devanagari, then Latin Extended and onwards until `count`."""
+    codepoints = list(range(0x20, 0x7F)) + list(range(0x900, 0x980))
+    codepoint = 0x100
+    while len(codepoints) < count:
+        if codepoint < 0x900 or codepoint >= 0x980:
+            codepoints.append(codepoint)
+        codepoint += 1
+    return codepoints[:count]
+
+
+def fixture_glyph(codepoint):
+    glyph = {'unicode': codepoint, 'advance': 0.25 + (codepoint % 7) * 0.0625}
+    if codepoint != 0x20:
+        k = codepoint % 64
+        glyph['planeBounds'] = {'left': -0.125, 'bottom': -0.25, 'right': 0.5 + k / 128, 'top': 0.75}
+        glyph['atlasBounds'] = {'left': k * 8 + 0.5, 'bottom': codepoint % 61 + 0.5,
+                                'right': k * 8 + 6.5, 'top': codepoint % 61 + 10.5}
+    return glyph
+
+
+def main():
+    out_path = sys.argv[1]
+    count = int(sys.argv[2]) if len(sys.argv) > 2 else 1000
+    size = int(sys.argv[3]) if len(sys.argv) > 3 else 256
+
+    glyphs = [fixture_glyph(codepoint) for codepoint in fixture_codepoints(count)]
+    glyphs.append({'index': 3, 'advance': 0.5})  # Glyph-index-only: must be skipped.
+    random.Random(49).shuffle(glyphs)
+    data = {
+        'atlas': {'type': 'msdf', 'distanceRange': 6, 'size': 48, 'width': size, 'height': size},
+        'metrics': {'emSize': 1, 'lineHeight': 1.362, 'ascender': 1.069, 'descender': -0.293},
+        'glyphs': glyphs,
+    }
+    pixels = [(x % 256, y % 256, (x ^ y) % 256, 255) for y in range(size) for x in range(size)]
+    write_header(out_path, size, size, pixels, data)
+
+
+if __name__ == '__main__':
+    main()